@@ -420,4 +420,11 @@ if(ENABLE_AIO)
         DESTINATION ${INSTALL_LIB_DIR}
         COMPONENT mindspore
     )
+    if(TARGET io_uring_plugin)
+        install(
+            TARGETS io_uring_plugin
+            DESTINATION ${INSTALL_LIB_DIR}
+            COMPONENT mindspore
+        )
+    endif()
 endif()
@@ -37,6 +37,14 @@ const size_t kMinimumAllocMem = 10 << 20;
 
 thread_local AllocatorDebugInfo DynamicMemAllocatorDebugInfo::debug_info_;
 
+namespace {
+// The current thread always uses the same cache slot.
+size_t CurrentMemCacheSlotIndex() {
+  static thread_local size_t slot_index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % kMemCacheSlotNum;
+  return slot_index;
+}
+}  // namespace
+
 static const std::map<DynamicMemBufStatus, std::string> kBufStatusString = {
   {DynamicMemBufStatus::kMemBufIdle, "idle"},
   {DynamicMemBufStatus::kMemBufUsed, "used"},
@@ -85,6 +93,27 @@ DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persis
     stream_id = kDefaultStreamIndex;
   }
   size_t align_size = AlignMemorySize(size);
+  bool use_mem_cache = IsMemCacheEligible(align_size, from_persistent_mem, need_recycle);
+  if (use_mem_cache) {
+    auto device_addr = AllocFromMemCache(align_size, stream_id);
+    if (device_addr != nullptr) {
+      device::tracker::CALL_MEMORY_TRACKER(AllocMemBlock, device_addr, size, GetMemoryPoolType(),
+                                           ActualPeakStatistics(), stream_id);
+      return device_addr;
+    }
+  }
+  auto device_addr = AllocTensorMemFromPool(size, align_size, from_persistent_mem, need_recycle, stream_id);
+  if (device_addr == nullptr && TotalMemCacheStatistics() > 0) {
+    MS_LOG(WARNING) << "Alloc tensor mem failed and try to flush the memory cache, cached size: "
+                    << TotalMemCacheStatistics() << ".";
+    FlushMemCache();
+    device_addr = AllocTensorMemFromPool(size, align_size, from_persistent_mem, need_recycle, stream_id);
+  }
+  return device_addr;
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemFromPool(size_t size, size_t align_size, bool from_persistent_mem,
+                                                           bool need_recycle, uint32_t stream_id) {
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -146,6 +175,8 @@ std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const
   if (!device_addr) {
     return device_addr_list;
   }
+  // The pre-alloc memory is split below, so it must not go back to the memory cache.
+  DetachFromMemCache(device_addr);
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -203,7 +234,9 @@ DeviceMemPtr DynamicMemPoolBestFit::FindAvailableMemBuf(size_t size, bool from_p
     // Eager free mem may occupy some memory, so total_mem_size need multiply by a factor.
     float threshold_factor = 0.8f;
     size_t threshold = static_cast<size_t>(total_mem_size() * threshold_factor);
-    if (TotalUsedMemStatistics() + TotalUsedByEventMemStatistics() + TotalIdleMemStatistics() + size <= threshold) {
+    size_t occupied_size =
+      TotalUsedMemStatistics() + TotalMemCacheStatistics() + TotalUsedByEventMemStatistics() + TotalIdleMemStatistics();
+    if (occupied_size + size <= threshold) {
       addr = FindMemBufByStatus(size, from_persistent_mem, DynamicMemBufStatus::kMemBufEagerFree, stream_id);
     }
   }
@@ -354,9 +387,11 @@ DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_
 
 DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBufByEagerFree(size_t size, bool from_persistent_mem,
                                                                     uint32_t stream_id) {
-  // Check used max memory limits.
-  if (TotalUsedMemStatistics() + TotalUsedByEventMemStatistics() + size > total_mem_size()) {
+  // Check used max memory limits, the memory cache occupies the memory as well.
+  if (TotalUsedMemStatistics() + TotalMemCacheStatistics() + TotalUsedByEventMemStatistics() + size >
+      total_mem_size()) {
     MS_LOG(ERROR) << "TotalUsedMemStatistics : " << TotalUsedMemStatistics()
+                  << " plus TotalMemCacheStatistics : " << TotalMemCacheStatistics()
                   << " plus TotalUsedByEventMemStatistics : " << TotalUsedByEventMemStatistics()
                   << " and plus alloc size : " << size << " is more than total mem size : " << total_mem_size() << ".";
     return nullptr;
@@ -526,6 +561,9 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 }
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
+  if (FreeToMemCache(device_addr)) {
+    return;
+  }
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -534,7 +572,7 @@ void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
   FreeTensorMemInner(device_addr);
 }
 
-void DynamicMemPoolBestFit::FreeTensorMemInner(const DeviceMemPtr &device_addr) {
+void DynamicMemPoolBestFit::FreeTensorMemInner(const DeviceMemPtr &device_addr, bool track_free) {
   auto [mem_block, iter, mem_mng] = FindByStrictAddr(device_addr);
   if (mem_block == nullptr) {
     // Maybe destroy the memory pool first, then destroy the address, so this is normal case.
@@ -544,7 +582,7 @@ void DynamicMemPoolBestFit::FreeTensorMemInner(const DeviceMemPtr &device_addr)
   auto mem_buf = iter->second;
   MS_EXCEPTION_IF_NULL(mem_buf);
   if (PreCombineMemBuf(mem_buf, mem_mng)) {
-    CombineMemBuf(mem_block, iter, mem_mng, mem_buf->status_, DynamicMemBufStatus::kMemBufIdle);
+    CombineMemBuf(mem_block, iter, mem_mng, mem_buf->status_, DynamicMemBufStatus::kMemBufIdle, track_free);
   }
 
   if (IsMemoryPoolRecycle()) {
@@ -580,7 +618,8 @@ bool DynamicMemPoolBestFit::PreCombineMemBuf(const DynamicMemBufPtr &mem_buf, co
 
 void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block,
                                           const DeviceAddrMapMemBuf::iterator &iter, const MemStatusManagerPtr &mem_mng,
-                                          DynamicMemBufStatus origin_status, DynamicMemBufStatus target_status) {
+                                          DynamicMemBufStatus origin_status, DynamicMemBufStatus target_status,
+                                          bool track_free) {
   const auto &mem_buf = iter->second;
   MS_LOG(DEBUG) << "Combine mem buf release mem buf, device_addr : " << mem_buf->device_addr_ << ".";
   if (common::IsNeedProfileMemory()) {
@@ -589,7 +628,9 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block,
                     << ", used by event mem: " << TotalUsedByEventMemStatistics()
                     << ", device address addr: " << mem_buf->device_addr_ << ", size: " << mem_buf->size_;
   }
-  device::tracker::CALL_MEMORY_TRACKER(FreeMemBlock, mem_buf->device_addr_);
+  if (track_free) {
+    device::tracker::CALL_MEMORY_TRACKER(FreeMemBlock, mem_buf->device_addr_);
+  }
 
   if (mem_buf->status_ != origin_status) {
     DumpDynamicMemPoolDebugInfo();
@@ -695,6 +736,12 @@ DynamicMemPoolBestFit::FindByStrictAddr(const DeviceMemPtr &device_addr) const {
 void DynamicMemPoolBestFit::FreePartTensorMems(const std::vector<DeviceMemPtr> &free_addrs,
                                                const std::vector<DeviceMemPtr> &keep_addrs,
                                                const std::vector<size_t> &keep_addr_sizes) {
+  for (auto &free_addr : free_addrs) {
+    DetachFromMemCache(free_addr);
+  }
+  for (auto &keep_addr : keep_addrs) {
+    DetachFromMemCache(keep_addr);
+  }
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -810,6 +857,7 @@ std::tuple<DynamicMemBlockPtr, DynamicMemBufPtr, MemStatusManagerPtr> DynamicMem
 }
 
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
+  FlushMemCache();
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -879,6 +927,7 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                << "M, peak used mem:" << UsedMemPeakStatistics() / kMBToByte
                << "M, actual peak used mem:" << ActualPeakStatistics() / kMBToByte
                << "M, in used mem:" << TotalUsedMemStatistics() / kMBToByte
+               << "M, total cached mem:" << TotalMemCacheStatistics() / kMBToByte
                << "M, total used by event mem:" << TotalUsedByEventMemStatistics() / kMBToByte
                << "M, total idle mem:" << TotalIdleMemStatistics() / kMBToByte
                << "M, total eager free mem:" << TotalEagerFreeMemStatistics() / kMBToByte
@@ -889,6 +938,7 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                << total_used_size_list[static_cast<int>(AllocatorType::kKernelOutput)] / kMBToByte
                << "M, other used size:" << total_used_size_list[static_cast<int>(AllocatorType::kOther)] / kMBToByte
                << "M.";
+  DumpMemCacheStateInfo();
 }
 
 void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
@@ -980,6 +1030,8 @@ bool DynamicMemPoolBestFit::RecordEvent(int64_t task_id_on_stream, uint32_t user
 #endif
   for (auto &[memory_stream_id, address] : memory_stream_addresses) {
     MS_LOG(DEBUG) << "Record event for address : " << address << ".";
+    // The memory bound with event is freed by the best-fit pool, which waits for the event.
+    DetachFromMemCache(address);
     auto &&mem_buf_tuple = FindByStrictAddr(address);
     auto mem_block = std::get<0>(mem_buf_tuple);
     MS_EXCEPTION_IF_NULL(mem_block);
@@ -1080,11 +1132,211 @@ bool DynamicMemPoolBestFit::SyncAllEventsInner() {
 }
 
 // The statistics information.
+const bool DynamicMemPoolBestFit::IsEnableMemCache() const {
+#ifdef __APPLE__
+  return false;
+#else
+  static const bool enable_mem_cache = common::GetEnv("MS_DEV_ENABLE_MEM_CACHE") == "1" &&
+                                       !common::IsNeedProfileMemory() &&
+                                       common::GetEnv("MS_MEMORY_STATISTIC") != "2";
+  return enable_mem_cache;
+#endif
+}
+
+bool DynamicMemPoolBestFit::IsMemCacheEligible(size_t align_size, bool from_persistent_mem, bool need_recycle) const {
+  if (from_persistent_mem || need_recycle || align_size > kMemCacheMaxSize) {
+    return false;
+  }
+  return IsEnableMemCache() && !IsMemoryPoolRecycle();
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocFromMemCache(size_t align_size, uint32_t stream_id) {
+  const auto &slot = mem_cache_slots_[CurrentMemCacheSlotIndex()];
+  MS_EXCEPTION_IF_NULL(slot);
+  std::lock_guard<std::mutex> slot_locker(slot->mutex_);
+  auto &free_list = slot->free_lists_[std::make_pair(stream_id, align_size)];
+  if (!free_list.empty()) {
+    auto device_addr = free_list.back();
+    free_list.pop_back();
+    slot->cache_size_ -= align_size;
+    ++slot->hit_count_;
+    return device_addr;
+  }
+
+  // Refill the size class in batch with one lock of the pool, only the first memory buf may add a new memory block.
+  ++slot->miss_count_;
+  std::vector<DeviceMemPtr> refill_addrs;
+  {
+#ifdef __APPLE__
+    std::lock_guard<SpinLock> spin_lock(spin_lock_);
+#else
+    std::lock_guard<std::mutex> locker(mutex_);
+#endif
+    for (size_t i = 0; i < kMemCacheBatchCount; ++i) {
+      auto device_addr = FindAvailableMemBuf(align_size, false, stream_id);
+      if (device_addr == nullptr && i == 0) {
+        device_addr = AddMemBlockAndMemBuf(align_size, false, false, stream_id);
+      }
+      if (device_addr == nullptr) {
+        break;
+      }
+      (void)refill_addrs.emplace_back(device_addr);
+    }
+  }
+  if (refill_addrs.empty()) {
+    return nullptr;
+  }
+  for (const auto &device_addr : refill_addrs) {
+    const auto &shard = GetMemCacheAddrShard(device_addr);
+    std::lock_guard<std::mutex> shard_locker(shard->mutex_);
+    shard->addrs_[device_addr] = std::make_pair(stream_id, align_size);
+  }
+  auto device_addr = refill_addrs.front();
+  (void)free_list.insert(free_list.end(), refill_addrs.rbegin(), refill_addrs.rend() - 1);
+  slot->cache_size_ += align_size * (refill_addrs.size() - 1);
+  MS_LOG(DEBUG) << "Refill memory cache, stream id: " << stream_id << ", size: " << align_size
+                << ", count: " << refill_addrs.size() << ", address: " << device_addr << ".";
+  return device_addr;
+}
+
+bool DynamicMemPoolBestFit::FreeToMemCache(const DeviceMemPtr &device_addr) {
+  if (!IsEnableMemCache()) {
+    return false;
+  }
+  std::pair<uint32_t, size_t> size_class;
+  {
+    const auto &shard = GetMemCacheAddrShard(device_addr);
+    std::lock_guard<std::mutex> shard_locker(shard->mutex_);
+    auto iter = shard->addrs_.find(device_addr);
+    if (iter == shard->addrs_.end()) {
+      return false;
+    }
+    size_class = iter->second;
+  }
+  device::tracker::CALL_MEMORY_TRACKER(FreeMemBlock, device_addr);
+
+  // Keep the memory buf in the slot of the freeing thread, flush a batch back to the pool when the list is full.
+  const auto &slot = mem_cache_slots_[CurrentMemCacheSlotIndex()];
+  MS_EXCEPTION_IF_NULL(slot);
+  std::vector<DeviceMemPtr> flush_addrs;
+  {
+    std::lock_guard<std::mutex> slot_locker(slot->mutex_);
+    auto &free_list = slot->free_lists_[size_class];
+    free_list.emplace_back(device_addr);
+    slot->cache_size_ += size_class.second;
+    if (free_list.size() > kMemCacheMaxCount) {
+      auto flush_begin = free_list.begin() + SizeToLong(free_list.size() - kMemCacheBatchCount);
+      (void)flush_addrs.insert(flush_addrs.end(), flush_begin, free_list.end());
+      (void)free_list.erase(flush_begin, free_list.end());
+      slot->cache_size_ -= size_class.second * flush_addrs.size();
+      ++slot->flush_count_;
+    }
+  }
+  if (flush_addrs.empty()) {
+    return true;
+  }
+  for (const auto &flush_addr : flush_addrs) {
+    DetachFromMemCache(flush_addr);
+  }
+#ifdef __APPLE__
+  std::lock_guard<SpinLock> spin_lock(spin_lock_);
+#else
+  std::lock_guard<std::mutex> locker(mutex_);
+#endif
+  for (const auto &flush_addr : flush_addrs) {
+    FreeTensorMemInner(flush_addr, false);
+  }
+  return true;
+}
+
+void DynamicMemPoolBestFit::DetachFromMemCache(const DeviceMemPtr &device_addr) {
+  if (!IsEnableMemCache()) {
+    return;
+  }
+  const auto &shard = GetMemCacheAddrShard(device_addr);
+  std::lock_guard<std::mutex> shard_locker(shard->mutex_);
+  (void)shard->addrs_.erase(device_addr);
+}
+
+const MemCacheAddrShardPtr &DynamicMemPoolBestFit::GetMemCacheAddrShard(const DeviceMemPtr &device_addr) const {
+  // The addresses are aligned by kDynamicMemAlignSize, whose low bits are all the same.
+  auto index = reinterpret_cast<uintptr_t>(device_addr) / kDynamicMemAlignSize % kMemCacheAddrShardNum;
+  return mem_cache_addr_shards_[index];
+}
+
+void DynamicMemPoolBestFit::FlushMemCache() {
+  if (!IsEnableMemCache()) {
+    return;
+  }
+  std::vector<DeviceMemPtr> flush_addrs;
+  for (const auto &slot : mem_cache_slots_) {
+    MS_EXCEPTION_IF_NULL(slot);
+    std::lock_guard<std::mutex> slot_locker(slot->mutex_);
+    for (auto &[size_class, free_list] : slot->free_lists_) {
+      slot->cache_size_ -= size_class.second * free_list.size();
+      (void)flush_addrs.insert(flush_addrs.end(), free_list.begin(), free_list.end());
+      free_list.clear();
+    }
+    ++slot->flush_count_;
+  }
+  // The addresses in use are freed by the best-fit pool from now on.
+  for (const auto &shard : mem_cache_addr_shards_) {
+    std::lock_guard<std::mutex> shard_locker(shard->mutex_);
+    shard->addrs_.clear();
+  }
+  MS_LOG(INFO) << "Flush memory cache, count: " << flush_addrs.size() << ".";
+#ifdef __APPLE__
+  std::lock_guard<SpinLock> spin_lock(spin_lock_);
+#else
+  std::lock_guard<std::mutex> locker(mutex_);
+#endif
+  for (const auto &flush_addr : flush_addrs) {
+    FreeTensorMemInner(flush_addr, false);
+  }
+}
+
+void DynamicMemPoolBestFit::DumpMemCacheStateInfo() const {
+  if (!IsEnableMemCache()) {
+    return;
+  }
+  std::ostringstream buf;
+  size_t total_hit_count = 0;
+  size_t total_miss_count = 0;
+  for (size_t i = 0; i < mem_cache_slots_.size(); ++i) {
+    const auto &slot = mem_cache_slots_[i];
+    MS_EXCEPTION_IF_NULL(slot);
+    size_t hit_count = slot->hit_count_;
+    size_t miss_count = slot->miss_count_;
+    if (hit_count + miss_count == 0) {
+      continue;
+    }
+    total_hit_count += hit_count;
+    total_miss_count += miss_count;
+    buf << ", cache[" << i << "] hit count:" << hit_count << " miss count:" << miss_count
+        << " hit rate:" << static_cast<float>(hit_count) / (hit_count + miss_count)
+        << " flush count:" << slot->flush_count_;
+  }
+  float total_hit_rate = total_hit_count + total_miss_count == 0
+                           ? 0.0f
+                           : static_cast<float>(total_hit_count) / (total_hit_count + total_miss_count);
+  MS_LOG(INFO) << "The memory cache total cached mem:" << TotalMemCacheStatistics() / kMBToByte
+               << "M, hit rate:" << total_hit_rate << buf.str();
+}
+
 size_t DynamicMemPoolBestFit::TotalMemStatistics() const {
   return common_mem_->mps_.total_mem_size_ + persistent_mem_->mps_.total_mem_size_;
 }
 size_t DynamicMemPoolBestFit::TotalUsedMemStatistics() const {
-  return common_mem_->mps_.total_used_mem_size_ + persistent_mem_->mps_.total_used_mem_size_;
+  size_t used_size = common_mem_->mps_.total_used_mem_size_ + persistent_mem_->mps_.total_used_mem_size_;
+  size_t cache_size = TotalMemCacheStatistics();
+  return used_size > cache_size ? used_size - cache_size : 0;
+}
+size_t DynamicMemPoolBestFit::TotalMemCacheStatistics() const {
+  size_t cache_size = 0;
+  for (const auto &slot : mem_cache_slots_) {
+    cache_size += slot->cache_size_;
+  }
+  return cache_size;
 }
 size_t DynamicMemPoolBestFit::TotalUsedByEventMemStatistics() const {
   return common_mem_->mps_.total_used_by_event_mem_size_ + persistent_mem_->mps_.total_used_by_event_mem_size_;
@@ -217,7 +217,8 @@ size_t Somas::GetCommunicationReservedSize() const { return 0; }
 void Somas::CommunicationTensorProcess(const std::vector<SomasTensorPtr> &tensors) const {}
 
 bool Somas::GetEnableCacheFlag(const session::KernelGraph &graph) const {
-  return graph.execution_order().size() >= kCachedResultThreshold;
+  // the branch and bound search is much slower than the heuristics, always cache its result
+  return graph.execution_order().size() >= kCachedResultThreshold || GetSomasSearchTimeLimit() > 0;
 }
 
 std::pair<bool, std::string> Somas::GetDebugConfig() const {
@@ -289,6 +290,10 @@ bool Somas::LoadSomasCache(const session::KernelGraph &graph) {
 bool Somas::CalcSomasModelHash(const session::KernelGraph &graph) {
   auto model_str = SomasInfo(true);
   hash_id_ = std::to_string(std::hash<std::string>()(model_str));
+  if (GetSomasSearchTimeLimit() > 0) {
+    // do not reuse a heuristic result once the search is enabled
+    hash_id_ += "_search";
+  }
   MS_LOG(INFO) << "Graph " << graph.graph_id() << "'s SOMAS Model hash id is " << hash_id_;
   std::string filename = Common::GetCompilerCachePath() + "/somas_meta/somas_graph_" +
                          std::to_string(graph.graph_id()) + "_" + hash_id_ + ".info";
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <stack>
 #include <utility>
+#include <vector>
 
 namespace mindspore {
 namespace somas {
@@ -273,5 +274,196 @@ bool FastHeuristic::Eval(vector<BlockTensor> *block_tensors_v, const std::shared
     << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start).count() << " ms";
   return true;
 }
+
+namespace {
+constexpr size_t kTimeCheckMask = 1023;
+// the offsets a block branches over, which bounds the search and makes it a heuristic one
+constexpr size_t kMaxBranchNum = 8;
+constexpr size_t kLowerBoundSeedNum = 16;
+}  // namespace
+
+bool BranchAndBound::TimeOut() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count() >=
+         time_limit_ms_;
+}
+
+bool BranchAndBound::BuildConflicts(const vector<BlockTensor> &block_tensors_v,
+                                    const std::vector<VectorBitSet> &constraints) {
+  // a whole contiguous block is seen as one interval, two blocks conflict when any pair of their tensors does
+  vector<pair<size_t, size_t>> tensor_blocks;
+  for (size_t i = 0; i < block_tensors_v.size(); i++) {
+    for (auto tensor = block_tensors_v[i].m_start_tensor_; tensor != nullptr; tensor = tensor->right_) {
+      tensor_blocks.emplace_back(tensor->index_, i);
+    }
+  }
+  conflicts_.assign(block_tensors_v.size(), {});
+  vector<size_t> marks(block_tensors_v.size(), SIZE_MAX);
+  size_t checks = 0;
+  for (const auto &[index1, block1] : tensor_blocks) {
+    if (sizes_[block1] == 0) {
+      continue;
+    }
+    for (const auto &[index2, block2] : tensor_blocks) {
+      if (block2 <= block1 || marks[block2] == block1 || sizes_[block2] == 0) {
+        continue;
+      }
+      if (!constraints[index1].IsBitTrue(index2) || !constraints[index2].IsBitTrue(index1)) {
+        marks[block2] = block1;
+        conflicts_[block1].push_back(block2);
+        conflicts_[block2].push_back(block1);
+      }
+    }
+    if ((++checks & kTimeCheckMask) == 0 && TimeOut()) {
+      return false;
+    }
+  }
+  for (auto &conflict : conflicts_) {
+    std::sort(conflict.begin(), conflict.end());
+    conflict.erase(std::unique(conflict.begin(), conflict.end()), conflict.end());
+  }
+  return true;
+}
+
+void BranchAndBound::CalcLowerBound() {
+  // blocks conflicting with each other can't share memory, the weight of a greedy clique grown from the largest
+  // blocks is a valid lower bound of the footprint
+  vector<size_t> order(sizes_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [this](size_t a, size_t b) { return sizes_[a] > sizes_[b]; });
+  lower_bound_ = 0;
+  for (size_t seed = 0; seed < std::min(kLowerBoundSeedNum, order.size()); seed++) {
+    auto start = order[seed];
+    vector<size_t> clique = {start};
+    size_t weight = sizes_[start];
+    auto members = conflicts_[start];
+    std::sort(members.begin(), members.end(), [this](size_t a, size_t b) { return sizes_[a] > sizes_[b]; });
+    for (auto member : members) {
+      auto &member_conflicts = conflicts_[member];
+      bool in_clique = std::all_of(clique.begin(), clique.end(), [&member_conflicts](size_t block) {
+        return std::binary_search(member_conflicts.begin(), member_conflicts.end(), block);
+      });
+      if (in_clique) {
+        clique.push_back(member);
+        weight += sizes_[member];
+      }
+    }
+    lower_bound_ = std::max(lower_bound_, weight);
+  }
+}
+
+void BranchAndBound::GetCandidates(size_t block, size_t bound, vector<size_t> *candidates) const {
+  MS_EXCEPTION_IF_NULL(candidates);
+  candidates->clear();
+  // a block either lies at the bottom or right above one of the blocks it conflicts with
+  vector<size_t> positions = {0};
+  for (auto conflict : conflicts_[block]) {
+    if (placed_[conflict]) {
+      positions.push_back(offsets_[conflict] + sizes_[conflict]);
+    }
+  }
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+  auto size = sizes_[block];
+  for (auto position : positions) {
+    if (position + size >= bound || candidates->size() >= kMaxBranchNum) {
+      break;
+    }
+    bool fit = std::none_of(conflicts_[block].begin(), conflicts_[block].end(), [this, position, size](size_t c) {
+      return placed_[c] && position < offsets_[c] + sizes_[c] && offsets_[c] < position + size;
+    });
+    if (fit) {
+      candidates->push_back(position);
+    }
+  }
+}
+
+bool BranchAndBound::Search(size_t *upperbound) {
+  struct Frame {
+    vector<size_t> candidates;
+    size_t next{0};
+    size_t peak{0};
+  };
+  auto block_num = sizes_.size();
+  vector<Frame> frames(block_num + 1);
+  bool found = false;
+  size_t depth = 0;
+  GetCandidates(0, *upperbound, &frames[0].candidates);
+  while (true) {
+    if (depth == block_num) {
+      *upperbound = frames[depth].peak;
+      best_offsets_ = offsets_;
+      found = true;
+      if (*upperbound <= lower_bound_) {
+        exhausted_ = true;
+        break;
+      }
+      depth--;
+      continue;
+    }
+    auto &frame = frames[depth];
+    bool exhausted = frame.next >= frame.candidates.size() ||
+                     frame.candidates[frame.next] + sizes_[depth] >= *upperbound ||
+                     std::max(frame.peak, lower_bound_) >= *upperbound;
+    if (exhausted) {
+      placed_[depth] = false;
+      if (depth == 0) {
+        exhausted_ = true;
+        break;
+      }
+      depth--;
+      continue;
+    }
+    if ((++node_count_ & kTimeCheckMask) == 0 && TimeOut()) {
+      break;
+    }
+    auto offset = frame.candidates[frame.next++];
+    offsets_[depth] = offset;
+    placed_[depth] = true;
+    auto &next_frame = frames[depth + 1];
+    next_frame.next = 0;
+    next_frame.peak = std::max(frame.peak, offset + sizes_[depth]);
+    depth++;
+    if (depth < block_num) {
+      GetCandidates(depth, *upperbound, &next_frame.candidates);
+    }
+  }
+  return found;
+}
+
+bool BranchAndBound::Eval(vector<BlockTensor> *block_tensors_v, const std::vector<VectorBitSet> *pConstraints,
+                          size_t *upperbound) {
+  MS_EXCEPTION_IF_NULL(block_tensors_v);
+  MS_EXCEPTION_IF_NULL(pConstraints);
+  MS_EXCEPTION_IF_NULL(upperbound);
+  start_ = std::chrono::steady_clock::now();
+  auto block_num = block_tensors_v->size();
+  if (block_num == 0) {
+    return false;
+  }
+  sizes_.clear();
+  for (auto &block : *block_tensors_v) {
+    sizes_.push_back(block.m_size_);
+  }
+  if (!BuildConflicts(*block_tensors_v, *pConstraints)) {
+    MS_LOG(INFO) << "Time limit " << time_limit_ms_ << " ms expires while building conflicts of " << block_num
+                 << " blocks.";
+    return false;
+  }
+  CalcLowerBound();
+  offsets_.assign(block_num, 0);
+  placed_.assign(block_num, false);
+  if (!Search(upperbound)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < block_num; i++) {
+    auto offset = best_offsets_[i];
+    for (auto tensor = (*block_tensors_v)[i].m_start_tensor_; tensor != nullptr; tensor = tensor->right_) {
+      tensor->offset_ = offset;
+      offset += tensor->size_;
+    }
+  }
+  return true;
+}
 }  // namespace somas
 }  // namespace mindspore
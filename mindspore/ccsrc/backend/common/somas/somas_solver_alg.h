@@ -194,6 +194,41 @@ class FastHeuristic {
   size_t m_alignment_;
   size_t m_tensors_allocated_;
 };
+
+class BranchAndBound {
+ public:
+  explicit BranchAndBound(int64_t time_limit_ms) : time_limit_ms_(time_limit_ms) {}
+  ~BranchAndBound() = default;
+
+  // search offsets of the blocks with a footprint lower than *upperbound, blocks are placed in the given order at
+  // the lowest offsets left free by their conflicting blocks, branching over a few of them only. So the search is a
+  // heuristic one even if it exhausts its branches, the result is optimal only when it reaches the lower bound. When a
+  // better solution is found before the time limit expires, the tensor offsets and *upperbound are updated and true
+  // is returned.
+  bool Eval(vector<BlockTensor> *block_tensors_v, const std::vector<VectorBitSet> *pConstraints, size_t *upperbound);
+  size_t LowerBound() const { return lower_bound_; }
+  size_t NodeCount() const { return node_count_; }
+  // whether all the branches are searched before the time limit expires, or the lower bound is reached
+  bool Exhausted() const { return exhausted_; }
+
+ private:
+  bool BuildConflicts(const vector<BlockTensor> &block_tensors_v, const std::vector<VectorBitSet> &constraints);
+  void CalcLowerBound();
+  bool Search(size_t *upperbound);
+  void GetCandidates(size_t block, size_t bound, vector<size_t> *candidates) const;
+  bool TimeOut() const;
+
+  int64_t time_limit_ms_;
+  std::chrono::steady_clock::time_point start_;
+  vector<size_t> sizes_;
+  vector<vector<size_t>> conflicts_;
+  vector<size_t> offsets_;
+  vector<bool> placed_;
+  vector<size_t> best_offsets_;
+  size_t lower_bound_{0};
+  size_t node_count_{0};
+  bool exhausted_{false};
+};
 }  // namespace somas
 }  // namespace mindspore
 
@@ -49,6 +49,44 @@ Status SomasSolverCore::MemoryAllocationSolver() {
   return retval;
 }
 
+Status SomasSolverCore::BranchAndBoundSolver(int64_t time_limit_ms) {
+  // seeded with the footprint found by MemoryAllocationSolver, lifelong tensors stay on top of the blocks
+  if (upperbound_ == SIZE_MAX || upperbound_ < lifelong_memory_) {
+    return FAILED;
+  }
+  auto heuristic_upperbound = upperbound_;
+  std::map<size_t, size_t> heuristic_offsets;
+  for (const auto &tensor : tensors_) {
+    (void)heuristic_offsets.emplace(tensor.first, tensor.second->offset_);
+  }
+
+  auto start = std::chrono::system_clock::now();
+  size_t upperbound = upperbound_ - lifelong_memory_;
+  BranchAndBound bnb(time_limit_ms);
+  bool improved = bnb.Eval(&block_tensors_, &constraints_, &upperbound);
+  auto end = std::chrono::system_clock::now();
+  MS_LOG(INFO) << "Branch and bound search for " << block_tensors_.size() << " blocks: "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms, "
+               << bnb.NodeCount() << " nodes, lower bound " << bnb.LowerBound() << " Bytes, heuristic result "
+               << heuristic_upperbound - lifelong_memory_ << " Bytes, search result " << upperbound << " Bytes"
+               << (bnb.LowerBound() >= upperbound ? " (optimal)" : (bnb.Exhausted() ? " (branches exhausted)" : ""));
+  if (!improved) {
+    return SUCCESS;
+  }
+
+  upperbound_ = upperbound;
+  AppendLifelongTensors();
+  if (!Verify(upperbound_)) {
+    MS_LOG(WARNING) << "Branch and bound solution check fails, keep the heuristic solution.";
+    for (const auto &tensor : tensors_) {
+      tensor.second->offset_ = heuristic_offsets[tensor.first];
+    }
+    upperbound_ = heuristic_upperbound;
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
 Status SomasSolverCore::Verify() {
   Status retval = SUCCESS;
   if (verify_) {
@@ -48,6 +48,7 @@ class SomasSolverCore {
   ~SomasSolverCore() = default;
 
   Status MemoryAllocationSolver();
+  Status BranchAndBoundSolver(int64_t time_limit_ms);
   Status Verify();
   bool Verify(const size_t &upperbound);
   void VerifySolution(const bool verify) { verify_ = verify; }
@@ -24,11 +24,31 @@
 #include "backend/common/somas/somas_solver_core.h"
 #include "backend/common/somas/somas_solver_pre.h"
 #include "include/common/debug/common.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace somas {
 constexpr auto kSolBytesThreshold = 100 * 1024 * 1024;
 constexpr auto kSolNumThresholdMultiThread = 8;
+constexpr auto kSomasSearchTimeEnv = "MS_DEV_SOMAS_SEARCH_TIME";
+
+int64_t GetSomasSearchTimeLimit() {
+  static const int64_t time_limit = []() -> int64_t {
+    auto env = common::GetEnv(kSomasSearchTimeEnv);
+    if (env.empty()) {
+      return 0;
+    }
+    try {
+      auto value = std::stoll(env);
+      return value > 0 ? value : 0;
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid value of " << kSomasSearchTimeEnv << ": " << env << ", the search is disabled.";
+      return 0;
+    }
+  }();
+  return time_limit;
+}
+
 Status SomasSolverPre::CheckTensors(const TensorsDescMap *pTensors, uint32_t index1, uint32_t index2) const {
   auto tensors = *pTensors;
   if (tensors[index1] == nullptr) {
@@ -165,13 +185,17 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
     common::ThreadPool::GetInstance().ClearThreadPool();
     BestInfo best_info;
     FindBest(total_sol, solvers, &best_info);
+    auto &best_solver = solvers[best_info.best_sol];
+    MS_EXCEPTION_IF_NULL(best_solver);
+    auto search_time_limit = GetSomasSearchTimeLimit();
+    if (search_time_limit > 0 && best_solver->BranchAndBoundSolver(search_time_limit) == SUCCESS) {
+      best_info.best = best_solver->GetUpperbound();
+    }
     auto end = std::chrono::system_clock::now();
     size_t total_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-    auto &best_solver = solvers[best_info.best_sol];
     for (auto &tensor : tensors) {
       *(tensor.second.get()) = *(vecTensorsMap[best_info.best_sol][tensor.first]);
     }
-    MS_EXCEPTION_IF_NULL(best_solver);
     max_offset_ = best_solver->GetUpperbound();
     constexpr float kFloatPresent = 100.0;
     MS_LOG(INFO) << "SOMAS SOLVER RESUME:";
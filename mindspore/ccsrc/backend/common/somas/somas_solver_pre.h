@@ -249,6 +249,9 @@ class SomasSolverPre {
   void TensorRelationLog(const std::vector<VectorBitSet> *pConstraints, const session::KernelGraph &graph) const;
 };
 using SomasSolverPrePtr = std::shared_ptr<SomasSolverPre>;
+
+// time limit in ms of the branch and bound search run after the heuristics, 0 means the search is disabled
+int64_t GetSomasSearchTimeLimit();
 }  // namespace somas
 }  // namespace mindspore
 
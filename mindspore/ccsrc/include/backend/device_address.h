@@ -76,7 +76,7 @@ struct StorageInfo {
   bool file_name_mutable_{true};
 };
 
-enum class StorageType { kDevice, kHost, kFile };
+enum class StorageType { kDevice, kHost, kFile, kCompressedHost };
 
 enum class DeviceAddressStatus {
   kInDevice,
@@ -85,7 +85,10 @@ enum class DeviceAddressStatus {
   kInDeviceToHost,
   kInHostToDevice,
   kInHostToFile,
-  kInFileToHost
+  kInFileToHost,
+  kInCompressedHost,
+  kInHostToCompressedHost,
+  kInCompressedHostToHost
 };
 
 // The flag of device address.
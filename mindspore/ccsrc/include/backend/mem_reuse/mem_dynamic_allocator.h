@@ -18,6 +18,7 @@
 #define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_DYNAMIC_ALLOCATOR_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
@@ -51,6 +52,16 @@ constexpr int kAllocatorTypeNum = 5;
 constexpr size_t kDynamicMemAlignSize = 512;
 // The minimum unit size (1G) of memory block used for dynamic extend.
 constexpr size_t kDynamicMemAllocUnitSize = 1024 << 20;
+// The memory cache keeps the aligned sizes up to 32K in per thread free lists, one size class per align size.
+constexpr size_t kMemCacheMaxSize = 32 << 10;
+// The number of cache slots, the current thread is mapped to one slot by the hash of thread id.
+constexpr size_t kMemCacheSlotNum = 16;
+// The number of memory bufs fetched from or returned to the best-fit pool by one lock of the pool.
+constexpr size_t kMemCacheBatchCount = 8;
+// The max number of memory bufs kept in one size class of one slot.
+constexpr size_t kMemCacheMaxCount = 32;
+// The number of shards of the addresses handed out by the memory cache, an address is mapped to one shard by itself.
+constexpr size_t kMemCacheAddrShardNum = 64;
 
 // The Comparator of device address from small to large.
 using DeviceMemPtr = void(*);
@@ -85,11 +96,39 @@ struct pair_hash {
   }
 };
 
+// The cache slot of small size classes in front of the best-fit pool.
+struct MemCacheSlot {
+  std::mutex mutex_;
+  // key : <stream_id, align_size>, value : the free list of the size class.
+  std::unordered_map<std::pair<uint32_t, size_t>, std::vector<DeviceMemPtr>, pair_hash> free_lists_;
+  // The statistics information.
+  std::atomic<size_t> hit_count_{0};
+  std::atomic<size_t> miss_count_{0};
+  std::atomic<size_t> flush_count_{0};
+  // The total size of memory bufs kept in the free lists, only changed under the mutex of the slot.
+  std::atomic<size_t> cache_size_{0};
+};
+using MemCacheSlotPtr = std::shared_ptr<MemCacheSlot>;
+
+// The shard of the addresses handed out by the memory cache, key: address, value: <stream_id, align_size>.
+struct MemCacheAddrShard {
+  std::mutex mutex_;
+  std::unordered_map<DeviceMemPtr, std::pair<uint32_t, size_t>> addrs_;
+};
+using MemCacheAddrShardPtr = std::shared_ptr<MemCacheAddrShard>;
+
 // The main class of dynamic memory pool.
 class BACKEND_EXPORT DynamicMemPoolBestFit {
  public:
   DynamicMemPoolBestFit()
-      : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {}
+      : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {
+    for (size_t i = 0; i < kMemCacheSlotNum; ++i) {
+      (void)mem_cache_slots_.emplace_back(std::make_shared<MemCacheSlot>());
+    }
+    for (size_t i = 0; i < kMemCacheAddrShardNum; ++i) {
+      (void)mem_cache_addr_shards_.emplace_back(std::make_shared<MemCacheAddrShard>());
+    }
+  }
   virtual ~DynamicMemPoolBestFit();
 
   // The main program entry of memory alloc.
@@ -114,7 +153,9 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
 
   // The statistics information.
   size_t TotalMemStatistics() const;
+  // The memory bufs kept in the memory cache are not counted in the used memory.
   size_t TotalUsedMemStatistics() const;
+  size_t TotalMemCacheStatistics() const;
   size_t TotalUsedByEventMemStatistics() const;
   size_t TotalIdleMemStatistics() const;
   size_t TotalEagerFreeMemStatistics() const;
@@ -161,6 +202,10 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
   virtual size_t AllocDeviceMemByEagerFree(size_t size, DeviceMemPtr *addr) { return 0; }
   virtual size_t FreeDeviceMemByEagerFree(const DeviceMemPtr addr, const size_t size) { return 0; }
   const size_t FreeIdleMemsByEagerFree();
+  // The related interface of memory cache, which is enabled by the env MS_DEV_ENABLE_MEM_CACHE.
+  virtual const bool IsEnableMemCache() const;
+  // Return all the memory bufs of the memory cache to the best-fit pool.
+  void FlushMemCache();
 
  private:
   // Find available memory buf from total pools by status, which contains idle and eager free.
@@ -191,14 +236,15 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
   // The Comparator of memory block by device address, because memory blocks are arranged in order by device address.
   static bool CmpMemBlock(const DeviceMemPtr &device_addr, const DynamicMemBlockPtr &mem_block);
 
-  // Free memory inner with no lock, the caller need lock.
-  void FreeTensorMemInner(const DeviceMemPtr &device_addr);
+  // Free memory inner with no lock, the caller need lock. The memory cache records the free in the memory tracker
+  // when the address is freed to the cache, so it does not record it again when the address is flushed to the pool.
+  void FreeTensorMemInner(const DeviceMemPtr &device_addr, bool track_free = true);
   // Pre combine mem buf, return false when mem buf can not combine.
   bool PreCombineMemBuf(const DynamicMemBufPtr &mem_buf, const MemStatusManagerPtr &mem_mng);
   // Combine the memory buf when memory free, to avoid the memory fragmentation.
   void CombineMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceAddrMapMemBuf::iterator &iter,
                      const MemStatusManagerPtr &mem_mng, DynamicMemBufStatus origin_status,
-                     DynamicMemBufStatus target_status);
+                     DynamicMemBufStatus target_status, bool track_free = true);
   // Fetch the mem info by the strict addr.
   std::tuple<DynamicMemBlockPtr, DeviceAddrMapMemBuf::iterator, MemStatusManagerPtr> FindByStrictAddr(
     const DeviceMemPtr &device_addr) const;
@@ -211,6 +257,21 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
   // Sync all events inner without lock.
   bool SyncAllEventsInner();
 
+  // Alloc memory from the best-fit pool with lock.
+  DeviceMemPtr AllocTensorMemFromPool(size_t size, size_t align_size, bool from_persistent_mem, bool need_recycle,
+                                      uint32_t stream_id);
+  // Whether the aligned size can be served by the memory cache.
+  bool IsMemCacheEligible(size_t align_size, bool from_persistent_mem, bool need_recycle) const;
+  // Alloc memory from the cache slot of current thread, refill the size class from the pool in batch when it is empty.
+  DeviceMemPtr AllocFromMemCache(size_t align_size, uint32_t stream_id);
+  // Free memory to the cache slot of current thread, return false when the address is not from the memory cache.
+  bool FreeToMemCache(const DeviceMemPtr &device_addr);
+  // The address leaves the memory cache and is freed by the best-fit pool later, the caller need not lock the pool.
+  void DetachFromMemCache(const DeviceMemPtr &device_addr);
+  const MemCacheAddrShardPtr &GetMemCacheAddrShard(const DeviceMemPtr &device_addr) const;
+  // Display the hit rate of every cache slot.
+  void DumpMemCacheStateInfo() const;
+
 #ifdef __APPLE__
   // There are some problems with using mutex on Mac, use spinlocks instead.
   SpinLock spin_lock_;
@@ -228,6 +289,11 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
 
   // key : <user_stream_id, memory_stream_id>
   std::unordered_map<std::pair<uint32_t, uint32_t>, std::set<DynamicMemBufPtr>, pair_hash> stream_pair_addresses_;
+
+  // The memory cache slots, the cached memory bufs are in used status in the best-fit pool.
+  std::vector<MemCacheSlotPtr> mem_cache_slots_;
+  // The addresses handed out by the memory cache, sharded so that the frees of the threads rarely share a lock.
+  std::vector<MemCacheAddrShardPtr> mem_cache_addr_shards_;
 };
 
 // Recording information for debugging the memory allocator.
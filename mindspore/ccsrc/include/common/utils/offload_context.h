@@ -53,6 +53,12 @@ class COMMON_EXPORT OffloadContext {
   void set_aio_queue_depth(size_t aio_queue_depth);
   size_t aio_queue_depth() const { return aio_queue_depth_; }
 
+  void set_aio_backend(const std::string &aio_backend);
+  std::string aio_backend() const { return aio_backend_; }
+
+  void set_enable_host_compression(bool enable_host_compression);
+  bool enable_host_compression() const { return enable_host_compression_; }
+
   void set_enable_pinned_mem(bool enable_pinned_mem);
   bool enable_pinned_mem() const { return enable_pinned_mem_; }
 
@@ -80,6 +86,8 @@ class COMMON_EXPORT OffloadContext {
   bool enable_aio_;
   size_t aio_block_size_;
   size_t aio_queue_depth_;
+  std::string aio_backend_;
+  bool enable_host_compression_;
   bool enable_pinned_mem_;
   bool auto_offload_;
   size_t host_mem_block_size_;
@@ -56,9 +56,28 @@ ConfigManager::ConfigManager()
   num_parallel_workers_ = num_parallel_workers_ < num_cpu_threads_ ? num_parallel_workers_ : num_cpu_threads_;
   std::string env_cache_host = common::GetEnv("MS_CACHE_HOST");
   std::string env_cache_port = common::GetEnv("MS_CACHE_PORT");
+  std::string env_io_prefetch_depth = common::GetEnv("MS_DEV_DATASET_IO_PREFETCH_DEPTH");
+  std::string env_shuffle_spill_memory = common::GetEnv("MS_DEV_DATASET_SHUFFLE_SPILL_MB");
+  shuffle_spill_dir_ = common::GetEnv("MS_DEV_DATASET_SHUFFLE_SPILL_DIR");
   if (!env_cache_host.empty()) {
     cache_host_ = env_cache_host;
   }
+  if (!env_io_prefetch_depth.empty()) {
+    char *end = nullptr;
+    io_prefetch_depth_ = static_cast<int32_t>(strtol(env_io_prefetch_depth.c_str(), &end, kDecimal));
+    if (*end != '\0' || io_prefetch_depth_ < 0) {
+      MS_LOG(WARNING) << "IO prefetch depth from env variable MS_DEV_DATASET_IO_PREFETCH_DEPTH is invalid\n";
+      io_prefetch_depth_ = 0;
+    }
+  }
+  if (!env_shuffle_spill_memory.empty()) {
+    char *end = nullptr;
+    shuffle_spill_memory_ = static_cast<int32_t>(strtol(env_shuffle_spill_memory.c_str(), &end, kDecimal));
+    if (*end != '\0' || shuffle_spill_memory_ < 0) {
+      MS_LOG(WARNING) << "Shuffle spill memory from env variable MS_DEV_DATASET_SHUFFLE_SPILL_MB is invalid\n";
+      shuffle_spill_memory_ = 0;
+    }
+  }
   if (!env_cache_port.empty()) {
     char *end = nullptr;
     cache_port_ = static_cast<int32_t>(strtol(env_cache_port.c_str(), &end, kDecimal));
@@ -92,6 +111,9 @@ Status ConfigManager::FromJson(const nlohmann::json &j) {
   set_cache_port(j.value("cachePort", cache_port_));
   set_num_connections(j.value("numConnections", num_connections_));
   set_cache_prefetch_size(j.value("cachePrefetchSize", cache_prefetch_size_));
+  set_io_prefetch_depth(j.value("ioPrefetchDepth", io_prefetch_depth_));
+  set_shuffle_spill_memory(j.value("shuffleSpillMemory", shuffle_spill_memory_));
+  set_shuffle_spill_dir(j.value("shuffleSpillDir", shuffle_spill_dir_));
   set_debug_mode(j.value("debug_mode_flag", debug_mode_flag_));
   return Status::OK();
 }
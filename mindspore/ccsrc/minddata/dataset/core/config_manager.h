@@ -284,6 +284,30 @@ class ConfigManager {
   // @return - Flag to indicate whether the dataset is dynamic-shape
   bool dynamic_shape() const { return dynamic_shape_; }
 
+  // setter function
+  // @param depth - Number of rows the leaf ops read ahead through the IO service, 0 to disable
+  void set_io_prefetch_depth(int32_t depth) { io_prefetch_depth_ = depth; }
+
+  // getter function
+  // @return - Number of rows the leaf ops read ahead through the IO service
+  int32_t io_prefetch_depth() const { return io_prefetch_depth_; }
+
+  // setter function
+  // @param memory - Memory in MB the shuffle op keeps its rows in before spilling them to disk, 0 to disable spilling
+  void set_shuffle_spill_memory(int32_t memory) { shuffle_spill_memory_ = memory; }
+
+  // getter function
+  // @return - Memory in MB the shuffle op keeps its rows in before spilling them to disk
+  int32_t shuffle_spill_memory() const { return shuffle_spill_memory_; }
+
+  // setter function
+  // @param dir - Directory of the files the shuffle op spills its rows to
+  void set_shuffle_spill_dir(const std::string &dir) { shuffle_spill_dir_ = dir; }
+
+  // getter function
+  // @return - Directory of the files the shuffle op spills its rows to
+  std::string shuffle_spill_dir() const { return shuffle_spill_dir_; }
+
   // setter function
   // @notes User must also set the seed to be able to get same augmentations
   // @notes Fast recovery can cause slightly different random augmentations than original run
@@ -354,6 +378,9 @@ class ConfigManager {
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
+  int32_t io_prefetch_depth_{0};     // Read-ahead depth of the leaf ops, 0 means rows are read in the workers
+  int32_t shuffle_spill_memory_{0};  // Memory budget of the shuffle op in MB, 0 means the rows are never spilled
+  std::string shuffle_spill_dir_;    // Directory of the spill files, the system temp directory if empty
   bool fast_recovery_{true};     // Used for failover scenario to recover quickly or produce same augmentations
   bool debug_mode_flag_{false};  // Indicator for debug mode
   ErrorSamplesMode error_samples_mode_{ErrorSamplesMode::kReturn};  // The method to process erroneous samples
@@ -107,6 +107,17 @@ class DATASET_API Tensor {
   static Status CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src,
                                  const dsize_t &length, TensorPtr *out);
 
+  /// Create a numeric tensor on top of memory owned by others. Data will not be copied, the holder keeps the memory
+  /// alive until the tensor is destroyed. The memory must stay writable in place, e.g. a private file mapping.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor
+  /// \param[in] src pointer to the source data, which should be aligned to the size of type
+  /// \param[in] holder owner of the source data
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateFromMemoryNoCopy(const TensorShape &shape, const DataType &type, const uchar *src,
+                                       std::shared_ptr<const void> holder, TensorPtr *out);
+
   /// Create a copy of the input tensor
   /// \param[in] in original tensor to be copied
   /// \param[out] out output tensor to be generated
@@ -860,6 +871,9 @@ class DATASET_API Tensor {
   /// shape for interpretation of YUV image
   std::vector<uint32_t> yuv_shape_;
 
+  /// Hold the memory which is not allocated by the tensor, e.g. a mapped file, so data_ points to it without memcpy
+  std::shared_ptr<const void> external_data_;
+
 #ifdef ENABLE_PYTHON
   /// Store python dictionary wrapper
   py::object python_dict_;
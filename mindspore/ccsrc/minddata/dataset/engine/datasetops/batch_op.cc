@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/engine/datasetops/batch_op.h"
 
+#include <cmath>
+#include <limits>
 #include <utility>
 
 #include "utils/ms_utils.h"
@@ -27,6 +29,67 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// free buffers kept by the pool of a batch op, the memory of one batch in flight is usually far below
+constexpr size_t kMaxFreeBatchBytes = 256 * 1024 * 1024;
+// larger batches are dominated by the copy rather than by the allocation
+constexpr size_t kMaxPooledBatchBytes = 64 * 1024 * 1024;
+// a free buffer is reused for a smaller batch only when at most half of it is wasted
+constexpr size_t kMaxBufferWasteRatio = 2;
+}  // namespace
+
+Status BatchBufferPool::CreateTensor(const TensorShape &shape, const DataType &type, std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Failed to create batched tensor, tensor shape is unknown.");
+  auto size = static_cast<size_t>(shape.NumOfElements()) * type.SizeInBytes();
+  if (size == 0 || size > max_buffer_size_ || !type.IsNumeric()) {
+    return Tensor::CreateEmpty(shape, type, out);
+  }
+  std::unique_ptr<uchar[]> buffer;
+  size_t capacity = size;
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    auto itr = free_buffers_.lower_bound(size);
+    if (itr != free_buffers_.end() && itr->first <= size * kMaxBufferWasteRatio) {
+      capacity = itr->first;
+      buffer = std::move(itr->second);
+      free_bytes_ -= capacity;
+      (void)free_buffers_.erase(itr);
+    }
+  }
+  if (buffer == nullptr) {
+    buffer = std::unique_ptr<uchar[]>(new (std::nothrow) uchar[size]);
+    CHECK_FAIL_RETURN_UNEXPECTED(buffer != nullptr, "Failed to allocate memory for batched tensor.");
+  }
+  std::weak_ptr<BatchBufferPool> weak_pool = weak_from_this();
+  uchar *data = buffer.release();
+  // the op may be gone before the tensors it batched, then the buffer is freed instead
+  std::shared_ptr<const void> holder(data, [weak_pool, capacity](uchar *ptr) {
+    auto pool = weak_pool.lock();
+    if (pool != nullptr) {
+      pool->Release(ptr, capacity);
+    } else {
+      delete[] ptr;
+    }
+  });
+  return Tensor::CreateFromMemoryNoCopy(shape, type, data, std::move(holder), out);
+}
+
+void BatchBufferPool::Release(uchar *buffer, size_t capacity) {
+  std::unique_ptr<uchar[]> ptr(buffer);
+  std::unique_lock<std::mutex> lck(mux_);
+  if (free_bytes_ + capacity > max_free_bytes_) {
+    return;
+  }
+  free_bytes_ += capacity;
+  (void)free_buffers_.emplace(capacity, std::move(ptr));
+}
+
+size_t BatchBufferPool::FreeBytes() {
+  std::unique_lock<std::mutex> lck(mux_);
+  return free_bytes_;
+}
+
 #ifdef ENABLE_PYTHON
 BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size, int32_t num_workers,
                  const std::vector<std::string> &in_col, const std::vector<std::string> &out_col,
@@ -48,7 +111,8 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
       pad_info_(std::move(pad_map)),
       batch_num_(0),
       batch_cnt_(0),
-      python_mp_(nullptr) {
+      python_mp_(nullptr),
+      buffer_pool_(std::make_shared<BatchBufferPool>(kMaxFreeBatchBytes, kMaxPooledBatchBytes)) {
   // Adjust connector queue size.  After batch each row is batch_size times larger
   worker_connector_size_ = std::max(1, worker_connector_size_ / start_batch_size_);
   if (num_workers == 1) {
@@ -144,7 +208,7 @@ void BatchOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeue, TensorRow *batched_tensor_row,
-                          bool concat_batch, bool contains_per_batch_map) {
+                          bool concat_batch, bool contains_per_batch_map, BatchBufferPool *pool) {
   RETURN_UNEXPECTED_IF_NULL(tensor_row_dequeue);
   RETURN_UNEXPECTED_IF_NULL(batched_tensor_row);
   auto batch_size = (*tensor_row_dequeue)->size();
@@ -164,13 +228,193 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeu
   auto num_columns = (*tensor_row_dequeue)->front().size();
   for (size_t i = 0; i < num_columns; i++) {
     std::shared_ptr<Tensor> batched_tensor;
-    RETURN_IF_NOT_OK(ConvertRowsToTensor(tensor_row_dequeue, &batched_tensor, batch_size, i, contains_per_batch_map));
+    RETURN_IF_NOT_OK(
+      ConvertRowsToTensor(tensor_row_dequeue, &batched_tensor, batch_size, i, contains_per_batch_map, pool));
     batched_tensor_row->emplace_back(std::move(batched_tensor));
   }
 
   return Status::OK();
 }
 
+Status BatchOp::PadAndBatchRows(const std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
+                                const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                                TensorRow *batched_tensor_row, bool contains_per_batch_map, BatchBufferPool *pool) {
+  RETURN_UNEXPECTED_IF_NULL(table);
+  RETURN_UNEXPECTED_IF_NULL(*table);
+  RETURN_UNEXPECTED_IF_NULL(batched_tensor_row);
+  CHECK_FAIL_RETURN_UNEXPECTED((*table)->size() > 1, "[Internal ERROR] Padding and batching need at least 2 rows.");
+  std::set<int32_t> pad_cols;
+  std::vector<std::shared_ptr<Tensor>> pad_vals;
+  std::vector<std::vector<dsize_t>> pad_shapes;
+  RETURN_IF_NOT_OK(GetPadShapes(table, pad_info, column_name_id_map, &pad_cols, &pad_vals, &pad_shapes));
+
+  auto batch_size = static_cast<dsize_t>((*table)->size());
+  auto num_columns = (*table)->front().size();
+  for (size_t col_id = 0; col_id < num_columns; col_id++) {
+    std::shared_ptr<Tensor> batched_tensor;
+    if (pad_cols.count(static_cast<int32_t>(col_id)) == 0) {
+      RETURN_IF_NOT_OK(
+        ConvertRowsToTensor(table, &batched_tensor, batch_size, col_id, contains_per_batch_map, pool));
+    } else if ((*table)->front()[col_id]->type().IsNumeric()) {
+      RETURN_IF_NOT_OK(
+        ConvertPaddedRowsToTensor(table, &batched_tensor, col_id, pad_shapes[col_id], pad_vals[col_id], pool));
+    } else {
+      // string tensors are padded row by row
+      for (TensorRow &row : **table) {
+        std::shared_ptr<Tensor> pad_tensor;
+        RETURN_IF_NOT_OK(PadEnd(row[col_id], &pad_tensor, pad_shapes[col_id], pad_vals[col_id]));
+        row[col_id] = pad_tensor;
+      }
+      RETURN_IF_NOT_OK(
+        ConvertRowsToTensor(table, &batched_tensor, batch_size, col_id, contains_per_batch_map, pool));
+    }
+    batched_tensor_row->emplace_back(std::move(batched_tensor));
+  }
+  return Status::OK();
+}
+
+namespace {
+Status CreateBatchTensor(const TensorShape &shape, const DataType &type, BatchBufferPool *pool,
+                         std::shared_ptr<Tensor> *batched_tensor) {
+  if (pool != nullptr) {
+    return pool->CreateTensor(shape, type, batched_tensor);
+  }
+  return Tensor::CreateEmpty(shape, type, batched_tensor);
+}
+
+// Get the bytes of one element of type filled with the pad value, the same way as PadEnd converts the pad value
+Status GetPadElement(const std::shared_ptr<Tensor> &pad_val, const DataType &type, std::vector<uchar> *pad_element) {
+  pad_element->assign(type.SizeInBytes(), 0);
+  if (pad_val == nullptr) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(pad_val->type().IsNumeric(),
+                               "PadEnd: can not pad numeric and string tensors together, but got: " +
+                                 pad_val->type().ToString() + " and " + type.ToString() + ".");
+  std::shared_ptr<Tensor> float_pad_value;
+  RETURN_IF_NOT_OK(TypeCast(pad_val, &float_pad_value, DataType(DataType::DE_FLOAT32)));
+  float val = 0.;
+  RETURN_IF_NOT_OK(float_pad_value->GetItemAt<float>(&val, {}));
+  if (std::fabs(val) <= std::numeric_limits<float>::epsilon()) {  // if pad with zero, don't care what type it is
+    return Status::OK();
+  }
+  std::shared_ptr<Tensor> float_scalar;
+  std::shared_ptr<Tensor> typed_scalar;
+  RETURN_IF_NOT_OK(Tensor::CreateScalar(val, &float_scalar));
+  RETURN_IF_NOT_OK(TypeCast(float_scalar, &typed_scalar, type));
+  CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(pad_element->data(), pad_element->size(), typed_scalar->GetBuffer(),
+                                        typed_scalar->SizeInBytes()) == EOK,
+                               "Failed to copy pad value.");
+  return Status::OK();
+}
+
+// Fill size bytes of dst with the pad element, the filled part is doubled on each copy
+Status FillPadElement(uchar *dst, size_t size, const std::vector<uchar> &pad_element) {
+  if (std::all_of(pad_element.begin(), pad_element.end(), [](uchar c) { return c == 0; })) {
+    CHECK_FAIL_RETURN_UNEXPECTED(memset_s(dst, size, 0, size) == EOK, "Failed to fill padded tensor.");
+    return Status::OK();
+  }
+  size_t filled = std::min(size, pad_element.size());
+  CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(dst, size, pad_element.data(), filled) == EOK,
+                               "Failed to fill padded tensor.");
+  while (filled < size) {
+    size_t count = std::min(filled, size - filled);
+    CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(dst + filled, size - filled, dst, count) == EOK,
+                                 "Failed to fill padded tensor.");
+    filled += count;
+  }
+  return Status::OK();
+}
+
+// Copy src into dst of dst_shape, which has the same rank. Each run along the last dimension is contiguous in both.
+Status CopyPaddedRow(const std::shared_ptr<Tensor> &src, const TensorShape &dst_shape, uchar *dst, size_t dst_size) {
+  auto rank = dst_shape.Rank();
+  auto type_size = src->type().SizeInBytes();
+  std::vector<dsize_t> src_strides(rank, 1);
+  std::vector<dsize_t> dst_strides(rank, 1);
+  std::vector<dsize_t> copy_shape(rank, 0);
+  for (size_t dim = rank; dim-- > 0;) {
+    copy_shape[dim] = std::min(src->shape()[dim], dst_shape[dim]);
+    if (copy_shape[dim] <= 0) {
+      return Status::OK();
+    }
+    if (dim + 1 < rank) {
+      src_strides[dim] = src_strides[dim + 1] * src->shape()[dim + 1];
+      dst_strides[dim] = dst_strides[dim + 1] * dst_shape[dim + 1];
+    }
+  }
+  const uchar *src_data = src->GetBuffer();
+  size_t run_bytes = static_cast<size_t>(copy_shape[rank - 1]) * type_size;
+  std::vector<dsize_t> index(rank, 0);
+  while (true) {
+    dsize_t src_offset = 0;
+    dsize_t dst_offset = 0;
+    for (size_t dim = 0; dim + 1 < rank; dim++) {
+      src_offset += index[dim] * src_strides[dim];
+      dst_offset += index[dim] * dst_strides[dim];
+    }
+    size_t dst_pos = static_cast<size_t>(dst_offset) * type_size;
+    CHECK_FAIL_RETURN_UNEXPECTED(
+      memcpy_s(dst + dst_pos, dst_size - dst_pos, src_data + src_offset * type_size, run_bytes) == EOK,
+      "Failed to copy tensor to padded batch.");
+    // next index of the outer dimensions
+    size_t dim = rank - 1;
+    while (dim > 0) {
+      --dim;
+      if (++index[dim] < copy_shape[dim]) {
+        break;
+      }
+      index[dim] = 0;
+      if (dim == 0) {
+        return Status::OK();
+      }
+    }
+    if (rank == 1) {
+      return Status::OK();
+    }
+  }
+}
+}  // namespace
+
+Status BatchOp::ConvertPaddedRowsToTensor(const std::unique_ptr<TensorQTable> *table,
+                                          std::shared_ptr<Tensor> *batched_tensor, size_t column_index,
+                                          const std::vector<dsize_t> &pad_shape, const std::shared_ptr<Tensor> &pad_val,
+                                          BatchBufferPool *pool) {
+  RETURN_UNEXPECTED_IF_NULL(table);
+  RETURN_UNEXPECTED_IF_NULL(batched_tensor);
+  auto batch_size = static_cast<dsize_t>((*table)->size());
+  DataType first_type = (*table)->at(0).at(column_index)->type();
+  TensorShape row_shape(pad_shape);
+  TensorShape new_shape = row_shape.PrependDim(batch_size);
+  std::shared_ptr<Tensor> new_tensor;
+  RETURN_IF_NOT_OK(CreateBatchTensor(new_shape, first_type, pool, &new_tensor));
+  std::vector<uchar> pad_element;
+  RETURN_IF_NOT_OK(GetPadElement(pad_val, first_type, &pad_element));
+  auto row_bytes = static_cast<size_t>(row_shape.NumOfElements()) * first_type.SizeInBytes();
+  for (dsize_t row_index = 0; row_index < batch_size; ++row_index) {
+    const std::shared_ptr<Tensor> &old_tensor = (**table)[row_index][column_index];
+    if (old_tensor->type() != first_type) {
+      RETURN_STATUS_UNEXPECTED("Cannot batch tensors with different types in column " + std::to_string(column_index) +
+                               ". First element had type " + first_type.ToString() + " and this element had type " +
+                               old_tensor->type().ToString());
+    }
+    if (row_bytes == 0) {
+      continue;
+    }
+    uchar *dst = new_tensor->GetMutableBuffer() + row_index * row_bytes;
+    if (old_tensor->shape() == row_shape) {
+      CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(dst, row_bytes, old_tensor->GetBuffer(), row_bytes) == EOK,
+                                   "Failed to copy tensor to batch.");
+      continue;
+    }
+    // only the rows which are smaller than the pad shape are filled with the pad value before the copy
+    RETURN_IF_NOT_OK(FillPadElement(dst, row_bytes, pad_element));
+    RETURN_IF_NOT_OK(CopyPaddedRow(old_tensor, row_shape, dst, row_bytes));
+  }
+  *batched_tensor = std::move(new_tensor);
+  return Status::OK();
+}
+
 Status CopyTensorToBatch(const std::shared_ptr<Tensor> &element_tensor, std::shared_ptr<Tensor> *batched_tensor,
                          size_t index) {
   RETURN_UNEXPECTED_IF_NULL(batched_tensor);
@@ -186,7 +430,7 @@ Status CopyTensorToBatch(const std::shared_ptr<Tensor> &element_tensor, std::sha
 
 Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *tensor_row_dequeue,
                                     std::shared_ptr<Tensor> *batched_tensor, dsize_t batch_size, size_t column_index,
-                                    bool contains_per_batch_map) {
+                                    bool contains_per_batch_map, BatchBufferPool *pool) {
   RETURN_UNEXPECTED_IF_NULL(tensor_row_dequeue);
   RETURN_UNEXPECTED_IF_NULL(batched_tensor);
   std::shared_ptr<Tensor> first_tensor = (*tensor_row_dequeue)->at(0).at(column_index);  // first row
@@ -196,7 +440,7 @@ Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *tensor_
 
   std::shared_ptr<Tensor> new_tensor;
   if (first_type.IsNumeric()) {  // numeric tensor
-    RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+    RETURN_IF_NOT_OK(CreateBatchTensor(new_shape, first_type, pool, &new_tensor));
     for (auto row_index = 0; row_index < batch_size; ++row_index) {
       const std::shared_ptr<Tensor> &old_tensor = (**tensor_row_dequeue)[row_index][column_index];
       // check the newly popped rows have the same dim and type as the first
@@ -363,10 +607,16 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
     RETURN_IF_NOT_OK(MapColumns(&tensor_info_pair, &concat_batch));
   }  // pass it through pyfunc
 #endif
+  if (pad_ && !concat_batch && tensor_info_pair.first->size() > 1) {
+    // pad while copying the rows into the batch
+    return PadAndBatchRows(&tensor_info_pair.first, pad_info_, column_name_id_map_, batched_tensor_row,
+                           contains_per_batch_map, buffer_pool_.get());
+  }
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&tensor_info_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
-  RETURN_IF_NOT_OK(BatchRows(&tensor_info_pair.first, batched_tensor_row, concat_batch, contains_per_batch_map));
+  RETURN_IF_NOT_OK(BatchRows(&tensor_info_pair.first, batched_tensor_row, concat_batch, contains_per_batch_map,
+                             buffer_pool_.get()));
   return Status::OK();
 }
 
@@ -604,32 +854,56 @@ Status BatchOp::InvokeBatchMapFunc(TensorTable *input, TensorTable *output, CBat
 Status BatchOp::PadColumns(const std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
                            const std::unordered_map<std::string, int32_t> &column_name_id_map) {
   RETURN_UNEXPECTED_IF_NULL(table);  // placeholder for now, might need this in the future
+  std::set<int32_t> pad_cols;
+  std::vector<std::shared_ptr<Tensor>> pad_vals;
+  std::vector<std::vector<dsize_t>> pad_shapes;
+  RETURN_IF_NOT_OK(GetPadShapes(table, pad_info, column_name_id_map, &pad_cols, &pad_vals, &pad_shapes));
+
+  // call pad on each tensor that needs to be padded
+  for (TensorRow &row : **table) {
+    for (size_t col_id : pad_cols) {
+      std::shared_ptr<Tensor> pad_tensor;
+      RETURN_IF_NOT_OK(PadEnd(row[col_id], &pad_tensor, pad_shapes[col_id], pad_vals[col_id]));
+      row[col_id] = pad_tensor;
+    }
+  }
+  return Status::OK();
+}
+
+Status BatchOp::GetPadShapes(const std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
+                             const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                             std::set<int32_t> *pad_cols, std::vector<std::shared_ptr<Tensor>> *pad_vals,
+                             std::vector<std::vector<dsize_t>> *pad_shapes) {
+  RETURN_UNEXPECTED_IF_NULL(table);
+  RETURN_UNEXPECTED_IF_NULL(pad_cols);
+  RETURN_UNEXPECTED_IF_NULL(pad_vals);
+  RETURN_UNEXPECTED_IF_NULL(pad_shapes);
   CHECK_FAIL_RETURN_UNEXPECTED(
     (*table)->front().size() == column_name_id_map.size(),
     "Invalid parameter, size of column_name_id_map must be equal to num of data columns. map size: " +
       std::to_string(column_name_id_map.size()) + ", column nums: " + std::to_string((*table)->front().size()));
-  std::vector<std::shared_ptr<Tensor>> pad_vals(column_name_id_map.size(),
-                                                nullptr);  // value to pad each column's tensor with, default nullptr
-  std::set<int32_t> pad_cols;
+  // value to pad each column's tensor with, default nullptr
+  pad_vals->assign(column_name_id_map.size(), nullptr);
   // padded_shape provided by user, maximum shapes of current batch of tensors
-  std::vector<std::vector<dsize_t>> pad_shapes(column_name_id_map.size()), max_shapes(column_name_id_map.size());
-  RETURN_IF_NOT_OK(UnpackPadInfo(pad_info, column_name_id_map, &pad_cols, &pad_vals, &pad_shapes));
+  pad_shapes->assign(column_name_id_map.size(), {});
+  std::vector<std::vector<dsize_t>> max_shapes(column_name_id_map.size());
+  RETURN_IF_NOT_OK(UnpackPadInfo(pad_info, column_name_id_map, pad_cols, pad_vals, pad_shapes));
 
   // init each shape in max_shape to {-1,-1...} init each unspecified shape in pad_shape to -1 as well
-  for (size_t col_id : pad_cols) {
+  for (size_t col_id : *pad_cols) {
     max_shapes[col_id] = std::vector<dsize_t>((*table)->front()[col_id]->Rank(), -1);
-    if (pad_shapes[col_id].empty()) {
-      pad_shapes[col_id] = max_shapes[col_id];  // fill pad shape with -1
+    if ((*pad_shapes)[col_id].empty()) {
+      (*pad_shapes)[col_id] = max_shapes[col_id];  // fill pad shape with -1
     }
     CHECK_FAIL_RETURN_UNEXPECTED(
-      pad_shapes[col_id].size() == max_shapes[col_id].size(),
+      (*pad_shapes)[col_id].size() == max_shapes[col_id].size(),
       "Invalid pad_info, rank of pad_shape must be equal to rank of specified column. pad_shapes rank:" +
-        std::to_string(pad_shapes[col_id].size()) + ", column rank: " + std::to_string(max_shapes[col_id].size()));
+        std::to_string((*pad_shapes)[col_id].size()) + ", column rank: " + std::to_string(max_shapes[col_id].size()));
   }
 
   // calculate maximum shape for each column that needs to be padded
   for (const TensorRow &row : **table) {  // iterator each row in a batch
-    for (size_t col_id : pad_cols) {      // iterator each tensor in a row
+    for (size_t col_id : *pad_cols) {     // iterator each tensor in a row
       CHECK_FAIL_RETURN_UNEXPECTED(
         row[col_id]->Rank() == max_shapes[col_id].size(),
         "Invalid data, data to be padded together need to have the same rank, got shape 1: " +
@@ -641,22 +915,13 @@ Status BatchOp::PadColumns(const std::unique_ptr<TensorQTable> *table, const Pad
   }
 
   // if user sets a dimension to -1 (None in python), use the max value for current dimension
-  for (size_t col_id : pad_cols) {
-    for (size_t dim = 0; dim < pad_shapes[col_id].size(); dim++) {
-      if (pad_shapes[col_id][dim] < 0) {
-        pad_shapes[col_id][dim] = max_shapes[col_id][dim];
+  for (size_t col_id : *pad_cols) {
+    for (size_t dim = 0; dim < (*pad_shapes)[col_id].size(); dim++) {
+      if ((*pad_shapes)[col_id][dim] < 0) {
+        (*pad_shapes)[col_id][dim] = max_shapes[col_id][dim];
       }
     }
   }
-
-  // call pad on each tensor that needs to be padded
-  for (TensorRow &row : **table) {
-    for (size_t col_id : pad_cols) {
-      std::shared_ptr<Tensor> pad_tensor;
-      RETURN_IF_NOT_OK(PadEnd(row[col_id], &pad_tensor, pad_shapes[col_id], pad_vals[col_id]));
-      row[col_id] = pad_tensor;
-    }
-  }
   return Status::OK();
 }
 
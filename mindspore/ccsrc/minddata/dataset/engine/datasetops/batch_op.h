@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <string>
@@ -74,6 +75,39 @@ struct CBatchInfo {
   }
 };
 
+// Pool of host buffers for batched tensors. A batched tensor holds its buffer through a holder which returns the buffer
+// to the pool when the last tensor sharing it is gone, so that the batches of the following steps reuse the memory
+// instead of allocating a new buffer every step.
+class BatchBufferPool : public std::enable_shared_from_this<BatchBufferPool> {
+ public:
+  // @param size_t max_free_bytes - total size of the free buffers kept by the pool
+  // @param size_t max_buffer_size - buffers larger than this are allocated by the tensor allocator and never pooled
+  BatchBufferPool(size_t max_free_bytes, size_t max_buffer_size)
+      : max_free_bytes_(max_free_bytes), max_buffer_size_(max_buffer_size), free_bytes_(0) {}
+
+  ~BatchBufferPool() = default;
+
+  // Create a numeric tensor with uninitialized data, the buffer comes from the pool
+  // @param const TensorShape &shape - shape of the tensor
+  // @param const DataType &type - type of the tensor
+  // @param std::shared_ptr<Tensor> *out - the created tensor
+  // @return Status The status code returned
+  Status CreateTensor(const TensorShape &shape, const DataType &type, std::shared_ptr<Tensor> *out);
+
+  // @return size_t total size of the free buffers
+  size_t FreeBytes();
+
+ private:
+  // Called when the last tensor sharing the buffer is gone
+  void Release(uchar *buffer, size_t capacity);
+
+  const size_t max_free_bytes_;
+  const size_t max_buffer_size_;
+  std::mutex mux_;
+  size_t free_bytes_;
+  std::multimap<size_t, std::unique_ptr<uchar[]>> free_buffers_;  // capacity to buffer
+};
+
 class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatchInfo>, TensorRow> {
  public:
 #ifdef ENABLE_PYTHON
@@ -124,10 +158,26 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @param TensorRow *batched_tensor_row - dest_table to hold batched rows
   // @param bool concat_batch - whether to keep batch to 1 row or expand dimensions
   // @param bool contains_per_batch_map - whether user has provided per_batch_map
+  // @param BatchBufferPool *pool - pool of the buffers of numeric batched tensors, nullptr to use the tensor allocator
   // @notes contains_per_batch_map is passed to this function since some callers require this function to be static
   // @return Status The status code returned
   static Status BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeue, TensorRow *batched_tensor_row,
-                          bool concat_batch = false, bool contains_per_batch_map = false);
+                          bool concat_batch = false, bool contains_per_batch_map = false,
+                          BatchBufferPool *pool = nullptr);
+
+  // pad and batch the rows in one pass, numeric columns are copied into the padded batched tensor directly instead of
+  // creating a padded tensor for each row first. The result is the same as PadColumns followed by BatchRows.
+  // @param const std::unique_ptr<TensorQTable> *table - table that has the rows for batching, at least 2 rows
+  // @param const PadInfo &pad_info pad info
+  // @param const std::unordered_map<std::string, int32_t>& column_name_id_map - column names to index mapping
+  // @param TensorRow *batched_tensor_row - dest_table to hold batched rows
+  // @param bool contains_per_batch_map - whether user has provided per_batch_map
+  // @param BatchBufferPool *pool - pool of the buffers of numeric batched tensors, nullptr to use the tensor allocator
+  // @return Status The status code returned
+  static Status PadAndBatchRows(const std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
+                                const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                                TensorRow *batched_tensor_row, bool contains_per_batch_map = false,
+                                BatchBufferPool *pool = nullptr);
 
   // convert the rows to tensor
   // @param const std::unique_ptr<TensorQTable> *tensor_row_dequeue - table that has the rows for batching
@@ -135,11 +185,12 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @param int32_t size - batch_size
   // @param int32_t size - column_index
   // @param bool contains_per_batch_map - whether user has provided per_batch_map
+  // @param BatchBufferPool *pool - pool of the buffers of numeric batched tensors, nullptr to use the tensor allocator
   // @notes contains_per_batch_map is passed to this function since some callers require this function to be static
   // @return Status The status code returned
   static Status ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *tensor_row_dequeue,
                                     std::shared_ptr<Tensor> *batched_tensor, dsize_t batch_size, size_t column_index,
-                                    bool contains_per_batch_map);
+                                    bool contains_per_batch_map, BatchBufferPool *pool = nullptr);
 
   // @param table
   // @param const PadInfo &pad_info pad info
@@ -196,6 +247,33 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
                               std::set<int32_t> *pad_cols, std::vector<std::shared_ptr<Tensor>> *pad_vals,
                               std::vector<std::vector<dsize_t>> *pad_shapes);
 
+  // Compute the shape each column is padded to, the unspecified dimensions take the max of the rows
+  // @param table
+  // @param const PadInfo &pad_info pad info
+  // @param const std::unordered_map<std::string, int32_t>& column_name_id_map - column names to index mapping
+  // @param std::set<int32_t> *cols, col ids to perform pad on
+  // @param std::vector<std::shared_ptr<Tensor>> *vals, padding value for each column
+  // @param std::vector<std::vector<dsize_t>> *shapes, padding shape of each column
+  // @return Status The status code returned
+  static Status GetPadShapes(const std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
+                             const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                             std::set<int32_t> *pad_cols, std::vector<std::shared_ptr<Tensor>> *pad_vals,
+                             std::vector<std::vector<dsize_t>> *pad_shapes);
+
+  // Batch a numeric column, each row is copied into the batched tensor at its place and the rest is filled with the pad
+  // value
+  // @param const std::unique_ptr<TensorQTable> *table - table that has the rows for batching
+  // @param std::shared_ptr<Tensor> *batched_tensor - the batched tensor
+  // @param size_t column_index - column to batch
+  // @param const std::vector<dsize_t> &pad_shape - shape each row is padded to
+  // @param const std::shared_ptr<Tensor> &pad_val - value to pad, nullptr to pad with 0
+  // @param BatchBufferPool *pool - pool of the buffer of the batched tensor, nullptr to use the tensor allocator
+  // @return Status The status code returned
+  static Status ConvertPaddedRowsToTensor(const std::unique_ptr<TensorQTable> *table,
+                                          std::shared_ptr<Tensor> *batched_tensor, size_t column_index,
+                                          const std::vector<dsize_t> &pad_shape, const std::shared_ptr<Tensor> &pad_val,
+                                          BatchBufferPool *pool);
+
   // get the batch size for next batch
   // @return Status The status code returned
   Status GetBatchSize(int32_t *batch_size, CBatchInfo info);
@@ -236,6 +314,7 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   py::function batch_map_func_;   // Function pointer of per batch map function
 #endif
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
+  std::shared_ptr<BatchBufferPool> buffer_pool_;             // buffers of the numeric batched tensors
 
  protected:
   Status Launch() override;
@@ -153,10 +153,14 @@ Status BucketBatchByLengthOp::PadAndBatchBucket(int32_t bucket_index, TensorRow
     }
   }
 
-  // PadColumns will change the data in bucket
-  RETURN_IF_NOT_OK(BatchOp::PadColumns(bucket, pad_info_copy, column_name_id_map_));
-
-  RETURN_IF_NOT_OK(BatchOp::BatchRows(bucket, batched_bucket));
+  if ((*bucket)->size() > 1) {
+    // pad while copying the rows into the batch
+    RETURN_IF_NOT_OK(BatchOp::PadAndBatchRows(bucket, pad_info_copy, column_name_id_map_, batched_bucket));
+  } else {
+    // PadColumns will change the data in bucket
+    RETURN_IF_NOT_OK(BatchOp::PadColumns(bucket, pad_info_copy, column_name_id_map_));
+    RETURN_IF_NOT_OK(BatchOp::BatchRows(bucket, batched_bucket));
+  }
   (*bucket)->clear();
 
   batch_count_++;
@@ -0,0 +1,271 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/external_shuffle_buffer.h"
+
+#include <utility>
+
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/path.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// spill files stay open until their rows are read, warn when a window needs more of them than this
+constexpr size_t kSpilledRunsWarningThreshold = 512;
+
+template <typename T>
+void WriteValue(std::ostream *out, const T &value) {
+  (void)out->write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+Status ReadValue(std::istream *in, T *value) {
+  (void)in->read(reinterpret_cast<char *>(value), sizeof(T));
+  CHECK_FAIL_RETURN_UNEXPECTED(in->good(), "[Internal ERROR] Failed to read the shuffle spill file.");
+  return Status::OK();
+}
+
+int64_t RowBytes(const TensorRow &row) {
+  int64_t bytes = 0;
+  for (const auto &tensor : row) {
+    bytes += tensor->SizeInBytes();
+  }
+  return bytes;
+}
+}  // namespace
+
+ExternalShuffleBuffer::ExternalShuffleBuffer(std::string spill_dir, std::string file_prefix, int64_t memory_budget,
+                                             std::mt19937_64 *rng)
+    : spill_dir_(std::move(spill_dir)),
+      file_prefix_(std::move(file_prefix)),
+      memory_budget_(memory_budget),
+      rng_(rng),
+      chunk_bytes_(0),
+      num_rows_(0),
+      num_files_(0),
+      sealed_(false) {
+  if (spill_dir_.empty()) {
+    spill_dir_ = common::GetEnv("TMPDIR");
+  }
+  if (spill_dir_.empty()) {
+#if defined(_WIN32) || defined(_WIN64)
+    spill_dir_ = ".";
+#else
+    spill_dir_ = "/tmp";
+#endif
+  }
+}
+
+ExternalShuffleBuffer::~ExternalShuffleBuffer() { Reset(); }
+
+Status ExternalShuffleBuffer::Add(TensorRow &&row) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!sealed_, "[Internal ERROR] Can not add rows to a sealed shuffle buffer.");
+  chunk_bytes_ += RowBytes(row);
+  chunk_.emplace_back(std::move(row));
+  num_rows_++;
+  if (chunk_bytes_ >= memory_budget_) {
+    RETURN_IF_NOT_OK(SpillChunk());
+  }
+  return Status::OK();
+}
+
+Status ExternalShuffleBuffer::Seal() {
+  CHECK_FAIL_RETURN_UNEXPECTED(!sealed_, "[Internal ERROR] Shuffle buffer is already sealed.");
+  // the rows left in memory make up the last run
+  ShuffleChunk();
+  sealed_ = true;
+  if (!runs_.empty()) {
+    MS_LOG(INFO) << "Shuffle window of " << num_rows_ << " rows is spilled to " << runs_.size() << " files.";
+  }
+  return Status::OK();
+}
+
+Status ExternalShuffleBuffer::Next(TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  CHECK_FAIL_RETURN_UNEXPECTED(sealed_ && num_rows_ > 0, "[Internal ERROR] No row left in the shuffle buffer.");
+  // pick a run with the probability of the number of rows left in it
+  auto slot = static_cast<int64_t>((*rng_)() % static_cast<uint64_t>(num_rows_));
+  num_rows_--;
+  if (slot < static_cast<int64_t>(chunk_.size())) {
+    *row = std::move(chunk_.back());
+    chunk_.pop_back();
+    return Status::OK();
+  }
+  slot -= static_cast<int64_t>(chunk_.size());
+  for (auto itr = runs_.begin(); itr != runs_.end(); ++itr) {
+    auto &run = *itr;
+    if (slot >= run->remaining) {
+      slot -= run->remaining;
+      continue;
+    }
+    RETURN_IF_NOT_OK(ReadRow(&run->in, row));
+    if (--run->remaining == 0) {
+      run->in.close();
+      RETURN_IF_NOT_OK(Path(run->path).Remove());
+      (void)runs_.erase(itr);
+    }
+    return Status::OK();
+  }
+  RETURN_STATUS_UNEXPECTED("[Internal ERROR] Number of rows in the shuffle buffer is out of sync with its runs.");
+}
+
+void ExternalShuffleBuffer::Reset() {
+  chunk_.clear();
+  chunk_bytes_ = 0;
+  for (auto &run : runs_) {
+    run->in.close();
+    Status rc = Path(run->path).Remove();
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Failed to remove shuffle spill file: " << run->path << ". " << rc.GetErrDescription();
+    }
+  }
+  runs_.clear();
+  num_rows_ = 0;
+  sealed_ = false;
+}
+
+void ExternalShuffleBuffer::ShuffleChunk() {
+  // Fisher-Yates with the raw rng, the same way as the in-memory shuffle buffer draws its slots
+  for (size_t i = chunk_.size(); i > 1; --i) {
+    size_t j = static_cast<size_t>((*rng_)() % i);
+    if (j != i - 1) {
+      std::swap(chunk_[j], chunk_[i - 1]);
+    }
+  }
+}
+
+Status ExternalShuffleBuffer::SpillChunk() {
+  if (chunk_.empty()) {
+    return Status::OK();
+  }
+  if (runs_.empty() && num_files_ == 0) {
+    Path dir(spill_dir_);
+    if (!dir.Exists()) {
+      RETURN_IF_NOT_OK(dir.CreateDirectories());
+    }
+  }
+  ShuffleChunk();
+  auto run = std::make_unique<Run>();
+  run->path = (Path(spill_dir_) / (file_prefix_ + "_" + std::to_string(num_files_++) + ".shuffle")).ToString();
+  std::ofstream out(run->path, std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(out.is_open(), "Invalid file, failed to create shuffle spill file: " + run->path +
+                                                ", check the permission of the directory or set another one by "
+                                                "MS_DEV_DATASET_SHUFFLE_SPILL_DIR.");
+  for (const auto &row : chunk_) {
+    RETURN_IF_NOT_OK(WriteRow(&out, row));
+  }
+  out.close();
+  CHECK_FAIL_RETURN_UNEXPECTED(!out.fail(), "Invalid file, failed to write shuffle spill file: " + run->path +
+                                              ", check the free space of the disk.");
+  run->in.open(run->path, std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED(run->in.is_open(), "Invalid file, failed to open shuffle spill file: " + run->path);
+  run->remaining = static_cast<int64_t>(chunk_.size());
+  runs_.emplace_back(std::move(run));
+  if (runs_.size() == kSpilledRunsWarningThreshold) {
+    MS_LOG(WARNING) << "Shuffle window is spilled to more than " << kSpilledRunsWarningThreshold
+                    << " files, increase the shuffle spill memory to reduce the number of open files.";
+  }
+  chunk_.clear();
+  chunk_bytes_ = 0;
+  return Status::OK();
+}
+
+Status ExternalShuffleBuffer::WriteRow(std::ostream *out, const TensorRow &row) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  WriteValue<int64_t>(out, row.getId());
+  auto paths = row.getPath();
+  WriteValue<uint32_t>(out, static_cast<uint32_t>(paths.size()));
+  for (const auto &path : paths) {
+    WriteValue<uint64_t>(out, path.size());
+    (void)out->write(path.data(), static_cast<std::streamsize>(path.size()));
+  }
+  WriteValue<uint32_t>(out, static_cast<uint32_t>(row.size()));
+  for (const auto &tensor : row) {
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    CHECK_FAIL_RETURN_UNEXPECTED(!tensor->type().IsPython(),
+                                 "Shuffle with spilling does not support python dictionary, unset "
+                                 "MS_DEV_DATASET_SHUFFLE_SPILL_MB to shuffle the rows in memory.");
+    WriteValue<uint8_t>(out, static_cast<uint8_t>(tensor->type().value()));
+    WriteValue<uint32_t>(out, static_cast<uint32_t>(tensor->Rank()));
+    for (auto dim : tensor->shape().AsVector()) {
+      WriteValue<int64_t>(out, dim);
+    }
+    WriteValue<int64_t>(out, tensor->SizeInBytes());
+    if (tensor->SizeInBytes() > 0) {
+      (void)out->write(reinterpret_cast<const char *>(tensor->GetBuffer()), tensor->SizeInBytes());
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(out->good(), "Invalid file, failed to write shuffle spill file.");
+  return Status::OK();
+}
+
+Status ExternalShuffleBuffer::ReadRow(std::istream *in, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(in);
+  RETURN_UNEXPECTED_IF_NULL(row);
+  int64_t id = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &id));
+  uint32_t num_paths = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &num_paths));
+  std::vector<std::string> paths(num_paths);
+  for (auto &path : paths) {
+    uint64_t length = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &length));
+    path.resize(length);
+    (void)in->read(path.data(), static_cast<std::streamsize>(length));
+  }
+  uint32_t num_tensors = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &num_tensors));
+  TensorRow new_row;
+  for (uint32_t i = 0; i < num_tensors; i++) {
+    uint8_t type = 0;
+    uint32_t rank = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &type));
+    RETURN_IF_NOT_OK(ReadValue(in, &rank));
+    std::vector<dsize_t> dims(rank);
+    for (auto &dim : dims) {
+      int64_t value = 0;
+      RETURN_IF_NOT_OK(ReadValue(in, &value));
+      dim = value;
+    }
+    int64_t length = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &length));
+    DataType data_type(static_cast<DataType::Type>(type));
+    std::shared_ptr<Tensor> tensor;
+    if (data_type.IsNumeric()) {
+      // read straight into the buffer of the tensor
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(dims), data_type, &tensor));
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        tensor->SizeInBytes() == length,
+        "[Internal ERROR] Size of tensor in the shuffle spill file does not match its shape.");
+      if (length > 0) {
+        (void)in->read(reinterpret_cast<char *>(tensor->GetMutableBuffer()), length);
+      }
+    } else {
+      std::vector<uchar> buffer(length);
+      (void)in->read(reinterpret_cast<char *>(buffer.data()), length);
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(dims), data_type, buffer.data(), length, &tensor));
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(in->good(), "[Internal ERROR] Failed to read the shuffle spill file.");
+    new_row.emplace_back(std::move(tensor));
+  }
+  new_row.setId(id);
+  new_row.setPath(paths);
+  *row = std::move(new_row);
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
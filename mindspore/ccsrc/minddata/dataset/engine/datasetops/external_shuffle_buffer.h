@@ -0,0 +1,113 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_EXTERNAL_SHUFFLE_BUFFER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_EXTERNAL_SHUFFLE_BUFFER_H_
+
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// A shuffle buffer which holds at most a fixed amount of memory.
+// Rows are added to an in-memory chunk. Once the chunk reaches the memory budget it is shuffled and spilled to a file
+// as a run. When all the rows of the window are added, the rows are taken out by picking a run at random, weighted by
+// the number of rows left in it, and reading its next row. Merging independently shuffled runs this way gives a
+// uniformly random order of the whole window, and the order only depends on the state of the given rng.
+class ExternalShuffleBuffer {
+ public:
+  // Constructor
+  // @param spill_dir - Directory of the spill files
+  // @param file_prefix - Prefix of the names of the spill files, unique to the owner
+  // @param memory_budget - Size in bytes of the rows kept in memory
+  // @param rng - Random generator shared with the owner
+  ExternalShuffleBuffer(std::string spill_dir, std::string file_prefix, int64_t memory_budget, std::mt19937_64 *rng);
+
+  // Destructor, removes the spill files
+  ~ExternalShuffleBuffer();
+
+  ExternalShuffleBuffer(const ExternalShuffleBuffer &) = delete;
+  ExternalShuffleBuffer &operator=(const ExternalShuffleBuffer &) = delete;
+
+  // Add a row of the current window, the in-memory chunk is spilled when it reaches the memory budget
+  // @param row - The row to add
+  // @return Status The status code returned
+  Status Add(TensorRow &&row);
+
+  // Finish adding the rows of the window and start taking them out
+  // @return Status The status code returned
+  Status Seal();
+
+  // Take a random row out of the window
+  // @param row - [out] The row taken out
+  // @return Status The status code returned
+  Status Next(TensorRow *row);
+
+  // @return Number of rows of the window which are not taken out yet
+  int64_t Size() const { return num_rows_; }
+
+  // @return Number of runs spilled to disk for the current window
+  size_t NumSpilledRuns() const { return runs_.size(); }
+
+  // Drop all the rows and remove the spill files
+  void Reset();
+
+  // Write a row in the format of the spill files
+  // @param out - The stream to write to
+  // @param row - The row to write
+  // @return Status The status code returned
+  static Status WriteRow(std::ostream *out, const TensorRow &row);
+
+  // Read a row written by WriteRow
+  // @param in - The stream to read from
+  // @param row - [out] The row read
+  // @return Status The status code returned
+  static Status ReadRow(std::istream *in, TensorRow *row);
+
+ private:
+  // A shuffled chunk of rows spilled to a file
+  struct Run {
+    std::string path;
+    std::ifstream in;
+    int64_t remaining = 0;
+  };
+
+  // Shuffle the in-memory chunk in place
+  void ShuffleChunk();
+
+  // Shuffle the in-memory chunk and write it to a new run
+  // @return Status The status code returned
+  Status SpillChunk();
+
+  std::string spill_dir_;
+  std::string file_prefix_;
+  int64_t memory_budget_;
+  std::mt19937_64 *rng_;
+  std::vector<TensorRow> chunk_;  // rows in memory, the last run once the window is sealed
+  int64_t chunk_bytes_;
+  std::vector<std::unique_ptr<Run>> runs_;
+  int64_t num_rows_;
+  int64_t num_files_;  // number of files created, used to name the next one
+  bool sealed_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_EXTERNAL_SHUFFLE_BUFFER_H_
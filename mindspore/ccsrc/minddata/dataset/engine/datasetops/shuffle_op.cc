@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 #if defined(_WIN32) || defined(_WIN64)
+#include <process.h>
 #include <stdlib.h>
+#else
+#include <unistd.h>
 #endif
 #include <chrono>
 #include <iomanip>
@@ -23,6 +26,7 @@
 #include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 
@@ -45,7 +49,13 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rng_(shuffle_seed),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      spill_memory_(0) {
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  const int64_t kBytesPerMB = 1024 * 1024;
+  spill_memory_ = static_cast<int64_t>(cfg->shuffle_spill_memory()) * kBytesPerMB;
+  spill_dir_ = cfg->shuffle_spill_dir();
+}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -60,6 +70,9 @@ Status ShuffleOp::SelfReset() {
   }
 
   shuffle_buffer_ = std::make_unique<TensorTable>();
+  if (external_buffer_ != nullptr) {
+    external_buffer_->Reset();
+  }
   shuffle_last_row_idx_ = 0;
   shuffle_buffer_state_ = kShuffleStateInit;
   return Status::OK();
@@ -77,7 +90,11 @@ void ShuffleOp::Print(std::ostream &out, bool show_all) const {
     PipelineOp::Print(out, show_all);
     // Then show any custom derived-internal stuff
     out << "\nShuffle size: " << shuffle_size_ << "\nShuffle buffer state: " << shuffle_buffer_state_
-        << "\nShuffle seed: " << shuffle_seed_ << "\n\n";
+        << "\nShuffle seed: " << shuffle_seed_;
+    if (spill_memory_ > 0) {
+      out << "\nShuffle spill memory (bytes): " << spill_memory_ << "\nShuffle spill dir: " << spill_dir_;
+    }
+    out << "\n\n";
   }
 }
 
@@ -101,8 +118,58 @@ Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
   return Status::OK();
 }
 
+Status ShuffleOp::FetchChildRow(TensorRow *row, bool is_pull_mode) {
+  if (!is_pull_mode) {
+    RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(row));
+  } else {
+    RETURN_IF_NOT_OK(child_[0]->GetNextRowPullMode(row));
+  }
+  return Status::OK();
+}
+
+Status ShuffleOp::FillExternalBuffer(TensorRow first_row, bool is_pull_mode) {
+  external_buffer_->Reset();
+  TensorRow new_row = std::move(first_row);
+  bool end_of_epoch = false;
+  while (true) {
+    if (new_row.empty()) {
+      end_of_epoch = true;
+      break;
+    }
+    RETURN_IF_NOT_OK(external_buffer_->Add(std::move(new_row)));
+    if (external_buffer_->Size() >= shuffle_size_) {
+      break;
+    }
+    RETURN_IF_NOT_OK(FetchChildRow(&new_row, is_pull_mode));
+  }
+  RETURN_IF_NOT_OK(external_buffer_->Seal());
+  // a full window may be followed by more rows of the epoch
+  shuffle_buffer_state_ = end_of_epoch ? kShuffleStateDrain : kShuffleStateActive;
+  shuffle_last_row_idx_ = static_cast<int32_t>(external_buffer_->Size() - 1);
+  return Status::OK();
+}
+
+Status ShuffleOp::GetExternalShuffledRow(TensorRow *row, bool is_pull_mode) {
+  RETURN_IF_NOT_OK(external_buffer_->Next(row));
+  if (external_buffer_->Size() == 0 && shuffle_buffer_state_ == kShuffleStateActive) {
+    // the window is drained, the next one starts with the next row of the child
+    TensorRow new_row;
+    RETURN_IF_NOT_OK(FetchChildRow(&new_row, is_pull_mode));
+    if (!new_row.empty()) {
+      RETURN_IF_NOT_OK(FillExternalBuffer(std::move(new_row), is_pull_mode));
+    } else {
+      shuffle_buffer_state_ = kShuffleStateDrain;
+    }
+  }
+  shuffle_last_row_idx_ = static_cast<int32_t>(external_buffer_->Size() - 1);
+  return Status::OK();
+}
+
 Status ShuffleOp::GetShuffledRowImpl(TensorRow *const row, bool is_pull_mode) {
   RETURN_UNEXPECTED_IF_NULL(row);
+  if (external_buffer_ != nullptr) {
+    return GetExternalShuffledRow(row, is_pull_mode);
+  }
   // Step 1)
   // Randomly select a slot from our shuffle buffer and copy that row into the output
   // tensor table. We remove the data from the shuffle buffer, leaving that slot
@@ -234,6 +301,19 @@ Status ShuffleOp::InitShuffleBuffer(bool is_pull_mode) {
     RETURN_STATUS_UNEXPECTED("[Internal ERROR] Unable to fetch a single row for shuffle buffer.");
   }
 
+  if (spill_memory_ > 0) {
+    if (external_buffer_ == nullptr) {
+#if defined(_WIN32) || defined(_WIN64)
+      auto pid = _getpid();
+#else
+      auto pid = getpid();
+#endif
+      std::string file_prefix = "ms_shuffle_" + std::to_string(pid) + "_" + std::to_string(id());
+      external_buffer_ = std::make_unique<ExternalShuffleBuffer>(spill_dir_, file_prefix, spill_memory_, &rng_);
+    }
+    return FillExternalBuffer(std::move(new_row), is_pull_mode);
+  }
+
   // Now fill the rest of the shuffle buffer until we are unable to get the next row or we reached
   // the desired shuffle buffer size.
   while (!new_row.empty() && shuffle_buffer_->size() < static_cast<size_t>(shuffle_size_ - 1)) {
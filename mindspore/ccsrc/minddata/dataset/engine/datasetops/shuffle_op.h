@@ -27,6 +27,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/external_shuffle_buffer.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -121,6 +122,26 @@ class ShuffleOp : public PipelineOp {
   /// \return Status The status code returned
   Status GetShuffledRowImpl(TensorRow *row, bool is_pull_mode);
 
+  /// \brief Fetch the next row from the child.
+  /// \param row[out] - Fetched TensorRow, empty at the end of the epoch
+  /// \param is_pull_mode - flag to indicate if pull mode is on
+  /// \return Status The status code returned
+  Status FetchChildRow(TensorRow *row, bool is_pull_mode);
+
+  /// \brief Fill the external shuffle buffer with the next window of up to shuffle_size_ rows, which may be spilled
+  ///     to disk.
+  /// \param first_row - The first row of the window, which is already fetched
+  /// \param is_pull_mode - flag to indicate if pull mode is on
+  /// \return Status The status code returned
+  Status FillExternalBuffer(TensorRow first_row, bool is_pull_mode);
+
+  /// \brief Gets one row out of the external shuffle buffer, and fills the next window once the current one is
+  ///     drained.
+  /// \param row[out] - Fetched TensorRow
+  /// \param is_pull_mode - flag to indicate if pull mode is on
+  /// \return Status The status code returned
+  Status GetExternalShuffledRow(TensorRow *row, bool is_pull_mode);
+
   // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
   // itself rather than waiting for the reset driven from operators above it in the pipeline.
   // @return Status The status code returned
@@ -142,6 +163,12 @@ class ShuffleOp : public PipelineOp {
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
   bool eof_received_{false};                       // flag to indicate if eof is reached in pull mode.
+
+  // When a memory budget is set, the rows are shuffled by windows of shuffle_size_ rows in an external shuffle buffer
+  // which spills them to disk, instead of the in-memory shuffle buffer.
+  int64_t spill_memory_;                                    // Memory budget in bytes, 0 to shuffle in memory
+  std::string spill_dir_;                                   // Directory of the spill files
+  std::unique_ptr<ExternalShuffleBuffer> external_buffer_;  // Created on the first epoch when spilling is enabled
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -22,6 +22,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 #include "minddata/dataset/util/path.h"
 #include "utils/file_utils.h"
 #ifndef ENABLE_ANDROID
@@ -258,11 +259,15 @@ Status CelebAOp::LoadTensorRow(row_id_type row_id, TensorRow *row) {
   Path path(folder_path_);
   Path image_path = path / image_label.first;
 
+  if (IOPrefetchDepth() > 0) {
+    RETURN_IF_NOT_OK(ReadFile(image_path.ToString(), &image));
+  } else {
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(image_path.ToString(), &image, decrypt_));
+    RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(image_path.ToString(), &image, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(image_path.ToString(), &image));
+    RETURN_IF_NOT_OK(Tensor::CreateFromFile(image_path.ToString(), &image));
 #endif
+  }
   if (decode_ == true) {
     Status rc = Decode(image, &image);
     if (rc.IsError()) {
@@ -291,6 +296,18 @@ Status CelebAOp::LoadTensorRow(row_id_type row_id, TensorRow *row) {
   return Status::OK();
 }
 
+bool CelebAOp::IOPrefetchSupported() const {
+#ifdef ENABLE_PYTHON
+  return decrypt_ == nullptr || py::isinstance<py::none>(decrypt_);
+#else
+  return true;
+#endif
+}
+
+Status CelebAOp::PrefetchRow(row_id_type row_id) {
+  return IOService::GetInstance().Prefetch((Path(folder_path_) / image_labels_vec_[row_id].first).ToString());
+}
+
 void CelebAOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
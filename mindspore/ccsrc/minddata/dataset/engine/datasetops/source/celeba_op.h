@@ -116,6 +116,15 @@ class CelebAOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  // Images are read through the IO service unless they have to be decrypted
+  // @return bool
+  bool IOPrefetchSupported() const override;
+
+  // Submit the read of the image of a row
+  // @param row_id_type row_id - id of the row
+  // @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// Check if need read according to dataset type
   /// @return bool - if need read
   bool CheckDatasetTypeValid();
@@ -24,6 +24,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 
@@ -43,7 +44,7 @@ Status FlickrOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::pair<std::string, std::vector<std::string>> data = image_annotation_pairs_[static_cast<size_t>(row_id)];
   std::shared_ptr<Tensor> image;
   std::shared_ptr<Tensor> annotations;
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(data.first, &image));
+  RETURN_IF_NOT_OK(ReadFile(data.first, &image));
   RETURN_IF_NOT_OK(Tensor::CreateFromVector(data.second, &annotations));
 
   if (decode_ == true) {
@@ -60,6 +61,12 @@ Status FlickrOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+bool FlickrOp::IOPrefetchSupported() const { return true; }
+
+Status FlickrOp::PrefetchRow(row_id_type row_id) {
+  return IOService::GetInstance().Prefetch(image_annotation_pairs_[static_cast<size_t>(row_id)].first);
+}
+
 void FlickrOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -78,6 +78,15 @@ class FlickrOp : public MappableLeafOp {
   /// \return Status - The status code returned
   Status LoadTensorRow(row_id_type index, TensorRow *trow) override;
 
+  /// Images are read through the IO service
+  /// \return bool
+  bool IOPrefetchSupported() const override;
+
+  /// Submit the read of the image of a row
+  /// \param[in] row_id Id of the row.
+  /// \return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// \brief Check if image ia valid.Only support JPEG/PNG/GIF/BMP
   /// \param[in] std::string file_name - image file name need to be checked
   /// \param[out] bool valid - whether the image type is valid
@@ -20,6 +20,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/io_service.h"
 #include "minddata/dataset/util/path.h"
 #include "utils/file_utils.h"
 
@@ -92,7 +93,7 @@ void Food101Op::Print(std::ostream &out, bool show_all) const {
 
 Status Food101Op::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   RETURN_UNEXPECTED_IF_NULL(trow);
-  std::string img_name = (Path(folder_path_) / Path("images") / Path(all_img_lists_[row_id])).ToString() + ".jpg";
+  std::string img_name = ImagePath(row_id);
   std::shared_ptr<Tensor> image;
   std::shared_ptr<Tensor> label;
   std::string label_str;
@@ -111,7 +112,7 @@ Status Food101Op::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
 
 Status Food101Op::ReadImageToTensor(const std::string &image_path, std::shared_ptr<Tensor> *tensor) {
   RETURN_UNEXPECTED_IF_NULL(tensor);
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(image_path, tensor));
+  RETURN_IF_NOT_OK(ReadFile(image_path, tensor));
   if (decode_) {
     Status rc = Decode(*tensor, tensor);
     CHECK_FAIL_RETURN_UNEXPECTED(
@@ -120,6 +121,14 @@ Status Food101Op::ReadImageToTensor(const std::string &image_path, std::shared_p
   return Status::OK();
 }
 
+std::string Food101Op::ImagePath(row_id_type row_id) const {
+  return (Path(folder_path_) / Path("images") / Path(all_img_lists_[row_id])).ToString() + ".jpg";
+}
+
+bool Food101Op::IOPrefetchSupported() const { return true; }
+
+Status Food101Op::PrefetchRow(row_id_type row_id) { return IOService::GetInstance().Prefetch(ImagePath(row_id)); }
+
 // Get dataset size.
 Status Food101Op::CountTotalRows(int64_t *count) {
   RETURN_UNEXPECTED_IF_NULL(count);
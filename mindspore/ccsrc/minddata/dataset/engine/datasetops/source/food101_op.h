@@ -69,11 +69,25 @@ class Food101Op : public MappableLeafOp {
   /// \return The status code returned.
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  /// Images are read through the IO service
+  /// \return bool
+  bool IOPrefetchSupported() const override;
+
+  /// Submit the read of the image of a row
+  /// \param[in] row_id Id of the row.
+  /// \return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// \param[in] image_path Path of image data.
   /// \param[in] tensor Get image tensor.
   /// \return The status code returned.
   Status ReadImageToTensor(const std::string &image_path, std::shared_ptr<Tensor> *tensor);
 
+  /// Get the path of the image of a row.
+  /// \param[in] row_id Row id.
+  /// \return The path of the image.
+  std::string ImagePath(row_id_type row_id) const;
+
   /// Called first when function is called. Get file_name, img_path info from ".txt" files.
   /// \return Status - The status code returned.
   Status PrepareData();
@@ -23,6 +23,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 
 namespace mindspore {
 namespace dataset {
@@ -108,11 +109,15 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   ImageLabelPair pair_ptr = image_label_pairs_[row_id];
   std::shared_ptr<Tensor> image, label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(pair_ptr->second, &label));
+  if (IOPrefetchDepth() > 0) {
+    RETURN_IF_NOT_OK(ReadFile(folder_path_ + (pair_ptr->first), &image));
+  } else {
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
+    RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+    RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
 #endif
+  }
 
   if (decode_ == true) {
     Status rc = Decode(image, &image);
@@ -127,6 +132,18 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+bool ImageFolderOp::IOPrefetchSupported() const {
+#ifdef ENABLE_PYTHON
+  return decrypt_ == nullptr || py::isinstance<py::none>(decrypt_);
+#else
+  return true;
+#endif
+}
+
+Status ImageFolderOp::PrefetchRow(row_id_type row_id) {
+  return IOService::GetInstance().Prefetch(folder_path_ + image_label_pairs_[row_id]->first);
+}
+
 void ImageFolderOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -139,6 +139,15 @@ class ImageFolderOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  /// Images are read through the IO service unless they have to be decrypted
+  /// @return bool
+  bool IOPrefetchSupported() const override;
+
+  /// Submit the read of the image of a row
+  /// @param row_id_type row_id - id of the row
+  /// @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// @param std::string & dir - dir to walk all images
   /// @param int64_t * cnt - number of non folder files under the current dir
   /// @return
@@ -138,7 +138,8 @@ Status LSUNOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::shared_ptr<Tensor> image, label;
   uint32_t label_num = static_cast<uint32_t>(pair_ptr->second);
   RETURN_IF_NOT_OK(Tensor::CreateScalar(label_num, &label));
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+  // the image is read ahead by ImageFolderOp::PrefetchRow
+  RETURN_IF_NOT_OK(ReadFile(folder_path_ + (pair_ptr->first), &image));
 
   if (decode_ == true) {
     Status rc = Decode(image, &image);
@@ -27,6 +27,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 
 namespace mindspore {
 namespace dataset {
@@ -60,7 +61,7 @@ Status ManifestOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
     RETURN_IF_NOT_OK(label->Reshape(TensorShape(std::vector<dsize_t>(1, label_index.size()))));
   }
 
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(data.first, &image));
+  RETURN_IF_NOT_OK(ReadFile(data.first, &image));
   if (decode_ == true) {
     Status rc = Decode(image, &image);
     if (rc.IsError()) {
@@ -74,6 +75,12 @@ Status ManifestOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+bool ManifestOp::IOPrefetchSupported() const { return true; }
+
+Status ManifestOp::PrefetchRow(row_id_type row_id) {
+  return IOService::GetInstance().Prefetch(image_labelname_[static_cast<size_t>(row_id)].first);
+}
+
 void ManifestOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
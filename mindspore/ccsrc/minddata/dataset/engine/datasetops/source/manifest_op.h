@@ -90,6 +90,15 @@ class ManifestOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *trow) override;
 
+  // Images are read through the IO service
+  // @return bool
+  bool IOPrefetchSupported() const override;
+
+  // Submit the read of the image of a row
+  // @param row_id_type row_id - id of the row
+  // @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   // Check if image ia valid.Only support JPEG/PNG/GIF/BMP
   // @return
   Status CheckImageType(const std::string &file_name, bool *valid);
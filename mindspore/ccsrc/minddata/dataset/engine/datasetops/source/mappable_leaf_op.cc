@@ -16,8 +16,10 @@
 #include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "utils/ms_utils.h"
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 
 namespace mindspore {
 namespace dataset {
@@ -26,7 +28,8 @@ MappableLeafOp::MappableLeafOp(int32_t num_wkrs, int32_t queue_size, std::shared
       sample_ids_(nullptr),
       curr_row_(0),
       prepared_data_{false},
-      eof_handled_{false} {}
+      eof_handled_{false},
+      io_prefetch_depth_(GlobalContext::config_manager()->io_prefetch_depth()) {}
 
 #ifdef ENABLE_PYTHON
 Status MappableLeafOp::ImageDecrypt(const std::string &path, std::shared_ptr<Tensor> *tensor,
@@ -70,6 +73,9 @@ Status MappableLeafOp::operator()() {
 
   int64_t ep_step = 0, total_step = 0;
   RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
+  if (IOPrefetchDepth() > 0) {
+    RETURN_IF_NOT_OK(IOService::CreateInstance());
+  }
   TensorRow sample_row;
   RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
   for (;;) {  // each iteration is 1 repeat (usually =1 epoch, unless we have a repeat node above us), breaks when
@@ -80,7 +86,10 @@ Status MappableLeafOp::operator()() {
     }
     while (sample_row.eoe() == false) {
       std::shared_ptr<Tensor> sample_ids = sample_row[0];
+      int64_t dispatched = 0;
+      int64_t prefetched = 0;
       for (auto itr = sample_ids->begin<int64_t>(); itr != sample_ids->end<int64_t>(); ++itr) {
+        RETURN_IF_NOT_OK(PrefetchSamples(sample_ids, dispatched++, &prefetched));
         if ((*itr) >= num_rows_) {
           MS_LOG(WARNING) << "Skipping sample with ID: " << *itr << " since it is out of bound: " << num_rows_;
           continue;  // index out of bound, skipping
@@ -109,6 +118,45 @@ Status MappableLeafOp::operator()() {
   return Status::OK();
 }
 
+Status MappableLeafOp::PrefetchSamples(const TensorPtr &sample_ids, int64_t dispatched, int64_t *prefetched) {
+  RETURN_UNEXPECTED_IF_NULL(prefetched);
+  int32_t depth = IOPrefetchDepth();
+  if (depth <= 0) {
+    return Status::OK();
+  }
+  int64_t end = std::min(dispatched + depth, sample_ids->Size());
+  if (*prefetched >= end) {
+    return Status::OK();
+  }
+  for (; *prefetched < end; ++(*prefetched)) {
+    int64_t row_id = 0;
+    RETURN_IF_NOT_OK(sample_ids->GetItemAt(&row_id, {*prefetched}));
+    if (row_id >= 0 && row_id < num_rows_) {
+      RETURN_IF_NOT_OK(PrefetchRow(row_id));
+    }
+  }
+  // the rows read ahead in this round are submitted together
+  IOService::GetInstance().Flush();
+  return Status::OK();
+}
+
+Status MappableLeafOp::ReadFile(const std::string &path, std::shared_ptr<Tensor> *tensor) {
+  RETURN_UNEXPECTED_IF_NULL(tensor);
+  if (IOPrefetchDepth() <= 0) {
+    return Tensor::CreateFromFile(path, tensor);
+  }
+  RETURN_IF_NOT_OK(IOService::CreateInstance());
+  std::shared_ptr<std::vector<uint8_t>> buffer;
+  Status rc = IOService::GetInstance().Read(path, &buffer);
+  if (rc.IsError()) {
+    // read in the usual way to report the error
+    return Tensor::CreateFromFile(path, tensor);
+  }
+  // the tensor owns the buffer filled by the IO service, no copy is needed
+  return Tensor::CreateFromMemoryNoCopy(TensorShape{static_cast<dsize_t>(buffer->size())},
+                                        DataType(DataType::DE_UINT8), buffer->data(), buffer, tensor);
+}
+
 // Reset Sampler and wakeup Master thread (functor)
 Status MappableLeafOp::Reset() {
   MS_LOG(DEBUG) << Name() << " performing a self-reset.";
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_MAPPABLE_LEAF_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_MAPPABLE_LEAF_OP_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <algorithm>
@@ -81,11 +82,40 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// \return Status The status code returned
   Status GetNextRowPullMode(TensorRow *const row) override;
 
+  /// \brief Number of rows read ahead through the IO service, 0 if the op reads its rows in the workers
+  int32_t IOPrefetchDepth() const { return IOPrefetchSupported() ? io_prefetch_depth_.load() : 0; }
+
+  /// \brief Change the number of rows read ahead, e.g. by AutoTune
+  void SetIOPrefetchDepth(int32_t depth) { io_prefetch_depth_ = depth; }
+
  protected:
   TensorPtr sample_ids_;  // sample id pointer for pull mode
   uint32_t curr_row_;     // current row number count for pull mode
   bool prepared_data_;    // flag to indicate whether the data is prepared before LoadTensorRow for pull mode
   bool eof_handled_;      // T/F if this op got an eof
+  std::atomic<int32_t> io_prefetch_depth_;  // number of rows submitted to the IO service ahead of the workers
+
+  /// Whether the rows can be read through the IO service, ops which load whole files by path override it
+  /// \return bool
+  virtual bool IOPrefetchSupported() const { return false; }
+
+  /// Submit the read of a row which will be handed out to the workers soon
+  /// \param row_id_type row_id - id of the row
+  /// \return Status The status code returned
+  virtual Status PrefetchRow(row_id_type row_id) { return Status::OK(); }
+
+  /// Read ahead the sample ids up to IOPrefetchDepth() rows after the one being dispatched
+  /// \param sample_ids - sample ids from the sampler
+  /// \param dispatched - position of the id being dispatched
+  /// \param prefetched - [in/out] position of the first id not prefetched yet
+  /// \return Status The status code returned
+  Status PrefetchSamples(const TensorPtr &sample_ids, int64_t dispatched, int64_t *prefetched);
+
+  /// Read a whole file into a uint8 tensor, the content comes from the IO service when the op reads ahead
+  /// \param path - path of the file
+  /// \param tensor - [out] the content of the file
+  /// \return Status The status code returned
+  Status ReadFile(const std::string &path, std::shared_ptr<Tensor> *tensor);
 
   /// Initialize Sampler, calls sampler->Init() within
   /// @return Status The status code returned
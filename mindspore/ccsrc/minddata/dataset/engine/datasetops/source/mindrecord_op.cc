@@ -205,11 +205,11 @@ Status MindRecordOp::WorkerEntry(int32_t worker_id) {
 Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, int32_t worker_id) {
   RETURN_UNEXPECTED_IF_NULL(fetched_row);
   *fetched_row = {};
-  auto task_content_ptr = std::make_shared<mindrecord::TASK_CONTENT>(
-    mindrecord::TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, mindrecord::json>>());
+  auto task_content_ptr = std::make_shared<mindrecord::TASK_VIEW_CONTENT>(
+    mindrecord::TaskType::kCommonTask, std::vector<std::tuple<mindrecord::BlobView, mindrecord::json>>());
   RETURN_IF_NOT_OK(shard_reader_->GetNextById(row_id, worker_id, &task_content_ptr));
   auto task_type = task_content_ptr->first;
-  auto tupled_buffer = task_content_ptr->second;
+  const auto &tupled_buffer = task_content_ptr->second;
   if (task_type == mindrecord::TaskType::kPaddedTask) {
     RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, {}, mindrecord::json(), task_type));
     std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
@@ -221,8 +221,8 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
   }
   if (task_type == mindrecord::TaskType::kCommonTask) {
     for (const auto &tupled_row : tupled_buffer) {
-      std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-      mindrecord::json columns_json = std::get<1>(tupled_row);
+      const mindrecord::BlobView &columns_blob = std::get<0>(tupled_row);
+      const mindrecord::json &columns_json = std::get<1>(tupled_row);
       RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob, columns_json, task_type));
       std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
       fetched_row->setPath(file_path);
@@ -233,7 +233,20 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
   return Status::OK();
 }
 
-Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+Status MindRecordOp::CreateNumericTensor(const TensorShape &shape, const DataType &type, const unsigned char *data,
+                                         uint64_t n_bytes, const mindrecord::BlobView &columns_blob,
+                                         std::shared_ptr<Tensor> *tensor) {
+  RETURN_UNEXPECTED_IF_NULL(tensor);
+  bool in_blob = columns_blob.holder != nullptr && data != nullptr && data >= columns_blob.data &&
+                 data + n_bytes <= columns_blob.data + columns_blob.size;
+  bool aligned = type.SizeInBytes() != 0 && reinterpret_cast<uintptr_t>(data) % type.SizeInBytes() == 0;
+  if (in_blob && aligned && static_cast<uint64_t>(shape.NumOfElements()) * type.SizeInBytes() <= n_bytes) {
+    return Tensor::CreateFromMemoryNoCopy(shape, type, data, columns_blob.holder, tensor);
+  }
+  return Tensor::CreateFromMemory(shape, type, data, tensor);
+}
+
+Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const mindrecord::BlobView &columns_blob,
                                    const mindrecord::json &columns_json, const mindrecord::TaskType task_type) {
   RETURN_UNEXPECTED_IF_NULL(tensor_row);
   for (int32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
@@ -271,9 +284,9 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
         data = reinterpret_cast<const unsigned char *>(data_ptr.get());
       }
     } else {
-      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, &data, &data_ptr,
-                                                          &n_bytes, &column_data_type, &column_data_type_size,
-                                                          &column_shape));
+      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob.data, columns_blob.size,
+                                                          columns_json, &data, &data_ptr, &n_bytes, &column_data_type,
+                                                          &column_data_type_size, &column_shape));
     }
 
     std::shared_ptr<Tensor> tensor;
@@ -299,11 +312,11 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
       } else {
         RETURN_IF_NOT_OK(column.MaterializeTensorShape(static_cast<int32_t>(num_elements), &new_shape));
       }
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateNumericTensor(new_shape, type, data, n_bytes, columns_blob, &tensor));
     } else {
       std::vector<dsize_t> shapeDetails = {static_cast<dsize_t>(num_elements)};
       auto new_shape = TensorShape(shapeDetails);
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateNumericTensor(new_shape, type, data, n_bytes, columns_blob, &tensor));
     }
     tensor_row->push_back(std::move(tensor));
   }
@@ -122,11 +122,23 @@ class MindRecordOp : public MappableLeafOp {
 
   /// Parses a single cell and puts the data into a tensor
   /// @param tensor_row - the tensor row to put the parsed data in
-  /// @param columns_blob - the blob data received from the reader
+  /// @param columns_blob - the view of blob data received from the reader
   /// @param columns_json - the data for fields received from the reader
-  Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+  Status LoadTensorRow(TensorRow *tensor_row, const mindrecord::BlobView &columns_blob,
                        const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
 
+  /// Creates a numeric tensor of a column, the tensor refers to the blob without copy when the column is stored
+  /// uncompressed and aligned in the blob
+  /// @param shape - the shape of the tensor
+  /// @param type - the type of the tensor
+  /// @param data - the data of the column
+  /// @param n_bytes - the size of the data
+  /// @param columns_blob - the view of blob data the column comes from
+  /// @param tensor - the created tensor
+  Status CreateNumericTensor(const TensorShape &shape, const DataType &type, const unsigned char *data,
+                             uint64_t n_bytes, const mindrecord::BlobView &columns_blob,
+                             std::shared_ptr<Tensor> *tensor);
+
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override {
     return Status(StatusCode::kMDSyntaxError, "[Internal ERROR] Cannot call this method.");
   }
@@ -23,6 +23,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/io_service.h"
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 
@@ -48,7 +49,7 @@ Status SUN397Op::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::shared_ptr<Tensor> image;
   std::shared_ptr<Tensor> label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(label_num, &label));
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(file_path, &image));
+  RETURN_IF_NOT_OK(ReadFile(file_path, &image));
 
   if (decode_) {
     Status rc = Decode(image, &image);
@@ -62,6 +63,12 @@ Status SUN397Op::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+bool SUN397Op::IOPrefetchSupported() const { return true; }
+
+Status SUN397Op::PrefetchRow(row_id_type row_id) {
+  return IOService::GetInstance().Prefetch(image_path_label_pairs_[row_id].first);
+}
+
 void SUN397Op::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info.
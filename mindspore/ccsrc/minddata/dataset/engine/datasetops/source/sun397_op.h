@@ -84,6 +84,15 @@ class SUN397Op : public MappableLeafOp {
   /// \return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row);
 
+  /// Images are read through the IO service
+  /// \return bool
+  bool IOPrefetchSupported() const override;
+
+  /// Submit the read of the image of a row
+  /// \param[in] row_id Id of the row.
+  /// \return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// \brief The content in the given file path.
   /// \param[in] info_file Info file name.
   /// \param[out] ans Store the content of the info file.
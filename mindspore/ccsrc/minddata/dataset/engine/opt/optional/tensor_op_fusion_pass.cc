@@ -16,54 +16,199 @@
 
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 
+#include <algorithm>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/rescale_ir.h"
+#include "minddata/dataset/kernels/ir/vision/resize_ir.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+using OperationList = std::vector<std::shared_ptr<TensorOperation>>;
+
+// start temporary code, to deal with pre-built TensorOperation
+Status FusePreBuiltDecodeRandomCropResize(const OperationList &matched, OperationList *replacement) {
+  auto fused_op = dynamic_cast<RandomCropAndResizeOp *>(matched[1]->Build().get());
+  RETURN_UNEXPECTED_IF_NULL(fused_op);
+  replacement->push_back(
+    std::make_shared<transforms::PreBuiltOperation>(std::make_shared<RandomCropDecodeResizeOp>(*fused_op, true)));
+  return Status::OK();
+}  // end of temporary code, needs to be deleted when tensorOperation's pybind completes
+
+Status FuseDecodeRandomResizedCrop(const OperationList &matched, OperationList *replacement) {
+  auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>(matched[1].get());
+  RETURN_UNEXPECTED_IF_NULL(fused_ir);
+  replacement->push_back(std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir, true));
+  return Status::OK();
+}
+
+// Decode -> Resize, hint Decode with the size of Resize so that large JPEG images are downscaled while decoding
+Status HintDecodeResize(const OperationList &matched, OperationList *replacement) {
+  auto *decode_ir = dynamic_cast<vision::DecodeOperation *>(matched[0].get());
+  RETURN_UNEXPECTED_IF_NULL(decode_ir);
+  nlohmann::json decode_args;
+  nlohmann::json resize_args;
+  RETURN_IF_NOT_OK(decode_ir->to_json(&decode_args));
+  RETURN_IF_NOT_OK(matched[1]->to_json(&resize_args));
+  RETURN_OK_IF_TRUE(decode_args["device_target"] != "CPU" || resize_args["device_target"] != "CPU");
+  auto size = resize_args["size"].get<std::vector<int32_t>>();
+  RETURN_OK_IF_TRUE(size.empty());
+  // a single value resizes the shorter side, both sides are at least as large as it
+  int32_t height = size[0];
+  int32_t width = size.size() > 1 ? size[1] : size[0];
+  auto hinted = std::make_shared<vision::DecodeOperation>(*decode_ir);
+  hinted->SetTargetSize(height, width);
+  *replacement = {hinted, matched[1]};
+  return Status::OK();
+}
+
+// [Resize | Rescale] -> Normalize -> [HwcToChw] -> [TypeCast]
+// The parameters are read from the json of the operations, which is the same for all of their constructors.
+Status FuseNormalizeChain(const OperationList &matched, OperationList *replacement) {
+  std::vector<std::shared_ptr<TensorOp>> ops;
+  std::shared_ptr<TensorOp> resize_op;
+  float rescale = 1.0;
+  float shift = 0.0;
+  std::vector<float> mean;
+  std::vector<float> std;
+  bool hwc_to_chw = false;
+  DataType output_type(DataType::DE_FLOAT32);
+  for (const auto &operation : matched) {
+    nlohmann::json args;
+    RETURN_IF_NOT_OK(operation->to_json(&args));
+    std::string name = operation->Name();
+    if (name == vision::kResizeOperation) {
+      RETURN_OK_IF_TRUE(args["device_target"] != "CPU");
+    } else if (name == vision::kRescaleOperation) {
+      rescale = args["rescale"];
+      shift = args["shift"];
+    } else if (name == vision::kNormalizeOperation) {
+      // the fused kernel reads <H, W, C> images on CPU only
+      RETURN_OK_IF_TRUE(args["device_target"] != "CPU" || !args["is_hwc"].get<bool>());
+      mean = args["mean"].get<std::vector<float>>();
+      std = args["std"].get<std::vector<float>>();
+    } else if (name == vision::kHwcToChwOperation) {
+      hwc_to_chw = true;
+    } else if (name == transforms::kTypeCastOperation) {
+      output_type = DataType(args["data_type"].get<std::string>());
+      RETURN_OK_IF_TRUE(!FusedNormalizeOp::IsSupportedOutputType(output_type));
+    } else {
+      RETURN_STATUS_UNEXPECTED("[Internal ERROR] TensorOpFusionPass: can not fuse " + name + " with Normalize.");
+    }
+    RETURN_IF_NOT_OK(operation->ValidateParams());
+    auto op = operation->Build();
+    RETURN_UNEXPECTED_IF_NULL(op);
+    if (name == vision::kResizeOperation) {
+      resize_op = op;
+    }
+    ops.push_back(std::move(op));
+  }
+  replacement->push_back(std::make_shared<transforms::PreBuiltOperation>(std::make_shared<FusedNormalizeOp>(
+    std::move(ops), std::move(resize_op), rescale, shift, std::move(mean), std::move(std), hwc_to_chw, output_type)));
+  return Status::OK();
+}
+
+std::vector<TensorOpFusionPass::FusionPattern> BuiltinPatterns() {
+  std::vector<TensorOpFusionPass::FusionPattern> patterns = {
+    {"DecodeRandomCropResize", {kDecodeOp, kRandomCropAndResizeOp}, FusePreBuiltDecodeRandomCropResize},
+    {"DecodeRandomResizedCrop",
+     {vision::kDecodeOperation, vision::kRandomResizedCropOperation},
+     FuseDecodeRandomResizedCrop},
+    // before the Normalize chains, which take Resize in
+    {"DecodeResize", {vision::kDecodeOperation, vision::kResizeOperation}, HintDecodeResize}};
+  // longest chains first, a chain is only fused when Normalize is followed or preceded by another operation
+  const std::vector<std::string> heads = {vision::kResizeOperation, vision::kRescaleOperation, ""};
+  const std::vector<std::vector<std::string>> tails = {
+    {vision::kHwcToChwOperation, transforms::kTypeCastOperation}, {vision::kHwcToChwOperation},
+    {transforms::kTypeCastOperation}, {}};
+  for (const auto &head : heads) {
+    for (const auto &tail : tails) {
+      std::vector<std::string> ops;
+      if (!head.empty()) {
+        ops.push_back(head);
+      }
+      ops.emplace_back(vision::kNormalizeOperation);
+      ops.insert(ops.end(), tail.begin(), tail.end());
+      if (ops.size() < 2) {
+        continue;
+      }
+      std::string name;
+      for (const auto &op : ops) {
+        name += op;
+      }
+      patterns.push_back({name, ops, FuseNormalizeChain});
+    }
+  }
+  return patterns;
+}
+
+std::mutex &PatternMutex() {
+  static std::mutex mux;
+  return mux;
+}
+
+std::vector<TensorOpFusionPass::FusionPattern> &Patterns() {
+  static std::vector<TensorOpFusionPass::FusionPattern> patterns = BuiltinPatterns();
+  return patterns;
+}
+}  // namespace
+
+void TensorOpFusionPass::RegisterPattern(FusionPattern pattern) {
+  std::lock_guard<std::mutex> lock(PatternMutex());
+  Patterns().push_back(std::move(pattern));
+}
+
+std::vector<TensorOpFusionPass::FusionPattern> TensorOpFusionPass::GetPatterns() {
+  std::lock_guard<std::mutex> lock(PatternMutex());
+  return Patterns();
+}
 
 Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
   RETURN_UNEXPECTED_IF_NULL(modified);
   std::vector<std::shared_ptr<TensorOperation>> ops = node->operations();
-
-  // start temporary code, to deal with pre-built TensorOperation
-  std::vector<std::string> pattern = {kDecodeOp, kRandomCropAndResizeOp};
-  auto itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
-                         [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
-  if (itr != ops.end()) {
-    MS_LOG(WARNING) << "Fusing pre-build Decode and RandomCropResize into one pre-build.";
-    auto fused_op = dynamic_cast<RandomCropAndResizeOp *>((*(itr + 1))->Build().get());
-    RETURN_UNEXPECTED_IF_NULL(fused_op);
-    (*itr) = std::make_shared<transforms::PreBuiltOperation>(std::make_shared<RandomCropDecodeResizeOp>(*fused_op));
-    ops.erase(itr + 1);
+  bool fused_any = false;
+  for (const auto &pattern : GetPatterns()) {
+    auto itr = ops.begin();
+    while (true) {
+      itr = std::search(itr, ops.end(), pattern.ops.begin(), pattern.ops.end(),
+                        [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
+      if (itr == ops.end()) {
+        break;
+      }
+      auto matched_end = itr + static_cast<std::ptrdiff_t>(pattern.ops.size());
+      OperationList replacement;
+      RETURN_IF_NOT_OK(pattern.fuse(OperationList(itr, matched_end), &replacement));
+      if (replacement.empty()) {
+        ++itr;
+        continue;
+      }
+      MS_LOG(INFO) << "Fusing " << pattern.name << " into " << replacement.size() << " operations in Map.";
+      // continue after the replacement, it may still match the pattern
+      itr = ops.erase(itr, matched_end);
+      itr = ops.insert(itr, replacement.begin(), replacement.end());
+      itr += static_cast<std::ptrdiff_t>(replacement.size());
+      fused_any = true;
+    }
+  }
+  if (fused_any) {
     node->setOperations(ops);
     *modified = true;
-    return Status::OK();
-  }  // end of temporary code, needs to be deleted when tensorOperation's pybind completes
-
-  // logic below is for non-prebuilt TensorOperation
-  pattern = {vision::kDecodeOperation, vision::kRandomResizedCropOperation};
-  itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
-                    [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
-
-  // return here if no pattern is found
-  RETURN_OK_IF_TRUE(itr == ops.end());
-  auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
-  RETURN_UNEXPECTED_IF_NULL(fused_ir);
-  // fuse the two ops
-  (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
-  ops.erase(itr + 1);
-  node->setOperations(ops);
-  *modified = true;
+  }
   return Status::OK();
 }
 }  // namespace dataset
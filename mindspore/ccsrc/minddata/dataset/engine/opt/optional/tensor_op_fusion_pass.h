@@ -16,16 +16,45 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
+
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
 namespace dataset {
+class TensorOperation;
 
 /// \class TensorOpFusionPass tensor_op_fusion_pass.h
 /// \brief And optional optimization pass identifying and fusing
 ///     tensor ops within MapOp
 class TensorOpFusionPass : public IRNodePass {
+ public:
+  /// \brief Function rewriting the operations matched by a pattern, usually into one fused operation. It leaves
+  ///     *replacement empty when the parameters of the matched operations can't be fused, and the next pattern is
+  ///     tried.
+  using FuseFunc = std::function<Status(const std::vector<std::shared_ptr<TensorOperation>> &matched,
+                                        std::vector<std::shared_ptr<TensorOperation>> *replacement)>;
+
+  /// \brief A sequence of operation names and the function rewriting them
+  struct FusionPattern {
+    std::string name;
+    std::vector<std::string> ops;
+    FuseFunc fuse;
+  };
+
+  /// \brief Register a fusion pattern, patterns are tried in the order of registration so longer patterns sharing a
+  ///     prefix with shorter ones should be registered first
+  /// \param[in] pattern The pattern to register
+  static void RegisterPattern(FusionPattern pattern);
+
+  /// \brief Get the registered fusion patterns, including the built-in ones
+  /// \return The patterns in the order they are tried
+  static std::vector<FusionPattern> GetPatterns();
+
+ private:
   /// \brief Identifies and fuses tensor ops within MapOp
   /// \param[in] node The node being visited
   /// \param[in, out] *modified indicates whether the node has been visited
@@ -24,6 +24,7 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/serdes.h"
@@ -583,6 +584,34 @@ Status AutoTune::RequestConnectorCapacityChange(int32_t op_id, int32_t old_size,
   return Status::OK();
 }
 
+Status AutoTune::RequestIOPrefetchDepthChange(int32_t op_id, int32_t old_depth, int32_t new_depth) {
+  AT_change_ = true;
+  new_depth = std::min(new_depth, MAX_IO_PREFETCH_DEPTH);
+  RETURN_IF_NOT_OK(
+    tree_modifier_->AddChangeRequest(op_id, std::make_shared<ChangeIOPrefetchDepthRequest>(new_depth)));
+  MS_LOG(INFO) << "Added request to change \"io_prefetch_depth\" of Operator: " << ops_[op_id]->NameWithID()
+               << "From old value: [" << old_depth << "] to new value: [" << new_depth << "].";
+  return Status::OK();
+}
+
+Status AutoTune::AnalyseIOPrefetch(int32_t op_id, double output_queue_util) {
+  auto leaf_op = std::dynamic_pointer_cast<MappableLeafOp>(ops_[op_id]);
+  if (leaf_op == nullptr) {
+    return Status::OK();
+  }
+  // read-ahead is only tuned when it is enabled
+  int32_t depth = leaf_op->IOPrefetchDepth();
+  if (depth <= 0 || depth >= MAX_IO_PREFETCH_DEPTH) {
+    return Status::OK();
+  }
+  if (output_queue_util < INPUT_QUEUE_LOW) {
+    MS_LOG(INFO) << "Op (" << leaf_op->NameWithID() << ") is waiting for IO, output connector utilization="
+                 << output_queue_util << " < " << INPUT_QUEUE_LOW << " threshold.";
+    RETURN_IF_NOT_OK(RequestIOPrefetchDepthChange(op_id, depth, depth * IO_PREFETCH_DEPTH_SCALE));
+  }
+  return Status::OK();
+}
+
 bool AutoTune::SkipOpsCheck(int op_id) {
   // Skip Generator op
   if (ops_[op_id]->Name() == "GeneratorOp") {
@@ -631,6 +660,9 @@ Status AutoTune::AnalyseTime() {
     int32_t requested_workers = 0;
     MS_LOG(DEBUG) << "Op (" << ops_[op_id]->NameWithID() << ") CPU=" << cpu_util / num_workers
                   << ", in=" << input_queue_util << "out=" << output_queue_util;
+    if (op_id == leaf_op_id_) {
+      RETURN_IF_NOT_OK(AnalyseIOPrefetch(op_id, output_queue_util));
+    }
     // map decisions - queue
     if (queue_diff > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD) {
       MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID()
@@ -141,6 +141,9 @@ class AutoTune {
   const float_t LEAF_QUEUE_THRESHOLD = 0.9;
   const float_t INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD = 0.35;
   const int64_t INCREMENT_QUEUE_SIZE = 4;
+  // IO read-ahead specifics
+  const int32_t IO_PREFETCH_DEPTH_SCALE = 2;
+  const int32_t MAX_IO_PREFETCH_DEPTH = 256;
   // CPU Specifics
   const float_t MAP_OP_WORKER_HIGH_THRESHOLD = 75;
   const float_t MAP_OP_WORKER_LOW_THRESHOLD = 35;
@@ -206,6 +209,19 @@ class AutoTune {
   /// \return Status code
   Status RequestConnectorCapacityChange(int32_t op_id, int32_t old_size, int32_t new_size);
 
+  /// Send a ChangeRequest to the leaf op to change the number of rows it reads ahead through the IO service
+  /// \param[in] op_id leaf op ID
+  /// \param[in] old_depth old read-ahead depth
+  /// \param[in] new_depth new read-ahead depth
+  /// \return Status code
+  Status RequestIOPrefetchDepthChange(int32_t op_id, int32_t old_depth, int32_t new_depth);
+
+  /// Deepen the read-ahead of the leaf op when it can't keep its output connector filled
+  /// \param[in] op_id leaf op ID
+  /// \param[in] output_queue_util utilization of the output connector of the leaf op
+  /// \return Status code
+  Status AnalyseIOPrefetch(int32_t op_id, double output_queue_util);
+
   /// Track the pipeline time of the current epoch into avg_pipeline_times_
   /// \return Status code
   Status TrackPipelineTime();
@@ -16,6 +16,8 @@
 
 #include "minddata/dataset/engine/tree_modifier.h"
 
+#include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
+
 namespace mindspore {
 namespace dataset {
 Status AutotuneCallback::DSNStepBegin(const CallbackParam &cb_param) {
@@ -65,6 +67,14 @@ Status ChangeNumWorkersRequest::ApplyChange(DatasetOp *op) {
   return Status::OK();
 }
 
+Status ChangeIOPrefetchDepthRequest::ApplyChange(DatasetOp *op) {
+  auto leaf_op = dynamic_cast<MappableLeafOp *>(op);
+  CHECK_FAIL_RETURN_UNEXPECTED(leaf_op != nullptr, "[Internal ERROR] Only mappable leaf op reads ahead, but got: " +
+                                                     op->NameWithID());
+  leaf_op->SetIOPrefetchDepth(depth_);
+  return Status::OK();
+}
+
 TreeModifier::TreeModifier(const TreeAdapter *adapter) : TreeModifier(adapter->tree_.get()) {}
 }  // namespace dataset
 }  // namespace mindspore
@@ -86,6 +86,23 @@ class ResizeConnectorRequest : public ChangeRequest {
   int32_t new_size_;
 };
 
+/// ChangeRequest to change the number of rows a mappable leaf op reads ahead through the IO service.
+class ChangeIOPrefetchDepthRequest : public ChangeRequest {
+ public:
+  /// Constructor
+  /// \param depth new read-ahead depth.
+  explicit ChangeIOPrefetchDepthRequest(int32_t depth) : depth_(depth) {}
+  virtual ~ChangeIOPrefetchDepthRequest() = default;
+
+  /// Actual change to the read-ahead depth of the given operator
+  /// \param op pointer to the operator that the change will be applied on
+  /// \return Status return Status code
+  Status ApplyChange(DatasetOp *op) override;
+
+ private:
+  int32_t depth_;
+};
+
 /// A callback class used by Aututune to queue changes for operators
 class AutotuneCallback : public DSCallback {
  public:
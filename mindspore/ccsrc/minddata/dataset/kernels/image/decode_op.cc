@@ -35,6 +35,9 @@ DecodeOp::DecodeOp(bool rgb) : is_rgb_format_(rgb) {
   }
 }
 
+DecodeOp::DecodeOp(bool rgb, int32_t target_height, int32_t target_width)
+    : is_rgb_format_(rgb), target_height_(target_height), target_width_(target_width) {}
+
 Status DecodeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   // check the input tensor shape
@@ -43,7 +46,11 @@ Status DecodeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
                              std::to_string(input->Rank()));
   }
   if (is_rgb_format_) {  // RGB color mode
+#ifndef ENABLE_ANDROID
+    return Decode(input, output, target_height_, target_width_);
+#else
     return Decode(input, output);
+#endif
   } else {  // BGR color mode
     RETURN_STATUS_UNEXPECTED(
       "Decode: only support Decoded into RGB image, check input parameter 'rgb' first, its value should be 'True'.");
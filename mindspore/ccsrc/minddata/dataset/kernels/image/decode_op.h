@@ -33,6 +33,10 @@ class DecodeOp : public TensorOp {
 
   explicit DecodeOp(bool rgb = true);
 
+  // Constructor with the size the image will be resized to, hinted by the optimizer when Decode is followed by
+  // Resize. JPEG images much larger than it are downscaled while decoding.
+  DecodeOp(bool rgb, int32_t target_height, int32_t target_width);
+
   ~DecodeOp() override = default;
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
@@ -45,6 +49,8 @@ class DecodeOp : public TensorOp {
 
  private:
   bool is_rgb_format_ = true;
+  int32_t target_height_ = 0;
+  int32_t target_width_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
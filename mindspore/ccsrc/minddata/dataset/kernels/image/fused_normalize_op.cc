@@ -0,0 +1,168 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+
+#include <utility>
+
+#include "minddata/dataset/kernels/image/image_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// T is the type of the input image, O is the type of the output
+template <typename T, typename O>
+void NormalizePixels(const T *src, O *dst, int64_t num_pixels, int64_t num_channels, float rescale, float shift,
+                     const std::vector<float> &mean, const std::vector<float> &std, bool hwc_to_chw) {
+  // same arithmetic as Rescale followed by Normalize, so the fused result matches the unfused one
+  for (int64_t pixel = 0; pixel < num_pixels; ++pixel) {
+    const T *in = src + pixel * num_channels;
+    for (int64_t channel = 0; channel < num_channels; ++channel) {
+      float value = static_cast<float>(in[channel]) * rescale + shift;
+      value = (value - mean[channel]) / std[channel];
+      int64_t index = hwc_to_chw ? channel * num_pixels + pixel : pixel * num_channels + channel;
+      dst[index] = static_cast<O>(value);
+    }
+  }
+}
+
+template <typename T>
+Status NormalizePixelsTo(const std::shared_ptr<Tensor> &input, const std::shared_ptr<Tensor> &output,
+                         int64_t num_pixels, int64_t num_channels, float rescale, float shift,
+                         const std::vector<float> &mean, const std::vector<float> &std, bool hwc_to_chw) {
+  const auto *src = reinterpret_cast<const T *>(input->GetBuffer());
+  switch (output->type().value()) {
+    case DataType::DE_FLOAT16:
+      NormalizePixels(src, reinterpret_cast<float16 *>(output->GetMutableBuffer()), num_pixels, num_channels,
+                      rescale, shift, mean, std, hwc_to_chw);
+      break;
+    case DataType::DE_FLOAT32:
+      NormalizePixels(src, reinterpret_cast<float *>(output->GetMutableBuffer()), num_pixels, num_channels, rescale,
+                      shift, mean, std, hwc_to_chw);
+      break;
+    case DataType::DE_FLOAT64:
+      NormalizePixels(src, reinterpret_cast<double *>(output->GetMutableBuffer()), num_pixels, num_channels, rescale,
+                      shift, mean, std, hwc_to_chw);
+      break;
+    default:
+      RETURN_STATUS_UNEXPECTED("[Internal ERROR] FusedNormalize: unsupported output type: " +
+                               output->type().ToString());
+  }
+  return Status::OK();
+}
+}  // namespace
+
+FusedNormalizeOp::FusedNormalizeOp(std::vector<std::shared_ptr<TensorOp>> ops, std::shared_ptr<TensorOp> resize_op,
+                                   float rescale, float shift, std::vector<float> mean, std::vector<float> std,
+                                   bool hwc_to_chw, const DataType &output_type)
+    : ops_(std::move(ops)),
+      resize_op_(std::move(resize_op)),
+      rescale_(rescale),
+      shift_(shift),
+      mean_(std::move(mean)),
+      std_(std::move(std)),
+      hwc_to_chw_(hwc_to_chw),
+      output_type_(output_type) {}
+
+bool FusedNormalizeOp::IsSupportedOutputType(const DataType &type) {
+  return type == DataType::DE_FLOAT16 || type == DataType::DE_FLOAT32 || type == DataType::DE_FLOAT64;
+}
+
+bool FusedNormalizeOp::CanFuse(const std::shared_ptr<Tensor> &input) const {
+  if (input->Rank() != kDefaultImageRank) {
+    return false;
+  }
+  if (input->type() != DataType::DE_UINT8 && input->type() != DataType::DE_FLOAT32) {
+    return false;
+  }
+  // a single mean and std value is applied to all the channels
+  auto num_channels = static_cast<size_t>(input->shape()[kChannelIndexHWC]);
+  return !mean_.empty() && mean_.size() == std_.size() && (mean_.size() == 1 || mean_.size() == num_channels);
+}
+
+Status FusedNormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  if (!CanFuse(input)) {
+    std::shared_ptr<Tensor> in = input;
+    for (const auto &op : ops_) {
+      std::shared_ptr<Tensor> out;
+      RETURN_IF_NOT_OK(op->Compute(in, &out));
+      in = std::move(out);
+    }
+    *output = std::move(in);
+    return Status::OK();
+  }
+  if (resize_op_ == nullptr) {
+    return NormalizeImage(input, output);
+  }
+  std::shared_ptr<Tensor> resized;
+  RETURN_IF_NOT_OK(resize_op_->Compute(input, &resized));
+  return NormalizeImage(resized, output);
+}
+
+Status FusedNormalizeOp::NormalizeImage(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  dsize_t height = input->shape()[0];
+  dsize_t width = input->shape()[1];
+  dsize_t num_channels = input->shape()[kChannelIndexHWC];
+  std::vector<float> mean = mean_;
+  std::vector<float> std = std_;
+  if (mean.size() == 1) {
+    mean.resize(num_channels, mean_[0]);
+    std.resize(num_channels, std_[0]);
+  }
+  TensorShape shape = hwc_to_chw_ ? TensorShape({num_channels, height, width})
+                                  : TensorShape({height, width, num_channels});
+  std::shared_ptr<Tensor> out;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, output_type_, &out));
+  if (input->type() == DataType::DE_UINT8) {
+    RETURN_IF_NOT_OK(NormalizePixelsTo<uint8_t>(input, out, height * width, num_channels, rescale_, shift_, mean,
+                                                std, hwc_to_chw_));
+  } else {
+    RETURN_IF_NOT_OK(
+      NormalizePixelsTo<float>(input, out, height * width, num_channels, rescale_, shift_, mean, std, hwc_to_chw_));
+  }
+  *output = std::move(out);
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  CHECK_FAIL_RETURN_UNEXPECTED(!inputs.empty(), "FusedNormalize: inputs cannot be empty.");
+  // the fused kernel writes the shape the original ops do: Resize resizes, HWC2CHW transposes, the others keep it
+  for (const auto &op : ops_) {
+    std::vector<TensorShape> op_inputs = std::move(outputs);
+    outputs.clear();
+    RETURN_IF_NOT_OK(op->OutputShape(op_inputs, outputs));
+  }
+  return Status::OK();
+}
+
+// Normalize writes float32 whatever the input type is, so the output type is the one of TypeCast or float32
+Status FusedNormalizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  CHECK_FAIL_RETURN_UNEXPECTED(!inputs.empty(), "FusedNormalize: inputs cannot be empty.");
+  outputs[0] = output_type_;
+  return Status::OK();
+}
+
+void FusedNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ", fused: {";
+  for (const auto &op : ops_) {
+    out << op->Name() << ", ";
+  }
+  out << "}" << std::endl;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,80 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// Fused kernel of [Resize | Rescale] -> Normalize -> [HWC2CHW] -> [TypeCast] created by the TensorOpFusionPass.
+// The rescaled and normalized value of each pixel is transposed and cast while it is written, so neither the float
+// image nor its transposed copy is materialized. Inputs the fused kernel does not handle run through the original ops.
+class FusedNormalizeOp : public TensorOp {
+ public:
+  // Constructor
+  // @param ops - The original ops, run one by one for the inputs which can't be fused
+  // @param resize_op - The Resize op run before normalizing, nullptr if there is none
+  // @param rescale - Rescale factor applied before normalizing, 1 if there is no Rescale
+  // @param shift - Shift applied before normalizing, 0 if there is no Rescale
+  // @param mean - Mean of Normalize
+  // @param std - Std of Normalize
+  // @param hwc_to_chw - Whether the output is transposed to <C, H, W>
+  // @param output_type - Type of the output, float16, float32 or float64
+  FusedNormalizeOp(std::vector<std::shared_ptr<TensorOp>> ops, std::shared_ptr<TensorOp> resize_op, float rescale,
+                   float shift, std::vector<float> mean, std::vector<float> std, bool hwc_to_chw,
+                   const DataType &output_type);
+
+  ~FusedNormalizeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kFusedNormalizeOp; }
+
+  // @return Whether the fused kernel can write the given type
+  static bool IsSupportedOutputType(const DataType &type);
+
+ private:
+  // @return Whether the fused kernel handles the input, otherwise it runs through the original ops
+  bool CanFuse(const std::shared_ptr<Tensor> &input) const;
+
+  // Rescale, normalize, transpose and cast a <H, W, C> image in one pass
+  Status NormalizeImage(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+
+  std::vector<std::shared_ptr<TensorOp>> ops_;
+  std::shared_ptr<TensorOp> resize_op_;
+  float rescale_;
+  float shift_;
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  bool hwc_to_chw_;
+  DataType output_type_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
@@ -18,6 +18,7 @@
 #include <opencv2/imgproc/types_c.h>
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <limits>
 #include <stdexcept>
@@ -336,12 +337,19 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input) {
   return input->SizeInBytes() > kPngMagicLen && memcmp(input->GetBuffer(), kPngMagic, kPngMagicLen) == 0;
 }
 
-Status Decode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+Status Decode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int32_t target_height,
+              int32_t target_width) {
   RETURN_IF_NOT_OK(CheckUnsupportedImage(input));
 
   Status ret;
   if (IsNonEmptyJPEG(input)) {
-    ret = JpegCropAndDecode(input, output);
+    int scale_denom = 1;
+    int height = 0;
+    int width = 0;
+    if (target_height > 0 && target_width > 0 && GetJpegImageInfo(input, &width, &height).IsOk()) {
+      scale_denom = GetJpegScaleDenom(height, width, target_height, target_width);
+    }
+    ret = JpegCropAndDecode(input, output, 0, 0, 0, 0, scale_denom);
   } else {
     ret = DecodeCv(input, output);
   }
@@ -517,8 +525,24 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
     STATUS_ERROR(StatusCode::kMDUnexpectedError, "Error raised by libjpeg: " + std::string(jpeg_error_msg)));
 }
 
+int GetJpegScaleDenom(int height, int width, int target_height, int target_width) {
+  // libjpeg has fast inverse DCT for these reductions, the scaled image covers ceil(size / denom) pixels
+  constexpr std::array<int, 3> kScaleDenoms = {8, 4, 2};
+  if (target_height <= 0 || target_width <= 0) {
+    return 1;
+  }
+  for (int denom : kScaleDenoms) {
+    if ((height + denom - 1) / denom >= target_height && (width + denom - 1) / denom >= target_width) {
+      return denom;
+    }
+  }
+  return 1;
+}
+
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+                         int crop_w, int crop_h, int scale_denom) {
+  CHECK_FAIL_RETURN_UNEXPECTED(scale_denom > 0, "JpegCropAndDecode: scale_denom should be positive, but got: " +
+                                                  std::to_string(scale_denom));
   struct jpeg_decompress_struct cinfo {};
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -532,6 +556,8 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = static_cast<unsigned int>(scale_denom);
     jpeg_calc_output_dimensions(&cinfo);
     RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
   } catch (std::runtime_error &e) {
@@ -159,7 +159,11 @@ Status Resize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *out
 /// supported by opencv, if user need more image analysis capabilities, please compile opencv particularlly.
 /// \param input: CVTensor containing the not decoded image 1D bytes
 /// \param output: Decoded image Tensor of shape <H,W,C> and type DE_UINT8. Pixel order is RGB
-Status Decode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+/// \param target_height: Height the image will be resized to, 0 if unknown. JPEG images much larger than the target
+///     size are downscaled while decoding, and are still at least as large as the target size
+/// \param target_width: Width the image will be resized to, 0 if unknown
+Status Decode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int32_t target_height = 0,
+              int32_t target_width = 0);
 
 Status DecodeCv(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
 
@@ -169,8 +173,18 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input);
 
 void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size);
 
+/// \brief Returns the largest JPEG DCT scaling denominator (1, 2, 4 or 8) keeping the image no smaller than the target
+/// \param height: Height of the image, or of the region to decode
+/// \param width: Width of the image, or of the region to decode
+/// \param target_height: Height the decoded image will be resized to, 0 if unknown
+/// \param target_width: Width the decoded image will be resized to, 0 if unknown
+int GetJpegScaleDenom(int height, int width, int target_height, int target_width);
+
+/// \brief Decode a crop of a JPEG image
+/// \param scale_denom: The image is downscaled by 1 / scale_denom in the DCT domain while decoding, the crop box is in
+///     the coordinates of the downscaled image
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
-                         int w = 0, int h = 0);
+                         int w = 0, int h = 0, int scale_denom = 1);
 
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
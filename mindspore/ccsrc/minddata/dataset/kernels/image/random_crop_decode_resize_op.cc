@@ -25,9 +25,11 @@ namespace mindspore {
 namespace dataset {
 RandomCropDecodeResizeOp::RandomCropDecodeResizeOp(int32_t target_height, int32_t target_width, float scale_lb,
                                                    float scale_ub, float aspect_lb, float aspect_ub,
-                                                   InterpolationMode interpolation, int32_t max_attempts)
+                                                   InterpolationMode interpolation, int32_t max_attempts,
+                                                   bool jpeg_downscale)
     : RandomCropAndResizeOp(target_height, target_width, scale_lb, scale_ub, aspect_lb, aspect_ub, interpolation,
-                            max_attempts) {}
+                            max_attempts),
+      jpeg_downscale_(jpeg_downscale) {}
 
 Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
@@ -54,8 +56,15 @@ Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *outp
       if (i == 0) {
         RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
       }
+      int scale_denom = jpeg_downscale_ ? GetJpegScaleDenom(crop_height, crop_width, target_height_, target_width_) : 1;
+      // map the crop box to the downscaled image, which covers ceil(size / scale_denom) pixels
+      int scaled_x = x / scale_denom;
+      int scaled_y = y / scale_denom;
+      int scaled_width = (x + crop_width + scale_denom - 1) / scale_denom - scaled_x;
+      int scaled_height = (y + crop_height + scale_denom - 1) / scale_denom - scaled_y;
       std::shared_ptr<Tensor> decoded_tensor = nullptr;
-      RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, x, y, crop_width, crop_height));
+      RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, scaled_x, scaled_y, scaled_width, scaled_height,
+                                         scale_denom));
       RETURN_IF_NOT_OK(Resize(decoded_tensor, &(*output)[i], target_height_, target_width_, 0.0, 0.0, interpolation_));
     }
   }
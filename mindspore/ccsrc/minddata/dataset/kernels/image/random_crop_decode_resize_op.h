@@ -33,9 +33,13 @@ namespace dataset {
 class RandomCropDecodeResizeOp : public RandomCropAndResizeOp {
  public:
   RandomCropDecodeResizeOp(int32_t target_height, int32_t target_width, float scale_lb, float scale_ub, float aspect_lb,
-                           float aspect_ub, InterpolationMode interpolation, int32_t max_attempts);
+                           float aspect_ub, InterpolationMode interpolation, int32_t max_attempts,
+                           bool jpeg_downscale = false);
 
-  explicit RandomCropDecodeResizeOp(const RandomCropAndResizeOp &rhs) : RandomCropAndResizeOp(rhs) {}
+  // @param rhs - The RandomCropAndResizeOp to fuse with Decode
+  // @param jpeg_downscale - Whether JPEG crops much larger than the target size are downscaled while decoding
+  explicit RandomCropDecodeResizeOp(const RandomCropAndResizeOp &rhs, bool jpeg_downscale = false)
+      : RandomCropAndResizeOp(rhs), jpeg_downscale_(jpeg_downscale) {}
 
   ~RandomCropDecodeResizeOp() override = default;
 
@@ -46,6 +50,9 @@ class RandomCropDecodeResizeOp : public RandomCropAndResizeOp {
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
   std::string Name() const override { return kRandomCropDecodeResizeOp; }
+
+ private:
+  bool jpeg_downscale_ = false;
 };
 }  // namespace dataset
 }  // namespace mindspore
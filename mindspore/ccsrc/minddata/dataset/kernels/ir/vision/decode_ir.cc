@@ -44,7 +44,7 @@ Status DecodeOperation::ValidateParams() {
 
 std::shared_ptr<TensorOp> DecodeOperation::Build() {
   if (device_target_ == "CPU") {
-    return std::make_shared<DecodeOp>(rgb_);
+    return std::make_shared<DecodeOp>(rgb_, target_height_, target_width_);
 #if !defined(BUILD_LITE) && defined(ENABLE_D)
   } else if (device_target_ == "Ascend") {
     return std::make_shared<DvppDecodeOp>();
@@ -49,9 +49,19 @@ class DecodeOperation : public TensorOperation {
 
   MapTargetDevice Type() override;
 
+  /// \brief Set the size the image will be resized to, used by the optimizer when Decode is followed by Resize.
+  /// \param[in] height Height of the resized image.
+  /// \param[in] width Width of the resized image.
+  void SetTargetSize(int32_t height, int32_t width) {
+    target_height_ = height;
+    target_width_ = width;
+  }
+
  private:
   bool rgb_;
   std::string device_target_;  // CPU, Ascend
+  int32_t target_height_ = 0;
+  int32_t target_width_ = 0;
 };
 }  // namespace vision
 }  // namespace dataset
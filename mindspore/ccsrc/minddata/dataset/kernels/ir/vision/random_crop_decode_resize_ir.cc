@@ -57,14 +57,16 @@ std::shared_ptr<TensorOp> RandomCropDecodeResizeOperation::Build() {
   float aspect_lower_bound = ratio_[dimension_zero];
   float aspect_upper_bound = ratio_[dimension_one];
 
-  auto tensor_op =
-    std::make_shared<RandomCropDecodeResizeOp>(crop_height, crop_width, scale_lower_bound, scale_upper_bound,
-                                               aspect_lower_bound, aspect_upper_bound, interpolation_, max_attempts_);
+  auto tensor_op = std::make_shared<RandomCropDecodeResizeOp>(crop_height, crop_width, scale_lower_bound,
+                                                              scale_upper_bound, aspect_lower_bound,
+                                                              aspect_upper_bound, interpolation_, max_attempts_,
+                                                              jpeg_downscale_);
   return tensor_op;
 }
 
-RandomCropDecodeResizeOperation::RandomCropDecodeResizeOperation(const RandomResizedCropOperation &base)
-    : RandomResizedCropOperation(base) {}
+RandomCropDecodeResizeOperation::RandomCropDecodeResizeOperation(const RandomResizedCropOperation &base,
+                                                                 bool jpeg_downscale)
+    : RandomResizedCropOperation(base), jpeg_downscale_(jpeg_downscale) {}
 
 Status RandomCropDecodeResizeOperation::to_json(nlohmann::json *out_json) {
   RETURN_UNEXPECTED_IF_NULL(out_json);
@@ -39,7 +39,10 @@ class RandomCropDecodeResizeOperation : public RandomResizedCropOperation {
                                   const std::vector<float> &ratio, InterpolationMode interpolation,
                                   int32_t max_attempts);
 
-  explicit RandomCropDecodeResizeOperation(const RandomResizedCropOperation &base);
+  /// \brief Constructor fusing Decode with RandomResizedCrop.
+  /// \param[in] base The RandomResizedCrop to fuse.
+  /// \param[in] jpeg_downscale Whether JPEG crops much larger than the target size are downscaled while decoding.
+  explicit RandomCropDecodeResizeOperation(const RandomResizedCropOperation &base, bool jpeg_downscale = false);
 
   ~RandomCropDecodeResizeOperation() override;
 
@@ -50,6 +53,9 @@ class RandomCropDecodeResizeOperation : public RandomResizedCropOperation {
   Status to_json(nlohmann::json *out_json) override;
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
+
+ private:
+  bool jpeg_downscale_ = false;
 };
 }  // namespace vision
 }  // namespace dataset
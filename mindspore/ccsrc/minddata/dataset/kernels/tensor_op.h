@@ -98,6 +98,7 @@ constexpr char kDvppResizedCropOp[] = "DvppResizedCropOp";
 constexpr char kDvppVerticalFlipOp[] = "DvppVerticalFlipOp";
 constexpr char kEqualizeOp[] = "EqualizeOp";
 constexpr char kEraseOp[] = "EraseOp";
+constexpr char kFusedNormalizeOp[] = "FusedNormalizeOp";
 constexpr char kGaussianBlurOp[] = "GaussianBlurOp";
 constexpr char kHorizontalFlipOp[] = "HorizontalFlipOp";
 constexpr char kHwcToChwOp[] = "HWC2CHWOp";
@@ -0,0 +1,625 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/io_service.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <thread>
+#include <utility>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__) && !defined(__ANDROID__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(IORING_FEAT_SINGLE_MMAP)
+#define MD_ENABLE_IO_URING
+#endif
+#endif
+#endif
+
+#include "./securec.h"
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/services.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int32_t kIOThreadNum = 4;
+#ifdef MD_ENABLE_IO_URING
+constexpr uint32_t kIOUringEntries = 128;
+#endif
+}  // namespace
+
+IOService *IOService::instance_ = nullptr;
+std::once_flag IOService::init_instance_flag_;
+
+/// Reads on a pool of threads, used when io_uring is not available.
+class ThreadEngine : public IOService::Engine {
+ public:
+  ThreadEngine(IOService *service, int32_t num_threads) : service_(service), num_threads_(num_threads) {}
+  ~ThreadEngine() override { (void)Stop(); }
+
+  Status Start() override {
+    for (int32_t i = 0; i < num_threads_; ++i) {
+      (void)threads_.emplace_back([this]() { Loop(); });
+    }
+    return Status::OK();
+  }
+
+  Status Stop() override {
+    {
+      std::unique_lock<std::mutex> lck(mux_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &thread : threads_) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+    threads_.clear();
+    return Status::OK();
+  }
+
+  bool Submit(IOService::IORequest *request) override {
+    {
+      std::unique_lock<std::mutex> lck(mux_);
+      if (stop_) {
+        return false;
+      }
+      queue_.push_back(request);
+    }
+    cv_.notify_one();
+    return true;
+  }
+
+  std::string Name() const override { return "thread"; }
+
+ private:
+  void Loop() {
+    while (true) {
+      IOService::IORequest *request = nullptr;
+      {
+        std::unique_lock<std::mutex> lck(mux_);
+        cv_.wait(lck, [this]() { return stop_ || !queue_.empty(); });
+        // drain the queue before quitting so that no reader waits forever
+        if (queue_.empty()) {
+          return;
+        }
+        request = queue_.front();
+        queue_.pop_front();
+      }
+      Status rc = IOService::ReadSync(request);
+      service_->Complete(request, rc.IsOk());
+    }
+  }
+
+  IOService *service_;
+  int32_t num_threads_;
+  bool stop_ = false;
+  std::mutex mux_;
+  std::condition_variable cv_;
+  std::deque<IOService::IORequest *> queue_;
+  std::vector<std::thread> threads_;
+};
+
+#ifdef MD_ENABLE_IO_URING
+/// Submits reads to an io_uring instance driven by raw syscalls, a reaper thread collects the completions.
+class UringEngine : public IOService::Engine {
+ public:
+  UringEngine(IOService *service, uint32_t entries) : service_(service), entries_(entries) {}
+  ~UringEngine() override { (void)Stop(); }
+
+  Status Start() override {
+    struct io_uring_params params {};
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries_, &params));
+    CHECK_FAIL_RETURN_UNEXPECTED(ring_fd_ >= 0, "Failed to setup io_uring, errno: " + std::to_string(errno));
+    sq_len_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_len_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_len_ = std::max(sq_len_, cq_len_);
+      cq_len_ = sq_len_;
+    }
+    sq_ptr_ = mmap(nullptr, sq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ptr_ == MAP_FAILED) {
+      sq_ptr_ = nullptr;
+      Release();
+      RETURN_STATUS_UNEXPECTED("Failed to mmap the submission queue of io_uring, errno: " + std::to_string(errno));
+    }
+    cq_ptr_ = single_mmap ? sq_ptr_
+                          : mmap(nullptr, cq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                                 IORING_OFF_CQ_RING);
+    if (cq_ptr_ == MAP_FAILED) {
+      cq_ptr_ = nullptr;
+      Release();
+      RETURN_STATUS_UNEXPECTED("Failed to mmap the completion queue of io_uring, errno: " + std::to_string(errno));
+    }
+    sqes_len_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes = mmap(nullptr, sqes_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                      IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      Release();
+      RETURN_STATUS_UNEXPECTED("Failed to mmap the submission entries of io_uring, errno: " + std::to_string(errno));
+    }
+    sqes_ = static_cast<struct io_uring_sqe *>(sqes);
+
+    auto sq_base = static_cast<uint8_t *>(sq_ptr_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq_base + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq_base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned *>(sq_base + params.sq_off.array);
+    auto cq_base = static_cast<uint8_t *>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq_base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(cq_base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe *>(cq_base + params.cq_off.cqes);
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+
+    reaper_ = std::thread([this]() { Reap(); });
+    return Status::OK();
+  }
+
+  Status Stop() override {
+    if (!reaper_.joinable()) {
+      Release();
+      return Status::OK();
+    }
+    {
+      std::unique_lock<std::mutex> lck(sq_mux_);
+      stop_ = true;
+    }
+    // a nop without request wakes up the reaper, which quits once every read in flight is done
+    while (true) {
+      std::unique_lock<std::mutex> lck(sq_mux_);
+      if (PushSqe(nullptr)) {
+        EnterLocked();
+        break;
+      }
+      EnterLocked();
+      lck.unlock();
+      std::this_thread::yield();
+    }
+    reaper_.join();
+    Release();
+    return Status::OK();
+  }
+
+  bool Submit(IOService::IORequest *request) override {
+    // checked and pushed under one lock so that the reads in flight never overflow the completion queue
+    std::unique_lock<std::mutex> lck(sq_mux_);
+    if (stop_ || in_flight_ >= cq_entries_) {
+      return false;
+    }
+    if (PushSqe(request)) {
+      return true;
+    }
+    // the ring is full of queued entries, hand them to the kernel to make room
+    EnterLocked();
+    return PushSqe(request);
+  }
+
+  void Flush() override {
+    std::unique_lock<std::mutex> lck(sq_mux_);
+    EnterLocked();
+  }
+
+  std::string Name() const override { return "io_uring"; }
+
+ private:
+  /// Put an entry into the submission queue, the caller holds sq_mux_ and submits it by EnterLocked.
+  bool PushSqe(IOService::IORequest *request) {
+    unsigned tail = *sq_tail_;
+    unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (tail - head >= sq_entries_) {
+      return false;
+    }
+    unsigned idx = tail & sq_mask_;
+    struct io_uring_sqe *sqe = &sqes_[idx];
+    (void)memset_s(sqe, sizeof(*sqe), 0, sizeof(*sqe));
+    if (request == nullptr) {
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = 0;
+    } else {
+      // the iovec must stay valid until the read completes
+      auto &iov = iovecs_[request];
+      iov.iov_base = request->buffer->data() + request->done;
+      iov.iov_len = static_cast<size_t>(request->length - request->done);
+      sqe->opcode = IORING_OP_READV;
+      sqe->fd = request->fd;
+      sqe->addr = reinterpret_cast<uint64_t>(&iov);
+      sqe->len = 1;
+      sqe->off = static_cast<uint64_t>(request->offset + request->done);
+      sqe->user_data = reinterpret_cast<uint64_t>(request);
+      ++in_flight_;
+    }
+    sq_array_[idx] = idx;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++to_submit_;
+    return true;
+  }
+
+  /// Submit the queued entries with one syscall, the caller holds sq_mux_.
+  void EnterLocked() {
+    if (to_submit_ == 0) {
+      return;
+    }
+    int ret = 0;
+    do {
+      ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, to_submit_, 0, 0, nullptr, 0));
+    } while (ret < 0 && (errno == EINTR || errno == EAGAIN));
+    if (ret < 0) {
+      // the entries stay in the ring and go with the next submission
+      MS_LOG(WARNING) << "Failed to submit to io_uring, errno: " << errno;
+      return;
+    }
+    to_submit_ -= std::min(to_submit_, static_cast<unsigned>(ret));
+  }
+
+  void Reap() {
+    bool stopping = false;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lck(sq_mux_);
+        if (stopping && in_flight_ == 0) {
+          return;
+        }
+      }
+      int ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+      if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        MS_LOG(ERROR) << "Failed to wait for io_uring completions, errno: " << errno;
+        return;
+      }
+      unsigned head = __atomic_load_n(cq_head_, __ATOMIC_RELAXED);
+      unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      std::vector<std::pair<IOService::IORequest *, int32_t>> completions;
+      for (; head != tail; ++head) {
+        const struct io_uring_cqe &cqe = cqes_[head & cq_mask_];
+        (void)completions.emplace_back(reinterpret_cast<IOService::IORequest *>(cqe.user_data), cqe.res);
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      for (const auto &[request, res] : completions) {
+        if (request == nullptr) {
+          stopping = true;
+          continue;
+        }
+        OnComplete(request, res);
+      }
+    }
+  }
+
+  void OnComplete(IOService::IORequest *request, int32_t res) {
+    {
+      std::unique_lock<std::mutex> lck(sq_mux_);
+      (void)iovecs_.erase(request);
+      --in_flight_;
+    }
+    if (res <= 0) {
+      service_->Complete(request, false);
+      return;
+    }
+    request->done += res;
+    if (request->done >= request->length) {
+      service_->Complete(request, true);
+      return;
+    }
+    // short read, continue from where it stops
+    if (!Submit(request)) {
+      service_->Complete(request, IOService::ReadSync(request).IsOk());
+      return;
+    }
+    Flush();
+  }
+
+  void Release() {
+    if (sqes_ != nullptr) {
+      (void)munmap(sqes_, sqes_len_);
+      sqes_ = nullptr;
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      (void)munmap(cq_ptr_, cq_len_);
+    }
+    cq_ptr_ = nullptr;
+    if (sq_ptr_ != nullptr) {
+      (void)munmap(sq_ptr_, sq_len_);
+      sq_ptr_ = nullptr;
+    }
+    if (ring_fd_ >= 0) {
+      (void)close(ring_fd_);
+      ring_fd_ = -1;
+    }
+  }
+
+  IOService *service_;
+  uint32_t entries_;
+  int ring_fd_ = -1;
+  void *sq_ptr_ = nullptr;
+  void *cq_ptr_ = nullptr;
+  size_t sq_len_ = 0;
+  size_t cq_len_ = 0;
+  size_t sqes_len_ = 0;
+  struct io_uring_sqe *sqes_ = nullptr;
+  struct io_uring_cqe *cqes_ = nullptr;
+  unsigned *sq_head_ = nullptr;
+  unsigned *sq_tail_ = nullptr;
+  unsigned *sq_array_ = nullptr;
+  unsigned *cq_head_ = nullptr;
+  unsigned *cq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned cq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  unsigned cq_entries_ = 0;
+  std::mutex sq_mux_;
+  bool stop_ = false;
+  unsigned in_flight_ = 0;
+  unsigned to_submit_ = 0;
+  std::unordered_map<IOService::IORequest *, struct iovec> iovecs_;
+  std::thread reaper_;
+};
+#endif
+
+Status IOService::CreateInstance() {
+  Status rc;
+  std::call_once(init_instance_flag_, [&rc]() {
+    auto &svcManager = Services::GetInstance();
+    rc = svcManager.AddHook(&instance_);
+    if (rc.IsOk()) {
+      rc = instance_->ServiceStart();
+    }
+  });
+  RETURN_IF_NOT_OK(rc);
+  CHECK_FAIL_RETURN_UNEXPECTED(instance_ != nullptr, "Failed to create the IO service.");
+  return Status::OK();
+}
+
+IOService::~IOService() { (void)ServiceStop(); }
+
+Status IOService::DoServiceStart() {
+#ifdef MD_ENABLE_IO_URING
+  if (common::GetEnv("MS_DEV_DATASET_IO_URING") != "0") {
+    auto engine = std::make_unique<UringEngine>(this, kIOUringEntries);
+    Status rc = engine->Start();
+    if (rc.IsOk()) {
+      engine_ = std::move(engine);
+    } else {
+      MS_LOG(INFO) << "io_uring is not available, read by threads instead. " << rc.GetErrDescription();
+    }
+  }
+#endif
+  if (engine_ == nullptr) {
+    engine_ = std::make_unique<ThreadEngine>(this, kIOThreadNum);
+    RETURN_IF_NOT_OK(engine_->Start());
+  }
+  MS_LOG(INFO) << "Starting IO service with " << engine_->Name() << " engine.";
+  return Status::OK();
+}
+
+Status IOService::DoServiceStop() {
+  if (engine_ != nullptr) {
+    RETURN_IF_NOT_OK(engine_->Stop());
+  }
+  std::unique_lock<std::mutex> lck(mux_);
+  requests_.clear();
+  order_.clear();
+  return Status::OK();
+}
+
+std::string IOService::EngineName() const { return engine_ == nullptr ? "" : engine_->Name(); }
+
+std::string IOService::MakeKey(const std::string &path, int64_t offset, int64_t length) {
+  return path + "@" + std::to_string(offset) + "+" + std::to_string(length);
+}
+
+Status IOService::OpenRequest(IORequest *request) {
+  RETURN_UNEXPECTED_IF_NULL(request);
+  CHECK_FAIL_RETURN_UNEXPECTED(request->offset >= 0, "Invalid offset: " + std::to_string(request->offset));
+  int64_t file_size = 0;
+#if !defined(_WIN32) && !defined(_WIN64)
+  request->fd = open(request->path.c_str(), O_RDONLY | O_CLOEXEC);
+  CHECK_FAIL_RETURN_UNEXPECTED(request->fd >= 0, "Invalid file, failed to open file: " + request->path);
+  struct stat file_stat;
+  if (fstat(request->fd, &file_stat) != 0) {
+    (void)close(request->fd);
+    request->fd = -1;
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to get the size of file: " + request->path);
+  }
+  file_size = static_cast<int64_t>(file_stat.st_size);
+#else
+  std::ifstream fs(request->path, std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED(fs.is_open(), "Invalid file, failed to open file: " + request->path);
+  file_size = static_cast<int64_t>(fs.tellg());
+#endif
+  if (request->length < 0) {
+    request->length = std::max<int64_t>(file_size - request->offset, 0);
+  }
+  if (request->offset + request->length > file_size) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    (void)close(request->fd);
+    request->fd = -1;
+#endif
+    RETURN_STATUS_UNEXPECTED("Invalid file, read [" + std::to_string(request->offset) + ", " +
+                             std::to_string(request->offset + request->length) + ") is out of the size " +
+                             std::to_string(file_size) + " of file: " + request->path);
+  }
+  request->done = 0;
+  request->buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(request->length));
+  return Status::OK();
+}
+
+Status IOService::ReadSync(IORequest *request) {
+  RETURN_UNEXPECTED_IF_NULL(request);
+  RETURN_UNEXPECTED_IF_NULL(request->buffer);
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (request->fd < 0) {
+    request->fd = open(request->path.c_str(), O_RDONLY | O_CLOEXEC);
+    CHECK_FAIL_RETURN_UNEXPECTED(request->fd >= 0, "Invalid file, failed to open file: " + request->path);
+  }
+  while (request->done < request->length) {
+    auto ret = pread(request->fd, request->buffer->data() + request->done,
+                     static_cast<size_t>(request->length - request->done), request->offset + request->done);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ret > 0, "Invalid file, failed to read file: " + request->path);
+    request->done += ret;
+  }
+#else
+  std::ifstream fs(request->path, std::ios::in | std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED(fs.is_open(), "Invalid file, failed to open file: " + request->path);
+  (void)fs.seekg(request->offset + request->done, std::ios::beg);
+  (void)fs.read(reinterpret_cast<char *>(request->buffer->data() + request->done), request->length - request->done);
+  CHECK_FAIL_RETURN_UNEXPECTED(fs.good(), "Invalid file, failed to read file: " + request->path);
+  request->done = request->length;
+#endif
+  return Status::OK();
+}
+
+void IOService::Complete(IORequest *request, bool success) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (request->fd >= 0) {
+    (void)close(request->fd);
+    request->fd = -1;
+  }
+#endif
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    request->finished = true;
+    request->failed = !success;
+  }
+  cv_.notify_all();
+}
+
+bool IOService::EvictStale() {
+  while (!order_.empty()) {
+    auto it = requests_.find(order_.front());
+    if (it == requests_.end()) {
+      order_.pop_front();
+      continue;
+    }
+    if (!it->second->finished) {
+      return false;
+    }
+    (void)requests_.erase(it);
+    order_.pop_front();
+    return true;
+  }
+  return requests_.size() < kMaxPendingRequests;
+}
+
+size_t IOService::NumPending() {
+  std::unique_lock<std::mutex> lck(mux_);
+  return requests_.size();
+}
+
+Status IOService::Prefetch(const std::string &path, int64_t offset, int64_t length) {
+  auto key = MakeKey(path, offset, length);
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    if (state_ != STATE::kRunning || requests_.count(key) > 0) {
+      return Status::OK();
+    }
+    // skip the keys which have been taken
+    while (!order_.empty() && requests_.count(order_.front()) == 0) {
+      order_.pop_front();
+    }
+    if (requests_.size() >= kMaxPendingRequests && !EvictStale()) {
+      return Status::OK();
+    }
+  }
+  auto request = std::make_shared<IORequest>();
+  request->path = path;
+  request->offset = offset;
+  request->length = length;
+  Status rc = OpenRequest(request.get());
+  if (rc.IsError()) {
+    // it is only a hint, the error is reported when the row is read
+    MS_LOG(DEBUG) << "Skip prefetching " << path << ". " << rc.GetErrDescription();
+    return Status::OK();
+  }
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    if (requests_.count(key) > 0) {
+      lck.unlock();
+      Complete(request.get(), false);
+      return Status::OK();
+    }
+    (void)requests_.emplace(key, request);
+    order_.push_back(key);
+  }
+  if (!engine_->Submit(request.get())) {
+    // the reader falls back to read synchronously
+    Complete(request.get(), false);
+  }
+  return Status::OK();
+}
+
+void IOService::Flush() {
+  if (engine_ != nullptr) {
+    engine_->Flush();
+  }
+}
+
+Status IOService::Read(const std::string &path, int64_t offset, int64_t length,
+                       std::shared_ptr<std::vector<uint8_t>> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  auto key = MakeKey(path, offset, length);
+  std::shared_ptr<IORequest> request;
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    auto it = requests_.find(key);
+    if (it != requests_.end()) {
+      request = it->second;
+      (void)requests_.erase(it);
+      if (!request->finished) {
+        // the read may still be queued by a prefetcher which has not flushed yet
+        lck.unlock();
+        Flush();
+        lck.lock();
+        cv_.wait(lck, [&request]() { return request->finished; });
+      }
+    }
+  }
+  if (request != nullptr && !request->failed) {
+    *out = request->buffer;
+    return Status::OK();
+  }
+  IORequest sync_request;
+  sync_request.path = path;
+  sync_request.offset = offset;
+  sync_request.length = length;
+  RETURN_IF_NOT_OK(OpenRequest(&sync_request));
+  Status rc = ReadSync(&sync_request);
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (sync_request.fd >= 0) {
+    (void)close(sync_request.fd);
+  }
+#endif
+  RETURN_IF_NOT_OK(rc);
+  *out = sync_request.buffer;
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/util/service.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A process wide service for asynchronous file reads shared by the leaf ops.
+/// Ops submit read-ahead hints with Prefetch() for the rows the sampler will hand out soon, and later take the content
+/// with Read(), which waits for the read in flight or reads synchronously if the row was never prefetched.
+/// Reads are submitted to io_uring when the kernel allows it, otherwise they run on a small pool of reader threads.
+class IOService : public Service {
+  friend class Services;
+
+ public:
+  /// \brief A pending read, the engine fills buffer and reports through IOService::Complete.
+  struct IORequest {
+    std::string path;
+    int64_t offset = 0;
+    int64_t length = -1;  // -1 means up to the end of file
+    int fd = -1;
+    int64_t done = 0;
+    bool finished = false;
+    bool failed = false;
+    std::shared_ptr<std::vector<uint8_t>> buffer;
+  };
+
+  /// \brief Backend running the reads.
+  class Engine {
+   public:
+    virtual ~Engine() = default;
+    virtual Status Start() = 0;
+    virtual Status Stop() = 0;
+    /// \brief Queue a request whose fd and buffer are ready, false if the engine can't take more requests.
+    virtual bool Submit(IORequest *request) = 0;
+    /// \brief Hand the requests queued by Submit to the kernel together.
+    virtual void Flush() {}
+    virtual std::string Name() const = 0;
+  };
+
+  ~IOService() override;
+
+  IOService(const IOService &) = delete;
+
+  IOService &operator=(const IOService &) = delete;
+
+  static Status CreateInstance();
+
+  static IOService &GetInstance() noexcept { return *instance_; }
+
+  Status DoServiceStart() override;
+
+  Status DoServiceStop() override;
+
+  /// \brief Queue a read-ahead of [offset, offset + length) of a file. It is only a hint, it is dropped when too many
+  /// reads are pending. The reads queued are submitted together by Flush(), or by Read() of any of them.
+  /// \param[in] path Path of the file.
+  /// \param[in] offset Offset to read from.
+  /// \param[in] length Number of bytes, -1 to read up to the end of file.
+  /// \return Status code.
+  Status Prefetch(const std::string &path, int64_t offset = 0, int64_t length = -1);
+
+  /// \brief Get [offset, offset + length) of a file, the prefetched content is handed out and forgotten.
+  /// \param[in] path Path of the file.
+  /// \param[in] offset Offset to read from.
+  /// \param[in] length Number of bytes, -1 to read up to the end of file.
+  /// \param[out] out Content of the file.
+  /// \return Status code.
+  Status Read(const std::string &path, int64_t offset, int64_t length, std::shared_ptr<std::vector<uint8_t>> *out);
+
+  /// \brief Get the whole content of a file.
+  Status Read(const std::string &path, std::shared_ptr<std::vector<uint8_t>> *out) { return Read(path, 0, -1, out); }
+
+  /// \brief Submit the read-aheads queued so far in one go.
+  void Flush();
+
+  /// \brief Called by the engine when a request is done.
+  void Complete(IORequest *request, bool success);
+
+  /// \brief Read the rest of a request synchronously.
+  static Status ReadSync(IORequest *request);
+
+  /// \brief Name of the engine running the reads.
+  std::string EngineName() const;
+
+  /// \brief Number of prefetched reads which are not taken yet.
+  size_t NumPending();
+
+  /// \brief Max number of prefetched reads which are not taken yet, bounds the memory held by read-ahead.
+  static constexpr size_t kMaxPendingRequests = 256;
+
+ private:
+  IOService() = default;
+
+  static std::string MakeKey(const std::string &path, int64_t offset, int64_t length);
+
+  /// \brief Open the file and allocate the buffer of a request.
+  static Status OpenRequest(IORequest *request);
+
+  /// \brief Drop the oldest prefetched reads which are finished but never taken, e.g. after an early stop.
+  /// \return whether there is room for a new request.
+  bool EvictStale();
+
+  static std::once_flag init_instance_flag_;
+  static IOService *instance_;
+
+  std::unique_ptr<Engine> engine_;
+  std::mutex mux_;
+  std::condition_variable cv_;
+  std::unordered_map<std::string, std::shared_ptr<IORequest>> requests_;
+  std::deque<std::string> order_;  // keys in submission order
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
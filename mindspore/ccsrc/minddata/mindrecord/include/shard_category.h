@@ -50,6 +50,8 @@ class MINDRECORD_API ShardCategory : public ShardOperator {
 
   int64_t GetNumSamples(int64_t dataset_size, int64_t num_classes) override;
 
+  bool IsRandomAccess() override { return true; }
+
  private:
   std::vector<std::pair<std::string, std::string>> categories_;
   std::string category_field_;
@@ -43,6 +43,8 @@ class MINDRECORD_API ShardDistributedSample : public ShardSample {
 
   int64_t GetNumSamples(int64_t dataset_size, int64_t num_classes) override;
 
+  bool IsRandomAccess() override { return shuffle_ && GetShuffleMode() != dataset::ShuffleMode::kFiles; }
+
  private:
   bool shuffle_;
   int64_t no_of_padded_samples_;
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "minddata/mindrecord/include/common/log_adapter.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief expected order in which the pages of a shard file are read
+enum class AccessPattern { kNormal = 0, kSequential, kRandom };
+
+/// \brief read-only view of a blob, holder keeps the memory pointed by data alive
+struct MINDRECORD_API BlobView {
+  const uint8_t *data = nullptr;
+  uint64_t size = 0;
+  std::shared_ptr<const void> holder = nullptr;
+};
+
+/// \brief a whole shard file mapped into memory, views of blobs point into the mapping and share its ownership
+class MINDRECORD_API ShardMmapFile : public std::enable_shared_from_this<ShardMmapFile> {
+ public:
+  ~ShardMmapFile();
+
+  ShardMmapFile(const ShardMmapFile &) = delete;
+  ShardMmapFile &operator=(const ShardMmapFile &) = delete;
+
+  /// \brief map the file, pages are private so that a consumer writing to a view never touches the file
+  /// \param[in] file_path the path of the shard file
+  /// \param[out] mmap_file_ptr the mapped file
+  /// \return Status
+  static Status Open(const std::string &file_path, std::shared_ptr<ShardMmapFile> *mmap_file_ptr);
+
+  /// \brief advise the kernel how the pages will be read, sequential read enables aggressive read ahead
+  /// \param[in] pattern the access pattern of the sampler
+  /// \return Status
+  Status Advise(AccessPattern pattern);
+
+  /// \brief get the view of [offset, offset + length) in the file
+  Status GetView(uint64_t offset, uint64_t length, BlobView *view);
+
+  /// \brief copy [offset, offset + length) of the file into dst
+  Status Read(uint64_t offset, uint64_t length, uint8_t *dst) const;
+
+  uint64_t Size() const { return size_; }
+
+ private:
+  ShardMmapFile(std::string file_path, uint8_t *addr, uint64_t size)
+      : file_path_(std::move(file_path)), addr_(addr), size_(size) {}
+
+  Status CheckRange(uint64_t offset, uint64_t length) const;
+
+  std::string file_path_;
+  uint8_t *addr_;
+  uint64_t size_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
@@ -64,6 +64,9 @@ class MINDRECORD_API ShardOperator {
 
   virtual dataset::ShuffleMode GetShuffleMode() { return shuffle_mode_; }
 
+  /// \brief whether the samples are read in an order other than the one stored in the files
+  virtual bool IsRandomAccess() { return false; }
+
   virtual void SetShardSampleCount(const std::vector<int64_t> &shard_sample_count) {
     shard_sample_count_ = shard_sample_count;
   }
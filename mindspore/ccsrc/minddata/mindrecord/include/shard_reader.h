@@ -47,6 +47,7 @@
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_mmap_file.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -58,6 +59,7 @@ namespace mindrecord {
 using ROW_GROUPS = std::pair<std::vector<std::vector<std::vector<uint64_t>>>, std::vector<std::vector<json>>>;
 using ROW_GROUP_BRIEF = std::tuple<std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>>;
+using TASK_VIEW_CONTENT = std::pair<TaskType, std::vector<std::tuple<BlobView, json>>>;
 const int kNumBatchInMap = 1000;  // iterator buffer size in row-reader mode
 
 class MINDRECORD_API ShardReader {
@@ -184,6 +186,17 @@ class MINDRECORD_API ShardReader {
   Status GetNextById(const int64_t &task_id, const int32_t &consumer_id,
                      std::shared_ptr<TASK_CONTENT> *task_content_ptr);
 
+  /// \brief return a row by id, the blob is a view of the mapped shard file without copy in mmap read mode
+  /// \return a batch of images and image data
+  Status GetNextById(const int64_t &task_id, const int32_t &consumer_id,
+                     std::shared_ptr<TASK_VIEW_CONTENT> *task_content_ptr);
+
+  /// \brief read blobs through mmap instead of file streams, must be set before Open
+  void SetMmapRead(bool mmap_read) { mmap_read_ = mmap_read; }
+
+  /// \brief whether blobs are read through mmap
+  bool IsMmapRead() const { return mmap_read_; }
+
   /// \brief  get blob filed list
   /// \return blob field list
   std::pair<ShardType, std::vector<std::string>> GetBlobFields();
@@ -299,9 +312,22 @@ class MINDRECORD_API ShardReader {
   /// \brief open multiple file handle
   void FileStreamsOperator();
 
+  /// \brief map shard files and advise the kernel with the access pattern of the operators
+  Status OpenMmapFiles();
+
+  /// \brief get the order in which the shard files are read
+  AccessPattern GetAccessPattern() const;
+
+  /// \brief find the blob and scalar variable fields of one task
+  Status LocateOneTask(int64_t task_id, uint32_t consumer_id, TaskType *task_type, uint32_t *shard_id,
+                       uint64_t *file_offset, uint64_t *blob_size, json *var_fields);
+
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief read one row by one task, the blob refers to the mapped shard file
+  Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_VIEW_CONTENT> *task_content_pt);
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -329,6 +355,7 @@ class MINDRECORD_API ShardReader {
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::shared_ptr<ShardMmapFile>> mmap_files_;                       // mapped files shared by consumers
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -341,6 +368,7 @@ class MINDRECORD_API ShardReader {
   // flags
   bool all_in_index_ = true;  // if all columns are stored in index-table
   bool interrupt_ = false;    // reader interrupted
+  bool mmap_read_ = false;    // read blobs through mmap
 
   int64_t num_padded_;  // number of padding samples
 
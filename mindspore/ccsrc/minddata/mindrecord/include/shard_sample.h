@@ -48,6 +48,8 @@ class MINDRECORD_API ShardSample : public ShardOperator {
 
   int64_t GetNumSamples(int64_t dataset_size, int64_t num_classes) override;
 
+  bool IsRandomAccess() override { return sampler_type_ == kSubsetRandomSampler || sampler_type_ == kSubsetSampler; }
+
  private:
   // Update the partition_shard_sample_count_ in tasks
   Status UpdatePartitionWhenSlowMode(ShardTaskList &tasks);  // NOLINT
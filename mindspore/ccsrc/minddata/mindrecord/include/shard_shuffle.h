@@ -35,6 +35,8 @@ class MINDRECORD_API ShardShuffle : public ShardOperator {
 
   int64_t GetNumSamples(int64_t dataset_size, int64_t num_classes) override;
 
+  bool IsRandomAccess() override { return GetShuffleMode() != dataset::ShuffleMode::kFiles; }
+
  private:
   // Private helper function
   Status CategoryShuffle(ShardTaskList &tasks);  // NOLINT
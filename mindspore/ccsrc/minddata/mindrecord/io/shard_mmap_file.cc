@@ -0,0 +1,106 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_mmap_file.h"
+
+#include <cerrno>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "./securec.h"
+
+namespace mindspore {
+namespace mindrecord {
+Status ShardMmapFile::Open(const std::string &file_path, std::shared_ptr<ShardMmapFile> *mmap_file_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(mmap_file_ptr);
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(file_path.c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open mindrecord file for mmap: " + file_path);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the size of mindrecord file: " + file_path);
+  }
+  auto size = static_cast<uint64_t>(file_stat.st_size);
+  // the mapping stays valid after the file descriptor is closed
+  void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "[Internal ERROR] Failed to mmap mindrecord file: " + file_path +
+                                                        ", errno: " + std::to_string(errno));
+  *mmap_file_ptr = std::shared_ptr<ShardMmapFile>(new ShardMmapFile(file_path, static_cast<uint8_t *>(addr), size));
+  return Status::OK();
+#else
+  RETURN_STATUS_UNEXPECTED_MR("mmap read of mindrecord file is not supported on Windows, file: " + file_path);
+#endif
+}
+
+ShardMmapFile::~ShardMmapFile() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (addr_ != nullptr && munmap(addr_, size_) != 0) {
+    MS_LOG(ERROR) << "[Internal ERROR] Failed to munmap mindrecord file: " << file_path_ << ", errno: " << errno;
+  }
+#endif
+  addr_ = nullptr;
+}
+
+Status ShardMmapFile::Advise(AccessPattern pattern) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  int advice = MADV_NORMAL;
+  if (pattern == AccessPattern::kSequential) {
+    advice = MADV_SEQUENTIAL;
+  } else if (pattern == AccessPattern::kRandom) {
+    advice = MADV_RANDOM;
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(madvise(addr_, size_, advice) == 0,
+                                  "[Internal ERROR] Failed to madvise mindrecord file: " + file_path_ +
+                                    ", errno: " + std::to_string(errno));
+#endif
+  return Status::OK();
+}
+
+Status ShardMmapFile::CheckRange(uint64_t offset, uint64_t length) const {
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(offset <= size_ && length <= size_ - offset,
+                                  "[Internal ERROR] Read [" + std::to_string(offset) + ", " +
+                                    std::to_string(offset + length) + ") is out of the size " + std::to_string(size_) +
+                                    " of mindrecord file: " + file_path_);
+  return Status::OK();
+}
+
+Status ShardMmapFile::GetView(uint64_t offset, uint64_t length, BlobView *view) {
+  RETURN_UNEXPECTED_IF_NULL_MR(view);
+  RETURN_IF_NOT_OK_MR(CheckRange(offset, length));
+  view->data = addr_ + offset;
+  view->size = length;
+  view->holder = shared_from_this();
+  return Status::OK();
+}
+
+Status ShardMmapFile::Read(uint64_t offset, uint64_t length, uint8_t *dst) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(dst);
+  RETURN_IF_NOT_OK_MR(CheckRange(offset, length));
+  if (length == 0) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(memcpy_s(dst, length, addr_ + offset, length) == EOK,
+                                  "[Internal ERROR] Failed to call securec func [memcpy_s]");
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
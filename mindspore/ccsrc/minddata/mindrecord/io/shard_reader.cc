@@ -45,7 +45,9 @@ ShardReader::ShardReader()
       sample_id_position_(0),
       deliver_id_(0),
       load_mode_(LoadMode::kFast),
-      shard_sample_count_() {}
+      shard_sample_count_() {
+  mmap_read_ = common::GetEnv("MS_DEV_MINDRECORD_MMAP") == "1";
+}
 
 Status ShardReader::GetMeta(const std::string &file_path, std::shared_ptr<json> meta_data_ptr,
                             std::shared_ptr<std::vector<std::string>> *addresses_ptr) {
@@ -225,6 +227,42 @@ Status ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Succeed to open file, path: " << file;
   }
+  if (mmap_read_) {
+    auto status = OpenMmapFiles();
+    if (status.IsError()) {
+      MS_LOG(WARNING) << "Failed to mmap mindrecord files, fall back to read by file streams. " << status.ToString();
+      mmap_files_.clear();
+      mmap_read_ = false;
+    }
+  }
+  return Status::OK();
+}
+
+AccessPattern ShardReader::GetAccessPattern() const {
+  for (const auto &op : operators_) {
+    for (auto cur = op; cur != nullptr; cur = cur->GetChildOp()) {
+      if (cur->IsRandomAccess()) {
+        return AccessPattern::kRandom;
+      }
+    }
+  }
+  return AccessPattern::kSequential;
+}
+
+Status ShardReader::OpenMmapFiles() {
+  mmap_files_.clear();
+  auto pattern = GetAccessPattern();
+  for (const auto &file : file_paths_) {
+    auto realpath = FileUtils::GetRealPath(file.c_str());
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      realpath.has_value(), "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file);
+    std::shared_ptr<ShardMmapFile> mmap_file;
+    RETURN_IF_NOT_OK_MR(ShardMmapFile::Open(realpath.value(), &mmap_file));
+    RETURN_IF_NOT_OK_MR(mmap_file->Advise(pattern));
+    mmap_files_.push_back(mmap_file);
+  }
+  MS_LOG(INFO) << "Succeed to mmap " << mmap_files_.size() << " mindrecord files, random access: "
+               << (pattern == AccessPattern::kRandom);
   return Status::OK();
 }
 
@@ -321,6 +359,8 @@ void ShardReader::FileStreamsOperator() {
       }
     }
   }
+  // views handed out to consumers keep their own mapping alive
+  mmap_files_.clear();
   for (int i = static_cast<int>(database_paths_.size()) - 1; i >= 0; --i) {
     if (database_paths_[i] != nullptr) {
       auto ret = sqlite3_close(database_paths_[i]);
@@ -1449,9 +1489,13 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
   return Status::OK();
 }
 
-Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
-                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+Status ShardReader::LocateOneTask(int64_t task_id, uint32_t consumer_id, TaskType *task_type, uint32_t *shard_id,
+                                  uint64_t *file_offset, uint64_t *blob_size, json *var_fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_type);
+  RETURN_UNEXPECTED_IF_NULL_MR(shard_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(file_offset);
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_size);
+  RETURN_UNEXPECTED_IF_NULL_MR(var_fields);
   if (load_mode_ == LoadMode::kFast || load_mode_ == LoadMode::kLazy) {
     // All tasks are done
     CHECK_FAIL_RETURN_UNEXPECTED_MR(task_id < tasks_.Size(), "[Internal ERROR] 'task_id': " + std::to_string(task_id) +
@@ -1463,23 +1507,19 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
         " is out of bound: " + std::to_string(num_padded_ + shard_sample_count_[shard_sample_count_.size() - 1]));
   }
 
-  uint32_t shard_id = 0;
   uint32_t group_id = 0;
   uint32_t blob_start = 0;
   uint32_t blob_end = 0;
-  json var_fields;
   // Pick up task from task list
   ShardTask task = tasks_.GetTaskByID(task_id);
 
   // check task type
-  auto task_type = std::get<0>(task);
-  if (task_type == TaskType::kPaddedTask) {
-    *task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+  *task_type = std::get<0>(task);
+  if (*task_type == TaskType::kPaddedTask) {
     return Status::OK();
   }
 
-  shard_id = std::get<0>(std::get<1>(task));  // shard id
+  *shard_id = std::get<0>(std::get<1>(task));  // shard id
 
   if (load_mode_ == LoadMode::kLazy || load_mode_ == LoadMode::kSlow) {
     // get scalar variable fields by sample id
@@ -1488,40 +1528,62 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
     // read the meta from index
     std::shared_ptr<ROW_GROUPS> row_group_ptr;
     RETURN_IF_NOT_OK_MR(
-      ReadRowGroupByShardIDAndSampleID(selected_columns_, shard_id, consumer_id, sample_id_in_shard, &row_group_ptr));
+      ReadRowGroupByShardIDAndSampleID(selected_columns_, *shard_id, consumer_id, sample_id_in_shard, &row_group_ptr));
     auto &offsets = std::get<0>(*row_group_ptr);
     auto &local_columns = std::get<1>(*row_group_ptr);
 
-    group_id = offsets[shard_id][0][1];       // group_id
-    blob_start = offsets[shard_id][0][2];     // blob start
-    blob_end = offsets[shard_id][0][3];       // blob end
-    var_fields = local_columns[shard_id][0];  // scalar variable field
+    group_id = offsets[*shard_id][0][1];        // group_id
+    blob_start = offsets[*shard_id][0][2];      // blob start
+    blob_end = offsets[*shard_id][0][3];        // blob end
+    *var_fields = local_columns[*shard_id][0];  // scalar variable field
   } else {
     group_id = std::get<1>(std::get<1>(task));  // group id
     blob_start = std::get<2>(task)[0];          // blob start
     blob_end = std::get<2>(task)[1];            // blob end
-    var_fields = std::get<3>(task);             // scalar variable field
+    *var_fields = std::get<3>(task);            // scalar variable field
   }
 
-  // read the blob from data file
+  // locate the blob in data file
   std::shared_ptr<Page> page_ptr;
-  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, *shard_id, &page_ptr));
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
 
-  // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
-  auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *blob_size = blob_end - blob_start;
+  return Status::OK();
+}
 
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(
+    LocateOneTask(task_id, consumer_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    return Status::OK();
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+
+  // Pack image list
+  std::vector<uint8_t> images(blob_size);
+  if (!mmap_files_.empty()) {
+    RETURN_IF_NOT_OK_MR(mmap_files_[shard_id]->Read(file_offset, blob_size, images.data()));
+  } else {
+    auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
+    if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+    }
+    auto &io_read = file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_size);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+    }
   }
 
   // Deliver batch data to output map
@@ -1532,6 +1594,42 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
   return Status::OK();
 }
 
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_VIEW_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  std::vector<std::tuple<BlobView, json>> batch;
+  if (mmap_files_.empty()) {
+    // the blob is read into its own buffer, which is owned by the view
+    std::shared_ptr<TASK_CONTENT> content_ptr;
+    RETURN_IF_NOT_OK_MR(ConsumerOneTask(task_id, consumer_id, &content_ptr));
+    for (auto &[blob, var_fields] : content_ptr->second) {
+      auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(blob));
+      BlobView view{buffer->data(), buffer->size(), buffer};
+      batch.emplace_back(std::move(view), std::move(var_fields));
+    }
+    *task_content_ptr = std::make_shared<TASK_VIEW_CONTENT>(content_ptr->first, std::move(batch));
+    return Status::OK();
+  }
+
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(
+    LocateOneTask(task_id, consumer_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr = std::make_shared<TASK_VIEW_CONTENT>(TaskType::kPaddedTask, std::move(batch));
+    return Status::OK();
+  }
+
+  BlobView view;
+  RETURN_IF_NOT_OK_MR(mmap_files_[shard_id]->GetView(file_offset, blob_size, &view));
+  batch.emplace_back(std::move(view), std::move(var_fields));
+  *task_content_ptr = std::make_shared<TASK_VIEW_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  return Status::OK();
+}
+
 void ShardReader::ConsumerByRow(int consumer_id) {
   // Set thread name
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
@@ -1645,6 +1743,15 @@ Status ShardReader::GetNextById(const int64_t &task_id, const int32_t &consumer_
   return Status::OK();
 }
 
+Status ShardReader::GetNextById(const int64_t &task_id, const int32_t &consumer_id,
+                                std::shared_ptr<TASK_VIEW_CONTENT> *task_content_ptr) {
+  if (interrupt_) {
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK_MR(ConsumerOneTask(task_id, consumer_id, task_content_ptr));
+  return Status::OK();
+}
+
 Status ShardReader::UnCompressBlob(const std::vector<uint8_t> &raw_blob_data,
                                    std::shared_ptr<std::vector<std::vector<uint8_t>>> *blob_data_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(blob_data_ptr);
@@ -97,6 +97,15 @@ Status ShardColumn::GetColumnValueByName(const std::string &column_name, const s
                                          std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *const n_bytes,
                                          ColumnDataType *column_data_type, uint64_t *column_data_type_size,
                                          std::vector<int64_t> *column_shape) {
+  return GetColumnValueByName(column_name, columns_blob.data(), columns_blob.size(), columns_json, data, data_ptr,
+                              n_bytes, column_data_type, column_data_type_size, column_shape);
+}
+
+Status ShardColumn::GetColumnValueByName(const std::string &column_name, const uint8_t *columns_blob,
+                                         uint64_t blob_size, const json &columns_json, const unsigned char **data,
+                                         std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *const n_bytes,
+                                         ColumnDataType *column_data_type, uint64_t *column_data_type_size,
+                                         std::vector<int64_t> *column_shape) {
   RETURN_UNEXPECTED_IF_NULL_MR(column_data_type);
   RETURN_UNEXPECTED_IF_NULL_MR(column_data_type_size);
   RETURN_UNEXPECTED_IF_NULL_MR(column_shape);
@@ -118,7 +127,7 @@ Status ShardColumn::GetColumnValueByName(const std::string &column_name, const s
   }
 
   // Retrieve value from blob
-  RETURN_IF_NOT_OK_MR(GetColumnFromBlob(column_name, columns_blob, data, data_ptr, n_bytes));
+  RETURN_IF_NOT_OK_MR(GetColumnFromBlob(column_name, columns_blob, blob_size, data, data_ptr, n_bytes));
   if (*data == nullptr) {
     *data = reinterpret_cast<const unsigned char *>(data_ptr->get());
   }
@@ -251,17 +260,23 @@ Status ShardColumn::GetInt(std::unique_ptr<unsigned char[]> *data_ptr, const jso
 Status ShardColumn::GetColumnFromBlob(const std::string &column_name, const std::vector<uint8_t> &columns_blob,
                                       const unsigned char **data, std::unique_ptr<unsigned char[]> *data_ptr,
                                       uint64_t *const n_bytes) {
+  return GetColumnFromBlob(column_name, columns_blob.data(), columns_blob.size(), data, data_ptr, n_bytes);
+}
+
+Status ShardColumn::GetColumnFromBlob(const std::string &column_name, const uint8_t *columns_blob, uint64_t blob_size,
+                                      const unsigned char **data, std::unique_ptr<unsigned char[]> *data_ptr,
+                                      uint64_t *const n_bytes) {
   RETURN_UNEXPECTED_IF_NULL_MR(data);
   uint64_t offset_address = 0;
   auto column_id = column_name_id_[column_name];
-  RETURN_IF_NOT_OK_MR(GetColumnAddressInBlock(column_id, columns_blob, n_bytes, &offset_address));
+  RETURN_IF_NOT_OK_MR(GetColumnAddressInBlock(column_id, columns_blob, blob_size, n_bytes, &offset_address));
   auto column_data_type = column_data_type_[column_id];
   if (has_compress_blob_ && column_data_type == ColumnInt32) {
     RETURN_IF_NOT_OK_MR(UncompressInt<int32_t>(column_id, data_ptr, columns_blob, n_bytes, offset_address));
   } else if (has_compress_blob_ && column_data_type == ColumnInt64) {
     RETURN_IF_NOT_OK_MR(UncompressInt<int64_t>(column_id, data_ptr, columns_blob, n_bytes, offset_address));
   } else {
-    *data = reinterpret_cast<const unsigned char *>(&(columns_blob[offset_address]));
+    *data = reinterpret_cast<const unsigned char *>(columns_blob + offset_address);
   }
 
   return Status::OK();
@@ -298,7 +313,7 @@ std::vector<uint8_t> ShardColumn::CompressBlob(const std::vector<uint8_t> &blob,
     }
 
     // Just copy and continue if column dat type is not int32/int64
-    uint64_t num_bytes = BytesBigToUInt64(blob, i_src, kInt64Type);
+    uint64_t num_bytes = BytesBigToUInt64(blob.data(), i_src, kInt64Type);
     if (src_data_type != ColumnInt32 && src_data_type != ColumnInt64) {
       dst_blob.insert(dst_blob.end(), blob.begin() + i_src, blob.begin() + i_src + kInt64Len + num_bytes);
       i_src += kInt64Len + num_bytes;
@@ -346,7 +361,7 @@ vector<uint8_t> ShardColumn::CompressInt(const vector<uint8_t> &src_bytes, const
     // Shift to next int position
     uint64_t pos = i * (kUnsignedOne << static_cast<uint8_t>(int_type));
     // Narrow down this int
-    int64_t i_n = BytesLittleToMinIntType(src_bytes, pos, int_type, &dst_int_type);
+    int64_t i_n = BytesLittleToMinIntType(src_bytes.data(), pos, int_type, &dst_int_type);
 
     // Write this int to destination blob
     uint64_t u_n = *reinterpret_cast<uint64_t *>(&i_n);
@@ -365,30 +380,37 @@ vector<uint8_t> ShardColumn::CompressInt(const vector<uint8_t> &src_bytes, const
   return dst_bytes;
 }
 
-Status ShardColumn::GetColumnAddressInBlock(const uint64_t &column_id, const std::vector<uint8_t> &columns_blob,
-                                            uint64_t *num_bytes, uint64_t *shift_idx) {
+Status ShardColumn::GetColumnAddressInBlock(const uint64_t &column_id, const uint8_t *columns_blob,
+                                            uint64_t blob_size, uint64_t *num_bytes, uint64_t *shift_idx) {
   RETURN_UNEXPECTED_IF_NULL_MR(num_bytes);
   RETURN_UNEXPECTED_IF_NULL_MR(shift_idx);
   if (num_blob_column_ == 1) {
-    *num_bytes = columns_blob.size();
+    *num_bytes = blob_size;
     *shift_idx = 0;
     return Status::OK();
   }
   auto blob_id = blob_column_id_[column_name_[column_id]];
 
-  for (int32_t i = 0; i < blob_id; i++) {
-    *shift_idx += kInt64Len + BytesBigToUInt64(columns_blob, *shift_idx, kInt64Type);
+  for (int32_t i = 0; i <= blob_id; i++) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(*shift_idx + kInt64Len <= blob_size,
+                                    "[Internal ERROR] the blob of column: " + column_name_[column_id] +
+                                      " is out of the blob size: " + std::to_string(blob_size));
+    *num_bytes = BytesBigToUInt64(columns_blob, *shift_idx, kInt64Type);
+    (*shift_idx) += kInt64Len;
+    if (i < blob_id) {
+      (*shift_idx) += *num_bytes;
+    }
   }
-  *num_bytes = BytesBigToUInt64(columns_blob, *shift_idx, kInt64Type);
-
-  (*shift_idx) += kInt64Len;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(*num_bytes <= blob_size - *shift_idx,
+                                  "[Internal ERROR] the blob of column: " + column_name_[column_id] +
+                                    " is out of the blob size: " + std::to_string(blob_size));
 
   return Status::OK();
 }
 
 template <typename T>
 Status ShardColumn::UncompressInt(const uint64_t &column_id, std::unique_ptr<unsigned char[]> *const data_ptr,
-                                  const std::vector<uint8_t> &columns_blob, uint64_t *num_bytes, uint64_t shift_idx) {
+                                  const uint8_t *columns_blob, uint64_t *num_bytes, uint64_t shift_idx) {
   RETURN_UNEXPECTED_IF_NULL_MR(data_ptr);
   RETURN_UNEXPECTED_IF_NULL_MR(num_bytes);
   auto num_elements = BytesBigToUInt64(columns_blob, shift_idx, kInt32Type);
@@ -418,8 +440,7 @@ Status ShardColumn::UncompressInt(const uint64_t &column_id, std::unique_ptr<uns
   return Status::OK();
 }
 
-uint64_t ShardColumn::BytesBigToUInt64(const std::vector<uint8_t> &bytes_array, const uint64_t &pos,
-                                       const IntegerType &i_type) {
+uint64_t ShardColumn::BytesBigToUInt64(const uint8_t *bytes_array, const uint64_t &pos, const IntegerType &i_type) {
   uint64_t result = 0;
   for (uint64_t i = 0; i < (kUnsignedOne << static_cast<uint8_t>(i_type)); i++) {
     result = (result << kBitsOfByte) + bytes_array[pos + i];
@@ -447,7 +468,7 @@ std::vector<uint8_t> ShardColumn::UIntToBytesLittle(uint64_t value, const Intege
   return result;
 }
 
-int64_t ShardColumn::BytesLittleToMinIntType(const std::vector<uint8_t> &bytes_array, const uint64_t &pos,
+int64_t ShardColumn::BytesLittleToMinIntType(const uint8_t *bytes_array, const uint64_t &pos,
                                              const IntegerType &src_i_type, IntegerType *dst_i_type) {
   uint64_t u_temp = 0;
   for (uint64_t i = 0; i < (kUnsignedOne << static_cast<uint8_t>(src_i_type)); i++) {
@@ -528,6 +528,12 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("aio_block_size", &OffloadContext::aio_block_size, "Get the size of aio block.")
     .def("set_aio_queue_depth", &OffloadContext::set_aio_queue_depth, "Set the depth of aio queue.")
     .def("aio_queue_depth", &OffloadContext::aio_queue_depth, "Get the depth of aio queue.")
+    .def("set_aio_backend", &OffloadContext::set_aio_backend, "Set the backend of aio, libaio or io_uring.")
+    .def("aio_backend", &OffloadContext::aio_backend, "Get the backend of aio.")
+    .def("set_enable_host_compression", &OffloadContext::set_enable_host_compression,
+         "Set the flag of whether compressing cold tensors in host memory.")
+    .def("enable_host_compression", &OffloadContext::enable_host_compression,
+         "Get the flag of whether compressing cold tensors in host memory.")
     .def("set_enable_pinned_mem", &OffloadContext::set_enable_pinned_mem,
          "Set the flag of whether enabling pinned memory.")
     .def("enable_pinned_mem", &OffloadContext::enable_pinned_mem, "Get the flag of whether enabling pinned memory.")
@@ -41,6 +41,7 @@ using mindspore::profiler::ProfilerManager;
 #include "frontend/operator/ops_front_infer_function.h"
 #include "runtime/pipeline/pipeline.h"
 #include "runtime/device/device_address_utils.h"
+#include "utils/hashing.h"
 
 namespace mindspore {
 namespace pynative {
@@ -340,6 +341,7 @@ GradExecutorPtr ForwardExecutor::grad() const {
 
 void ForwardExecutor::InitOpRunInfo(const FrontendOpRunInfoPtr &op_run_info) {
   Init();
+  RecordOpTrace(op_run_info->base_op_run_info.op_name);
   // Used for async run
   op_run_info->requires_grad = grad()->RequiresGrad();
   if (op_run_info->requires_grad) {
@@ -699,6 +701,7 @@ FrontendOpRunInfoPtr ForwardExecutor::GenerateOpRunInfo(const py::args &args, bo
   const auto &op_run_info = std::make_shared<FrontendOpRunInfo>();
   // Used for async run
   op_run_info->base_op_run_info.op_name = args[static_cast<size_t>(RunOpArgsEnum::PY_NAME)].cast<std::string>();
+  RecordOpTrace(op_run_info->base_op_run_info.op_name);
   op_run_info->requires_grad = grad()->RequiresGrad();
   if (op_run_info->requires_grad) {
     op_run_info->base_op_run_info.use_dynamic_shape_process = grad()->use_dynamic_shape_process();
@@ -1130,6 +1133,23 @@ ValuePtr ForwardExecutor::RunOpInMsInner(const FrontendOpRunInfoPtr &op_run_info
   return result_v;
 }
 
+void ForwardExecutor::RecordOpTraceInner(const std::string &op_name) {
+  auto op_hash = std::hash<std::string>()(op_name);
+  for (auto &trace_hash : op_trace_hashes_) {
+    trace_hash = hash_combine(trace_hash, op_hash);
+  }
+}
+
+size_t ForwardExecutor::EndOpTrace() {
+  if (op_trace_hashes_.empty()) {
+    MS_LOG(DEBUG) << "The op trace is cleared";
+    return 0;
+  }
+  auto trace_hash = op_trace_hashes_.back();
+  op_trace_hashes_.pop_back();
+  return trace_hash;
+}
+
 void ForwardExecutor::ClearRes() {
   MS_LOG(DEBUG) << "Clear forward res";
   {
@@ -1147,6 +1167,7 @@ void ForwardExecutor::ClearRes() {
   infer_operation()->ClearPrimAbsList();
   infer_operation()->ClearConstFlagPrimCache();
   std::stack<CellPtr>().swap(forward_cell_stack_);
+  op_trace_hashes_.clear();
   mindrt_backends_.clear();
   slice_prim_cache_.clear();
 }
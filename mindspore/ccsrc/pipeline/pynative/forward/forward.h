@@ -110,8 +110,18 @@ class ForwardExecutor {
     return pyboost_cast_operation_;
   }
   void ChildAfterFork();
+  // Record the types of the ops run between BeginOpTrace and EndOpTrace, which guards the lazy eager mode of cell.
+  // The traces can be nested, an op is recorded by all the traces in progress.
+  void BeginOpTrace() { (void)op_trace_hashes_.emplace_back(0); }
+  size_t EndOpTrace();
+  inline void RecordOpTrace(const std::string &op_name) {
+    if (!op_trace_hashes_.empty()) {
+      RecordOpTraceInner(op_name);
+    }
+  }
 
  private:
+  void RecordOpTraceInner(const std::string &op_name);
   compile::MindRTBackendPtr GetMindRtBackend(const string &cur_device_target);
   inline CastOperationPtr cast_operation() const {
     MS_EXCEPTION_IF_NULL(cast_operation_);
@@ -168,6 +178,7 @@ class ForwardExecutor {
   InferOperationPtr infer_operation_;
   MindrtBackendMap mindrt_backends_;
   mindspore::HashMap<std::string, PrimitivePtr> slice_prim_cache_;
+  std::vector<size_t> op_trace_hashes_;
 };
 }  // namespace pynative
 }  // namespace mindspore
@@ -131,6 +131,10 @@ py::object PyNativeExecutor::RunSliceOpStub(const std::vector<ValuePtr> &input_v
                                             const std::vector<SliceOpInfoPtr> &slice_op_infos) const {
   runtime::ProfilerStageRecorder recorder(runtime::ProfilerStage::kRunOp);
   SetCallbackForInputTensor(input_values);
+  for (const auto &slice_op_info : slice_op_infos) {
+    MS_EXCEPTION_IF_NULL(slice_op_info);
+    forward_executor()->RecordOpTrace(slice_op_info->slice_op_name);
+  }
   auto requires_grad = grad_executor()->RequiresGrad();
   if (!forward_executor()->EnablePipeline("")) {
     forward_executor()->WaitForwardTask();
@@ -289,6 +293,10 @@ void PyNativeExecutor::SetJitCompileStatus(bool is_compiling, const std::string
   grad_executor()->jit()->set_graph_phase(phase);
 }
 
+void PyNativeExecutor::BeginOpTrace() const { forward_executor()->BeginOpTrace(); }
+
+size_t PyNativeExecutor::EndOpTrace() const { return forward_executor()->EndOpTrace(); }
+
 void PyNativeExecutor::SetDynamicInput(const py::object &obj, const py::args &args) const {
   grad_executor()->SaveDynamicInputsCells(obj, args);
   if (grad_executor()->dynamic_shape()->enable_unknown_shape()) {
@@ -363,6 +371,8 @@ void RegPyNativeExecutor(const py::module *m) {
     .def("set_kernel_build_server_dir", &PyNativeExecutor::set_kernel_build_server_dir,
          py::arg("kernel_build_server_dir") = py::str(""), "set kernel build server directory path.")
     .def("set_jit_compile_status", &PyNativeExecutor::SetJitCompileStatus, "set jit compile status.")
+    .def("begin_op_trace", &PyNativeExecutor::BeginOpTrace, "begin to record the types of ops run.")
+    .def("end_op_trace", &PyNativeExecutor::EndOpTrace, "end the op trace and return its hash.")
     .def("real_run_op", &PyNativeExecutor::RealRunOp, "Run op pynatively.")
     .def("run_op_async", &PyNativeExecutor::RunOpStub, "run op asynchronously")
     .def("constant_folding", &PyNativeExecutor::CallConstantFolding, "Call Constant Folding Primitive");
@@ -82,6 +82,8 @@ class PyNativeExecutor : public std::enable_shared_from_this<PyNativeExecutor> {
   bool IsFirstCell() const;
   void WorkerJoin();
   void SetJitCompileStatus(bool is_compiling, const std::string &phase) const;
+  void BeginOpTrace() const;
+  size_t EndOpTrace() const;
   void ParentBeforeFork();
   void ChildAfterFork();
   py::object RunSliceOpStub(const std::vector<ValuePtr> &input_v,
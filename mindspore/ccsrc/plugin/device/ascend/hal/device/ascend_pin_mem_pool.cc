@@ -52,6 +52,7 @@ void AscendPinMemPool::PinnedMemAlloc(DeviceMemPtr *addr, size_t alloc_size) {
 
 bool AscendPinMemPool::FreeDeviceMem(const DeviceMemPtr &addr) {
   MS_EXCEPTION_IF_NULL(addr);
+  OnMemBlockFree(addr);
   if (pinned_mem_) {
     (void)CALL_ASCEND_API(aclrtFreeHost, addr);
   } else {
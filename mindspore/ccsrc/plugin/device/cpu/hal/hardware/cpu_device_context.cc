@@ -28,6 +28,7 @@
 #endif
 #include "plugin/factory/ms_factory.h"
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
 #include "kernel/kernel_build_info.h"
 #include "kernel/framework_utils.h"
 #include "plugin/device/cpu/hal/device/kernel_select_cpu.h"
@@ -138,6 +139,8 @@ void CPUDeviceResManager::Initialize() {
 }
 
 void CPUDeviceResManager::Destroy() {
+  // The entries of the parallel search are appended as they converge, compact them while the process is still alive.
+  kernel::ParallelSearchCache::GetInstance().Save();
   // Release memory.
   if (mem_manager_ != nullptr) {
     mem_manager_->Finalize();
@@ -578,6 +581,10 @@ bool CPUKernelExecutor::DoLaunchKernel(const CNodePtr &kernel, const std::vector
                                        const std::vector<KernelTensor *> &outputs, KernelMod *kernel_mod) const {
   MS_EXCEPTION_IF_NULL(kernel);
   MS_EXCEPTION_IF_NULL(kernel_mod);
+  if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeCpuKernelMod) {
+    // The shapes are only changed by Resize, the key is kept for the launches in between.
+    static_cast<kernel::NativeCpuKernelMod *>(kernel_mod)->UpdateParallelSearchKey(inputs, outputs);
+  }
   uint64_t start_time = 0;
   PROFILER_START(start_time);
   auto ret = kernel_mod->Launch(inputs, workspace, outputs, nullptr);
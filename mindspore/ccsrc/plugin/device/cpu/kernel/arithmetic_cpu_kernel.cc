@@ -32,6 +32,7 @@
 #include "plugin/device/cpu/kernel/nnacl/fp32/power_fp32.h"
 #include "plugin/device/cpu/kernel/nnacl/fp32/sub_fp32.h"
 #include "plugin/device/cpu/kernel/nnacl/fp32/add_fp32.h"
+#include "plugin/device/cpu/kernel/nnacl/bf16/arithmetic_bf16.h"
 #include "Eigen/Eigen"
 
 namespace mindspore {
@@ -303,6 +304,29 @@ void ArithmeticCpuTypeFunc<T>::Add(const T *input1, const T *input2, T *out) {
       ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
       return;
     }
+  } else if constexpr (std::is_same_v<T, bfloat16>) {
+    // Computed in float32 by simd and rounded once, which is the same as the operator of bfloat16.
+    auto in0 = reinterpret_cast<const uint16_t *>(input1);
+    auto in1 = reinterpret_cast<const uint16_t *>(input2);
+    auto dst = reinterpret_cast<uint16_t *>(out);
+    if (input_shape1_ == input_shape2_) {
+      auto task = [in0, in1, dst](size_t start, size_t end) {
+        (void)ElementAddBf16(in0 + start, in1 + start, dst + start, end - start);
+      };
+      ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
+      return;
+    }
+    if (op_para_.in_elements_num0_ == 1 || op_para_.in_elements_num1_ == 1) {
+      auto task = [this, in0, in1, dst](size_t start, size_t end) {
+        if (op_para_.in_elements_num0_ == 1) {
+          (void)ElementOptAddBf16(in0, in1 + start, dst + start, end - start, true);
+        } else {
+          (void)ElementOptAddBf16(in0 + start, in1, dst + start, end - start, false);
+        }
+      };
+      ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
+      return;
+    }
   }
   if (!is_init_broadcast_) {
     InitBroadCast();
@@ -382,6 +406,29 @@ void ArithmeticCpuTypeFunc<T>::Mul(const T *input1, const T *input2, T *out) {
       ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
       return;
     }
+  } else if constexpr (std::is_same_v<T, bfloat16>) {
+    // Computed in float32 by simd and rounded once, which is the same as the operator of bfloat16.
+    auto in0 = reinterpret_cast<const uint16_t *>(input1);
+    auto in1 = reinterpret_cast<const uint16_t *>(input2);
+    auto dst = reinterpret_cast<uint16_t *>(out);
+    if (input_shape1_ == input_shape2_) {
+      auto task = [in0, in1, dst](size_t start, size_t end) {
+        (void)ElementMulBf16(in0 + start, in1 + start, dst + start, end - start);
+      };
+      ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
+      return;
+    }
+    if (op_para_.in_elements_num0_ == 1 || op_para_.in_elements_num1_ == 1) {
+      auto task = [this, in0, in1, dst](size_t start, size_t end) {
+        if (op_para_.in_elements_num0_ == 1) {
+          (void)ElementOptMulBf16(in0, in1 + start, dst + start, end - start, true);
+        } else {
+          (void)ElementOptMulBf16(in0 + start, in1, dst + start, end - start, false);
+        }
+      };
+      ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
+      return;
+    }
   }
   if (!is_init_broadcast_) {
     InitBroadCast();
@@ -942,6 +989,11 @@ static std::map<std::string, std::vector<std::pair<KernelAttr, ArithmeticCpuFunc
      SpecializeArithFunc<float>},
     {KernelAttr().AddInputAttr(kNumberTypeFloat64).AddInputAttr(kNumberTypeFloat64).AddOutputAttr(kNumberTypeFloat64),
      SpecializeArithFunc<double>},
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddOutputAttr(kNumberTypeBFloat16),
+     SpecializeArithFunc<bfloat16>},
     {KernelAttr()
        .AddInputAttr(kNumberTypeComplex64)
        .AddInputAttr(kNumberTypeComplex64)
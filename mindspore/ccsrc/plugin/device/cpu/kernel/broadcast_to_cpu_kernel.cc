@@ -16,126 +16,107 @@
 
 #include <algorithm>
 #include <utility>
-#include <complex>
-#include "plugin/device/cpu/kernel/nnacl/errorcode.h"
+#include "abstract/utils.h"
 #include "mindspore/core/ops/array_ops.h"
 #include "plugin/device/cpu/kernel/broadcast_to_cpu_kernel.h"
 
 namespace mindspore {
 namespace kernel {
 namespace {
-using complex64 = std::complex<float>;
-using complex128 = std::complex<double>;
 constexpr size_t kBroadcastToOutputsNum = 1;
 }  // namespace
 
-#define BROADCAST_TO_CPU_REG(MS_T, T)                                                                   \
-  KernelAttr().AddInputAttr(MS_T).AddInputAttr(kObjectTypeTuple, kNumberTypeInt64).AddOutputAttr(MS_T), \
-    &BroadcastToCpuKernelMod::LaunchKernel<T>
-
-std::map<std::string, std::vector<std::pair<KernelAttr, BroadcastToCpuKernelMod::BroadcastToFunc>>>
-  BroadcastToCpuKernelMod::func_list_ = {{kBroadcastTo,
-                                          {{BROADCAST_TO_CPU_REG(kNumberTypeInt8, int8_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeInt16, int16_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeInt32, int32_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeInt64, int64_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeUInt8, uint8_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeUInt16, uint16_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeUInt32, uint32_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeUInt64, uint64_t)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeFloat16, float16)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeFloat32, float)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeFloat64, double)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeComplex64, complex64)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeComplex128, complex128)},
-                                           {BROADCAST_TO_CPU_REG(kNumberTypeBool, bool)}}},
-                                         {kDynamicBroadcastTo,
-                                          {{KernelAttr()
-                                              .AddInputAttr(kNumberTypeFloat32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
-                                              .AddOutputAttr(kNumberTypeFloat32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<float>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeFloat32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeFloat32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<float>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeInt32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
-                                              .AddOutputAttr(kNumberTypeInt32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeBool)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
-                                              .AddOutputAttr(kNumberTypeBool),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<bool>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeInt8)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
-                                              .AddOutputAttr(kNumberTypeInt8),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeFloat32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeFloat32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<float>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeInt32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeInt32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeBool)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeBool),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<bool>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeInt8)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeInt8),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeUInt8)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeUInt8),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeUInt16)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeUInt16),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeUInt32)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeUInt32),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeUInt64)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeUInt64),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int>},
-                                           {KernelAttr()
-                                              .AddInputAttr(kNumberTypeInt64)
-                                              .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
-                                              .AddOutputAttr(kNumberTypeUInt64),
-                                            &BroadcastToCpuKernelMod::LaunchKernel<int64_t>}}}};
+#define BROADCAST_TO_CPU_REG(MS_T) \
+  KernelAttr().AddInputAttr(MS_T).AddInputAttr(kObjectTypeTuple, kNumberTypeInt64).AddOutputAttr(MS_T)
+
+std::map<std::string, std::vector<KernelAttr>> BroadcastToCpuKernelMod::support_list_ = {
+  {kBroadcastTo,
+   {BROADCAST_TO_CPU_REG(kNumberTypeInt8),
+    BROADCAST_TO_CPU_REG(kNumberTypeInt16),
+    BROADCAST_TO_CPU_REG(kNumberTypeInt32),
+    BROADCAST_TO_CPU_REG(kNumberTypeInt64),
+    BROADCAST_TO_CPU_REG(kNumberTypeUInt8),
+    BROADCAST_TO_CPU_REG(kNumberTypeUInt16),
+    BROADCAST_TO_CPU_REG(kNumberTypeUInt32),
+    BROADCAST_TO_CPU_REG(kNumberTypeUInt64),
+    BROADCAST_TO_CPU_REG(kNumberTypeFloat16),
+    BROADCAST_TO_CPU_REG(kNumberTypeFloat32),
+    BROADCAST_TO_CPU_REG(kNumberTypeFloat64),
+    BROADCAST_TO_CPU_REG(kNumberTypeComplex64),
+    BROADCAST_TO_CPU_REG(kNumberTypeComplex128),
+    BROADCAST_TO_CPU_REG(kNumberTypeBool)}},
+  {kDynamicBroadcastTo,
+   {KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeFloat32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeFloat32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeInt32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeInt32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeBool)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeBool),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeInt8)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeInt8),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeFloat32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeInt32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeInt32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeBool)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeBool),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeInt8)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeInt8),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeUInt8)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeUInt8),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeUInt16)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeUInt16),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeUInt32)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeUInt32),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeUInt64)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeUInt64),
+    KernelAttr()
+       .AddInputAttr(kNumberTypeInt64)
+       .AddInputAttr(kObjectTypeTuple, kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeUInt64)}}};
 
 bool BroadcastToCpuKernelMod::Init(const std::vector<KernelTensor *> &inputs,
                                    const std::vector<KernelTensor *> &outputs) {
   kernel_type_ = kernel_name_;
-  auto iter = func_list_.find(kernel_type_);
-  if (iter == func_list_.end()) {
+  auto iter = support_list_.find(kernel_type_);
+  if (iter == support_list_.end()) {
     MS_LOG(EXCEPTION) << "BroadcastTo cpu does not support " << kernel_type_;
   }
 
   auto kernel_attr = GetKernelAttrFromTensors(inputs, outputs);
-  auto [is_match, index] = MatchKernelAttr(kernel_attr, GetOpSupport());
+  auto is_match = MatchKernelAttr(kernel_attr, GetOpSupport()).first;
   if (!is_match) {
     MS_LOG(ERROR) << "For '" << kernel_name_ << "' does not support this kernel type: " << kernel_attr;
     return false;
   }
-  kernel_func_ = func_list_[kernel_type_][index].second;
   return true;
 }
 
@@ -149,17 +130,9 @@ int BroadcastToCpuKernelMod::Resize(const std::vector<KernelTensor *> &inputs,
     return KRET_UNKNOWN_SHAPE;
   }
 
-  size_t input_shape_size = input_shape_.size();
-  size_t output_shape_size = output_shape_.size();
-
-  for (size_t i = 0; i < input_shape_size; ++i) {
-    shape_info_.input_shape_[i] = LongToInt(input_shape_[i]);
+  if (output_shape_.size() >= input_shape_.size()) {
+    engine_.InitBroadcast(input_shape_, output_shape_, abstract::TypeIdSize(inputs[kIndex0]->dtype_id()));
   }
-  for (size_t i = 0; i < output_shape_size; ++i) {
-    shape_info_.output_shape_[i] = LongToInt(output_shape_[i]);
-  }
-  shape_info_.input_shape_size_ = SizeToInt(input_shape_size);
-  shape_info_.output_shape_size_ = SizeToInt(output_shape_size);
   int ret = KernelMod::Resize(inputs, outputs);
   return ret;
 }
@@ -191,10 +164,8 @@ void BroadcastToCpuKernelMod::CheckArgs() {
   }
 }
 
-template <typename T>
-bool BroadcastToCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs,
-                                           const std::vector<KernelTensor *> &,
-                                           const std::vector<KernelTensor *> &outputs) {
+bool BroadcastToCpuKernelMod::Launch(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &,
+                                     const std::vector<KernelTensor *> &outputs) {
   CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kBroadcastToOutputsNum, kernel_name_);
   CheckArgs();
 
@@ -202,69 +173,16 @@ bool BroadcastToCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &in
       std::find(output_shape_.begin(), output_shape_.end(), 0) != output_shape_.end()) {
     return true;
   }
-
-  const void *input_addr = inputs[0]->device_ptr();
-  void *output_addr = outputs[0]->device_ptr();
-
-  if (output_shape_.empty()) {
-    *(reinterpret_cast<T *>(output_addr)) = *(reinterpret_cast<const T *>(input_addr));
-    return true;
-  }
-
-  int status = static_cast<int>(NNACL_OK);
-  if constexpr (std::is_same_v<T, bool>) {
-    status = BroadcastToSize8(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, int8_t>) {
-    status = BroadcastToSize8(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, int16_t>) {
-    status = BroadcastToSize16(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, int32_t>) {
-    status = BroadcastToSize32(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, int64_t>) {
-    status = BroadcastToSize64(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, uint8_t>) {
-    status = BroadcastToSize8(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, uint16_t>) {
-    status = BroadcastToSize16(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, uint32_t>) {
-    status = BroadcastToSize32(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, uint64_t>) {
-    status = BroadcastToSize64(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, float16>) {
-    status = BroadcastToSize16(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, float>) {
-    status = BroadcastToSize32(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, double>) {
-    status = BroadcastToSize64(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, complex64>) {
-    status = BroadcastToSize64(input_addr, &shape_info_, output_addr);
-  } else if constexpr (std::is_same_v<T, complex128>) {
-    status = BroadcastToSize128(input_addr, &shape_info_, output_addr);
-  } else {
-    MS_LOG(EXCEPTION) << "For '" << kernel_name_
-                      << "', not supported data type, the dtype of input must be bool, int, complex, float or double";
-  }
-
-  if (status != static_cast<int>(NNACL_OK)) {
-    MS_LOG(EXCEPTION) << "For '" << kernel_name_
-                      << "', each dimension pair, 'input_x' shape and target shape, "
-                         "must be either equal or input is one or the target dimension is -1. "
-                         "But got 'input_x' shape: "
-                      << input_shape_ << " and target shape: " << output_shape_ << ". Error code: " << status;
-  }
+  engine_.Run(inputs[kIndex0]->device_ptr(), outputs[kIndex0]->device_ptr());
   return true;
 }
 
 std::vector<KernelAttr> BroadcastToCpuKernelMod::GetOpSupport() {
-  auto iter = func_list_.find(kernel_type_);
-  if (iter == func_list_.end()) {
+  auto iter = support_list_.find(kernel_type_);
+  if (iter == support_list_.end()) {
     MS_LOG(EXCEPTION) << "not support " << kernel_type_ << "!";
   }
-
-  std::vector<KernelAttr> support_list;
-  (void)std::transform(iter->second.begin(), iter->second.end(), std::back_inserter(support_list),
-                       [](const std::pair<KernelAttr, BroadcastToFunc> &pair) { return pair.first; });
-  return support_list;
+  return iter->second;
 }
 
 MS_KERNEL_FACTORY_REG_BY_CREATOR(NativeCpuKernelMod, BroadcastTo,
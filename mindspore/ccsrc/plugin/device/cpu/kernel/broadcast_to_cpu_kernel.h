@@ -26,7 +26,7 @@
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
 #include "mindspore/core/ops/array_ops.h"
 #include "plugin/factory/ms_factory.h"
-#include "plugin/device/cpu/kernel/nnacl/base/broadcast_to.h"
+#include "plugin/device/cpu/kernel/utils/transpose_engine.h"
 
 namespace mindspore {
 namespace kernel {
@@ -40,9 +40,7 @@ class BroadcastToCpuKernelMod : public NativeCpuKernelMod {
   ~BroadcastToCpuKernelMod() = default;
 
   bool Launch(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
-              const std::vector<KernelTensor *> &outputs) override {
-    return kernel_func_(this, inputs, workspace, outputs);
-  }
+              const std::vector<KernelTensor *> &outputs) override;
 
   bool Init(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
 
@@ -53,20 +51,11 @@ class BroadcastToCpuKernelMod : public NativeCpuKernelMod {
   std::vector<KernelAttr> GetOpSupport() override;
 
  private:
-  template <typename T>
-  bool LaunchKernel(const std::vector<kernel::KernelTensor *> &inputs,
-                    const std::vector<kernel::KernelTensor *> &workspace,
-                    const std::vector<kernel::KernelTensor *> &outputs);
-  using BroadcastToFunc =
-    std::function<bool(BroadcastToCpuKernelMod *, const std::vector<kernel::KernelTensor *> &,
-                       const std::vector<kernel::KernelTensor *> &, const std::vector<kernel::KernelTensor *> &)>;
-  static std::map<std::string, std::vector<std::pair<KernelAttr, BroadcastToFunc>>> func_list_;
-  BroadcastToFunc kernel_func_;
+  static std::map<std::string, std::vector<KernelAttr>> support_list_;
 
-  void InitTaskFunc(const CNodePtr &kernel_node);
   ShapeVector input_shape_;
   ShapeVector output_shape_;
-  BroadcastShapeInfo shape_info_{};
+  TransposeEngine engine_;
   std::string kernel_type_{kUnknown};
 };
 }  // namespace kernel
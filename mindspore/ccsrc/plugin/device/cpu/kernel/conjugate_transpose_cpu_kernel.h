@@ -24,6 +24,7 @@
 #include <string>
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
 #include "plugin/factory/ms_factory.h"
+#include "plugin/device/cpu/kernel/utils/transpose_engine.h"
 #include "nnacl/transpose_parameter.h"
 
 namespace mindspore {
@@ -91,47 +92,14 @@ class ConjugateTransposeCpuKernelMod : public NativeCpuKernelMod {
 
  private:
   template <typename T>
-  void LaunchKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
+  std::vector<int64_t> GetPerm(const KernelTensor *perm_tensor) const;
   template <typename T>
-  void LaunchComplexKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
-  template <typename T>
-  void ParallelRun(const T *input_addr, T *output_addr, const int *output_shape, size_t count,
-                   const TransposeParameter *transpose_param);
-  template <typename T>
-  int DoTranspose(const T *in_data, T *out_data, const int *output_shape, const TransposeParameter *transpose_param);
-  template <typename T>
-  void TransposeDim2(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDim3(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDim4(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDim5(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDim6(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDim7(const T *in_data, T *out_data, const int *strides, const int *out_strides, const int *perm,
-                     const int *output_shape);
-  template <typename T>
-  void TransposeDims(const T *in_data, T *out_data, const int *output_shape, const TransposeParameter *transpose_param,
-                     const int task_id, const int thread_num);
+  void ConjOutput(const std::vector<KernelTensor *> &outputs);
 
-  int data_size = 0;
-  TransposeParameter transpose_param_;
   std::vector<int64_t> input_shape_;
-  std::vector<int64_t> output_shape_;
-  std::vector<size_t> axes_;
   TypeId dtype_{kTypeUnknown};
   TypeId perm_type_{kTypeUnknown};
-  using TypeKernel = std::function<void(ConjugateTransposeCpuKernelMod *, const std::vector<KernelTensor *> &,
-                                        const std::vector<KernelTensor *> &)>;
-  std::unordered_map<TypeId, TypeKernel> launch_map_;
-  TypeKernel launch_func_;
+  TransposeEngine engine_;
 };
 }  // namespace kernel
 }  // namespace mindspore
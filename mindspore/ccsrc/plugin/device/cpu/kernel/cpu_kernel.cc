@@ -22,10 +22,13 @@
 #include <map>
 #include <set>
 #include <numeric>
+#include <sstream>
 #include "kernel/oplib/oplib.h"
 #include "utils/profile.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "kernel/common_utils.h"
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
+#include "utils/shape_utils.h"
 
 namespace mindspore {
 namespace kernel {
@@ -89,6 +92,60 @@ std::vector<KernelAttr> NativeCpuKernelMod::GetSupportFromOpLib(const std::strin
   return support_kernel_attrs;
 }
 
+bool NativeCpuKernelMod::IsParallelSearchShapeChanged(const std::vector<KernelTensor *> &inputs,
+                                                      const std::vector<KernelTensor *> &outputs) const {
+  if (parallel_search_shapes_.size() != inputs.size() + outputs.size()) {
+    return true;
+  }
+  size_t index = 0;
+  for (const auto *tensors : {&inputs, &outputs}) {
+    for (const auto *tensor : *tensors) {
+      if (tensor != nullptr && tensor->GetShapeVector() != parallel_search_shapes_[index]) {
+        return true;
+      }
+      ++index;
+    }
+  }
+  return false;
+}
+
+void NativeCpuKernelMod::UpdateParallelSearchKey(const std::vector<KernelTensor *> &inputs,
+                                                 const std::vector<KernelTensor *> &outputs) {
+  if (!ParallelSearchCache::GetInstance().enabled() || !IsParallelSearchShapeChanged(inputs, outputs)) {
+    return;
+  }
+  parallel_search_shapes_.clear();
+  std::ostringstream key;
+  key << kernel_name_;
+  if (primitive_ != nullptr) {
+    // the attributes like axis change the parallel tasks as much as the shapes do, sort them for a stable key
+    std::map<std::string, std::string> attrs;
+    for (const auto &attr : primitive_->attrs()) {
+      attrs[attr.first] = attr.second == nullptr ? "" : attr.second->ToString();
+    }
+    for (const auto &attr : attrs) {
+      key << "|" << attr.first << "=" << attr.second;
+    }
+  }
+  for (const auto *tensors : {&inputs, &outputs}) {
+    key << "|";
+    for (const auto *tensor : *tensors) {
+      if (tensor == nullptr) {
+        parallel_search_shapes_.emplace_back();
+        key << "null;";
+        continue;
+      }
+      parallel_search_shapes_.push_back(tensor->GetShapeVector());
+      key << TypeIdToString(tensor->dtype_id()) << ShapeVectorToString(tensor->GetShapeVector()) << ";";
+    }
+  }
+  auto key_str = key.str();
+  std::replace(key_str.begin(), key_str.end(), '\n', ' ');
+  ParallelSearchInfo search_info;
+  search_info.cache_key = std::move(key_str);
+  parallel_search_info_ = std::move(search_info);
+}
+
 void CPUKernelUtils::ExpandDimsTo4(ShapeVector *shape) {
   MS_EXCEPTION_IF_NULL(shape);
   auto len = shape->size();
@@ -268,6 +325,20 @@ void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
     parallel_search_info->kernel_thread_num_set = true;
   }
   const size_t AVG_COUNT = 5;
+  if (!parallel_search_info->cache_key.empty() && !parallel_search_info->cache_checked) {
+    // the best block size of a kernel configuration is also decided by the kernel threads and the task count
+    auto thread_pool = pool == nullptr ? GetActorMgrInnerThreadPool() : pool;
+    parallel_search_info->cache_key +=
+      "|threads=" + std::to_string(thread_pool->GetKernelThreadNum()) + "|count=" + std::to_string(count);
+    parallel_search_info->cache_checked = true;
+    size_t best_pow = 0;
+    if (ParallelSearchCache::GetInstance().Get(parallel_search_info->cache_key, &best_pow) &&
+        best_pow < parallel_search_info->max_pow) {
+      parallel_search_info->best_pow = best_pow;
+      parallel_search_info->best_block_size = static_cast<float>(count) / std::pow(2.0f, best_pow);
+      parallel_search_info->search_count = AVG_COUNT * parallel_search_info->max_pow;
+    }
+  }
   size_t current_pow = parallel_search_info->search_count / AVG_COUNT;
   if (current_pow < parallel_search_info->max_pow) {
     if (parallel_search_info->search_count % AVG_COUNT == 0) {
@@ -288,6 +359,10 @@ void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
       } else if (current_pow - parallel_search_info->best_pow >= 2) {
         parallel_search_info->search_count = AVG_COUNT * parallel_search_info->max_pow;
       }
+      if (parallel_search_info->search_count >= AVG_COUNT * parallel_search_info->max_pow &&
+          !parallel_search_info->cache_key.empty()) {
+        ParallelSearchCache::GetInstance().Put(parallel_search_info->cache_key, parallel_search_info->best_pow);
+      }
     }
   } else {
     ParallelLaunch(task, count, parallel_search_info->best_block_size, content, pool);
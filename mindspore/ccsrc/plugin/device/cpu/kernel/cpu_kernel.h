@@ -137,6 +137,9 @@ struct ParallelSearchInfo {
   size_t search_count{0};
   bool kernel_thread_num_set{false};
   size_t max_pow{6};
+  // Key of the kernel configuration in the ParallelSearchCache, empty when the result is not cached.
+  std::string cache_key;
+  bool cache_checked{false};
 };
 
 class BACKEND_EXPORT NativeCpuKernelMod : public CpuKernelMod {
@@ -167,12 +170,19 @@ class BACKEND_EXPORT NativeCpuKernelMod : public CpuKernelMod {
 
   enum KernelModType GetKernelModType() const override { return KernelModType::NativeCpuKernelMod; }
 
+  // Key parallel_search_info_ by the kernel configuration when the ParallelSearchCache is enabled, and restart the
+  // search when the shapes are changed by Resize.
+  void UpdateParallelSearchKey(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
+
   ParallelSearchInfo parallel_search_info_;
 
  protected:
   ThreadPool *pool_{nullptr};
 
  private:
+  bool IsParallelSearchShapeChanged(const std::vector<KernelTensor *> &inputs,
+                                    const std::vector<KernelTensor *> &outputs) const;
+  std::vector<ShapeVector> parallel_search_shapes_;
   std::vector<KernelAttr> GetAllSupportedList(const std::string &kernel_name);
   std::vector<KernelAttr> GetSupportFromOpLib(const std::string &kernel_name) const;
   inline static mindspore::HashMap<std::string, std::vector<KernelAttr>> support_map_;
@@ -38,6 +38,15 @@ bool DataFormatVecPermuteCpuKernelMod::Init(const std::vector<KernelTensor *> &i
 
   src_format_ = GetValue<std::string>(primitive_->GetAttr(ops::kSrcFormat));
   dst_format_ = GetValue<std::string>(primitive_->GetAttr(ops::kDstFormat));
+  format_perm_.clear();
+  for (size_t i = 0; i < dst_format_.size(); i++) {
+    auto pos = src_format_.find(dst_format_[i]);
+    if (pos == std::string::npos) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', the dst_format " << dst_format_
+                        << " must be a permutation of the src_format " << src_format_;
+    }
+    format_perm_.push_back(pos);
+  }
   input_type_ = inputs[0]->dtype_id();
   output_type_ = outputs[0]->dtype_id();
   return true;
@@ -63,26 +72,11 @@ bool DataFormatVecPermuteCpuKernelMod::LaunchKernel(const std::vector<kernel::Ke
   CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kDataFormatVecPermuteOutputsNum, kernel_name_);
   auto input = reinterpret_cast<T *>(inputs[0]->device_ptr());
   auto output = reinterpret_cast<T *>(outputs[0]->device_ptr());
-  size_t dim1 = 1;
-  size_t dim2 = 2;
-  if (dim_ == dim1) {
-    for (size_t i = 0; i < dst_format_.size(); i++) {
-      for (size_t j = 0; j < src_format_.size(); j++) {
-        if (dst_format_[i] == src_format_[j]) {
-          output[i] = input[j];
-          break;
-        }
-      }
-    }
-  } else if (dim_ == dim2) {
-    for (size_t i = 0; i < dst_format_.size(); i++) {
-      for (size_t j = 0; j < src_format_.size(); j++) {
-        if (dst_format_[i] == src_format_[j]) {
-          output[i * dim2] = input[j * dim2];
-          output[i * dim2 + 1] = input[j * dim2 + 1];
-          break;
-        }
-      }
+  // The entries of 1-D input are the values of the dims, and the rows of 2-D input are the pairs of the dims.
+  size_t row_size = dim_ == kDim2 ? kDim2 : 1;
+  for (size_t i = 0; i < format_perm_.size(); i++) {
+    for (size_t j = 0; j < row_size; j++) {
+      output[i * row_size + j] = input[format_perm_[i] * row_size + j];
     }
   }
   return true;
@@ -54,6 +54,8 @@ class DataFormatVecPermuteCpuKernelMod : public NativeCpuKernelMod {
   DataFormatVecPermuteFunc kernel_func_;
   std::string src_format_;
   std::string dst_format_;
+  // The output entry i is the input entry format_perm_[i], which is found in Init.
+  std::vector<size_t> format_perm_;
   std::vector<int64_t> input_shape_;
   std::vector<int64_t> output_shape_;
   TypeId input_type_{kTypeUnknown};
@@ -0,0 +1,274 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/flash_attention_score_cpu_kernel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include "base/float16.h"
+#include "mindspore/core/ops/flash_attention_score.h"
+#include "plugin/device/cpu/kernel/utils/flash_attention_helper.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kFlashAttentionScoreRankBSH = 3;
+constexpr size_t kFlashAttentionScoreRankBNSD = 4;
+constexpr size_t kSoftmaxLastDim = 8;
+// Query rows of a task, which share the key and value rows read.
+constexpr size_t kFlashAttentionQTile = 32;
+constexpr int64_t kFlashAttentionNoBand = std::numeric_limits<int32_t>::max();
+}  // namespace
+
+bool FlashAttentionScoreCpuKernelMod::Init(const std::vector<KernelTensor *> &inputs,
+                                           const std::vector<KernelTensor *> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), ops::kFlashAttentionScoreInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), ops::kFlashAttentionScoreOutputsNum, kernel_name_);
+  auto kernel_attr = GetKernelAttrFromTensors(inputs, outputs);
+  auto [is_match, index] = MatchKernelAttr(kernel_attr, GetOpSupport());
+  if (!is_match) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', it does not support this kernel data type: " << kernel_attr;
+    return false;
+  }
+  kernel_func_ = func_list_[index].second;
+
+  head_num_ = LongToSize(GetValue<int64_t>(primitive_->GetAttr(kAttrHeadNum)));
+  scale_value_ = GetValue<float>(primitive_->GetAttr(kAttrScaleValue));
+  pre_tokens_ = GetValue<int64_t>(primitive_->GetAttr(kAttrPreTokens));
+  next_tokens_ = GetValue<int64_t>(primitive_->GetAttr(kAttrNextTokens));
+  sparse_mode_ = GetValue<int64_t>(primitive_->GetAttr(kAttrSparseMode));
+  bsh_layout_ = GetValue<std::string>(primitive_->GetAttr(kAttrInputLayout)) == "BSH";
+  const auto keep_prob = GetValue<float>(primitive_->GetAttr(kAttrKeepProb));
+  if (std::fabs(keep_prob - 1.0f) > std::numeric_limits<float>::epsilon()) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', dropout is not supported on CPU, keep_prob should be 1.0, but got "
+                  << keep_prob;
+    return false;
+  }
+  if (sparse_mode_ < ops::kSparseDefaultMask || sparse_mode_ > ops::kSparseBand || head_num_ == 0) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the sparse_mode should be in [0, 4] and head_num should be "
+                  << "positive on CPU, but got " << sparse_mode_ << " and " << head_num_;
+    return false;
+  }
+  return true;
+}
+
+int FlashAttentionScoreCpuKernelMod::Resize(const std::vector<KernelTensor *> &inputs,
+                                            const std::vector<KernelTensor *> &outputs) {
+  if (auto ret = KernelMod::Resize(inputs, outputs); ret != KRET_OK) {
+    return ret;
+  }
+  for (size_t index : {ops::kFlashAttentionScoreInputRealShiftIndex, ops::kFlashAttentionScoreInputDropMaskIndex,
+                       ops::kFlashAttentionScoreInputPaddingMaskIndex, ops::kFlashAttentionScoreInputPrefixIndex}) {
+    if (!inputs[index]->GetType()->isa<TypeNone>()) {
+      MS_LOG(ERROR) << "For '" << kernel_name_ << "', real_shift, drop_mask, padding_mask and prefix should be None "
+                    << "on CPU, but got input " << index;
+      return KRET_RESIZE_FAILED;
+    }
+  }
+  const auto &query_shape = inputs[ops::kFlashAttentionScoreInputQueryIndex]->GetShapeVector();
+  const auto &key_shape = inputs[ops::kFlashAttentionScoreInputKeyIndex]->GetShapeVector();
+  const size_t rank = bsh_layout_ ? kFlashAttentionScoreRankBSH : kFlashAttentionScoreRankBNSD;
+  if (query_shape.size() != rank || key_shape.size() != rank) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the rank of query and key should be " << rank << ", but got "
+                  << query_shape << " and " << key_shape;
+    return KRET_RESIZE_FAILED;
+  }
+  batch_size_ = LongToSize(query_shape[kIndex0]);
+  if (bsh_layout_) {
+    q_seq_len_ = LongToSize(query_shape[kIndex1]);
+    kv_seq_len_ = LongToSize(key_shape[kIndex1]);
+    head_dim_ = LongToSize(query_shape[kIndex2]) / head_num_;
+    kv_head_num_ = head_dim_ == 0 ? 0 : LongToSize(key_shape[kIndex2]) / head_dim_;
+  } else {
+    q_seq_len_ = LongToSize(query_shape[kIndex2]);
+    kv_seq_len_ = LongToSize(key_shape[kIndex2]);
+    head_dim_ = LongToSize(query_shape[kIndex3]);
+    kv_head_num_ = LongToSize(key_shape[kIndex1]);
+  }
+  if (kv_head_num_ == 0 || head_num_ % kv_head_num_ != 0) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the head num of key should be a factor of the head num "
+                  << head_num_ << " of query, but got shapes " << query_shape << " and " << key_shape;
+    return KRET_RESIZE_FAILED;
+  }
+
+  const auto &attn_mask = inputs[ops::kFlashAttentionScoreInputAttnMaskIndex];
+  // The compressed attn_mask of the causal and band modes is the same as the one computed from the sparse mode.
+  has_attn_mask_ = !attn_mask->GetType()->isa<TypeNone>() && sparse_mode_ <= ops::kSparseAllMask;
+  if (sparse_mode_ == ops::kSparseAllMask && !has_attn_mask_) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', attn_mask is required when sparse_mode is 1.";
+    return KRET_RESIZE_FAILED;
+  }
+  if (has_attn_mask_) {
+    const auto &mask_shape = attn_mask->GetShapeVector();
+    attn_mask_batch_shared_ = mask_shape.size() == kDim2;
+    attn_mask_head_shared_ = attn_mask_batch_shared_ || mask_shape[kIndex1] == 1;
+  }
+  return KRET_OK;
+}
+
+template <typename T>
+bool FlashAttentionScoreCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs,
+                                                   const std::vector<KernelTensor *> &,
+                                                   const std::vector<KernelTensor *> &outputs) {
+  auto *softmax_out = GetDeviceAddress<T>(outputs, ops::kFlashAttentionScoreOutputSoftmaxOutIndex);
+  if (softmax_out != nullptr) {
+    // The softmax output is a placeholder of one element.
+    *softmax_out = static_cast<T>(0);
+  }
+  if (batch_size_ * head_num_ * q_seq_len_ * head_dim_ == 0) {
+    return true;
+  }
+  const auto *query = GetDeviceAddress<T>(inputs, ops::kFlashAttentionScoreInputQueryIndex);
+  const auto *key = GetDeviceAddress<T>(inputs, ops::kFlashAttentionScoreInputKeyIndex);
+  const auto *value = GetDeviceAddress<T>(inputs, ops::kFlashAttentionScoreInputValueIndex);
+  const auto *attn_mask =
+    has_attn_mask_ ? GetDeviceAddress<uint8_t>(inputs, ops::kFlashAttentionScoreInputAttnMaskIndex) : nullptr;
+  auto *softmax_max = GetDeviceAddress<float>(outputs, ops::kFlashAttentionScoreOutputSoftmaxMaxIndex);
+  auto *softmax_sum = GetDeviceAddress<float>(outputs, ops::kFlashAttentionScoreOutputSoftmaxSumIndex);
+  auto *output = GetDeviceAddress<T>(outputs, ops::kFlashAttentionScoreOutputAttentionOutIndex);
+  MS_EXCEPTION_IF_NULL(query);
+  MS_EXCEPTION_IF_NULL(key);
+  MS_EXCEPTION_IF_NULL(value);
+  MS_EXCEPTION_IF_NULL(softmax_max);
+  MS_EXCEPTION_IF_NULL(softmax_sum);
+  MS_EXCEPTION_IF_NULL(output);
+  if (has_attn_mask_) {
+    MS_EXCEPTION_IF_NULL(attn_mask);
+  }
+
+  // Key row j is kept for query row i if -pre_tokens <= j - i - shift <= next_tokens, where the shift aligns the last
+  // rows of query and key in the right down modes.
+  const int64_t q_seq_len = SizeToLong(q_seq_len_);
+  const int64_t kv_seq_len = SizeToLong(kv_seq_len_);
+  int64_t shift = 0;
+  int64_t pre_tokens = pre_tokens_;
+  int64_t next_tokens = next_tokens_;
+  if (sparse_mode_ == ops::kSparseAllMask || (sparse_mode_ == ops::kSparseDefaultMask && !has_attn_mask_)) {
+    pre_tokens = kFlashAttentionNoBand;
+    next_tokens = kFlashAttentionNoBand;
+  } else if (sparse_mode_ == ops::kSparseLeftUpCausal || sparse_mode_ == ops::kSparseRightDownCausal) {
+    pre_tokens = kFlashAttentionNoBand;
+    next_tokens = 0;
+  }
+  if (sparse_mode_ == ops::kSparseRightDownCausal || sparse_mode_ == ops::kSparseBand) {
+    shift = kv_seq_len - q_seq_len;
+  }
+
+  const size_t hidden_size = head_num_ * head_dim_;
+  const size_t kv_hidden_size = kv_head_num_ * head_dim_;
+  const size_t q_stride = bsh_layout_ ? hidden_size : head_dim_;
+  const size_t kv_stride = bsh_layout_ ? kv_hidden_size : head_dim_;
+  const size_t group_size = head_num_ / kv_head_num_;
+  const size_t q_tiles = UP_DIV(q_seq_len_, kFlashAttentionQTile);
+  auto task = [&](size_t start, size_t end) {
+    FlashAttentionTile tile(kFlashAttentionQTile, head_dim_);
+    for (size_t index = start; index < end; ++index) {
+      const size_t row_begin = index % q_tiles * kFlashAttentionQTile;
+      const size_t rows = std::min(kFlashAttentionQTile, q_seq_len_ - row_begin);
+      const size_t head = index / q_tiles % head_num_;
+      const size_t batch = index / q_tiles / head_num_;
+      const size_t kv_head = head / group_size;
+      const size_t q_offset = bsh_layout_ ? (batch * q_seq_len_ + row_begin) * hidden_size + head * head_dim_
+                                          : ((batch * head_num_ + head) * q_seq_len_ + row_begin) * head_dim_;
+      const size_t kv_offset = bsh_layout_ ? batch * kv_seq_len_ * kv_hidden_size + kv_head * head_dim_
+                                           : (batch * kv_head_num_ + kv_head) * kv_seq_len_ * head_dim_;
+      tile.Start(query + q_offset, rows, q_stride);
+
+      // Only the key rows in the band of the tile are read.
+      const int64_t row_first = SizeToLong(row_begin);
+      const int64_t row_last = row_first + SizeToLong(rows) - 1;
+      const int64_t kv_begin = std::max<int64_t>(0, row_first + shift - pre_tokens);
+      const int64_t kv_end = std::min<int64_t>(kv_seq_len, row_last + shift + next_tokens + 1);
+      if (kv_begin < kv_end) {
+        const T *k = key + kv_offset + LongToSize(kv_begin) * kv_stride;
+        const T *v = value + kv_offset + LongToSize(kv_begin) * kv_stride;
+        const size_t kv_rows = LongToSize(kv_end - kv_begin);
+        const bool in_band =
+          kv_end - 1 - row_first - shift <= next_tokens && kv_begin - row_last - shift >= -pre_tokens;
+        if (in_band && attn_mask == nullptr) {
+          tile.AddBlock(k, v, kv_rows, kv_stride, scale_value_);
+        } else {
+          const size_t mask_batch = attn_mask_batch_shared_ ? 0 : batch;
+          const size_t mask_head = attn_mask_head_shared_ ? 0 : head;
+          const uint8_t *mask_rows =
+            attn_mask == nullptr
+              ? nullptr
+              : attn_mask + ((mask_batch * (attn_mask_head_shared_ ? 1 : head_num_) + mask_head) * q_seq_len_ +
+                             row_begin) * kv_seq_len_;
+          auto mask = [&](float *scores, size_t offset, size_t block_rows) {
+            for (size_t i = 0; i < rows; ++i) {
+              for (size_t j = 0; j < block_rows; ++j) {
+                const int64_t kv_index = kv_begin + SizeToLong(offset + j);
+                const int64_t distance = kv_index - row_first - SizeToLong(i) - shift;
+                if (distance > next_tokens || distance < -pre_tokens ||
+                    (mask_rows != nullptr && mask_rows[i * kv_seq_len_ + LongToSize(kv_index)] != 0)) {
+                  scores[i * block_rows + j] = -INFINITY;
+                }
+              }
+            }
+          };
+          tile.AddBlock(k, v, kv_rows, kv_stride, scale_value_, mask);
+        }
+      }
+      tile.Finish(output + q_offset, q_stride);
+
+      // The max and the exp sum of each row are repeated in the last dim of the softmax outputs.
+      const size_t softmax_offset = ((batch * head_num_ + head) * q_seq_len_ + row_begin) * kSoftmaxLastDim;
+      for (size_t i = 0; i < rows; ++i) {
+        std::fill_n(softmax_max + softmax_offset + i * kSoftmaxLastDim, kSoftmaxLastDim, tile.row_max()[i]);
+        std::fill_n(softmax_sum + softmax_offset + i * kSoftmaxLastDim, kSoftmaxLastDim, tile.row_sum()[i]);
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(task, batch_size_ * head_num_ * q_tiles, this, &parallel_search_info_);
+  return true;
+}
+
+#define FLASH_ATTENTION_SCORE_CPU_REG(MS_T, T)                            \
+  {                                                                       \
+    KernelAttr()                                                          \
+      .AddInputAttr(MS_T)                                                 \
+      .AddInputAttr(MS_T)                                                 \
+      .AddInputAttr(MS_T)                                                 \
+      .AddOptionalInputAttr(MS_T)                                         \
+      .AddOptionalInputAttr(kNumberTypeUInt8)                             \
+      .AddOptionalInputAttr(MS_T)                                         \
+      .AddOptionalInputAttr(kNumberTypeUInt8)                             \
+      .AddOptionalInputAttr(kNumberTypeInt64)                             \
+      .AddOutputAttr(kNumberTypeFloat32)                                  \
+      .AddOutputAttr(kNumberTypeFloat32)                                  \
+      .AddOutputAttr(MS_T)                                                \
+      .AddOutputAttr(MS_T),                                               \
+      &FlashAttentionScoreCpuKernelMod::LaunchKernel<T>                   \
+  }
+
+std::vector<std::pair<KernelAttr, FlashAttentionScoreCpuKernelMod::FlashAttentionScoreFunc>>
+  FlashAttentionScoreCpuKernelMod::func_list_ = {
+    FLASH_ATTENTION_SCORE_CPU_REG(kNumberTypeFloat32, float),
+    FLASH_ATTENTION_SCORE_CPU_REG(kNumberTypeFloat16, float16),
+};
+
+std::vector<KernelAttr> FlashAttentionScoreCpuKernelMod::GetOpSupport() {
+  std::vector<KernelAttr> support_list;
+  (void)std::transform(func_list_.begin(), func_list_.end(), std::back_inserter(support_list),
+                       [](const std::pair<KernelAttr, FlashAttentionScoreFunc> &item) { return item.first; });
+  return support_list;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, FlashAttentionScore, FlashAttentionScoreCpuKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,76 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_FLASH_ATTENTION_SCORE_CPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_FLASH_ATTENTION_SCORE_CPU_KERNEL_H_
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/factory/ms_factory.h"
+
+namespace mindspore {
+namespace kernel {
+// FlashAttentionScore fuses the scores, softmax and weighted sum of values of attention. Each task computes a tile of
+// query rows of a head over the key and value rows not masked by the sparse mode, so that the score matrix is never
+// stored. Dropout, real_shift, padding_mask and prefix are not supported on CPU.
+class FlashAttentionScoreCpuKernelMod : public NativeCpuKernelMod {
+ public:
+  FlashAttentionScoreCpuKernelMod() = default;
+  ~FlashAttentionScoreCpuKernelMod() override = default;
+
+  bool Init(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
+
+  int Resize(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
+
+  bool Launch(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+              const std::vector<KernelTensor *> &outputs) override {
+    return kernel_func_(this, inputs, workspace, outputs);
+  }
+
+  std::vector<KernelAttr> GetOpSupport() override;
+
+ private:
+  template <typename T>
+  bool LaunchKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+                    const std::vector<KernelTensor *> &outputs);
+
+  using FlashAttentionScoreFunc =
+    std::function<bool(FlashAttentionScoreCpuKernelMod *, const std::vector<KernelTensor *> &,
+                       const std::vector<KernelTensor *> &, const std::vector<KernelTensor *> &)>;
+  static std::vector<std::pair<KernelAttr, FlashAttentionScoreFunc>> func_list_;
+  FlashAttentionScoreFunc kernel_func_;
+
+  bool bsh_layout_{true};
+  int64_t sparse_mode_{0};
+  int64_t pre_tokens_{0};
+  int64_t next_tokens_{0};
+  float scale_value_{1.0};
+  size_t batch_size_{0};
+  size_t head_num_{1};
+  size_t kv_head_num_{1};
+  size_t head_dim_{0};
+  size_t q_seq_len_{0};
+  size_t kv_seq_len_{0};
+  // Whether the attn_mask is given, and whether it is shared by the heads or by the batches.
+  bool has_attn_mask_{false};
+  bool attn_mask_head_shared_{false};
+  bool attn_mask_batch_shared_{false};
+};
+}  // namespace kernel
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_FLASH_ATTENTION_SCORE_CPU_KERNEL_H_
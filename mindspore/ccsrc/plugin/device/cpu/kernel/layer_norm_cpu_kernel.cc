@@ -19,6 +19,7 @@
 #include "kernel/common_utils.h"
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
 #include "include/common/thread_pool.h"
+#include "nnacl/bf16/cast_bf16.h"
 
 namespace mindspore {
 namespace kernel {
@@ -163,6 +164,63 @@ void LayerNormCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inpu
   ParallelLaunch(tasks);
 }
 
+void LayerNormCpuKernelMod::LaunchBf16Kernel(const std::vector<KernelTensor *> &inputs,
+                                             const std::vector<KernelTensor *> &outputs) {
+  if (inputs[kLayerNormInputGammaIndex]->size() != sizeof(bfloat16) * param_num_ ||
+      inputs[kLayerNormInputBetaIndex]->size() != sizeof(bfloat16) * param_num_) {
+    MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', the product of gamma and beta's shape must be " << param_num_;
+  }
+  if (outputs[kLayerNormOutputMeanIndex]->size() != outputs[kLayerNormOutputVarIndex]->size()) {
+    MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', the product of mean and var's shape must be " << block_num_;
+  }
+  auto x = reinterpret_cast<uint16_t *>(inputs[kLayerNormInputXIndex]->device_ptr());
+  auto gamma = reinterpret_cast<uint16_t *>(inputs[kLayerNormInputGammaIndex]->device_ptr());
+  auto beta = reinterpret_cast<uint16_t *>(inputs[kLayerNormInputBetaIndex]->device_ptr());
+  auto y = reinterpret_cast<uint16_t *>(outputs[kLayerNormOutputYIndex]->device_ptr());
+  auto mean = reinterpret_cast<float *>(outputs[kLayerNormOutputMeanIndex]->device_ptr());
+  auto var = reinterpret_cast<float *>(outputs[kLayerNormOutputVarIndex]->device_ptr());
+  MS_EXCEPTION_IF_NULL(x);
+  MS_EXCEPTION_IF_NULL(gamma);
+  MS_EXCEPTION_IF_NULL(beta);
+  MS_EXCEPTION_IF_NULL(y);
+  MS_EXCEPTION_IF_NULL(mean);
+  MS_EXCEPTION_IF_NULL(var);
+  // The blocks are normalized in float32 and rounded to bfloat16 once, instead of rounding every operation.
+  std::vector<float> gamma_fp32(param_num_);
+  std::vector<float> beta_fp32(param_num_);
+  Bf16ToFloat32(gamma, gamma_fp32.data(), SizeToInt(param_num_));
+  Bf16ToFloat32(beta, beta_fp32.data(), SizeToInt(param_num_));
+  auto task = [this, x, y, mean, var, &gamma_fp32, &beta_fp32](size_t start, size_t end) {
+    std::vector<float> block(block_size_);
+    for (size_t i = start; i < end; ++i) {
+      Bf16ToFloat32(x + i * block_size_, block.data(), SizeToInt(block_size_));
+      double sum = 0.0;
+      double square_sum = 0.0;
+      for (size_t j = 0; j < block_size_; ++j) {
+        auto x_j = static_cast<double>(block[j]);
+        sum += x_j;
+        square_sum += x_j * x_j;
+      }
+      double block_mean = sum / block_size_;
+      float block_var = static_cast<float>(square_sum / block_size_ - block_mean * block_mean);
+      if (block_var < 0) {
+        block_var = 0;
+      }
+      MS_EXCEPTION_IF_ZERO("Var + Epsilon", block_var + eps_);
+      auto block_mean_fp32 = static_cast<float>(block_mean);
+      float rstd = 1.0f / std::sqrt(block_var + eps_);
+      for (size_t j = 0; j < block_size_; ++j) {
+        auto param_shift = (i * block_size_ + j) % param_num_;
+        block[j] = (block[j] - block_mean_fp32) * rstd * gamma_fp32[param_shift] + beta_fp32[param_shift];
+      }
+      Float32ToBf16(block.data(), y + i * block_size_, SizeToInt(block_size_));
+      mean[i] = block_mean_fp32;
+      var[i] = block_var;
+    }
+  };
+  ParallelLaunchAutoSearch(task, block_num_, this, &parallel_search_info_);
+}
+
 std::vector<std::pair<KernelAttr, LayerNormCpuKernelMod::KernelFunc>> LayerNormCpuKernelMod::func_list_ = {
   {KernelAttr()
      .AddInputAttr(kNumberTypeFloat16)
@@ -196,7 +254,18 @@ std::vector<std::pair<KernelAttr, LayerNormCpuKernelMod::KernelFunc>> LayerNormC
      .AddOutputAttr(kNumberTypeFloat64)
      .AddOutputAttr(kNumberTypeFloat32)
      .AddOutputAttr(kNumberTypeFloat32),
-   &LayerNormCpuKernelMod::LaunchKernel<double>}};
+   &LayerNormCpuKernelMod::LaunchKernel<double>},
+  {KernelAttr()
+     .AddInputAttr(kNumberTypeBFloat16)
+     .AddInputAttr(kNumberTypeBFloat16)
+     .AddInputAttr(kNumberTypeBFloat16)
+     .AddInputAttr(kObjectTypeNumber, kNumberTypeInt64)
+     .AddInputAttr(kObjectTypeNumber, kNumberTypeInt64)
+     .AddInputAttr(kObjectTypeNumber, kNumberTypeFloat32)
+     .AddOutputAttr(kNumberTypeBFloat16)
+     .AddOutputAttr(kNumberTypeFloat32)
+     .AddOutputAttr(kNumberTypeFloat32),
+   &LayerNormCpuKernelMod::LaunchBf16Kernel}};
 
 std::vector<KernelAttr> LayerNormCpuKernelMod::GetOpSupport() {
   std::vector<KernelAttr> support_list;
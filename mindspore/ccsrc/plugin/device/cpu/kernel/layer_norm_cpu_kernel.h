@@ -40,6 +40,7 @@ class LayerNormCpuKernelMod : public NativeCpuKernelMod {
  private:
   template <typename T>
   void LaunchKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
+  void LaunchBf16Kernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
 
   using KernelFunc = std::function<void(LayerNormCpuKernelMod *, const std::vector<KernelTensor *> &,
                                         const std::vector<KernelTensor *> &)>;
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/matmul_bf16_cpu_kernel_func.h"
+#include <algorithm>
+#include "mindspore/core/ops/mat_mul.h"
+#include "nnacl/bf16/matmul_bf16.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kMatMulInputsNum = 2;
+constexpr size_t kMatMulOutputsNum = 1;
+constexpr size_t kRankMin = 2;
+constexpr size_t kIndexOffset = 2;
+// The columns of packed b are in blocks of 16 and the deep in pairs.
+constexpr size_t kPackColUnit = 16;
+constexpr size_t kPackDeepUnit = 2;
+// A task computes kRowUnit x kColUnit of the output, kColUnit being a multiple of the 32 columns of the avx512 tile.
+constexpr size_t kRowUnit = 64;
+constexpr size_t kColUnit = 64;
+
+size_t RoundUp(size_t value, size_t unit) { return (value + unit - 1) / unit * unit; }
+
+// Gets the batch of the input of shape and the batch of it used by every batch of the output of out_batch_shape, the
+// batch dims of the input being broadcast to out_batch_shape. Returns false if they can not be broadcast.
+bool GetBatchIndex(const ShapeVector &shape, const ShapeVector &out_batch_shape, size_t *batch,
+                   std::vector<size_t> *batch_index) {
+  size_t rank = shape.size() - kIndexOffset;
+  size_t out_rank = out_batch_shape.size();
+  if (rank > out_rank) {
+    return false;
+  }
+  std::vector<size_t> strides(out_rank, 0);
+  size_t stride = 1;
+  for (size_t i = rank; i > 0; --i) {
+    auto dim = shape[i - 1];
+    auto out_dim = out_batch_shape[out_rank - rank + i - 1];
+    if (dim != out_dim && dim != 1) {
+      return false;
+    }
+    strides[out_rank - rank + i - 1] = dim == 1 ? 0 : stride;
+    stride *= LongToSize(dim);
+  }
+  *batch = stride;
+  size_t out_batch = 1;
+  for (auto dim : out_batch_shape) {
+    out_batch *= LongToSize(dim);
+  }
+  batch_index->assign(out_batch, 0);
+  for (size_t i = 0; i < out_batch; ++i) {
+    size_t rest = i;
+    for (size_t j = out_rank; j > 0; --j) {
+      auto out_dim = LongToSize(out_batch_shape[j - 1]);
+      (*batch_index)[i] += rest % out_dim * strides[j - 1];
+      rest /= out_dim;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+void MatmulBf16CpuKernelFunc::InitFunc(const PrimitivePtr &primitive, const std::vector<KernelTensor *> &inputs,
+                                       const std::vector<KernelTensor *> &outputs) {
+  kernel_name_ = primitive->name();
+  trans_a_ = GetValue<bool>(primitive->GetAttr(ops::kTransposeA));
+  trans_b_ = GetValue<bool>(primitive->GetAttr(ops::kTransposeB));
+  MatmulBf16Init();
+}
+
+int MatmulBf16CpuKernelFunc::Resize(const std::vector<KernelTensor *> &inputs,
+                                    const std::vector<KernelTensor *> &outputs) {
+  const auto &a_shape = inputs[kIndex0]->GetShapeVector();
+  const auto &b_shape = inputs[kIndex1]->GetShapeVector();
+  const auto &out_shape = outputs[kIndex0]->GetShapeVector();
+  if (a_shape.size() < kRankMin || b_shape.size() < kRankMin || out_shape.size() < kRankMin) {
+    MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', the tensor rank must be greater than or equal to " << kRankMin;
+  }
+  auto rank = a_shape.size();
+  ShapeVector out_batch_shape(out_shape.begin(), out_shape.end() - kIndexOffset);
+  if (!GetBatchIndex(a_shape, out_batch_shape, &a_batch_, &a_batch_index_) ||
+      !GetBatchIndex(b_shape, out_batch_shape, &b_batch_, &b_batch_index_)) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the batch dims of the inputs can not be broadcast to the output "
+                  << out_shape << ", the inputs being " << a_shape << " and " << b_shape;
+    return KRET_RESIZE_FAILED;
+  }
+  batch_ = a_batch_index_.size();
+  row_ = LongToSize(out_shape[out_shape.size() - kIndexOffset]);
+  col_ = LongToSize(out_shape[out_shape.size() - 1]);
+  deep_ = LongToSize(trans_a_ ? a_shape[rank - kIndexOffset] : a_shape[rank - 1]);
+  row_blocks_ = RoundUp(row_, kRowUnit) / kRowUnit;
+  col_blocks_ = RoundUp(col_, kColUnit) / kColUnit;
+  packed_b_.resize(b_batch_ * RoundUp(col_, kPackColUnit) * RoundUp(deep_, kPackDeepUnit));
+  trans_a_buffer_.resize(trans_a_ ? a_batch_ * row_ * deep_ : 0);
+  b_const_ = inputs[kIndex1]->IsConstValue();
+  b_packed_ = false;
+  return KRET_OK;
+}
+
+void MatmulBf16CpuKernelFunc::PackInputs(const uint16_t *a, const uint16_t *b, bool pack_b) {
+  // b is packed by the blocks of kColUnit columns of every batch, and a transposed by the batch.
+  size_t pack_b_tasks = pack_b ? b_batch_ * col_blocks_ : 0;
+  size_t trans_a_tasks = trans_a_ ? a_batch_ : 0;
+  size_t packed_b_size = RoundUp(col_, kPackColUnit) * RoundUp(deep_, kPackDeepUnit);
+  auto task = [this, a, b, pack_b_tasks, packed_b_size](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      if (i < pack_b_tasks) {
+        size_t batch = i / col_blocks_;
+        size_t col_start = i % col_blocks_ * kColUnit;
+        size_t col_end = std::min(col_start + kColUnit, col_);
+        PackMatmulBf16BCols(b + batch * deep_ * col_, packed_b_.data() + batch * packed_b_size, SizeToInt(deep_),
+                            SizeToInt(col_), SizeToInt(col_start), SizeToInt(col_end), trans_b_);
+        continue;
+      }
+      // a of deep x row is transposed, so that the rows are contiguous in the deep.
+      size_t batch = i - pack_b_tasks;
+      const uint16_t *src = a + batch * row_ * deep_;
+      uint16_t *dst = trans_a_buffer_.data() + batch * row_ * deep_;
+      for (size_t d = 0; d < deep_; ++d) {
+        for (size_t r = 0; r < row_; ++r) {
+          dst[r * deep_ + d] = src[d * row_ + r];
+        }
+      }
+    }
+  };
+  if (pack_b_tasks + trans_a_tasks > 0) {
+    ParallelLaunch(task, pack_b_tasks + trans_a_tasks, 1.0);
+  }
+}
+
+bool MatmulBf16CpuKernelFunc::RunFunc(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &,
+                                      const std::vector<KernelTensor *> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMatMulInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMatMulOutputsNum, kernel_name_);
+  auto a = static_cast<const uint16_t *>(inputs[kIndex0]->device_ptr());
+  auto b = static_cast<const uint16_t *>(inputs[kIndex1]->device_ptr());
+  auto c = static_cast<uint16_t *>(outputs[kIndex0]->device_ptr());
+  MS_EXCEPTION_IF_NULL(a);
+  MS_EXCEPTION_IF_NULL(b);
+  MS_EXCEPTION_IF_NULL(c);
+  PackInputs(a, b, !b_const_ || !b_packed_);
+  b_packed_ = true;
+  if (trans_a_) {
+    a = trans_a_buffer_.data();
+  }
+
+  size_t packed_b_size = RoundUp(col_, kPackColUnit) * RoundUp(deep_, kPackDeepUnit);
+  size_t deep2 = RoundUp(deep_, kPackDeepUnit);
+  auto task = [this, a, c, packed_b_size, deep2](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      size_t batch = i / (row_blocks_ * col_blocks_);
+      size_t row_start = i / col_blocks_ % row_blocks_ * kRowUnit;
+      size_t col_start = i % col_blocks_ * kColUnit;
+      size_t cur_row = std::min(kRowUnit, row_ - row_start);
+      size_t cur_col = std::min(kColUnit, col_ - col_start);
+      MatmulBf16(a + (a_batch_index_[batch] * row_ + row_start) * deep_,
+                 packed_b_.data() + b_batch_index_[batch] * packed_b_size + col_start * deep2,
+                 c + (batch * row_ + row_start) * col_ + col_start, SizeToInt(cur_row), SizeToInt(cur_col),
+                 SizeToInt(deep_), SizeToInt(deep_), SizeToInt(col_));
+    }
+  };
+  ParallelLaunchAutoSearch(task, batch_ * row_blocks_ * col_blocks_, this, &parallel_search_info_);
+  return true;
+}
+}  // namespace kernel
+}  // namespace mindspore
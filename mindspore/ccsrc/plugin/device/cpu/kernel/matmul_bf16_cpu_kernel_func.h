@@ -0,0 +1,68 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_BF16_CPU_KERNEL_FUNC_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_BF16_CPU_KERNEL_FUNC_H_
+
+#include <string>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+
+namespace mindspore {
+namespace kernel {
+// MatMul and BatchMatMul of bfloat16, which keep the inputs in bfloat16 and accumulate in float32 by the nnacl bf16
+// kernels: the avx512-bf16 dot products when the cpu supports them, otherwise the avx2 ones on the widened values.
+class MatmulBf16CpuKernelFunc : public CpuKernelFunc {
+ public:
+  MatmulBf16CpuKernelFunc() = default;
+  ~MatmulBf16CpuKernelFunc() override = default;
+
+  void InitFunc(const PrimitivePtr &primitive, const std::vector<KernelTensor *> &inputs,
+                const std::vector<KernelTensor *> &outputs) override;
+
+  bool RunFunc(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+               const std::vector<KernelTensor *> &outputs) override;
+
+  int Resize(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
+
+ private:
+  void PackInputs(const uint16_t *a, const uint16_t *b, bool pack_b);
+
+  std::string kernel_name_;
+  size_t batch_{1};
+  // The batches of a and b, and the batch of a and b used by every batch of the output, after broadcasting.
+  size_t a_batch_{1};
+  size_t b_batch_{1};
+  std::vector<size_t> a_batch_index_;
+  std::vector<size_t> b_batch_index_;
+  size_t row_{0};
+  size_t col_{0};
+  size_t deep_{0};
+  size_t row_blocks_{0};
+  size_t col_blocks_{0};
+  bool trans_a_{false};
+  bool trans_b_{false};
+  // A constant b is packed at the first launch after Resize only.
+  bool b_const_{false};
+  bool b_packed_{false};
+  // b of every batch packed by PackMatmulBf16B, and a transposed to row x deep if trans_a_.
+  std::vector<uint16_t> packed_b_;
+  std::vector<uint16_t> trans_a_buffer_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_BF16_CPU_KERNEL_FUNC_H_
@@ -16,6 +16,7 @@
 
 #include "plugin/device/cpu/kernel/matmul_cpu_kernel.h"
 #include "plugin/device/cpu/kernel/eigen/matmul_double_cpu_kernel_func.h"
+#include "plugin/device/cpu/kernel/matmul_bf16_cpu_kernel_func.h"
 #include "plugin/device/cpu/kernel/mkldnn/matmul_cpu_kernel_func.h"
 #include <utility>
 #include <algorithm>
@@ -41,6 +42,11 @@ static std::map<std::string, std::vector<std::pair<KernelAttr, MatMulFuncCreator
        .AddInputAttr(kNumberTypeFloat32)
        .AddOutputAttr(kNumberTypeFloat32),
      []() { return std::make_shared<MatMulCpuKernelFunc>(); }},
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddOutputAttr(kNumberTypeBFloat16),
+     []() { return std::make_shared<MatmulBf16CpuKernelFunc>(); }},
     {KernelAttr().AddInputAttr(kNumberTypeFloat64).AddInputAttr(kNumberTypeFloat64).AddOutputAttr(kNumberTypeFloat64),
      []() { return std::make_shared<MatmulDoubleCpuKernelFunc>(); }},
     {KernelAttr().AddInputAttr(kNumberTypeInt8).AddInputAttr(kNumberTypeInt8).AddOutputAttr(kNumberTypeInt8),
@@ -80,6 +86,11 @@ static std::map<std::string, std::vector<std::pair<KernelAttr, MatMulFuncCreator
   {kBatchMatMul,
    {{KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
      []() { return std::make_shared<MatMulCpuKernelFunc>(); }},
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddInputAttr(kNumberTypeBFloat16)
+       .AddOutputAttr(kNumberTypeBFloat16),
+     []() { return std::make_shared<MatmulBf16CpuKernelFunc>(); }},
     {KernelAttr().AddInputAttr(kNumberTypeFloat64).AddInputAttr(kNumberTypeFloat64).AddOutputAttr(kNumberTypeFloat64),
      []() { return std::make_shared<MatmulDoubleCpuKernelFunc>(); }},
     {KernelAttr().AddInputAttr(kNumberTypeInt8).AddInputAttr(kNumberTypeInt8).AddOutputAttr(kNumberTypeInt8),
@@ -112,7 +123,7 @@ static std::map<std::string, std::vector<std::pair<KernelAttr, MatMulFuncCreator
 template <typename T>
 void LaunchEmptyTensor(const std::vector<KernelTensor *> &outputs) {
   auto output = reinterpret_cast<T *>(outputs[kIndex0]->device_ptr());
-  output[kIndex0] = 0;
+  output[kIndex0] = static_cast<T>(0);
 }
 
 static std::map<int, LaunchEmptyTensorFunc> empty_tensor_map_ = {
@@ -122,6 +133,7 @@ static std::map<int, LaunchEmptyTensorFunc> empty_tensor_map_ = {
   {kNumberTypeUInt8, LaunchEmptyTensor<uint8_t>},       {kNumberTypeUInt16, LaunchEmptyTensor<uint16_t>},
   {kNumberTypeUInt32, LaunchEmptyTensor<uint32_t>},     {kNumberTypeUInt64, LaunchEmptyTensor<uint64_t>},
   {kNumberTypeComplex64, LaunchEmptyTensor<complex64>}, {kNumberTypeComplex128, LaunchEmptyTensor<complex128>},
+  {kNumberTypeBFloat16, LaunchEmptyTensor<bfloat16>},
 };
 }  // namespace
 
@@ -15,7 +15,10 @@
  */
 
 #include "nnacl/base/transpose_base.h"
+#include <limits.h>
 #include "nnacl/errorcode.h"
+#include "nnacl/fp32/pack_fp32.h"
+#include "nnacl/intrinsics/ms_simd_instructions.h"
 
 #define TRANSPOSE_TWO_DIMS(TYPE, NAME)                                                                      \
   void TransposeDim2##NAME(const TYPE *in_data, TYPE *out_data, const int *strides, const int *out_strides, \
@@ -272,3 +275,127 @@ TRANSPOSE_TEMPLATE(int32_t, Int32)
 TRANSPOSE_TEMPLATE(int64_t, Int64)
 TRANSPOSE_TEMPLATE(double, Float64)
 TRANSPOSE_TEMPLATE(bool, Bool)
+
+#define TRANSPOSE_MATRIX_BLOCK 32
+
+typedef struct TransposeBit128 {
+  uint64_t value_[2];
+} TransposeBit128;
+
+// Transposes the 8 x 8 tile of src with rows src_stride apart to dst with rows dst_stride apart.
+typedef void (*TransposeTileFunc)(const void *src, void *dst, int src_stride, int dst_stride);
+
+#ifdef ENABLE_SSE
+static void TransposeTileBit16Sse(const void *src, void *dst, int src_stride, int dst_stride) {
+  const uint16_t *src_data = (const uint16_t *)src;
+  uint16_t *dst_data = (uint16_t *)dst;
+  __m128i rows[C8NUM];
+  for (int i = 0; i < C8NUM; ++i) {
+    rows[i] = _mm_loadu_si128((const __m128i *)(src_data + i * src_stride));
+  }
+  // The pairs of the rows by 16 bits, then the quads of the rows by 32 bits, and then the 8 rows by 64 bits.
+  __m128i pairs[C8NUM];
+  for (int i = 0; i < C4NUM; ++i) {
+    pairs[C2NUM * i] = _mm_unpacklo_epi16(rows[C2NUM * i], rows[C2NUM * i + 1]);
+    pairs[C2NUM * i + 1] = _mm_unpackhi_epi16(rows[C2NUM * i], rows[C2NUM * i + 1]);
+  }
+  __m128i quads[C8NUM];
+  for (int i = 0; i < C2NUM; ++i) {
+    for (int j = 0; j < C2NUM; ++j) {
+      quads[C4NUM * i + C2NUM * j] = _mm_unpacklo_epi32(pairs[C4NUM * i + j], pairs[C4NUM * i + C2NUM + j]);
+      quads[C4NUM * i + C2NUM * j + 1] = _mm_unpackhi_epi32(pairs[C4NUM * i + j], pairs[C4NUM * i + C2NUM + j]);
+    }
+  }
+  for (int i = 0; i < C4NUM; ++i) {
+    _mm_storeu_si128((__m128i *)(dst_data + C2NUM * i * dst_stride), _mm_unpacklo_epi64(quads[i], quads[C4NUM + i]));
+    _mm_storeu_si128((__m128i *)(dst_data + (C2NUM * i + 1) * dst_stride),
+                     _mm_unpackhi_epi64(quads[i], quads[C4NUM + i]));
+  }
+}
+#endif
+
+#if defined(ENABLE_SSE) || defined(ENABLE_ARM)
+static void TransposeTileBit32(const void *src, void *dst, int src_stride, int dst_stride) {
+#ifdef ENABLE_AVX
+  Transpose8X8Fp32Avx((const float *)src, (float *)dst, src_stride, dst_stride);
+#elif defined(ENABLE_SSE)
+  Transpose8X8Fp32Sse((const float *)src, (float *)dst, src_stride, dst_stride);
+#elif defined(ENABLE_ARM64)
+  Transpose8X8Fp32Arm64((const float *)src, (float *)dst, src_stride, dst_stride);
+#elif defined(ENABLE_ARM32)
+  Transpose8X8Fp32Arm32((const float *)src, (float *)dst, src_stride, dst_stride);
+#endif
+}
+#define TRANSPOSE_TILE_BIT32 TransposeTileBit32
+#else
+#define TRANSPOSE_TILE_BIT32 NULL
+#endif
+#ifdef ENABLE_SSE
+#define TRANSPOSE_TILE_BIT16 TransposeTileBit16Sse
+#else
+#define TRANSPOSE_TILE_BIT16 NULL
+#endif
+
+#define TRANSPOSE_MATRIX(TYPE, NAME, TILE_FUNC)                                                                      \
+  static void TransposeMatrix##NAME(const TYPE *src, TYPE *dst, int64_t row, int64_t col, int64_t src_stride,       \
+                                    int64_t dst_stride) {                                                            \
+    TransposeTileFunc tile_func = TILE_FUNC;                                                                         \
+    if (src_stride > INT_MAX || dst_stride > INT_MAX) {                                                              \
+      tile_func = NULL;                                                                                              \
+    }                                                                                                                \
+    for (int64_t r_start = 0; r_start < row; r_start += TRANSPOSE_MATRIX_BLOCK) {                                    \
+      int64_t r_end = MSMIN(r_start + TRANSPOSE_MATRIX_BLOCK, row);                                                  \
+      for (int64_t c_start = 0; c_start < col; c_start += TRANSPOSE_MATRIX_BLOCK) {                                  \
+        int64_t c_end = MSMIN(c_start + TRANSPOSE_MATRIX_BLOCK, col);                                                \
+        int64_t r = r_start;                                                                                         \
+        for (; tile_func != NULL && r + C8NUM <= r_end; r += C8NUM) {                                                \
+          int64_t c = c_start;                                                                                       \
+          for (; c + C8NUM <= c_end; c += C8NUM) {                                                                   \
+            tile_func(src + r * src_stride + c, dst + c * dst_stride + r, (int)src_stride, (int)dst_stride);         \
+          }                                                                                                          \
+          for (; c < c_end; ++c) {                                                                                   \
+            for (int64_t i = r; i < r + C8NUM; ++i) {                                                                \
+              dst[c * dst_stride + i] = src[i * src_stride + c];                                                     \
+            }                                                                                                        \
+          }                                                                                                          \
+        }                                                                                                            \
+        for (int64_t c = c_start; c < c_end; ++c) {                                                                  \
+          for (int64_t i = r; i < r_end; ++i) {                                                                      \
+            dst[c * dst_stride + i] = src[i * src_stride + c];                                                       \
+          }                                                                                                          \
+        }                                                                                                            \
+      }                                                                                                              \
+    }                                                                                                                \
+  }
+
+TRANSPOSE_MATRIX(uint8_t, Bit8, NULL)
+TRANSPOSE_MATRIX(uint16_t, Bit16, TRANSPOSE_TILE_BIT16)
+TRANSPOSE_MATRIX(uint32_t, Bit32, TRANSPOSE_TILE_BIT32)
+TRANSPOSE_MATRIX(uint64_t, Bit64, NULL)
+TRANSPOSE_MATRIX(TransposeBit128, Bit128, NULL)
+
+int TransposeMatrix(const void *src, void *dst, int64_t row, int64_t col, int64_t src_stride, int64_t dst_stride,
+                    int data_size) {
+  NNACL_CHECK_NULL_RETURN_ERR(src);
+  NNACL_CHECK_NULL_RETURN_ERR(dst);
+  switch (data_size) {
+    case sizeof(uint8_t):
+      TransposeMatrixBit8((const uint8_t *)src, (uint8_t *)dst, row, col, src_stride, dst_stride);
+      break;
+    case sizeof(uint16_t):
+      TransposeMatrixBit16((const uint16_t *)src, (uint16_t *)dst, row, col, src_stride, dst_stride);
+      break;
+    case sizeof(uint32_t):
+      TransposeMatrixBit32((const uint32_t *)src, (uint32_t *)dst, row, col, src_stride, dst_stride);
+      break;
+    case sizeof(uint64_t):
+      TransposeMatrixBit64((const uint64_t *)src, (uint64_t *)dst, row, col, src_stride, dst_stride);
+      break;
+    case sizeof(TransposeBit128):
+      TransposeMatrixBit128((const TransposeBit128 *)src, (TransposeBit128 *)dst, row, col, src_stride, dst_stride);
+      break;
+    default:
+      return NNACL_PARAM_INVALID;
+  }
+  return NNACL_OK;
+}
@@ -62,6 +62,14 @@ void TransposeDimsFloat64(const double *in_data, double *out_data, const int *ou
 void TransposeDimsBool(const bool *in_data, bool *out_data, const int *output_shape,
                        const TransposeParameter *transpose_param, int task_id, int thread_num);
 
+/*
+ * Transposes the row x col matrix src, whose rows are src_stride elements apart, to the col x row matrix dst, whose
+ * rows are dst_stride elements apart, for the elements of data_size bytes: 1, 2, 4, 8 or 16. The matrix goes by blocks
+ * which stay in cache, and the elements of 2 and 4 bytes by the 8 x 8 tiles in simd registers.
+ */
+int TransposeMatrix(const void *src, void *dst, int64_t row, int64_t col, int64_t src_stride, int64_t dst_stride,
+                    int data_size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/bf16/arithmetic_bf16.h"
+#include "nnacl/bf16/cast_bf16.h"
+#include "nnacl/errorcode.h"
+
+#ifdef ENABLE_AVX
+#define ELEMENT_BF16_SIMD(simd_op)                                                    \
+  for (; index <= size - C8NUM; index += C8NUM) {                                     \
+    __m256 src0 = Bf16x8ToFloat32(_mm_loadu_si128((const __m128i *)(in0 + index)));   \
+    __m256 src1 = Bf16x8ToFloat32(_mm_loadu_si128((const __m128i *)(in1 + index)));   \
+    _mm_storeu_si128((__m128i *)(out + index), Float32x8ToBf16(simd_op(src0, src1))); \
+  }
+#define ELEMENT_OPT_BF16_SIMD(simd_op)                                                \
+  __m256 scalar_x8 = _mm256_set1_ps(scalar);                                          \
+  for (; index <= size - C8NUM; index += C8NUM) {                                     \
+    __m256 src = Bf16x8ToFloat32(_mm_loadu_si128((const __m128i *)(vector + index))); \
+    __m256 dst = first_scalar ? simd_op(scalar_x8, src) : simd_op(src, scalar_x8);    \
+    _mm_storeu_si128((__m128i *)(out + index), Float32x8ToBf16(dst));                 \
+  }
+#else
+#define ELEMENT_BF16_SIMD(simd_op)
+#define ELEMENT_OPT_BF16_SIMD(simd_op)
+#endif
+
+#define ELEMENT_BF16_FUNC(name, simd_op, op)                                                                \
+  int Element##name##Bf16(const uint16_t *in0, const uint16_t *in1, uint16_t *out, int size) {              \
+    int index = 0;                                                                                          \
+    ELEMENT_BF16_SIMD(simd_op)                                                                              \
+    for (; index < size; ++index) {                                                                         \
+      out[index] = Float32ToBf16Scalar(Bf16ToFloat32Scalar(in0[index]) op Bf16ToFloat32Scalar(in1[index])); \
+    }                                                                                                       \
+    return NNACL_OK;                                                                                        \
+  }                                                                                                         \
+  int ElementOpt##name##Bf16(const uint16_t *in0, const uint16_t *in1, uint16_t *out, int size,             \
+                             bool first_scalar) {                                                           \
+    float scalar = Bf16ToFloat32Scalar(first_scalar ? in0[0] : in1[0]);                                     \
+    const uint16_t *vector = first_scalar ? in1 : in0;                                                      \
+    int index = 0;                                                                                          \
+    ELEMENT_OPT_BF16_SIMD(simd_op)                                                                          \
+    for (; index < size; ++index) {                                                                         \
+      float src = Bf16ToFloat32Scalar(vector[index]);                                                       \
+      out[index] = Float32ToBf16Scalar(first_scalar ? scalar op src : src op scalar);                       \
+    }                                                                                                       \
+    return NNACL_OK;                                                                                        \
+  }
+
+ELEMENT_BF16_FUNC(Add, _mm256_add_ps, +)
+ELEMENT_BF16_FUNC(Mul, _mm256_mul_ps, *)
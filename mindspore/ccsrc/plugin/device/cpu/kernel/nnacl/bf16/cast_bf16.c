@@ -0,0 +1,40 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/bf16/cast_bf16.h"
+
+void Bf16ToFloat32(const uint16_t *input, float *output, int number) {
+  int index = 0;
+#ifdef ENABLE_AVX
+  for (; index <= number - C8NUM; index += C8NUM) {
+    _mm256_storeu_ps(output + index, Bf16x8ToFloat32(_mm_loadu_si128((const __m128i *)(input + index))));
+  }
+#endif
+  for (; index < number; ++index) {
+    output[index] = Bf16ToFloat32Scalar(input[index]);
+  }
+}
+
+void Float32ToBf16(const float *input, uint16_t *output, int number) {
+  int index = 0;
+#ifdef ENABLE_AVX
+  for (; index <= number - C8NUM; index += C8NUM) {
+    _mm_storeu_si128((__m128i *)(output + index), Float32x8ToBf16(_mm256_loadu_ps(input + index)));
+  }
+#endif
+  for (; index < number; ++index) {
+    output[index] = Float32ToBf16Scalar(input[index]);
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NNACL_BF16_CAST_BF16_H_
+#define NNACL_BF16_CAST_BF16_H_
+
+#include "nnacl/op_base.h"
+#ifdef ENABLE_AVX
+#include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* bfloat16 is stored as uint16_t, which is the high half of a float32. */
+#define BF16_QUIET_NAN 0x7fc0
+
+static inline float Bf16ToFloat32Scalar(uint16_t src) {
+  uint32_t bits = (uint32_t)src << 16;
+  float dst;
+  memcpy(&dst, &bits, sizeof(dst));
+  return dst;
+}
+
+/* Rounds to the nearest even, the same as mindspore::BFloat16. */
+static inline uint16_t Float32ToBf16Scalar(float src) {
+  uint32_t bits;
+  memcpy(&bits, &src, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) {
+    return BF16_QUIET_NAN;
+  }
+  return (uint16_t)((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+#ifdef ENABLE_AVX
+static inline __m256 Bf16x8ToFloat32(__m128i src) {
+  return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(src), 16));
+}
+
+static inline __m128i Float32x8ToBf16(__m256 src) {
+  __m256i bits = _mm256_castps_si256(src);
+  __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+  __m256i dst = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))), 16);
+  __m256i nan_mask = _mm256_castps_si256(_mm256_cmp_ps(src, src, _CMP_UNORD_Q));
+  dst = _mm256_blendv_epi8(dst, _mm256_set1_epi32(BF16_QUIET_NAN), nan_mask);
+  return _mm_packus_epi32(_mm256_castsi256_si128(dst), _mm256_extracti128_si256(dst, 1));
+}
+#endif
+
+void Bf16ToFloat32(const uint16_t *input, float *output, int number);
+void Float32ToBf16(const float *input, uint16_t *output, int number);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NNACL_BF16_CAST_BF16_H_
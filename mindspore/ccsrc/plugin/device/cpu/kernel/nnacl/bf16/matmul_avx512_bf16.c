@@ -0,0 +1,82 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <immintrin.h>
+#include "nnacl/bf16/matmul_bf16.h"
+#include "nnacl/bf16/cast_bf16.h"
+
+/*
+ * Each vdpbf16ps accumulates the products of a pair of deep for 16 columns into float32. A tile of 8 rows takes
+ * col_blocks (1 or 2) blocks of 16 columns, whose stride in packed b is 16 * deep2.
+ */
+static inline void MatmulBf16Avx512Tile(const uint16_t *a, const uint16_t *b, uint16_t *c, int cur_row, int cur_col,
+                                        int deep, int a_stride, int c_stride, const int col_blocks) {
+  const uint16_t *a_rows[C8NUM];
+  for (int i = 0; i < C8NUM; ++i) {
+    // The rows out of the tile repeat the last one, which are computed but not stored.
+    a_rows[i] = a + MSMIN(i, cur_row - 1) * a_stride;
+  }
+  int b_stride = UP_ROUND(deep, C2NUM) * C16NUM;
+  __m512 acc[C8NUM][C2NUM];
+  for (int i = 0; i < C8NUM; ++i) {
+    for (int j = 0; j < col_blocks; ++j) {
+      acc[i][j] = _mm512_setzero_ps();
+    }
+  }
+  for (int d = 0; d < deep; d += C2NUM) {
+    __m512bh b_pair[C2NUM];
+    for (int j = 0; j < col_blocks; ++j) {
+      b_pair[j] = (__m512bh)_mm512_loadu_si512(b + j * b_stride);
+    }
+    bool has_odd = d + 1 < deep;
+    for (int i = 0; i < C8NUM; ++i) {
+      int32_t a_value = a_rows[i][d];
+      if (has_odd) {
+        memcpy(&a_value, a_rows[i] + d, sizeof(a_value));
+      }
+      __m512bh a_pair = (__m512bh)_mm512_set1_epi32(a_value);
+      for (int j = 0; j < col_blocks; ++j) {
+        acc[i][j] = _mm512_dpbf16_ps(acc[i][j], a_pair, b_pair[j]);
+      }
+    }
+    b += C32NUM;
+  }
+  float tile[C32NUM];
+  for (int i = 0; i < cur_row; ++i) {
+    for (int j = 0; j < col_blocks; ++j) {
+      _mm512_storeu_ps(tile + j * C16NUM, acc[i][j]);
+    }
+    Float32ToBf16(tile, c + i * c_stride, cur_col);
+  }
+}
+
+void MatmulBf16Avx512(const uint16_t *a, const uint16_t *packed_b, uint16_t *c, int row, int col, int deep,
+                      int a_stride, int c_stride) {
+  int deep2 = UP_ROUND(deep, C2NUM);
+  for (int col_start = 0; col_start < col; col_start += C32NUM) {
+    const uint16_t *b = packed_b + col_start * deep2;
+    int cur_col = MSMIN(C32NUM, col - col_start);
+    for (int r = 0; r < row; r += C8NUM) {
+      const uint16_t *cur_a = a + r * a_stride;
+      uint16_t *cur_c = c + r * c_stride + col_start;
+      int cur_row = MSMIN(C8NUM, row - r);
+      if (cur_col > C16NUM) {
+        MatmulBf16Avx512Tile(cur_a, b, cur_c, cur_row, cur_col, deep, a_stride, c_stride, C2NUM);
+      } else {
+        MatmulBf16Avx512Tile(cur_a, b, cur_c, cur_row, cur_col, deep, a_stride, c_stride, 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/bf16/matmul_bf16.h"
+#include "nnacl/bf16/cast_bf16.h"
+#ifdef ENABLE_AVX
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+void PackMatmulBf16B(const uint16_t *src, uint16_t *dst, int deep, int col, bool trans) {
+  PackMatmulBf16BCols(src, dst, deep, col, 0, col, trans);
+}
+
+void PackMatmulBf16BCols(const uint16_t *src, uint16_t *dst, int deep, int col, int col_start, int col_end,
+                         bool trans) {
+  int deep2 = UP_ROUND(deep, C2NUM);
+  memset(dst + col_start * deep2, 0, (UP_ROUND(col_end, C16NUM) - col_start) * deep2 * sizeof(uint16_t));
+  for (int d = 0; d < deep; ++d) {
+    uint16_t *dst_pair = dst + d / C2NUM * C32NUM + d % C2NUM;
+    for (int c = col_start; c < col_end; ++c) {
+      uint16_t value = trans ? src[c * deep + d] : src[d * col + c];
+      dst_pair[c / C16NUM * C16NUM * deep2 + c % C16NUM * C2NUM] = value;
+    }
+  }
+}
+
+#ifdef ENABLE_AVX
+/*
+ * A pair of bfloat16 in an int32 lane holds the even deep in the low half and the odd deep in the high half, whose
+ * float32 values are the lane shifted left by 16 bits and the lane with the low half cleared.
+ */
+#define BF16_PAIR_EVEN(pair) _mm256_castsi256_ps(_mm256_slli_epi32(pair, 16))
+#define BF16_PAIR_ODD(pair, mask) _mm256_castsi256_ps(_mm256_and_si256(pair, mask))
+
+static void MatmulBf16AvxTile4x16(const uint16_t *a, const uint16_t *b, uint16_t *c, int cur_row, int cur_col,
+                                  int deep, int a_stride, int c_stride) {
+  const __m256i odd_mask = _mm256_set1_epi32((int)0xffff0000);
+  const uint16_t *a_rows[C4NUM];
+  for (int i = 0; i < C4NUM; ++i) {
+    // The rows out of the tile repeat the last one, which are computed but not stored.
+    a_rows[i] = a + MSMIN(i, cur_row - 1) * a_stride;
+  }
+  __m256 acc[C4NUM][C2NUM];
+  for (int i = 0; i < C4NUM; ++i) {
+    acc[i][0] = _mm256_setzero_ps();
+    acc[i][1] = _mm256_setzero_ps();
+  }
+  for (int d = 0; d < deep; d += C2NUM) {
+    __m256i b_pair0 = _mm256_loadu_si256((const __m256i *)b);
+    __m256i b_pair1 = _mm256_loadu_si256((const __m256i *)(b + C16NUM));
+    __m256 b_even0 = BF16_PAIR_EVEN(b_pair0);
+    __m256 b_odd0 = BF16_PAIR_ODD(b_pair0, odd_mask);
+    __m256 b_even1 = BF16_PAIR_EVEN(b_pair1);
+    __m256 b_odd1 = BF16_PAIR_ODD(b_pair1, odd_mask);
+    bool has_odd = d + 1 < deep;
+    for (int i = 0; i < C4NUM; ++i) {
+      int32_t a_value = a_rows[i][d];
+      if (has_odd) {
+        memcpy(&a_value, a_rows[i] + d, sizeof(a_value));
+      }
+      __m256i a_pair = _mm256_set1_epi32(a_value);
+      __m256 a_even = BF16_PAIR_EVEN(a_pair);
+      __m256 a_odd = BF16_PAIR_ODD(a_pair, odd_mask);
+      acc[i][0] = _mm256_fmadd_ps(a_even, b_even0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_ps(a_even, b_even1, acc[i][1]);
+      acc[i][0] = _mm256_fmadd_ps(a_odd, b_odd0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_ps(a_odd, b_odd1, acc[i][1]);
+    }
+    b += C32NUM;
+  }
+  float tile[C16NUM];
+  for (int i = 0; i < cur_row; ++i) {
+    _mm256_storeu_ps(tile, acc[i][0]);
+    _mm256_storeu_ps(tile + C8NUM, acc[i][1]);
+    Float32ToBf16(tile, c + i * c_stride, cur_col);
+  }
+}
+#endif
+
+static void MatmulBf16Base(const uint16_t *a, const uint16_t *packed_b, uint16_t *c, int row, int col, int deep,
+                           int a_stride, int c_stride) {
+  int deep2 = UP_ROUND(deep, C2NUM);
+  for (int col_start = 0; col_start < col; col_start += C16NUM) {
+    const uint16_t *b = packed_b + col_start * deep2;
+    int cur_col = MSMIN(C16NUM, col - col_start);
+    for (int r = 0; r < row; r += C4NUM) {
+      int cur_row = MSMIN(C4NUM, row - r);
+#ifdef ENABLE_AVX
+      MatmulBf16AvxTile4x16(a + r * a_stride, b, c + r * c_stride + col_start, cur_row, cur_col, deep, a_stride,
+                            c_stride);
+#else
+      for (int i = 0; i < cur_row; ++i) {
+        const uint16_t *a_row = a + (r + i) * a_stride;
+        for (int j = 0; j < cur_col; ++j) {
+          float value = 0.0f;
+          for (int d = 0; d < deep; ++d) {
+            value += Bf16ToFloat32Scalar(a_row[d]) * Bf16ToFloat32Scalar(b[d / C2NUM * C32NUM + j * C2NUM + d % C2NUM]);
+          }
+          c[(r + i) * c_stride + col_start + j] = Float32ToBf16Scalar(value);
+        }
+      }
+#endif
+    }
+  }
+}
+
+void MatmulBf16(const uint16_t *a, const uint16_t *packed_b, uint16_t *c, int row, int col, int deep, int a_stride,
+                int c_stride) {
+#ifdef ENABLE_AVX512_BF16
+  if (X86_Avx512_Bf16_Support()) {
+    MatmulBf16Avx512(a, packed_b, c, row, col, deep, a_stride, c_stride);
+    return;
+  }
+#endif
+  MatmulBf16Base(a, packed_b, c, row, col, deep, a_stride, c_stride);
+}
+
+void MatmulBf16Init(void) {
+#ifdef ENABLE_AVX
+  (void)IntelX86CpuInfoInit();
+#endif
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NNACL_BF16_MATMUL_BF16_H_
+#define NNACL_BF16_MATMUL_BF16_H_
+
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Packs b of deep x col (col x deep if trans) into blocks of 16 columns, in which the values of every two rows of deep
+ * are interleaved: dst[c / 16][d / 2][c % 16][d % 2]. The columns are padded to 16 and the deep to 2 by zero, so dst
+ * takes UP_ROUND(col, 16) * UP_ROUND(deep, 2) values.
+ */
+void PackMatmulBf16B(const uint16_t *src, uint16_t *dst, int deep, int col, bool trans);
+
+/*
+ * Packs the columns [col_start, col_end) of b into their blocks of dst laid out as PackMatmulBf16B, so that the blocks
+ * are packed in parallel. col_start should be a multiple of 16, and col_end a multiple of 16 or col.
+ */
+void PackMatmulBf16BCols(const uint16_t *src, uint16_t *dst, int deep, int col, int col_start, int col_end, bool trans);
+
+/*
+ * c of row x col = a of row x deep * packed b, accumulated in float32 and rounded to bfloat16 once. a_stride and
+ * c_stride are the row strides of a and c. For a part of the columns, packed_b starts at a block of 16 columns.
+ */
+void MatmulBf16(const uint16_t *a, const uint16_t *packed_b, uint16_t *c, int row, int col, int deep, int a_stride,
+                int c_stride);
+
+/* Detects the cpu features for MatmulBf16, which runs the avx512-bf16 dot products if they are supported. */
+void MatmulBf16Init(void);
+
+#ifdef ENABLE_AVX512_BF16
+void MatmulBf16Avx512(const uint16_t *a, const uint16_t *packed_b, uint16_t *c, int row, int col, int deep,
+                      int a_stride, int c_stride);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NNACL_BF16_MATMUL_BF16_H_
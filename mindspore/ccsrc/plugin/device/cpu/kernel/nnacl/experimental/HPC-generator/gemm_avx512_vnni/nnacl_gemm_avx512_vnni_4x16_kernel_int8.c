@@ -0,0 +1,161 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <x86intrin.h>
+#include "nnacl/int8/matmul_vnni_int8.h"
+
+// nnacl int8 gemm in x86 avx512 vnni intrinsic code
+void nnacl_gemm_avx512_vnni_4x16_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16) {
+  const size_t b_stride = deep16 << 2;
+  // vpdpbusd multiplies unsigned bytes by signed bytes, a is offset by 128 and the offset is removed by corr.
+  const __m512i sign = _mm512_set1_epi8((char)0x80);
+  __m512i corr0 = _mm512_setzero_si512();
+  __m512i corr1 = _mm512_setzero_si512();
+  __m512i corr2 = _mm512_setzero_si512();
+  __m512i corr3 = _mm512_setzero_si512();
+  __m512i dst0 = _mm512_setzero_si512();
+  __m512i dst1 = _mm512_setzero_si512();
+  __m512i dst2 = _mm512_setzero_si512();
+  __m512i dst3 = _mm512_setzero_si512();
+  __m512i dst4 = _mm512_setzero_si512();
+  __m512i dst5 = _mm512_setzero_si512();
+  __m512i dst6 = _mm512_setzero_si512();
+  __m512i dst7 = _mm512_setzero_si512();
+  __m512i dst8 = _mm512_setzero_si512();
+  __m512i dst9 = _mm512_setzero_si512();
+  __m512i dst10 = _mm512_setzero_si512();
+  __m512i dst11 = _mm512_setzero_si512();
+  __m512i dst12 = _mm512_setzero_si512();
+  __m512i dst13 = _mm512_setzero_si512();
+  __m512i dst14 = _mm512_setzero_si512();
+  __m512i dst15 = _mm512_setzero_si512();
+  for (size_t d = 0; d < deep16; d += 16) {
+    __m512i weight0 = _mm512_loadu_si512(b + 0 * b_stride);
+    corr0 = _mm512_dpbusd_epi32(corr0, sign, weight0);
+    __m512i weight1 = _mm512_loadu_si512(b + 1 * b_stride);
+    corr1 = _mm512_dpbusd_epi32(corr1, sign, weight1);
+    __m512i weight2 = _mm512_loadu_si512(b + 2 * b_stride);
+    corr2 = _mm512_dpbusd_epi32(corr2, sign, weight2);
+    __m512i weight3 = _mm512_loadu_si512(b + 3 * b_stride);
+    corr3 = _mm512_dpbusd_epi32(corr3, sign, weight3);
+    __m512i src0 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 0)));
+    src0 = _mm512_xor_si512(src0, sign);
+    dst0 = _mm512_dpbusd_epi32(dst0, src0, weight0);
+    dst1 = _mm512_dpbusd_epi32(dst1, src0, weight1);
+    dst2 = _mm512_dpbusd_epi32(dst2, src0, weight2);
+    dst3 = _mm512_dpbusd_epi32(dst3, src0, weight3);
+    __m512i src1 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 16)));
+    src1 = _mm512_xor_si512(src1, sign);
+    dst4 = _mm512_dpbusd_epi32(dst4, src1, weight0);
+    dst5 = _mm512_dpbusd_epi32(dst5, src1, weight1);
+    dst6 = _mm512_dpbusd_epi32(dst6, src1, weight2);
+    dst7 = _mm512_dpbusd_epi32(dst7, src1, weight3);
+    __m512i src2 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 32)));
+    src2 = _mm512_xor_si512(src2, sign);
+    dst8 = _mm512_dpbusd_epi32(dst8, src2, weight0);
+    dst9 = _mm512_dpbusd_epi32(dst9, src2, weight1);
+    dst10 = _mm512_dpbusd_epi32(dst10, src2, weight2);
+    dst11 = _mm512_dpbusd_epi32(dst11, src2, weight3);
+    __m512i src3 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 48)));
+    src3 = _mm512_xor_si512(src3, sign);
+    dst12 = _mm512_dpbusd_epi32(dst12, src3, weight0);
+    dst13 = _mm512_dpbusd_epi32(dst13, src3, weight1);
+    dst14 = _mm512_dpbusd_epi32(dst14, src3, weight2);
+    dst15 = _mm512_dpbusd_epi32(dst15, src3, weight3);
+    a += 64;
+    b += 64;
+  }
+  // the 4 lanes of each column hold the sums of 4 parts of deep16
+  dst0 = _mm512_sub_epi32(dst0, corr0);
+  dst0 = _mm512_add_epi32(dst0, _mm512_shuffle_epi32(dst0, _MM_PERM_CDAB));
+  dst0 = _mm512_add_epi32(dst0, _mm512_shuffle_epi32(dst0, _MM_PERM_BADC));
+  dst0 = _mm512_maskz_compress_epi32(0x1111, dst0);
+  _mm_storeu_si128((__m128i *)(dst + 0), _mm512_castsi512_si128(dst0));
+  dst1 = _mm512_sub_epi32(dst1, corr1);
+  dst1 = _mm512_add_epi32(dst1, _mm512_shuffle_epi32(dst1, _MM_PERM_CDAB));
+  dst1 = _mm512_add_epi32(dst1, _mm512_shuffle_epi32(dst1, _MM_PERM_BADC));
+  dst1 = _mm512_maskz_compress_epi32(0x1111, dst1);
+  _mm_storeu_si128((__m128i *)(dst + 4), _mm512_castsi512_si128(dst1));
+  dst2 = _mm512_sub_epi32(dst2, corr2);
+  dst2 = _mm512_add_epi32(dst2, _mm512_shuffle_epi32(dst2, _MM_PERM_CDAB));
+  dst2 = _mm512_add_epi32(dst2, _mm512_shuffle_epi32(dst2, _MM_PERM_BADC));
+  dst2 = _mm512_maskz_compress_epi32(0x1111, dst2);
+  _mm_storeu_si128((__m128i *)(dst + 8), _mm512_castsi512_si128(dst2));
+  dst3 = _mm512_sub_epi32(dst3, corr3);
+  dst3 = _mm512_add_epi32(dst3, _mm512_shuffle_epi32(dst3, _MM_PERM_CDAB));
+  dst3 = _mm512_add_epi32(dst3, _mm512_shuffle_epi32(dst3, _MM_PERM_BADC));
+  dst3 = _mm512_maskz_compress_epi32(0x1111, dst3);
+  _mm_storeu_si128((__m128i *)(dst + 12), _mm512_castsi512_si128(dst3));
+  dst4 = _mm512_sub_epi32(dst4, corr0);
+  dst4 = _mm512_add_epi32(dst4, _mm512_shuffle_epi32(dst4, _MM_PERM_CDAB));
+  dst4 = _mm512_add_epi32(dst4, _mm512_shuffle_epi32(dst4, _MM_PERM_BADC));
+  dst4 = _mm512_maskz_compress_epi32(0x1111, dst4);
+  _mm_storeu_si128((__m128i *)(dst + 16), _mm512_castsi512_si128(dst4));
+  dst5 = _mm512_sub_epi32(dst5, corr1);
+  dst5 = _mm512_add_epi32(dst5, _mm512_shuffle_epi32(dst5, _MM_PERM_CDAB));
+  dst5 = _mm512_add_epi32(dst5, _mm512_shuffle_epi32(dst5, _MM_PERM_BADC));
+  dst5 = _mm512_maskz_compress_epi32(0x1111, dst5);
+  _mm_storeu_si128((__m128i *)(dst + 20), _mm512_castsi512_si128(dst5));
+  dst6 = _mm512_sub_epi32(dst6, corr2);
+  dst6 = _mm512_add_epi32(dst6, _mm512_shuffle_epi32(dst6, _MM_PERM_CDAB));
+  dst6 = _mm512_add_epi32(dst6, _mm512_shuffle_epi32(dst6, _MM_PERM_BADC));
+  dst6 = _mm512_maskz_compress_epi32(0x1111, dst6);
+  _mm_storeu_si128((__m128i *)(dst + 24), _mm512_castsi512_si128(dst6));
+  dst7 = _mm512_sub_epi32(dst7, corr3);
+  dst7 = _mm512_add_epi32(dst7, _mm512_shuffle_epi32(dst7, _MM_PERM_CDAB));
+  dst7 = _mm512_add_epi32(dst7, _mm512_shuffle_epi32(dst7, _MM_PERM_BADC));
+  dst7 = _mm512_maskz_compress_epi32(0x1111, dst7);
+  _mm_storeu_si128((__m128i *)(dst + 28), _mm512_castsi512_si128(dst7));
+  dst8 = _mm512_sub_epi32(dst8, corr0);
+  dst8 = _mm512_add_epi32(dst8, _mm512_shuffle_epi32(dst8, _MM_PERM_CDAB));
+  dst8 = _mm512_add_epi32(dst8, _mm512_shuffle_epi32(dst8, _MM_PERM_BADC));
+  dst8 = _mm512_maskz_compress_epi32(0x1111, dst8);
+  _mm_storeu_si128((__m128i *)(dst + 32), _mm512_castsi512_si128(dst8));
+  dst9 = _mm512_sub_epi32(dst9, corr1);
+  dst9 = _mm512_add_epi32(dst9, _mm512_shuffle_epi32(dst9, _MM_PERM_CDAB));
+  dst9 = _mm512_add_epi32(dst9, _mm512_shuffle_epi32(dst9, _MM_PERM_BADC));
+  dst9 = _mm512_maskz_compress_epi32(0x1111, dst9);
+  _mm_storeu_si128((__m128i *)(dst + 36), _mm512_castsi512_si128(dst9));
+  dst10 = _mm512_sub_epi32(dst10, corr2);
+  dst10 = _mm512_add_epi32(dst10, _mm512_shuffle_epi32(dst10, _MM_PERM_CDAB));
+  dst10 = _mm512_add_epi32(dst10, _mm512_shuffle_epi32(dst10, _MM_PERM_BADC));
+  dst10 = _mm512_maskz_compress_epi32(0x1111, dst10);
+  _mm_storeu_si128((__m128i *)(dst + 40), _mm512_castsi512_si128(dst10));
+  dst11 = _mm512_sub_epi32(dst11, corr3);
+  dst11 = _mm512_add_epi32(dst11, _mm512_shuffle_epi32(dst11, _MM_PERM_CDAB));
+  dst11 = _mm512_add_epi32(dst11, _mm512_shuffle_epi32(dst11, _MM_PERM_BADC));
+  dst11 = _mm512_maskz_compress_epi32(0x1111, dst11);
+  _mm_storeu_si128((__m128i *)(dst + 44), _mm512_castsi512_si128(dst11));
+  dst12 = _mm512_sub_epi32(dst12, corr0);
+  dst12 = _mm512_add_epi32(dst12, _mm512_shuffle_epi32(dst12, _MM_PERM_CDAB));
+  dst12 = _mm512_add_epi32(dst12, _mm512_shuffle_epi32(dst12, _MM_PERM_BADC));
+  dst12 = _mm512_maskz_compress_epi32(0x1111, dst12);
+  _mm_storeu_si128((__m128i *)(dst + 48), _mm512_castsi512_si128(dst12));
+  dst13 = _mm512_sub_epi32(dst13, corr1);
+  dst13 = _mm512_add_epi32(dst13, _mm512_shuffle_epi32(dst13, _MM_PERM_CDAB));
+  dst13 = _mm512_add_epi32(dst13, _mm512_shuffle_epi32(dst13, _MM_PERM_BADC));
+  dst13 = _mm512_maskz_compress_epi32(0x1111, dst13);
+  _mm_storeu_si128((__m128i *)(dst + 52), _mm512_castsi512_si128(dst13));
+  dst14 = _mm512_sub_epi32(dst14, corr2);
+  dst14 = _mm512_add_epi32(dst14, _mm512_shuffle_epi32(dst14, _MM_PERM_CDAB));
+  dst14 = _mm512_add_epi32(dst14, _mm512_shuffle_epi32(dst14, _MM_PERM_BADC));
+  dst14 = _mm512_maskz_compress_epi32(0x1111, dst14);
+  _mm_storeu_si128((__m128i *)(dst + 56), _mm512_castsi512_si128(dst14));
+  dst15 = _mm512_sub_epi32(dst15, corr3);
+  dst15 = _mm512_add_epi32(dst15, _mm512_shuffle_epi32(dst15, _MM_PERM_CDAB));
+  dst15 = _mm512_add_epi32(dst15, _mm512_shuffle_epi32(dst15, _MM_PERM_BADC));
+  dst15 = _mm512_maskz_compress_epi32(0x1111, dst15);
+  _mm_storeu_si128((__m128i *)(dst + 60), _mm512_castsi512_si128(dst15));
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <x86intrin.h>
+#include "nnacl/int8/matmul_vnni_int8.h"
+
+// nnacl int8 gemm in x86 avx512 vnni intrinsic code
+void nnacl_gemm_avx512_vnni_4x8_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16) {
+  const size_t b_stride = deep16 << 2;
+  // vpdpbusd multiplies unsigned bytes by signed bytes, a is offset by 128 and the offset is removed by corr.
+  const __m512i sign = _mm512_set1_epi8((char)0x80);
+  __m512i corr0 = _mm512_setzero_si512();
+  __m512i corr1 = _mm512_setzero_si512();
+  __m512i dst0 = _mm512_setzero_si512();
+  __m512i dst1 = _mm512_setzero_si512();
+  __m512i dst2 = _mm512_setzero_si512();
+  __m512i dst3 = _mm512_setzero_si512();
+  __m512i dst4 = _mm512_setzero_si512();
+  __m512i dst5 = _mm512_setzero_si512();
+  __m512i dst6 = _mm512_setzero_si512();
+  __m512i dst7 = _mm512_setzero_si512();
+  for (size_t d = 0; d < deep16; d += 16) {
+    __m512i weight0 = _mm512_loadu_si512(b + 0 * b_stride);
+    corr0 = _mm512_dpbusd_epi32(corr0, sign, weight0);
+    __m512i weight1 = _mm512_loadu_si512(b + 1 * b_stride);
+    corr1 = _mm512_dpbusd_epi32(corr1, sign, weight1);
+    __m512i src0 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 0)));
+    src0 = _mm512_xor_si512(src0, sign);
+    dst0 = _mm512_dpbusd_epi32(dst0, src0, weight0);
+    dst1 = _mm512_dpbusd_epi32(dst1, src0, weight1);
+    __m512i src1 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 16)));
+    src1 = _mm512_xor_si512(src1, sign);
+    dst2 = _mm512_dpbusd_epi32(dst2, src1, weight0);
+    dst3 = _mm512_dpbusd_epi32(dst3, src1, weight1);
+    __m512i src2 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 32)));
+    src2 = _mm512_xor_si512(src2, sign);
+    dst4 = _mm512_dpbusd_epi32(dst4, src2, weight0);
+    dst5 = _mm512_dpbusd_epi32(dst5, src2, weight1);
+    __m512i src3 = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a + 48)));
+    src3 = _mm512_xor_si512(src3, sign);
+    dst6 = _mm512_dpbusd_epi32(dst6, src3, weight0);
+    dst7 = _mm512_dpbusd_epi32(dst7, src3, weight1);
+    a += 64;
+    b += 64;
+  }
+  // the 4 lanes of each column hold the sums of 4 parts of deep16
+  dst0 = _mm512_sub_epi32(dst0, corr0);
+  dst0 = _mm512_add_epi32(dst0, _mm512_shuffle_epi32(dst0, _MM_PERM_CDAB));
+  dst0 = _mm512_add_epi32(dst0, _mm512_shuffle_epi32(dst0, _MM_PERM_BADC));
+  dst0 = _mm512_maskz_compress_epi32(0x1111, dst0);
+  _mm_storeu_si128((__m128i *)(dst + 0), _mm512_castsi512_si128(dst0));
+  dst1 = _mm512_sub_epi32(dst1, corr1);
+  dst1 = _mm512_add_epi32(dst1, _mm512_shuffle_epi32(dst1, _MM_PERM_CDAB));
+  dst1 = _mm512_add_epi32(dst1, _mm512_shuffle_epi32(dst1, _MM_PERM_BADC));
+  dst1 = _mm512_maskz_compress_epi32(0x1111, dst1);
+  _mm_storeu_si128((__m128i *)(dst + 4), _mm512_castsi512_si128(dst1));
+  dst2 = _mm512_sub_epi32(dst2, corr0);
+  dst2 = _mm512_add_epi32(dst2, _mm512_shuffle_epi32(dst2, _MM_PERM_CDAB));
+  dst2 = _mm512_add_epi32(dst2, _mm512_shuffle_epi32(dst2, _MM_PERM_BADC));
+  dst2 = _mm512_maskz_compress_epi32(0x1111, dst2);
+  _mm_storeu_si128((__m128i *)(dst + 16), _mm512_castsi512_si128(dst2));
+  dst3 = _mm512_sub_epi32(dst3, corr1);
+  dst3 = _mm512_add_epi32(dst3, _mm512_shuffle_epi32(dst3, _MM_PERM_CDAB));
+  dst3 = _mm512_add_epi32(dst3, _mm512_shuffle_epi32(dst3, _MM_PERM_BADC));
+  dst3 = _mm512_maskz_compress_epi32(0x1111, dst3);
+  _mm_storeu_si128((__m128i *)(dst + 20), _mm512_castsi512_si128(dst3));
+  dst4 = _mm512_sub_epi32(dst4, corr0);
+  dst4 = _mm512_add_epi32(dst4, _mm512_shuffle_epi32(dst4, _MM_PERM_CDAB));
+  dst4 = _mm512_add_epi32(dst4, _mm512_shuffle_epi32(dst4, _MM_PERM_BADC));
+  dst4 = _mm512_maskz_compress_epi32(0x1111, dst4);
+  _mm_storeu_si128((__m128i *)(dst + 32), _mm512_castsi512_si128(dst4));
+  dst5 = _mm512_sub_epi32(dst5, corr1);
+  dst5 = _mm512_add_epi32(dst5, _mm512_shuffle_epi32(dst5, _MM_PERM_CDAB));
+  dst5 = _mm512_add_epi32(dst5, _mm512_shuffle_epi32(dst5, _MM_PERM_BADC));
+  dst5 = _mm512_maskz_compress_epi32(0x1111, dst5);
+  _mm_storeu_si128((__m128i *)(dst + 36), _mm512_castsi512_si128(dst5));
+  dst6 = _mm512_sub_epi32(dst6, corr0);
+  dst6 = _mm512_add_epi32(dst6, _mm512_shuffle_epi32(dst6, _MM_PERM_CDAB));
+  dst6 = _mm512_add_epi32(dst6, _mm512_shuffle_epi32(dst6, _MM_PERM_BADC));
+  dst6 = _mm512_maskz_compress_epi32(0x1111, dst6);
+  _mm_storeu_si128((__m128i *)(dst + 48), _mm512_castsi512_si128(dst6));
+  dst7 = _mm512_sub_epi32(dst7, corr1);
+  dst7 = _mm512_add_epi32(dst7, _mm512_shuffle_epi32(dst7, _MM_PERM_CDAB));
+  dst7 = _mm512_add_epi32(dst7, _mm512_shuffle_epi32(dst7, _MM_PERM_BADC));
+  dst7 = _mm512_maskz_compress_epi32(0x1111, dst7);
+  _mm_storeu_si128((__m128i *)(dst + 52), _mm512_castsi512_si128(dst7));
+}
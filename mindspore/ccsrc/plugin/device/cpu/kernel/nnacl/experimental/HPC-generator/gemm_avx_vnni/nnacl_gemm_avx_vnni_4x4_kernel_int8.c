@@ -0,0 +1,79 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <x86intrin.h>
+#include "nnacl/int8/matmul_vnni_int8.h"
+
+// nnacl int8 gemm in x86 avx vnni intrinsic code
+void nnacl_gemm_avx_vnni_4x4_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16) {
+  const size_t b_stride = deep16 << 2;
+  // vpdpbusd multiplies unsigned bytes by signed bytes, a is offset by 128 and the offset is removed by corr.
+  const __m256i sign = _mm256_set1_epi8((char)0x80);
+  __m256i corr0 = _mm256_setzero_si256();
+  __m256i corr1 = _mm256_setzero_si256();
+  __m256i dst0 = _mm256_setzero_si256();
+  __m256i dst1 = _mm256_setzero_si256();
+  __m256i dst2 = _mm256_setzero_si256();
+  __m256i dst3 = _mm256_setzero_si256();
+  __m256i dst4 = _mm256_setzero_si256();
+  __m256i dst5 = _mm256_setzero_si256();
+  __m256i dst6 = _mm256_setzero_si256();
+  __m256i dst7 = _mm256_setzero_si256();
+  for (size_t d = 0; d < deep16; d += 16) {
+    __m256i weight0 = _mm256_loadu_si256((const __m256i *)(b + 0 * b_stride + 0));
+    corr0 = _mm256_dpbusd_avx_epi32(corr0, sign, weight0);
+    __m256i weight1 = _mm256_loadu_si256((const __m256i *)(b + 0 * b_stride + 32));
+    corr1 = _mm256_dpbusd_avx_epi32(corr1, sign, weight1);
+    __m256i src0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a + 0)));
+    src0 = _mm256_xor_si256(src0, sign);
+    dst0 = _mm256_dpbusd_avx_epi32(dst0, src0, weight0);
+    dst1 = _mm256_dpbusd_avx_epi32(dst1, src0, weight1);
+    __m256i src1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a + 16)));
+    src1 = _mm256_xor_si256(src1, sign);
+    dst2 = _mm256_dpbusd_avx_epi32(dst2, src1, weight0);
+    dst3 = _mm256_dpbusd_avx_epi32(dst3, src1, weight1);
+    __m256i src2 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a + 32)));
+    src2 = _mm256_xor_si256(src2, sign);
+    dst4 = _mm256_dpbusd_avx_epi32(dst4, src2, weight0);
+    dst5 = _mm256_dpbusd_avx_epi32(dst5, src2, weight1);
+    __m256i src3 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a + 48)));
+    src3 = _mm256_xor_si256(src3, sign);
+    dst6 = _mm256_dpbusd_avx_epi32(dst6, src3, weight0);
+    dst7 = _mm256_dpbusd_avx_epi32(dst7, src3, weight1);
+    a += 64;
+    b += 64;
+  }
+  // the 4 lanes of each column hold the sums of 4 parts of deep16
+  dst0 = _mm256_sub_epi32(dst0, corr0);
+  dst1 = _mm256_sub_epi32(dst1, corr1);
+  __m128i sum0 = _mm_hadd_epi32(_mm256_castsi256_si128(dst0), _mm256_extracti128_si256(dst0, 1));
+  __m128i sum1 = _mm_hadd_epi32(_mm256_castsi256_si128(dst1), _mm256_extracti128_si256(dst1, 1));
+  _mm_storeu_si128((__m128i *)(dst + 0), _mm_hadd_epi32(sum0, sum1));
+  dst2 = _mm256_sub_epi32(dst2, corr0);
+  dst3 = _mm256_sub_epi32(dst3, corr1);
+  __m128i sum2 = _mm_hadd_epi32(_mm256_castsi256_si128(dst2), _mm256_extracti128_si256(dst2, 1));
+  __m128i sum3 = _mm_hadd_epi32(_mm256_castsi256_si128(dst3), _mm256_extracti128_si256(dst3, 1));
+  _mm_storeu_si128((__m128i *)(dst + 16), _mm_hadd_epi32(sum2, sum3));
+  dst4 = _mm256_sub_epi32(dst4, corr0);
+  dst5 = _mm256_sub_epi32(dst5, corr1);
+  __m128i sum4 = _mm_hadd_epi32(_mm256_castsi256_si128(dst4), _mm256_extracti128_si256(dst4, 1));
+  __m128i sum5 = _mm_hadd_epi32(_mm256_castsi256_si128(dst5), _mm256_extracti128_si256(dst5, 1));
+  _mm_storeu_si128((__m128i *)(dst + 32), _mm_hadd_epi32(sum4, sum5));
+  dst6 = _mm256_sub_epi32(dst6, corr0);
+  dst7 = _mm256_sub_epi32(dst7, corr1);
+  __m128i sum6 = _mm_hadd_epi32(_mm256_castsi256_si128(dst6), _mm256_extracti128_si256(dst6, 1));
+  __m128i sum7 = _mm_hadd_epi32(_mm256_castsi256_si128(dst7), _mm256_extracti128_si256(dst7, 1));
+  _mm_storeu_si128((__m128i *)(dst + 48), _mm_hadd_epi32(sum6, sum7));
+}
@@ -86,3 +86,12 @@ do
     python3 $CRTDIR/generator.py -I $CRTDIR/template_file/gemm_avx512_nhwc_asm.c.in -A row_block=$row col_block=${n[index]} -O $dst_file
   done
 done
+
+# generate int8 gemm avx512 vnni and avx vnni intrinsic code
+for col in 4 8 12 16
+do
+  dst_file=$CRTDIR"/gemm_avx512_vnni/nnacl_gemm_avx512_vnni_4x${col}_kernel_int8.c"
+  python3 $CRTDIR/generator.py -I $CRTDIR/template_file/gemm_avx512_vnni_int8.c.in -A row_block=4 col_block=$col -O $dst_file
+done
+dst_file=$CRTDIR"/gemm_avx_vnni/nnacl_gemm_avx_vnni_4x4_kernel_int8.c"
+python3 $CRTDIR/generator.py -I $CRTDIR/template_file/gemm_avx_vnni_int8.c.in -A row_block=4 col_block=4 -O $dst_file
@@ -0,0 +1,133 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/flash_attention_fp32.h"
+#include <math.h>
+#include "nnacl/flash_attention_fp32_simd.h"
+
+void FlashAttentionInitFp32(float *row_max, float *row_sum, float *out, int q_rows, int head_dim) {
+  for (int i = 0; i < q_rows; ++i) {
+    row_max[i] = -INFINITY;
+    row_sum[i] = 0.0f;
+  }
+  for (int i = 0; i < q_rows * head_dim; ++i) {
+    out[i] = 0.0f;
+  }
+}
+
+void FlashAttentionScoresFp32(const float *q, int q_rows, int q_stride, const float *k, int kv_rows, int kv_stride,
+                              int head_dim, float scale, float *scores) {
+  int row = 0;
+  // Four query rows share each row of k loaded.
+  for (; row + C4NUM <= q_rows; row += C4NUM) {
+    const float *q0 = q + row * q_stride;
+    const float *q1 = q0 + q_stride;
+    const float *q2 = q1 + q_stride;
+    const float *q3 = q2 + q_stride;
+    for (int j = 0; j < kv_rows; ++j) {
+      const float *k_row = k + j * kv_stride;
+      float dots[C4NUM] = {0.0f, 0.0f, 0.0f, 0.0f};
+      int index = 0;
+      SIMD_RUN_NO_SCALAR(FlashAttentionDot4, index, q0, q1, q2, q3, k_row, dots, head_dim);
+      for (; index < head_dim; ++index) {
+        dots[0] += q0[index] * k_row[index];
+        dots[1] += q1[index] * k_row[index];
+        dots[2] += q2[index] * k_row[index];
+        dots[3] += q3[index] * k_row[index];
+      }
+      for (int i = 0; i < C4NUM; ++i) {
+        scores[(row + i) * kv_rows + j] = dots[i] * scale;
+      }
+    }
+  }
+  for (; row < q_rows; ++row) {
+    const float *q_row = q + row * q_stride;
+    for (int j = 0; j < kv_rows; ++j) {
+      const float *k_row = k + j * kv_stride;
+      float dot = 0.0f;
+      int index = 0;
+      SIMD_RUN_NO_SCALAR(FlashAttentionDot, index, q_row, k_row, &dot, head_dim);
+      for (; index < head_dim; ++index) {
+        dot += q_row[index] * k_row[index];
+      }
+      scores[row * kv_rows + j] = dot * scale;
+    }
+  }
+}
+
+void FlashAttentionUpdateFp32(float *scores, const float *v, int q_rows, int kv_rows, int kv_stride, int head_dim,
+                              float *row_max, float *row_sum, float *out) {
+  for (int i = 0; i < q_rows; ++i) {
+    float *row_scores = scores + i * kv_rows;
+    float max = -INFINITY;
+    int index = 0;
+    SIMD_RUN_NO_SCALAR(FlashAttentionGetMax, index, row_scores, &max, kv_rows);
+    for (; index < kv_rows; ++index) {
+      max = MSMAX(max, row_scores[index]);
+    }
+    if (max == -INFINITY) {
+      // All the scores of the block are masked.
+      continue;
+    }
+    float *row_out = out + i * head_dim;
+    if (max > row_max[i]) {
+      if (row_max[i] != -INFINITY) {
+        float correction = expf(row_max[i] - max);
+        row_sum[i] *= correction;
+        index = 0;
+        SIMD_RUN_NO_SCALAR(FlashAttentionScale, index, row_out, correction, head_dim);
+        for (; index < head_dim; ++index) {
+          row_out[index] *= correction;
+        }
+      }
+      row_max[i] = max;
+    }
+
+    float exp_sum = 0.0f;
+    index = 0;
+    SIMD_RUN_NO_SCALAR(FlashAttentionExpSum, index, row_scores, row_max[i], &exp_sum, kv_rows);
+    for (; index < kv_rows; ++index) {
+      row_scores[index] = simd_exp32_f32(row_scores[index] - row_max[i]);
+      exp_sum += row_scores[index];
+    }
+    row_sum[i] += exp_sum;
+
+    for (int j = 0; j < kv_rows; ++j) {
+      const float *v_row = v + j * kv_stride;
+      const float weight = row_scores[j];
+      index = 0;
+      SIMD_RUN_NO_SCALAR(FlashAttentionAxpy, index, weight, v_row, row_out, head_dim);
+      for (; index < head_dim; ++index) {
+        row_out[index] += weight * v_row[index];
+      }
+    }
+  }
+}
+
+void FlashAttentionNormFp32(float *out, const float *row_sum, int q_rows, int head_dim) {
+  for (int i = 0; i < q_rows; ++i) {
+    if (row_sum[i] <= 0.0f) {
+      continue;
+    }
+    float *row_out = out + i * head_dim;
+    float scale = 1.0f / row_sum[i];
+    int index = 0;
+    SIMD_RUN_NO_SCALAR(FlashAttentionScale, index, row_out, scale, head_dim);
+    for (; index < head_dim; ++index) {
+      row_out[index] *= scale;
+    }
+  }
+}
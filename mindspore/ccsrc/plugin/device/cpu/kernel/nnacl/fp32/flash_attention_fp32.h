@@ -0,0 +1,46 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+#define MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+
+#include "nnacl/op_base.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* Flash attention computes softmax(scale * q * k^T) * v for a tile of query rows block by block of key and value rows,
+ * without the whole score matrix. Each query row keeps the max and the exp sum of the scores seen so far, the output
+ * accumulated by them is rescaled once the max grows (online softmax). Rows of q, k and v are head_dim long, and their
+ * strides allow reading a head out of interleaved heads directly. */
+
+// Reset the state of the query rows: row_max to -inf, row_sum and out to 0.
+void FlashAttentionInitFp32(float *row_max, float *row_sum, float *out, int q_rows, int head_dim);
+
+// scores[i * kv_rows + j] = scale * dot(q row i, k row j).
+void FlashAttentionScoresFp32(const float *q, int q_rows, int q_stride, const float *k, int kv_rows, int kv_stride,
+                              int head_dim, float scale, float *scores);
+
+// Fold a block of scores into the state of the query rows, masked scores are -inf. The scores are overwritten.
+void FlashAttentionUpdateFp32(float *scores, const float *v, int q_rows, int kv_rows, int kv_stride, int head_dim,
+                              float *row_max, float *row_sum, float *out);
+
+// Divide the output by the exp sum, rows with all scores masked get zeros.
+void FlashAttentionNormFp32(float *out, const float *row_sum, int q_rows, int head_dim);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
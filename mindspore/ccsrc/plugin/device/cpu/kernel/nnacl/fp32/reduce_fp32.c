@@ -357,3 +357,118 @@ int ReduceDeviation(const float *src_data, int64_t size, float mean, float *devi
   }
   return NNACL_OK;
 }
+
+// The number of elements of the axis reduced at once, whose sums are cascaded.
+#define REDUCE_CASCADE_SIZE 256
+
+static float ReduceSumRowPairwise(const float *src, int64_t size) {
+  if (size > REDUCE_CASCADE_SIZE) {
+    int64_t half = UP_DIV(size / C2NUM, REDUCE_CASCADE_SIZE) * REDUCE_CASCADE_SIZE;
+    return ReduceSumRowPairwise(src, half) + ReduceSumRowPairwise(src + half, size - half);
+  }
+  float value = 0.0f;
+  int64_t i = 0;
+  SIMD_RUN_NO_SCALAR(ReduceSumRow, i, src, size, &value);
+  for (; i < size; i++) {
+    value += src[i];
+  }
+  return value;
+}
+
+static float ReduceRowFp32(ReduceModeC mode, const float *src, int64_t size) {
+  if (mode == Reduce_Sum) {
+    return ReduceSumRowPairwise(src, size);
+  }
+  float value = mode == Reduce_Prod ? 1.0f : src[0];
+  int64_t i = 0;
+  if (mode == Reduce_Max) {
+    SIMD_RUN_NO_SCALAR(ReduceMaxRow, i, src, size, &value);
+    for (; i < size; i++) {
+      value = fmaxf(value, src[i]);
+    }
+  } else if (mode == Reduce_Min) {
+    SIMD_RUN_NO_SCALAR(ReduceMinRow, i, src, size, &value);
+    for (; i < size; i++) {
+      value = fminf(value, src[i]);
+    }
+  } else {
+    SIMD_RUN_NO_SCALAR(ReduceProdRow, i, src, size, &value);
+    for (; i < size; i++) {
+      value *= src[i];
+    }
+  }
+  return value;
+}
+
+int ReduceLastAxisPartFp32(ReduceModeC mode, const float *src, float *dst, int64_t axis_size, int64_t axis_start,
+                           int64_t axis_end, int64_t start, int64_t end) {
+  NNACL_CHECK_TRUE_RET(src != NULL && dst != NULL, NNACL_NULL_PTR);
+  NNACL_CHECK_TRUE_RET(axis_start >= 0 && axis_start < axis_end && axis_end <= axis_size, NNACL_PARAM_INVALID);
+  NNACL_CHECK_TRUE_RET(mode == Reduce_Sum || mode == Reduce_Max || mode == Reduce_Min || mode == Reduce_Prod,
+                       NNACL_PARAM_INVALID);
+  for (int64_t j = start; j < end; j++) {
+    dst[j] = ReduceRowFp32(mode, src + j * axis_size + axis_start, axis_end - axis_start);
+  }
+  return NNACL_OK;
+}
+
+static void ReduceStridedBlockFp32(ReduceModeC mode, const float *src, float *dst, int64_t len, int64_t inner,
+                                   int64_t axis_len, bool accumulate) {
+  int64_t index = 0;
+  if (mode == Reduce_Sum) {
+    SIMD_RUN_NO_SCALAR(ReduceSumStrided, index, src, dst, len, inner, axis_len, accumulate);
+  } else if (mode == Reduce_Max) {
+    SIMD_RUN_NO_SCALAR(ReduceMaxStrided, index, src, dst, len, inner, axis_len, accumulate);
+  } else if (mode == Reduce_Min) {
+    SIMD_RUN_NO_SCALAR(ReduceMinStrided, index, src, dst, len, inner, axis_len, accumulate);
+  } else {
+    SIMD_RUN_NO_SCALAR(ReduceProdStrided, index, src, dst, len, inner, axis_len, accumulate);
+  }
+  for (; index < len; index++) {
+    const float *inner_src = src + index;
+    float value = 0.0f;
+    if (accumulate) {
+      value = dst[index];
+    } else if (mode == Reduce_Max || mode == Reduce_Min) {
+      value = inner_src[0];
+    } else if (mode == Reduce_Prod) {
+      value = 1.0f;
+    }
+    for (int64_t i = 0; i < axis_len; i++) {
+      float src_value = inner_src[i * inner];
+      if (mode == Reduce_Sum) {
+        value += src_value;
+      } else if (mode == Reduce_Max) {
+        value = fmaxf(value, src_value);
+      } else if (mode == Reduce_Min) {
+        value = fminf(value, src_value);
+      } else {
+        value *= src_value;
+      }
+    }
+    dst[index] = value;
+  }
+}
+
+int ReduceMidAxisPartFp32(ReduceModeC mode, const float *src, float *dst, int64_t inner, int64_t axis_size,
+                          int64_t axis_start, int64_t axis_end, int64_t start, int64_t end) {
+  NNACL_CHECK_TRUE_RET(src != NULL && dst != NULL, NNACL_NULL_PTR);
+  NNACL_CHECK_TRUE_RET(inner > 0, NNACL_PARAM_INVALID);
+  NNACL_CHECK_TRUE_RET(axis_start >= 0 && axis_start < axis_end && axis_end <= axis_size, NNACL_PARAM_INVALID);
+  NNACL_CHECK_TRUE_RET(mode == Reduce_Sum || mode == Reduce_Max || mode == Reduce_Min || mode == Reduce_Prod,
+                       NNACL_PARAM_INVALID);
+  int64_t axis_len = axis_end - axis_start;
+  for (int64_t j = start; j < end;) {
+    int64_t outer_index = j / inner;
+    int64_t inner_index = j % inner;
+    // A segment of the outputs is contiguous in the inner of one outer.
+    int64_t len = MSMIN(inner - inner_index, end - j);
+    const float *segment_src = src + (outer_index * axis_size + axis_start) * inner + inner_index;
+    for (int64_t i = 0; i < axis_len; i += REDUCE_CASCADE_SIZE) {
+      ReduceStridedBlockFp32(mode, segment_src + i * inner, dst + j, len, inner,
+                             MSMIN(REDUCE_CASCADE_SIZE, axis_len - i), i > 0);
+    }
+    j += len;
+  }
+  return NNACL_OK;
+}
@@ -58,6 +58,19 @@ int ReduceSumDim2Axis1(size_t col_len, const float *src_data, float *dst_data);
 int ReduceMeanWithAxis(const float *src_data, float *mean, int64_t size);
 int ReduceDeviation(const float *src_data, int64_t size, float mean, float *deviation);
 
+/*
+ * Reduces the rows [start, end) of src in outer x axis_size to dst over the part [axis_start, axis_end) of the axis.
+ * The modes are Reduce_Sum, Reduce_Max, Reduce_Min and Reduce_Prod, and the sums are pairwise in blocks of the row.
+ */
+int ReduceLastAxisPartFp32(ReduceModeC mode, const float *src, float *dst, int64_t axis_size, int64_t axis_start,
+                           int64_t axis_end, int64_t start, int64_t end);
+/*
+ * Reduces the outputs [start, end) of src in outer x axis_size x inner to dst of outer x inner over the part
+ * [axis_start, axis_end) of the axis, with the simd lanes on the contiguous inner and the sums cascaded by blocks.
+ */
+int ReduceMidAxisPartFp32(ReduceModeC mode, const float *src, float *dst, int64_t inner, int64_t axis_size,
+                          int64_t axis_start, int64_t axis_end, int64_t start, int64_t end);
+
 #ifdef ENABLE_NNACL_INFER_SHAPE
 int ReduceInferShape(int32_t **in_shape, size_t *dim_size, int32_t *out_shape, int32_t *in_format, int32_t *out_format,
                      int32_t *in_datatype, int32_t *out_datatype, OpParameter *param);
@@ -16,6 +16,7 @@
 
 #include "nnacl/int8/dynamic_matmul_int8.h"
 #include "nnacl/int8/fixed_point.h"
+#include "nnacl/int8/matmul_vnni_int8.h"
 
 void DynamicMatmul4x4x16AIWI(const int8_t *a, const int8_t *b, float *out, size_t deep4, const float *multi_scales,
                              const float *bias, size_t row, size_t col, size_t stride, const int32_t *a_sums,
@@ -104,6 +105,13 @@ void DynamicMatmul4x16x4AIWI(const int8_t *a, const int8_t *b, const float *bias
    * row4x16-major * row16x4-major => (int8)row-major
    * support activation per-layer symmetric && weight per-layer/per-channel symmetric
    * */
+#ifdef ENABLE_INT8_VNNI
+  if (MatmulInt8VnniSupport()) {
+    DynamicMatmul4x16x4AIWIVnni(a, b, bias, dst, row, col, deep, deep16, stride, input_zp, input_scale, filter_scale,
+                                filter_zp, input_per_channel, filter_per_channel, act_type);
+    return;
+  }
+#endif
   for (int r = 0; r < row; r++) {
     for (int c = 0; c < col; c++) {
       int r4div = r / C4NUM, r4mod = r % C4NUM;
@@ -16,6 +16,7 @@
 
 #include "nnacl/int8/matmul_int8.h"
 #include "nnacl/int8/fixed_point.h"
+#include "nnacl/int8/matmul_vnni_int8.h"
 
 void RowMajor2Row2x16MajorInt8(const int8_t *src_ptr, int8_t *dst_ptr, int row, int col) {
   int col16 = UP_ROUND(col, C16NUM);
@@ -303,6 +304,13 @@ void MatmulInt8Opt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int c
    * a_sums is  perT  : input_row_sum * filter_zp
    *            perOc : input_row_sum
    * */
+#ifdef ENABLE_INT8_VNNI
+  if (MatmulInt8VnniSupport()) {
+    MatmulInt8OptVnni(a, b, dst, row, col, deep16, a_sums, bias, mini, maxi, out_zp, multiplier, left_shift,
+                      right_shift, stride, filter_peroc, filter_zp);
+    return;
+  }
+#endif
   for (int r = 0; r < row; r++) {
     for (int c = 0; c < col; c++) {
       int r4div = r / C4NUM, r4mod = r % C4NUM;
@@ -0,0 +1,149 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/int8/matmul_vnni_int8.h"
+#ifdef ENABLE_INT8_VNNI
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#include "nnacl/int8/fixed_point.h"
+
+#ifdef ENABLE_AVX512_VNNI
+static const MatmulInt8VnniKernel kAvx512VnniKernels[] = {
+  nnacl_gemm_avx512_vnni_4x4_kernel_int8, nnacl_gemm_avx512_vnni_4x8_kernel_int8,
+  nnacl_gemm_avx512_vnni_4x12_kernel_int8, nnacl_gemm_avx512_vnni_4x16_kernel_int8};
+#endif
+#ifdef ENABLE_AVX_VNNI
+static const MatmulInt8VnniKernel kAvxVnniKernels[] = {nnacl_gemm_avx_vnni_4x4_kernel_int8};
+#endif
+
+/* Returns the number of columns a kernel computes at most, the kernel of 4 * (i + 1) columns is kernels[i]. */
+static int GetMatmulInt8VnniKernels(const MatmulInt8VnniKernel **kernels) {
+#ifdef ENABLE_AVX512_VNNI
+  if (X86_Avx512_Vnni_Support()) {
+    *kernels = kAvx512VnniKernels;
+    return C16NUM;
+  }
+#endif
+#ifdef ENABLE_AVX_VNNI
+  if (X86_Avx_Vnni_Support()) {
+    *kernels = kAvxVnniKernels;
+    return C4NUM;
+  }
+#endif
+  *kernels = NULL;
+  return 0;
+}
+
+/* Sum of the row (or column) of row4x16-major a (or col16x4-major b) from its first 16 values. */
+static int32_t PackedSumInt8(const int8_t *src, int deep16) {
+  int32_t sum = 0;
+  for (int d = 0; d < deep16; d += C16NUM) {
+    for (int i = 0; i < C16NUM; ++i) {
+      sum += src[i];
+    }
+    src += C4NUM * C16NUM;
+  }
+  return sum;
+}
+
+void MatmulInt8OptVnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                       const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                       const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                       size_t filter_peroc, const int32_t *filter_zp) {
+  const MatmulInt8VnniKernel *kernels = NULL;
+  int col_tile = GetMatmulInt8VnniKernels(&kernels);
+  int32_t tile[C4NUM * C16NUM];
+  for (int c = 0; c < col; c += col_tile) {
+    int cur_col = MSMIN(col_tile, col - c);
+    MatmulInt8VnniKernel kernel = kernels[UP_DIV(cur_col, C4NUM) - 1];
+    for (int r = 0; r < row; r += C4NUM) {
+      int cur_row = MSMIN(C4NUM, row - r);
+      kernel(tile, a + r * deep16, b + c * deep16, deep16);
+      for (int i = 0; i < cur_row; ++i) {
+        for (int j = 0; j < cur_col; ++j) {
+          int ri = r + i;
+          int ci = c + j;
+          int32_t value = tile[i * C16NUM + j];
+          int32_t cur_input_sum = filter_peroc ? a_sums[ri] * filter_zp[ci] : a_sums[ri];
+          value -= cur_input_sum;
+          value += bias[ci];
+          int32_t cur_left_shift = filter_peroc ? left_shift[ci] : left_shift[0];
+          int32_t cur_right_shift = filter_peroc ? right_shift[ci] : right_shift[0];
+          int32_t cur_multiplier = filter_peroc ? multiplier[ci] : multiplier[0];
+          value = MultiplyByQuantizedMultiplier(value, cur_multiplier, cur_left_shift, cur_right_shift) + out_zp;
+          value = MSMIN(act_max, value);
+          value = MSMAX(act_min, value);
+          dst[ri * stride + ci] = (int8_t)value;
+        }
+      }
+    }
+  }
+}
+
+void DynamicMatmul4x16x4AIWIVnni(const int8_t *a, const int8_t *b, const float *bias, float *dst, int row, int col,
+                                 int deep, int deep16, size_t stride, int input_zp, const float *input_scale,
+                                 const float *filter_scale, int filter_zp, bool input_per_channel,
+                                 bool filter_per_channel, int64_t act_type) {
+  const MatmulInt8VnniKernel *kernels = NULL;
+  int col_tile = GetMatmulInt8VnniKernels(&kernels);
+  int32_t tile[C4NUM * C16NUM];
+  int32_t zp_sum = deep * input_zp * filter_zp;
+  for (int c = 0; c < col; c += col_tile) {
+    int cur_col = MSMIN(col_tile, col - c);
+    MatmulInt8VnniKernel kernel = kernels[UP_DIV(cur_col, C4NUM) - 1];
+    int32_t b_sums[C16NUM] = {0};
+    if (input_zp != 0) {
+      for (int j = 0; j < cur_col; ++j) {
+        b_sums[j] = input_zp * PackedSumInt8(b + (c + j) / C4NUM * deep16 * C4NUM + (c + j) % C4NUM * C16NUM, deep16);
+      }
+    }
+    for (int r = 0; r < row; r += C4NUM) {
+      int cur_row = MSMIN(C4NUM, row - r);
+      kernel(tile, a + r * deep16, b + c * deep16, deep16);
+      for (int i = 0; i < cur_row; ++i) {
+        int ri = r + i;
+        int32_t a_sum = filter_zp == 0 ? 0 : filter_zp * PackedSumInt8(a + r * deep16 + i * C16NUM, deep16);
+        for (int j = 0; j < cur_col; ++j) {
+          int ci = c + j;
+          int32_t value = tile[i * C16NUM + j] - a_sum - b_sums[j] + zp_sum;
+          int input_quant_index = input_per_channel ? ri : 0;
+          int filter_quant_index = filter_per_channel ? ci : 0;
+          float multi_scale = input_scale[input_quant_index] * filter_scale[filter_quant_index];
+          size_t dst_index = ri * stride + ci;
+          dst[dst_index] = multi_scale * value;
+          if (bias != NULL) {
+            dst[dst_index] += bias[ci];
+          }
+          if (act_type == ActType_Relu) {
+            dst[dst_index] = MSMAX(0, dst[dst_index]);
+          } else if (act_type == ActType_Relu6) {
+            dst[dst_index] = MSMAX(0, dst[dst_index]);
+            dst[dst_index] = MSMIN(C6NUM, dst[dst_index]);
+          }
+        }
+      }
+    }
+  }
+}
+#endif
+
+bool MatmulInt8VnniSupport(void) {
+#ifdef ENABLE_INT8_VNNI
+  const MatmulInt8VnniKernel *kernels = NULL;
+  return GetMatmulInt8VnniKernels(&kernels) != 0;
+#else
+  return false;
+#endif
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NNACL_INT8_MATMUL_VNNI_INT8_H_
+#define NNACL_INT8_MATMUL_VNNI_INT8_H_
+
+#include <stdbool.h>
+#include "nnacl/op_base.h"
+
+#if defined(ENABLE_AVX512_VNNI) || defined(ENABLE_AVX_VNNI)
+#define ENABLE_INT8_VNNI
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * The int32 products of 4 rows of row4x16-major a and 4x(cols) columns of col16x4-major b, which are generated by
+ * HPC-generator, dst is row-major with stride C16NUM.
+ */
+typedef void (*MatmulInt8VnniKernel)(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+
+#ifdef ENABLE_AVX512_VNNI
+void nnacl_gemm_avx512_vnni_4x4_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+void nnacl_gemm_avx512_vnni_4x8_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+void nnacl_gemm_avx512_vnni_4x12_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+void nnacl_gemm_avx512_vnni_4x16_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+#endif
+#ifdef ENABLE_AVX_VNNI
+void nnacl_gemm_avx_vnni_4x4_kernel_int8(int32_t *dst, const int8_t *a, const int8_t *b, const size_t deep16);
+#endif
+
+/* Whether the x86 vnni kernels are built and supported by the cpu, IntelX86CpuInfoInit should be called before. */
+bool MatmulInt8VnniSupport(void);
+
+#ifdef ENABLE_INT8_VNNI
+/* The same as MatmulInt8Opt and DynamicMatmul4x16x4AIWI, the results are bit-exact with them. */
+void MatmulInt8OptVnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                       const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                       const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                       size_t filter_peroc, const int32_t *filter_zp);
+void DynamicMatmul4x16x4AIWIVnni(const int8_t *a, const int8_t *b, const float *bias, float *dst, int row, int col,
+                                 int deep, int deep16, size_t stride, int input_zp, const float *input_scale,
+                                 const float *filter_scale, int filter_zp, bool input_per_channel,
+                                 bool filter_per_channel, int64_t act_type);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NNACL_INT8_MATMUL_VNNI_INT8_H_
@@ -0,0 +1,191 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/paged_attention_cpu_kernel.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include "base/float16.h"
+#include "mindspore/core/ops/ops_func_impl/paged_attention.h"
+#include "plugin/device/cpu/kernel/utils/flash_attention_helper.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kPagedAttentionOutputsNum = 1;
+constexpr size_t kPagedAttentionCacheMinRank = 3;
+
+size_t ShapeSizeFrom(const ShapeVector &shape, size_t begin) {
+  return LongToSize(
+    std::accumulate(shape.begin() + SizeToLong(begin), shape.end(), int64_t(1), std::multiplies<int64_t>()));
+}
+}  // namespace
+
+bool PagedAttentionCpuKernelMod::Init(const std::vector<KernelTensor *> &inputs,
+                                      const std::vector<KernelTensor *> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), ops::kPagedAttentionInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kPagedAttentionOutputsNum, kernel_name_);
+  auto kernel_attr = GetKernelAttrFromTensors(inputs, outputs);
+  auto [is_match, index] = MatchKernelAttr(kernel_attr, GetOpSupport());
+  if (!is_match) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', it does not support this kernel data type: " << kernel_attr;
+    return false;
+  }
+  kernel_func_ = func_list_[index].second;
+  return true;
+}
+
+int PagedAttentionCpuKernelMod::Resize(const std::vector<KernelTensor *> &inputs,
+                                       const std::vector<KernelTensor *> &outputs) {
+  if (auto ret = KernelMod::Resize(inputs, outputs); ret != KRET_OK) {
+    return ret;
+  }
+  const auto &query_shape = inputs[ops::kPagedAttentionInputQueryIndex]->GetShapeVector();
+  const auto &cache_shape = inputs[ops::kPagedAttentionInputKeyCacheIndex]->GetShapeVector();
+  const auto &block_tables_shape = inputs[ops::kPagedAttentionInputBlockTablesIndex]->GetShapeVector();
+  if (query_shape.size() < kDim2 || cache_shape.size() < kPagedAttentionCacheMinRank ||
+      block_tables_shape.size() != kDim2 ||
+      cache_shape != inputs[ops::kPagedAttentionInputValueCacheIndex]->GetShapeVector()) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the shape of query should be (num_tokens, num_head, head_dim), "
+                  << "the shapes of key_cache and value_cache should be the same (num_blocks, block_size, kv_head_num, "
+                  << "head_dim), and the shape of block_tables should be (num_tokens, max_num_blocks_per_batch), but "
+                  << "got " << query_shape << ", " << cache_shape << ", "
+                  << inputs[ops::kPagedAttentionInputValueCacheIndex]->GetShapeVector() << " and "
+                  << block_tables_shape;
+    return KRET_RESIZE_FAILED;
+  }
+  head_num_ = LongToSize(inputs[ops::kPagedAttentionInputNumHeadIndex]->GetValueWithCheck<int64_t>());
+  scale_value_ = inputs[ops::kPagedAttentionInputScaleValueIndex]->GetValueWithCheck<float>();
+  kv_head_num_ = LongToSize(inputs[ops::kPagedAttentionInputNumKVHeadIndex]->GetValueWithCheck<int64_t>());
+  num_tokens_ = LongToSize(query_shape[kIndex0]);
+  const size_t hidden_size = ShapeSizeFrom(query_shape, kIndex1);
+  const size_t kv_hidden_size = ShapeSizeFrom(cache_shape, kIndex2);
+  if (head_num_ == 0 || kv_head_num_ == 0 || hidden_size % head_num_ != 0 || head_num_ % kv_head_num_ != 0 ||
+      kv_hidden_size != hidden_size / head_num_ * kv_head_num_) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the head_num " << head_num_ << " should be a multiple of the "
+                  << "kv_head_num " << kv_head_num_ << ", and the hidden size of query " << hidden_size
+                  << " and cache " << kv_hidden_size << " should be their multiples of the same head_dim.";
+    return KRET_RESIZE_FAILED;
+  }
+  head_dim_ = hidden_size / head_num_;
+  num_blocks_ = LongToSize(cache_shape[kIndex0]);
+  block_size_ = LongToSize(cache_shape[kIndex1]);
+  max_num_blocks_ = LongToSize(block_tables_shape[kIndex1]);
+  if (LongToSize(block_tables_shape[kIndex0]) != num_tokens_ ||
+      ShapeSizeFrom(inputs[ops::kPagedAttentionInputContextLensIndex]->GetShapeVector(), kIndex0) != num_tokens_) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', block_tables and context_lens should have " << num_tokens_
+                  << " rows, the same as query.";
+    return KRET_RESIZE_FAILED;
+  }
+  return KRET_OK;
+}
+
+template <typename T, typename S>
+bool PagedAttentionCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs,
+                                              const std::vector<KernelTensor *> &,
+                                              const std::vector<KernelTensor *> &outputs) {
+  if (num_tokens_ == 0) {
+    return true;
+  }
+  const auto *query = GetDeviceAddress<T>(inputs, ops::kPagedAttentionInputQueryIndex);
+  const auto *key_cache = GetDeviceAddress<T>(inputs, ops::kPagedAttentionInputKeyCacheIndex);
+  const auto *value_cache = GetDeviceAddress<T>(inputs, ops::kPagedAttentionInputValueCacheIndex);
+  const auto *block_tables = GetDeviceAddress<S>(inputs, ops::kPagedAttentionInputBlockTablesIndex);
+  const auto *context_lens = GetDeviceAddress<S>(inputs, ops::kPagedAttentionInputContextLensIndex);
+  auto *output = GetDeviceAddress<T>(outputs, kIndex0);
+  MS_EXCEPTION_IF_NULL(query);
+  MS_EXCEPTION_IF_NULL(key_cache);
+  MS_EXCEPTION_IF_NULL(value_cache);
+  MS_EXCEPTION_IF_NULL(block_tables);
+  MS_EXCEPTION_IF_NULL(context_lens);
+  MS_EXCEPTION_IF_NULL(output);
+
+  // Check the tables before the parallel tasks, so that no task reads out of the cache.
+  for (size_t token = 0; token < num_tokens_; ++token) {
+    const auto context_len = static_cast<int64_t>(context_lens[token]);
+    if (context_len < 0 || LongToSize(context_len) > max_num_blocks_ * block_size_) {
+      MS_LOG(ERROR) << "For '" << kernel_name_ << "', the context length of token " << token << " should be in [0, "
+                    << max_num_blocks_ * block_size_ << "], but got " << context_len;
+      return false;
+    }
+    const S *blocks = block_tables + token * max_num_blocks_;
+    for (size_t i = 0; i * block_size_ < LongToSize(context_len); ++i) {
+      if (static_cast<int64_t>(blocks[i]) < 0 || LongToSize(static_cast<int64_t>(blocks[i])) >= num_blocks_) {
+        MS_LOG(ERROR) << "For '" << kernel_name_ << "', the block ids should be in [0, " << num_blocks_
+                      << "), but got " << blocks[i] << " of token " << token;
+        return false;
+      }
+    }
+  }
+
+  const size_t group_size = head_num_ / kv_head_num_;
+  const size_t hidden_size = head_num_ * head_dim_;
+  const size_t kv_hidden_size = kv_head_num_ * head_dim_;
+  auto task = [&](size_t start, size_t end) {
+    FlashAttentionTile tile(group_size, head_dim_);
+    for (size_t index = start; index < end; ++index) {
+      const size_t token = index / kv_head_num_;
+      const size_t kv_head = index % kv_head_num_;
+      const size_t q_offset = token * hidden_size + kv_head * group_size * head_dim_;
+      tile.Start(query + q_offset, group_size, head_dim_);
+      const size_t context_len = LongToSize(static_cast<int64_t>(context_lens[token]));
+      const S *blocks = block_tables + token * max_num_blocks_;
+      for (size_t i = 0; i * block_size_ < context_len; ++i) {
+        const size_t cache_offset =
+          LongToSize(static_cast<int64_t>(blocks[i])) * block_size_ * kv_hidden_size + kv_head * head_dim_;
+        const size_t rows = std::min(block_size_, context_len - i * block_size_);
+        tile.AddBlock(key_cache + cache_offset, value_cache + cache_offset, rows, kv_hidden_size, scale_value_);
+      }
+      tile.Finish(output + q_offset, head_dim_);
+    }
+  };
+  ParallelLaunchAutoSearch(task, num_tokens_ * kv_head_num_, this, &parallel_search_info_);
+  return true;
+}
+
+#define PAGED_ATTENTION_CPU_REG(MS_T, MS_S, T, S)                         \
+  {                                                                       \
+    KernelAttr()                                                          \
+      .AddInputAttr(MS_T)                                                 \
+      .AddInputAttr(MS_T)                                                 \
+      .AddInputAttr(MS_T)                                                 \
+      .AddInputAttr(MS_S)                                                 \
+      .AddInputAttr(MS_S)                                                 \
+      .AddInputAttr(kObjectTypeNumber, kNumberTypeInt64)                  \
+      .AddInputAttr(kObjectTypeNumber, kNumberTypeFloat32)                \
+      .AddInputAttr(kObjectTypeNumber, kNumberTypeInt64)                  \
+      .AddOutputAttr(MS_T),                                               \
+      &PagedAttentionCpuKernelMod::LaunchKernel<T, S>                     \
+  }
+
+std::vector<std::pair<KernelAttr, PagedAttentionCpuKernelMod::PagedAttentionFunc>>
+  PagedAttentionCpuKernelMod::func_list_ = {
+    PAGED_ATTENTION_CPU_REG(kNumberTypeFloat32, kNumberTypeInt32, float, int32_t),
+    PAGED_ATTENTION_CPU_REG(kNumberTypeFloat32, kNumberTypeInt64, float, int64_t),
+    PAGED_ATTENTION_CPU_REG(kNumberTypeFloat16, kNumberTypeInt32, float16, int32_t),
+    PAGED_ATTENTION_CPU_REG(kNumberTypeFloat16, kNumberTypeInt64, float16, int64_t),
+};
+
+std::vector<KernelAttr> PagedAttentionCpuKernelMod::GetOpSupport() {
+  std::vector<KernelAttr> support_list;
+  (void)std::transform(func_list_.begin(), func_list_.end(), std::back_inserter(support_list),
+                       [](const std::pair<KernelAttr, PagedAttentionFunc> &item) { return item.first; });
+  return support_list;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, PagedAttention, PagedAttentionCpuKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
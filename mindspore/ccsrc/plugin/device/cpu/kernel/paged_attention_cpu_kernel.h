@@ -0,0 +1,69 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PAGED_ATTENTION_CPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PAGED_ATTENTION_CPU_KERNEL_H_
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/factory/ms_factory.h"
+
+namespace mindspore {
+namespace kernel {
+// PagedAttention attends each token to the keys and values of its sequence in the block-paged KV cache, which are
+// found by the block table of the token. The query heads sharing a kv head are computed as a tile, so each row of the
+// cache is read once for them.
+class PagedAttentionCpuKernelMod : public NativeCpuKernelMod {
+ public:
+  PagedAttentionCpuKernelMod() = default;
+  ~PagedAttentionCpuKernelMod() override = default;
+
+  bool Init(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
+
+  int Resize(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs) override;
+
+  bool Launch(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+              const std::vector<KernelTensor *> &outputs) override {
+    return kernel_func_(this, inputs, workspace, outputs);
+  }
+
+  std::vector<KernelAttr> GetOpSupport() override;
+
+ private:
+  template <typename T, typename S>
+  bool LaunchKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+                    const std::vector<KernelTensor *> &outputs);
+
+  using PagedAttentionFunc =
+    std::function<bool(PagedAttentionCpuKernelMod *, const std::vector<KernelTensor *> &,
+                       const std::vector<KernelTensor *> &, const std::vector<KernelTensor *> &)>;
+  static std::vector<std::pair<KernelAttr, PagedAttentionFunc>> func_list_;
+  PagedAttentionFunc kernel_func_;
+
+  size_t num_tokens_{0};
+  size_t head_num_{1};
+  size_t kv_head_num_{1};
+  size_t head_dim_{0};
+  size_t num_blocks_{0};
+  size_t block_size_{0};
+  size_t max_num_blocks_{0};
+  float scale_value_{1.0};
+};
+}  // namespace kernel
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PAGED_ATTENTION_CPU_KERNEL_H_
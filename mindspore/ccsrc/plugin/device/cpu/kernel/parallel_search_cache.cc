@@ -0,0 +1,186 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+// Serializes the writers of the file of path across processes while alive.
+class FileLock {
+ public:
+  explicit FileLock(const std::string &path) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    auto lock_file = path + ".lock";
+    fd_ = open(lock_file.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd_ < 0) {
+      MS_LOG(WARNING) << "Open lock file " << lock_file << " failed.";
+      return;
+    }
+    (void)flock(fd_, LOCK_EX);
+#endif
+    locked_ = true;
+  }
+  ~FileLock() {
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (fd_ >= 0) {
+      (void)flock(fd_, LOCK_UN);
+      (void)close(fd_);
+    }
+#endif
+  }
+  bool locked() const { return locked_; }
+
+ private:
+  int fd_{-1};
+  bool locked_{false};
+};
+
+ParallelSearchCache::Mode GetModeFromEnv() {
+  auto mode = common::GetEnv(kParallelSearchCacheModeEnv);
+  if (mode.empty() || mode == "read_write") {
+    return ParallelSearchCache::Mode::kReadWrite;
+  }
+  if (mode == "read_only") {
+    return ParallelSearchCache::Mode::kReadOnly;
+  }
+  if (mode == "tune") {
+    return ParallelSearchCache::Mode::kTune;
+  }
+  MS_LOG(WARNING) << "The value of " << kParallelSearchCacheModeEnv
+                  << " should be read_write, read_only or tune, but got " << mode << ", use read_write instead.";
+  return ParallelSearchCache::Mode::kReadWrite;
+}
+}  // namespace
+
+ParallelSearchCache::ParallelSearchCache(std::string path, Mode mode) : path_(std::move(path)), mode_(mode) {
+  if (enabled()) {
+    Load(path_, &entries_);
+    MS_LOG(INFO) << "Load " << entries_.size() << " parallel search entries from " << path_;
+  }
+}
+
+ParallelSearchCache &ParallelSearchCache::GetInstance() {
+  static ParallelSearchCache instance(common::GetEnv(kParallelSearchCacheEnv), GetModeFromEnv());
+  return instance;
+}
+
+void ParallelSearchCache::Load(const std::string &path, std::map<std::string, size_t> *entries) {
+  std::ifstream ifs(path);
+  if (!ifs.is_open()) {
+    return;
+  }
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    size_t best_pow = 0;
+    std::string key;
+    if (!(iss >> best_pow) || !std::getline(iss >> std::ws, key) || key.empty()) {
+      MS_LOG(WARNING) << "Skip invalid line in parallel search cache " << path << ": " << line;
+      continue;
+    }
+    (*entries)[key] = best_pow;
+  }
+}
+
+bool ParallelSearchCache::Get(const std::string &key, size_t *best_pow) {
+  MS_EXCEPTION_IF_NULL(best_pow);
+  if (mode_ == Mode::kTune) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    return false;
+  }
+  *best_pow = iter->second;
+  return true;
+}
+
+void ParallelSearchCache::Put(const std::string &key, size_t best_pow) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[key] = best_pow;
+  if (!enabled() || mode_ == Mode::kReadOnly) {
+    return;
+  }
+  new_entries_[key] = best_pow;
+  Append(key, best_pow);
+}
+
+void ParallelSearchCache::Append(const std::string &key, size_t best_pow) {
+  // A search converges once per kernel configuration, append the line instead of rewriting the whole file.
+  FileLock file_lock(path_);
+  if (!file_lock.locked()) {
+    MS_LOG(WARNING) << "The parallel search entry " << key << " is not appended to " << path_;
+    return;
+  }
+  std::ofstream ofs(path_, std::ios::out | std::ios::app);
+  ofs << best_pow << " " << key << "\n";
+  ofs.close();
+  if (ofs.fail()) {
+    MS_LOG(WARNING) << "Append the parallel search entry " << key << " to " << path_ << " failed.";
+  }
+}
+
+void ParallelSearchCache::Save() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled() || new_entries_.empty()) {
+    return;
+  }
+  // Several processes may tune the same file, merge under the lock so no process drops the entries of the others.
+  FileLock file_lock(path_);
+  if (!file_lock.locked()) {
+    MS_LOG(WARNING) << "The parallel search cache " << path_ << " is not compacted.";
+    return;
+  }
+  std::map<std::string, size_t> merged;
+  Load(path_, &merged);
+  for (const auto &entry : new_entries_) {
+    merged[entry.first] = entry.second;
+  }
+  // Write a temporary file and rename it, readers never see a partial file.
+  auto tmp_path = path_ + ".tmp";
+  std::ofstream ofs(tmp_path, std::ios::out | std::ios::trunc);
+  bool saved = ofs.is_open();
+  if (saved) {
+    for (const auto &entry : merged) {
+      ofs << entry.second << " " << entry.first << "\n";
+    }
+    ofs.close();
+#if defined(_WIN32) || defined(_WIN64)
+    (void)std::remove(path_.c_str());
+#endif
+    saved = !ofs.fail() && std::rename(tmp_path.c_str(), path_.c_str()) == 0;
+  }
+  if (saved) {
+    MS_LOG(INFO) << "Save " << new_entries_.size() << " new parallel search entries to " << path_;
+    new_entries_.clear();
+  } else {
+    MS_LOG(WARNING) << "Write parallel search cache " << path_ << " failed.";
+  }
+}
+}  // namespace kernel
+}  // namespace mindspore
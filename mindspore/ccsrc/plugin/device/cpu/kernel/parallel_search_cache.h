@@ -0,0 +1,78 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace kernel {
+// Environment variables of the tuning cache of ParallelLaunchAutoSearch.
+// MS_CPU_PARALLEL_SEARCH_CACHE: path of the cache file, the cache is disabled when it is not set.
+// MS_CPU_PARALLEL_SEARCH_CACHE_MODE: "read_write" (default), "read_only" to use a pre-tuned file without writing it,
+//   or "tune" to search all the kernels again and overwrite their entries, which is how a file is pre-tuned offline.
+constexpr char kParallelSearchCacheEnv[] = "MS_CPU_PARALLEL_SEARCH_CACHE";
+constexpr char kParallelSearchCacheModeEnv[] = "MS_CPU_PARALLEL_SEARCH_CACHE_MODE";
+
+// Persistent cache of the best block size power found by ParallelLaunchAutoSearch, keyed by the kernel name,
+// attributes, shapes, data types, kernel thread number and task count, so that the search runs once per kernel
+// configuration instead of once per kernel instance and process. Each line of the file is "<best_pow> <key>", a later
+// line of the same key overrides the earlier ones. An entry is appended to the file as soon as its search converges,
+// so it survives a crash of the process, and Save compacts the file at the shutdown of the device.
+// scripts/tune_cpu_parallel_search.sh pre-tunes a file offline.
+class BACKEND_EXPORT ParallelSearchCache {
+ public:
+  enum class Mode { kReadWrite, kReadOnly, kTune };
+
+  // Loads the entries of the file at path, an empty path disables the cache.
+  ParallelSearchCache(std::string path, Mode mode);
+  ~ParallelSearchCache() = default;
+
+  // The cache configured by the environment variables.
+  static ParallelSearchCache &GetInstance();
+
+  bool enabled() const { return !path_.empty(); }
+
+  // Returns false when there is no entry of key, or when all the kernels are searched again in tune mode.
+  bool Get(const std::string &key, size_t *best_pow);
+  // Records the converged search of key and appends it to the file unless in read_only mode.
+  void Put(const std::string &key, size_t best_pow);
+
+  // Rewrites the file with one line per key when this process has put entries, keeping the entries written by other
+  // processes in the meantime.
+  void Save();
+
+ private:
+  DISABLE_COPY_AND_ASSIGN(ParallelSearchCache);
+  static void Load(const std::string &path, std::map<std::string, size_t> *entries);
+  void Append(const std::string &key, size_t best_pow);
+
+  std::string path_;
+  Mode mode_;
+  std::mutex mutex_;
+  std::map<std::string, size_t> entries_;
+  // Entries found in this process and appended to the file since the last Save.
+  std::map<std::string, size_t> new_entries_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
@@ -27,6 +27,7 @@
 #include "utils/check_convert_utils.h"
 #include "ops/reduce.h"
 #include "plugin/device/cpu/kernel/nnacl/errorcode.h"
+#include "include/common/thread_pool.h"
 
 namespace mindspore {
 namespace kernel {
@@ -40,6 +41,8 @@ constexpr auto kReduceAll = "ReduceAll";
 constexpr auto kReduceAny = "ReduceAny";
 
 constexpr size_t kReduceSmallVectorSize = 200000;
+// The least length of a part of the reduced axis, when the axis is split for few outputs.
+constexpr int64_t kReduceAxisPartMinSize = 16384;
 constexpr size_t kReduceOutputsNum = 1;
 
 using complex64 = std::complex<float>;
@@ -60,7 +63,8 @@ class ReduceCpuKernelFunc : public CpuKernelFunc {
   void AccelerateLongVector(T *input_addr, T *output_addr, size_t input_size);
   void ChooseFunc();
   void HandleInputAxis();
-  void SpecialExcute();
+  void InitSimdReduce();
+  void SimdReduce(const float *input_addr, float *output_addr);
   void CalAxesAndStride(std::vector<size_t> *axes, size_t *stride);
 
   enum class ReduceFuncType {
@@ -77,7 +81,13 @@ class ReduceCpuKernelFunc : public CpuKernelFunc {
   static constexpr size_t kAxisIndex_{1};
   ReduceFuncType reduce_type_{ReduceFuncType::kReduceAllType};
   std::function<void(const T *, T *, size_t, size_t, TransposeIterator *)> reduce_func_;
-  bool simple_execute_{false};
+  // The float input is viewed as outer x axis x inner when the reduced axes are adjacent, ignoring the axes of size 1,
+  // and reduced by the nnacl simd kernels on the contiguous axis (inner is 1) or on the contiguous inner.
+  bool simd_reduce_{false};
+  int64_t outer_size_{1};
+  int64_t axis_size_{1};
+  int64_t inner_size_{1};
+  std::vector<float> partial_output_;
   std::string kernel_name_;
   bool need_skip_execute_{false};
   bool skip_mode_{false};
@@ -213,25 +223,41 @@ void ReduceAny(const T *in, T *out, size_t start, size_t end, TransposeIterator
 }
 
 template <typename T>
-void ReduceCpuKernelFunc<T>::SpecialExcute() {
-  // reset simple_execute_
-  simple_execute_ = false;
-  // special accelerate for axis = 1 and input has 2 dims
-  if ((reduce_type_ == ReduceFuncType::kReduceMeanType || reduce_type_ == ReduceFuncType::kReduceSumType) &&
-      axis_.size() == 1 && axis_[0] == 1 && input_shape_.size() == kDim2) {
-    simple_execute_ = true;
-  }
-  // special accelerate for axis[0] = 0 and other dims for axis is 1.
-  if (reduce_type_ == ReduceFuncType::kReduceSumType && axis_.size() >= 1 && axis_[0] == 0 &&
-      input_shape_.size() >= kDim2) {
-    simple_execute_ = true;
-    for (size_t i = 1; i < axis_.size(); ++i) {
-      if (static_cast<int64_t>(input_shape_.size()) > axis_[i] && input_shape_[axis_[i]] != 1) {
-        simple_execute_ = false;
-        break;
+void ReduceCpuKernelFunc<T>::InitSimdReduce() {
+  simd_reduce_ = false;
+  outer_size_ = 1;
+  axis_size_ = 1;
+  inner_size_ = 1;
+  // The axes are in the outer before the reduced ones, then in the reduced ones, and then in the inner.
+  enum class AxisPart { kOuter, kReduced, kInner };
+  auto part = AxisPart::kOuter;
+  size_t j = 0;
+  for (size_t i = 0; i < input_shape_.size(); ++i) {
+    bool is_reduced = j < axis_.size() && axis_[j] == SizeToLong(i);
+    if (is_reduced) {
+      ++j;
+    }
+    auto dim = input_shape_[i];
+    if (dim <= 0) {
+      return;
+    }
+    if (dim == 1) {
+      continue;
+    }
+    if (is_reduced) {
+      if (part == AxisPart::kInner) {
+        return;
       }
+      part = AxisPart::kReduced;
+      axis_size_ *= dim;
+    } else if (part == AxisPart::kOuter) {
+      outer_size_ *= dim;
+    } else {
+      part = AxisPart::kInner;
+      inner_size_ *= dim;
     }
   }
+  simd_reduce_ = true;
 }
 
 template <typename T>
@@ -262,7 +288,7 @@ void ReduceCpuKernelFunc<T>::HandleInputAxis() {
   auto last = std::unique(axis_.begin(), axis_.end());
   axis_.erase(last, axis_.end());
   if constexpr (std::is_same<T, float>::value) {
-    SpecialExcute();
+    InitSimdReduce();
   }
 }
 
@@ -379,6 +405,13 @@ bool ReduceCpuKernelFunc<T>::RunFunc(const std::vector<kernel::KernelTensor *> &
     return true;
   }
 
+  if constexpr (std::is_same<T, float>::value) {
+    if (simd_reduce_) {
+      SimdReduce(input_addr, output_addr);
+      return true;
+    }
+  }
+
   if (axis_.empty() || input_shape_.empty() || input_shape_.size() == 1) {
     if (input_size < kReduceSmallVectorSize) {
       // Get one ret
@@ -397,32 +430,6 @@ bool ReduceCpuKernelFunc<T>::RunFunc(const std::vector<kernel::KernelTensor *> &
     CalAxesAndStride(&axes, &stride);
 
     size_t output_size = outputs[0]->size() / sizeof(T);
-    if constexpr (std::is_same<T, float>::value) {
-      if (simple_execute_) {
-        if (axis_[0] == 1) {
-          auto task = [&](size_t start, size_t end) {
-            for (size_t i = start; i < end; ++i) {
-              (void)ReduceSumDim2Axis1(stride, input_addr + i * stride, output_addr + i);
-              if (reduce_type_ == ReduceFuncType::kReduceMeanType) {
-                output_addr[i] /= SizeToFloat(stride);
-              }
-            }
-          };
-          ParallelLaunchAutoSearch(task, output_size, this, &parallel_search_info_);
-          return true;
-        } else {
-          auto task = [&](size_t start, size_t end) {
-            int ret =
-              ReduceSumDim2Axis0(end - start, output_size, input_shape_[0], input_addr + start, output_addr + start);
-            if (ret != NNACL_OK) {
-              MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', ReduceSumDim2Axis0 failed.Error no: " << ret;
-            }
-          };
-          ParallelLaunchAutoSearch(task, output_size, this, &parallel_search_info_);
-          return true;
-        }
-      }
-    }
 
     // Calculate transpose shape
     std::vector<int64_t> transpose_shape(input_shape_.size());
@@ -448,6 +455,61 @@ bool ReduceCpuKernelFunc<T>::RunFunc(const std::vector<kernel::KernelTensor *> &
   return true;
 }
 
+template <typename T>
+void ReduceCpuKernelFunc<T>::SimdReduce(const float *input_addr, float *output_addr) {
+  ReduceModeC mode = Reduce_Sum;
+  if (reduce_type_ == ReduceFuncType::kReduceMaxType) {
+    mode = Reduce_Max;
+  } else if (reduce_type_ == ReduceFuncType::kReduceMinType) {
+    mode = Reduce_Min;
+  } else if (reduce_type_ == ReduceFuncType::kReduceProdType) {
+    mode = Reduce_Prod;
+  }
+  auto reduce = [this, mode](const float *src, float *dst, int64_t axis_size, int64_t inner_size, int64_t axis_start,
+                             int64_t axis_end, int64_t start, int64_t end) {
+    int ret = inner_size == 1
+                ? ReduceLastAxisPartFp32(mode, src, dst, axis_size, axis_start, axis_end, start, end)
+                : ReduceMidAxisPartFp32(mode, src, dst, inner_size, axis_size, axis_start, axis_end, start, end);
+    if (ret != NNACL_OK) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', reduce failed. Error no: " << ret;
+    }
+  };
+  auto mean = [this, output_addr](size_t start, size_t end) {
+    if (reduce_type_ == ReduceFuncType::kReduceMeanType) {
+      for (size_t i = start; i < end; ++i) {
+        output_addr[i] /= static_cast<float>(axis_size_);
+      }
+    }
+  };
+  int64_t output_size = outer_size_ * inner_size_;
+  int64_t thread_num = SizeToLong(common::ThreadPool::GetInstance().GetSyncRunThreadNum());
+  int64_t axis_parts = 1;
+  if (output_size < thread_num) {
+    axis_parts = std::min(thread_num, axis_size_ / kReduceAxisPartMinSize);
+  }
+  if (axis_parts <= 1) {
+    auto task = [this, &reduce, &mean, input_addr, output_addr](size_t start, size_t end) {
+      reduce(input_addr, output_addr, axis_size_, inner_size_, 0, axis_size_, SizeToLong(start), SizeToLong(end));
+      mean(start, end);
+    };
+    ParallelLaunchAutoSearch(task, LongToSize(output_size), this, &parallel_search_info_);
+    return;
+  }
+
+  // A long axis of few outputs is split into parts reduced in parallel, whose outputs are reduced again.
+  partial_output_.resize(LongToSize(axis_parts * output_size));
+  auto task = [this, &reduce, input_addr, axis_parts, output_size](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      int64_t part = SizeToLong(i);
+      reduce(input_addr, partial_output_.data() + part * output_size, axis_size_, inner_size_,
+             axis_size_ * part / axis_parts, axis_size_ * (part + 1) / axis_parts, 0, output_size);
+    }
+  };
+  ParallelLaunch(task, LongToSize(axis_parts), 1.0);
+  reduce(partial_output_.data(), output_addr, axis_parts, output_size, 0, axis_parts, 0, output_size);
+  mean(0, LongToSize(output_size));
+}
+
 template <typename T>
 void ReduceCpuKernelFunc<T>::AccelerateLongVector(T *input_addr, T *output_addr, size_t input_size) {
   // init output_addr
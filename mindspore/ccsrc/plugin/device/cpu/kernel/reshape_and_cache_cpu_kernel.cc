@@ -0,0 +1,151 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/reshape_and_cache_cpu_kernel.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include "mindspore/core/ops/ops_func_impl/reshape_and_cache.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kReshapeAndCacheOutputsNum = 1;
+constexpr size_t kReshapeAndCacheCacheMinRank = 3;
+}  // namespace
+
+bool ReshapeAndCacheCpuKernelMod::Init(const std::vector<KernelTensor *> &inputs,
+                                       const std::vector<KernelTensor *> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), ops::kReshapeAndCacheInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kReshapeAndCacheOutputsNum, kernel_name_);
+  auto kernel_attr = GetKernelAttrFromTensors(inputs, outputs);
+  auto [is_match, index] = MatchKernelAttr(kernel_attr, GetOpSupport());
+  if (!is_match) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', it does not support this kernel data type: " << kernel_attr;
+    return false;
+  }
+  kernel_func_ = func_list_[index].second;
+  return true;
+}
+
+int ReshapeAndCacheCpuKernelMod::Resize(const std::vector<KernelTensor *> &inputs,
+                                        const std::vector<KernelTensor *> &outputs) {
+  if (auto ret = KernelMod::Resize(inputs, outputs); ret != KRET_OK) {
+    return ret;
+  }
+  const auto &key_shape = inputs[ops::kReshapeAndCacheInputKeyIndex]->GetShapeVector();
+  const auto &cache_shape = inputs[ops::kReshapeAndCacheInputKeyCacheIndex]->GetShapeVector();
+  if (key_shape != inputs[ops::kReshapeAndCacheInputValueIndex]->GetShapeVector() ||
+      cache_shape != inputs[ops::kReshapeAndCacheInputValueCacheIndex]->GetShapeVector() ||
+      cache_shape.size() < kReshapeAndCacheCacheMinRank) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', key and value should have the same shape, and so should key_cache "
+                  << "and value_cache of (num_blocks, block_size, kv_head_num, head_dim), but got " << key_shape
+                  << ", " << inputs[ops::kReshapeAndCacheInputValueIndex]->GetShapeVector() << ", " << cache_shape
+                  << " and " << inputs[ops::kReshapeAndCacheInputValueCacheIndex]->GetShapeVector();
+    return KRET_RESIZE_FAILED;
+  }
+  const size_t type_size = abstract::TypeIdSize(inputs[ops::kReshapeAndCacheInputKeyIndex]->dtype_id());
+  const size_t token_elements = LongToSize(
+    std::accumulate(cache_shape.begin() + kIndex2, cache_shape.end(), int64_t(1), std::multiplies<int64_t>()));
+  num_tokens_ = SizeOf(inputs[ops::kReshapeAndCacheInputSlotMappingIndex]->GetShapeVector());
+  num_slots_ = LongToSize(cache_shape[kIndex0] * cache_shape[kIndex1]);
+  token_size_ = token_elements * type_size;
+  if (SizeOf(key_shape) != num_tokens_ * token_elements) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the key of shape " << key_shape << " should be " << num_tokens_
+                  << " tokens of the cache of shape " << cache_shape;
+    return KRET_RESIZE_FAILED;
+  }
+  return KRET_OK;
+}
+
+template <typename S>
+bool ReshapeAndCacheCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs,
+                                               const std::vector<KernelTensor *> &,
+                                               const std::vector<KernelTensor *> &outputs) {
+  if (num_tokens_ == 0) {
+    return true;
+  }
+  const auto *key = GetDeviceAddress<uint8_t>(inputs, ops::kReshapeAndCacheInputKeyIndex);
+  const auto *value = GetDeviceAddress<uint8_t>(inputs, ops::kReshapeAndCacheInputValueIndex);
+  auto *key_cache = GetDeviceAddress<uint8_t>(inputs, ops::kReshapeAndCacheInputKeyCacheIndex);
+  auto *value_cache = GetDeviceAddress<uint8_t>(inputs, ops::kReshapeAndCacheInputValueCacheIndex);
+  const auto *slot_mapping = GetDeviceAddress<S>(inputs, ops::kReshapeAndCacheInputSlotMappingIndex);
+  auto *output = GetDeviceAddress<uint8_t>(outputs, kIndex0);
+  MS_EXCEPTION_IF_NULL(key);
+  MS_EXCEPTION_IF_NULL(value);
+  MS_EXCEPTION_IF_NULL(key_cache);
+  MS_EXCEPTION_IF_NULL(value_cache);
+  MS_EXCEPTION_IF_NULL(slot_mapping);
+  MS_EXCEPTION_IF_NULL(output);
+  for (size_t token = 0; token < num_tokens_; ++token) {
+    if (static_cast<int64_t>(slot_mapping[token]) >= SizeToLong(num_slots_)) {
+      MS_LOG(ERROR) << "For '" << kernel_name_ << "', the slots should be less than " << num_slots_ << ", but got "
+                    << slot_mapping[token] << " of token " << token;
+      return false;
+    }
+  }
+
+  auto task = [&](size_t start, size_t end) {
+    for (size_t token = start; token < end; ++token) {
+      const auto slot = static_cast<int64_t>(slot_mapping[token]);
+      if (slot < 0) {
+        continue;
+      }
+      const size_t cache_offset = LongToSize(slot) * token_size_;
+      const size_t token_offset = token * token_size_;
+      auto ret = memcpy_s(key_cache + cache_offset, token_size_, key + token_offset, token_size_);
+      if (ret == EOK) {
+        ret = memcpy_s(value_cache + cache_offset, token_size_, value + token_offset, token_size_);
+      }
+      if (ret != EOK) {
+        MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', memcpy failed, ret = " << ret;
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(task, num_tokens_, this, &parallel_search_info_);
+  auto ret = memcpy_s(output, outputs[kIndex0]->size(), key, num_tokens_ * token_size_);
+  if (ret != EOK) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', copy key to output failed, ret = " << ret;
+    return false;
+  }
+  return true;
+}
+
+#define RESHAPE_AND_CACHE_CPU_REG(MS_T, MS_S, S)                                                                 \
+  {                                                                                                              \
+    KernelAttr().AddInputAttr(MS_T).AddInputAttr(MS_T).AddInputAttr(MS_T).AddInputAttr(MS_T).AddInputAttr(MS_S) \
+      .AddOutputAttr(MS_T),                                                                                      \
+      &ReshapeAndCacheCpuKernelMod::LaunchKernel<S>                                                              \
+  }
+
+std::vector<std::pair<KernelAttr, ReshapeAndCacheCpuKernelMod::ReshapeAndCacheFunc>>
+  ReshapeAndCacheCpuKernelMod::func_list_ = {
+    RESHAPE_AND_CACHE_CPU_REG(kNumberTypeFloat32, kNumberTypeInt32, int32_t),
+    RESHAPE_AND_CACHE_CPU_REG(kNumberTypeFloat32, kNumberTypeInt64, int64_t),
+    RESHAPE_AND_CACHE_CPU_REG(kNumberTypeFloat16, kNumberTypeInt32, int32_t),
+    RESHAPE_AND_CACHE_CPU_REG(kNumberTypeFloat16, kNumberTypeInt64, int64_t),
+};
+
+std::vector<KernelAttr> ReshapeAndCacheCpuKernelMod::GetOpSupport() {
+  std::vector<KernelAttr> support_list;
+  (void)std::transform(func_list_.begin(), func_list_.end(), std::back_inserter(support_list),
+                       [](const std::pair<KernelAttr, ReshapeAndCacheFunc> &item) { return item.first; });
+  return support_list;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, ReshapeAndCache, ReshapeAndCacheCpuKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
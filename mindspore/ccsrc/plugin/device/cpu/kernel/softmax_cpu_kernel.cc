@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
 #include "plugin/device/cpu/kernel/nnacl/fp32/softmax_fp32.h"
+#include "plugin/device/cpu/kernel/nnacl/bf16/cast_bf16.h"
 
 namespace mindspore {
 namespace kernel {
@@ -40,6 +41,11 @@ struct AccType<float16> {
   using type = float;
 };
 
+template <>
+struct AccType<bfloat16> {
+  using type = float;
+};
+
 template <typename T, typename acc_T>
 void SoftmaxFunc(const T *input_ptr, T *output_ptr, acc_T *sum_data, int start, int end, int dim_axis, int inner_size) {
   for (int i = start; i < end; i++) {
@@ -82,8 +88,8 @@ bool SoftmaxCpuKernelMod::Init(const std::vector<KernelTensor *> &inputs, const
 
   auto dtype = inputs[0]->dtype_id();
   unit_size_ = abstract::TypeIdSize(dtype);
-  // for fp16, use acc_T in workspace
-  unit_size_ = dtype == kNumberTypeFloat16 ? unit_size_ * 2 : unit_size_;
+  // for fp16 and bf16, use acc_T in workspace
+  unit_size_ = (dtype == kNumberTypeFloat16 || dtype == kNumberTypeBFloat16) ? unit_size_ * 2 : unit_size_;
 
   return true;
 }
@@ -165,6 +171,23 @@ bool SoftmaxCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs
       ParallelLaunchAutoSearch(task, output_elements_, this, &parallel_search_info_);
       return true;
     }
+  } else if constexpr (std::is_same_v<T, bfloat16>) {
+    if (last_axis_) {
+      // Every row is widened to float32 for the simd softmax, and rounded to bfloat16 once.
+      auto task = [this, input_data, output_data](size_t start, size_t end) {
+        size_t dim_axis = LongToSize(dim_axis_);
+        int dim_axis_int = LongToInt(dim_axis_);
+        std::vector<float> row_in(dim_axis);
+        std::vector<float> row_out(dim_axis);
+        for (size_t i = start; i < end; ++i) {
+          Bf16ToFloat32(reinterpret_cast<const uint16_t *>(input_data + i * dim_axis), row_in.data(), dim_axis_int);
+          (void)SoftmaxLastAxis(row_in.data(), row_out.data(), 1, dim_axis_int);
+          Float32ToBf16(row_out.data(), reinterpret_cast<uint16_t *>(output_data + i * dim_axis), dim_axis_int);
+        }
+      };
+      ParallelLaunchAutoSearch(task, output_elements_, this, &parallel_search_info_);
+      return true;
+    }
   }
 
   auto outter_size = output_elements_ / inner_size_;
@@ -180,7 +203,8 @@ bool SoftmaxCpuKernelMod::LaunchKernel(const std::vector<KernelTensor *> &inputs
 std::vector<std::pair<KernelAttr, SoftmaxCpuKernelMod::LaunchFunc>> SoftmaxCpuKernelMod::func_list_ = {
   {SOFTMAX_CPU_REG(kNumberTypeFloat16, float16)},
   {SOFTMAX_CPU_REG(kNumberTypeFloat32, float)},
-  {SOFTMAX_CPU_REG(kNumberTypeFloat64, double)}};
+  {SOFTMAX_CPU_REG(kNumberTypeFloat64, double)},
+  {SOFTMAX_CPU_REG(kNumberTypeBFloat16, bfloat16)}};
 
 std::vector<KernelAttr> SoftmaxCpuKernelMod::GetOpSupport() {
   static std::vector<KernelAttr> support_list;
@@ -24,6 +24,7 @@
 #include <memory>
 #include <string>
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/device/cpu/kernel/utils/transpose_engine.h"
 #include "nnacl/transpose_parameter.h"
 
 namespace mindspore {
@@ -43,27 +44,6 @@ class TransposeFwdCpuKernelMod : public NativeCpuKernelMod {
   std::vector<size_t> GetLaunchIgnoredInputAddressIdx() const override { return {kIndex1}; }
 
  private:
-  template <typename T>
-  void LaunchKernel(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &outputs);
-  template <typename T>
-  void ParallelRun(const T *input_addr, T *output_addr, size_t count) const;
-  template <typename T>
-  ErrorCodeCommonEnum DoTranspose(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim2(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim3(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim4(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim5(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim6(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDim7(const T *in_data, T *out_data) const;
-  template <typename T>
-  void TransposeDims(const T *in_data, T *out_data, int64_t task_id, int64_t thread_num) const;
-
   void CheckPermValue();
 
   template <typename T>
@@ -71,24 +51,13 @@ class TransposeFwdCpuKernelMod : public NativeCpuKernelMod {
 
   std::vector<int64_t> input_shape_;
   std::vector<int64_t> perm_shape_;
-  std::vector<int64_t> output_shape_;
-  TypeId dtype_{kTypeUnknown};
   TypeId perm_type_{kNumberTypeInt64};
   std::vector<int64_t> perm_;
-  size_t num_axes_{0};
-  size_t data_num_{0};
-  size_t output_size_{1};
-  std::vector<int64_t> strides_;
-  std::vector<int64_t> out_strides_;
-  std::vector<size_t> tanspose_index_;
+  size_t data_size_{0};
   bool got_perm_value_{false};
+  TransposeEngine engine_;
 
-  using TypeKernel = std::function<void(TransposeFwdCpuKernelMod *, const std::vector<KernelTensor *> &,
-                                        const std::vector<KernelTensor *> &)>;
-  static std::vector<std::pair<KernelAttr, TypeKernel>> launch_list_;
-  TypeKernel launch_func_;
-  bool is_scalar_tensor_{false};
-  bool is_empty_tensor_{false};
+  static std::vector<KernelAttr> support_list_;
 };
 }  // namespace kernel
 }  // namespace mindspore
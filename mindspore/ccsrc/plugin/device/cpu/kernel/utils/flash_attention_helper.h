@@ -0,0 +1,128 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_FLASH_ATTENTION_HELPER_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_FLASH_ATTENTION_HELPER_H_
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include "utils/convert_utils_base.h"
+#include "plugin/device/cpu/kernel/nnacl/fp32/flash_attention_fp32.h"
+
+namespace mindspore {
+namespace kernel {
+// Rows of keys and values folded into the online softmax at a time, the scores of a tile of them stay in cache.
+constexpr size_t kFlashAttentionKVTile = 64;
+
+// FlashAttentionTile computes the attention of a tile of query rows of a head block by block of key and value rows, by
+// the online softmax of nnacl. Rows of half type are converted to float once per block, float rows are read in place.
+// A tile is used by one thread, and reused for the tiles of no more than q_rows rows.
+class FlashAttentionTile {
+ public:
+  FlashAttentionTile(size_t q_rows, size_t head_dim)
+      : head_dim_(head_dim),
+        q_(q_rows * head_dim),
+        k_(kFlashAttentionKVTile * head_dim),
+        v_(kFlashAttentionKVTile * head_dim),
+        scores_(q_rows * kFlashAttentionKVTile),
+        row_max_(q_rows),
+        row_sum_(q_rows),
+        out_(q_rows * head_dim) {}
+  ~FlashAttentionTile() = default;
+
+  const float *row_max() const { return row_max_.data(); }
+  const float *row_sum() const { return row_sum_.data(); }
+
+  // Start the tile with q_rows rows of query, which are q_stride apart. The rows are read until the tile finishes.
+  template <typename T>
+  void Start(const T *q, size_t q_rows, size_t q_stride) {
+    cur_q_rows_ = q_rows;
+    q_data_ = ToFloat(q, q_rows, q_stride, &q_, &q_stride_);
+    FlashAttentionInitFp32(row_max_.data(), row_sum_.data(), out_.data(), SizeToInt(q_rows), SizeToInt(head_dim_));
+  }
+
+  // Fold kv_rows rows of key and value into the tile, by kFlashAttentionKVTile rows at a time. mask(scores, offset,
+  // rows) sets the masked ones of the row-major scores of the tile with rows [offset, offset + rows) of the block to
+  // -inf.
+  template <typename T, typename MaskFunc>
+  void AddBlock(const T *k, const T *v, size_t kv_rows, size_t kv_stride, float scale, const MaskFunc &mask) {
+    for (size_t start = 0; start < kv_rows; start += kFlashAttentionKVTile) {
+      const size_t rows = std::min(kFlashAttentionKVTile, kv_rows - start);
+      size_t k_stride = 0;
+      size_t v_stride = 0;
+      const float *k_data = ToFloat(k + start * kv_stride, rows, kv_stride, &k_, &k_stride);
+      const float *v_data = ToFloat(v + start * kv_stride, rows, kv_stride, &v_, &v_stride);
+      FlashAttentionScoresFp32(q_data_, SizeToInt(cur_q_rows_), SizeToInt(q_stride_), k_data, SizeToInt(rows),
+                               SizeToInt(k_stride), SizeToInt(head_dim_), scale, scores_.data());
+      mask(scores_.data(), start, rows);
+      FlashAttentionUpdateFp32(scores_.data(), v_data, SizeToInt(cur_q_rows_), SizeToInt(rows), SizeToInt(v_stride),
+                               SizeToInt(head_dim_), row_max_.data(), row_sum_.data(), out_.data());
+    }
+  }
+
+  template <typename T>
+  void AddBlock(const T *k, const T *v, size_t kv_rows, size_t kv_stride, float scale) {
+    AddBlock(k, v, kv_rows, kv_stride, scale, [](float *, size_t, size_t) {});
+  }
+
+  // Normalize the tile and write the rows of output, which are out_stride apart.
+  template <typename T>
+  void Finish(T *out, size_t out_stride) {
+    FlashAttentionNormFp32(out_.data(), row_sum_.data(), SizeToInt(cur_q_rows_), SizeToInt(head_dim_));
+    for (size_t i = 0; i < cur_q_rows_; ++i) {
+      const float *src = out_.data() + i * head_dim_;
+      T *dst = out + i * out_stride;
+      for (size_t j = 0; j < head_dim_; ++j) {
+        dst[j] = static_cast<T>(src[j]);
+      }
+    }
+  }
+
+ private:
+  template <typename T>
+  const float *ToFloat(const T *src, size_t rows, size_t stride, std::vector<float> *buf, size_t *float_stride) {
+    if constexpr (std::is_same_v<T, float>) {
+      *float_stride = stride;
+      return src;
+    } else {
+      if (buf->size() < rows * head_dim_) {
+        buf->resize(rows * head_dim_);
+      }
+      for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < head_dim_; ++j) {
+          (*buf)[i * head_dim_ + j] = static_cast<float>(src[i * stride + j]);
+        }
+      }
+      *float_stride = head_dim_;
+      return buf->data();
+    }
+  }
+
+  size_t head_dim_;
+  size_t cur_q_rows_{0};
+  const float *q_data_{nullptr};
+  size_t q_stride_{0};
+  std::vector<float> q_;
+  std::vector<float> k_;
+  std::vector<float> v_;
+  std::vector<float> scores_;
+  std::vector<float> row_max_;
+  std::vector<float> row_sum_;
+  std::vector<float> out_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_FLASH_ATTENTION_HELPER_H_
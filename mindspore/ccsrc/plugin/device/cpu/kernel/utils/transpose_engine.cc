@@ -0,0 +1,245 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/utils/transpose_engine.h"
+#include <algorithm>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "nnacl/base/transpose_base.h"
+#include "nnacl/errorcode.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+// The least elements of a task of the row modes.
+constexpr float kTransposeParallelGrain = 16384.0;
+// A task of kTranspose transposes the blocks of no more than kTransposeBlock x kTransposeBlock elements.
+constexpr int64_t kTransposeBlock = 128;
+
+struct TransposeBit128 {
+  uint64_t value[2];
+};
+}  // namespace
+
+void TransposeEngine::InitTranspose(const std::vector<int64_t> &in_shape, const std::vector<int64_t> &perm,
+                                    size_t data_size) {
+  if (perm.size() != in_shape.size()) {
+    MS_LOG(EXCEPTION) << "The perm size " << perm.size() << " must be equal to the input rank " << in_shape.size();
+  }
+  std::vector<int64_t> strides(in_shape.size(), 1);
+  for (size_t i = in_shape.size(); i > 1; --i) {
+    strides[i - kIndex2] = strides[i - 1] * in_shape[i - 1];
+  }
+  std::vector<int64_t> out_shape(perm.size());
+  std::vector<int64_t> in_strides(perm.size());
+  for (size_t i = 0; i < perm.size(); ++i) {
+    if (perm[i] < 0 || perm[i] >= SizeToLong(in_shape.size())) {
+      MS_LOG(EXCEPTION) << "The perm value must be in [0, " << in_shape.size() << "), but got " << perm[i];
+    }
+    out_shape[i] = in_shape[LongToSize(perm[i])];
+    in_strides[i] = strides[LongToSize(perm[i])];
+  }
+  Init(out_shape, in_strides, data_size);
+}
+
+void TransposeEngine::InitBroadcast(const std::vector<int64_t> &in_shape, const std::vector<int64_t> &out_shape,
+                                    size_t data_size) {
+  if (out_shape.size() < in_shape.size()) {
+    MS_LOG(EXCEPTION) << "The output rank " << out_shape.size() << " must be not less than the input rank "
+                      << in_shape.size();
+  }
+  size_t offset = out_shape.size() - in_shape.size();
+  std::vector<int64_t> in_strides(out_shape.size(), 0);
+  int64_t stride = 1;
+  for (size_t i = in_shape.size(); i > 0; --i) {
+    if (in_shape[i - 1] != 1) {
+      in_strides[offset + i - 1] = stride;
+    }
+    stride *= in_shape[i - 1];
+  }
+  Init(out_shape, in_strides, data_size);
+}
+
+void TransposeEngine::Init(const std::vector<int64_t> &out_shape, const std::vector<int64_t> &in_strides,
+                           size_t data_size) {
+  data_size_ = data_size;
+  shape_.clear();
+  in_strides_.clear();
+  out_strides_.clear();
+  if (std::any_of(out_shape.begin(), out_shape.end(), [](int64_t dim) { return dim <= 0; })) {
+    mode_ = Mode::kEmpty;
+    return;
+  }
+  for (size_t i = 0; i < out_shape.size(); ++i) {
+    if (out_shape[i] == 1) {
+      continue;
+    }
+    if (!shape_.empty() && in_strides_.back() == in_strides[i] * out_shape[i]) {
+      shape_.back() *= out_shape[i];
+      in_strides_.back() = in_strides[i];
+    } else {
+      shape_.push_back(out_shape[i]);
+      in_strides_.push_back(in_strides[i]);
+    }
+  }
+  size_t rank = shape_.size();
+  out_strides_.resize(rank, 1);
+  for (size_t i = rank; i > 1; --i) {
+    out_strides_[i - kIndex2] = out_strides_[i - 1] * shape_[i - 1];
+  }
+
+  if (rank == 0 || (rank == 1 && in_strides_[0] == 1)) {
+    mode_ = Mode::kCopy;
+  } else if (in_strides_.back() == 1) {
+    mode_ = Mode::kCopyRows;
+  } else if (in_strides_.back() == 0) {
+    mode_ = Mode::kFillRows;
+  } else {
+    auto iter = std::find(in_strides_.begin(), in_strides_.end() - 1, 1);
+    if (iter != in_strides_.end() - 1) {
+      mode_ = Mode::kTranspose;
+      contiguous_dim_ = LongToSize(iter - in_strides_.begin());
+    } else {
+      mode_ = Mode::kGatherRows;
+    }
+  }
+}
+
+void TransposeEngine::Run(const void *input, void *output) const {
+  if (mode_ == Mode::kEmpty) {
+    return;
+  }
+  MS_EXCEPTION_IF_NULL(input);
+  MS_EXCEPTION_IF_NULL(output);
+  if (mode_ == Mode::kTranspose) {
+    RunTranspose(input, output);
+    return;
+  }
+  switch (data_size_) {
+    case sizeof(uint8_t):
+      RunRows(static_cast<const uint8_t *>(input), static_cast<uint8_t *>(output));
+      break;
+    case sizeof(uint16_t):
+      RunRows(static_cast<const uint16_t *>(input), static_cast<uint16_t *>(output));
+      break;
+    case sizeof(uint32_t):
+      RunRows(static_cast<const uint32_t *>(input), static_cast<uint32_t *>(output));
+      break;
+    case sizeof(uint64_t):
+      RunRows(static_cast<const uint64_t *>(input), static_cast<uint64_t *>(output));
+      break;
+    case sizeof(TransposeBit128):
+      RunRows(static_cast<const TransposeBit128 *>(input), static_cast<TransposeBit128 *>(output));
+      break;
+    default:
+      MS_LOG(EXCEPTION) << "The transpose does not support the data size " << data_size_;
+  }
+}
+
+template <typename T>
+void TransposeEngine::RunRows(const T *input, T *output) const {
+  if (mode_ == Mode::kCopy) {
+    size_t count = shape_.empty() ? 1 : LongToSize(shape_[0]);
+    auto task = [input, output](size_t start, size_t end) {
+      (void)std::copy(input + start, input + end, output + start);
+    };
+    ParallelLaunch(task, count, kTransposeParallelGrain);
+    return;
+  }
+
+  size_t rank = shape_.size();
+  int64_t inner = shape_[rank - 1];
+  int64_t inner_stride = in_strides_[rank - 1];
+  int64_t rows = 1;
+  for (size_t i = 0; i + 1 < rank; ++i) {
+    rows *= shape_[i];
+  }
+  auto task = [this, input, output, rank, inner, inner_stride](size_t start, size_t end) {
+    // The index of the output row start and its input offset, which then go on row by row.
+    std::vector<int64_t> index(rank - 1);
+    int64_t offset = 0;
+    int64_t row = SizeToLong(start);
+    for (size_t i = rank - 1; i > 0; --i) {
+      index[i - 1] = row % shape_[i - 1];
+      row /= shape_[i - 1];
+      offset += index[i - 1] * in_strides_[i - 1];
+    }
+    for (size_t r = start; r < end; ++r) {
+      const T *src = input + offset;
+      T *dst = output + SizeToLong(r) * inner;
+      if (mode_ == Mode::kCopyRows) {
+        (void)std::copy(src, src + inner, dst);
+      } else if (mode_ == Mode::kFillRows) {
+        std::fill(dst, dst + inner, *src);
+      } else {
+        for (int64_t j = 0; j < inner; ++j) {
+          dst[j] = src[j * inner_stride];
+        }
+      }
+      for (size_t i = rank - 1; i > 0; --i) {
+        offset += in_strides_[i - 1];
+        if (++index[i - 1] < shape_[i - 1]) {
+          break;
+        }
+        offset -= in_strides_[i - 1] * shape_[i - 1];
+        index[i - 1] = 0;
+      }
+    }
+  };
+  ParallelLaunch(task, LongToSize(rows), std::max(1.0f, kTransposeParallelGrain / inner));
+}
+
+void TransposeEngine::RunTranspose(const void *input, void *output) const {
+  // The blocks of the output are by the last dim and the dim contiguous in the input, in the other output dims.
+  size_t last = shape_.size() - 1;
+  size_t contiguous = contiguous_dim_;
+  int64_t last_blocks = UP_DIV(shape_[last], kTransposeBlock);
+  int64_t contiguous_blocks = UP_DIV(shape_[contiguous], kTransposeBlock);
+  int64_t units = last_blocks * contiguous_blocks;
+  for (size_t i = 0; i < last; ++i) {
+    units *= i == contiguous ? 1 : shape_[i];
+  }
+  auto task = [this, input, output, last, contiguous, last_blocks, contiguous_blocks](size_t start, size_t end) {
+    for (size_t u = start; u < end; ++u) {
+      int64_t unit = SizeToLong(u);
+      int64_t last_start = unit % last_blocks * kTransposeBlock;
+      unit /= last_blocks;
+      int64_t contiguous_start = unit % contiguous_blocks * kTransposeBlock;
+      unit /= contiguous_blocks;
+      int64_t in_offset = contiguous_start + last_start * in_strides_[last];
+      int64_t out_offset = contiguous_start * out_strides_[contiguous] + last_start;
+      for (size_t i = last; i > 0; --i) {
+        if (i - 1 == contiguous) {
+          continue;
+        }
+        int64_t index = unit % shape_[i - 1];
+        unit /= shape_[i - 1];
+        in_offset += index * in_strides_[i - 1];
+        out_offset += index * out_strides_[i - 1];
+      }
+      int64_t row = std::min(kTransposeBlock, shape_[last] - last_start);
+      int64_t col = std::min(kTransposeBlock, shape_[contiguous] - contiguous_start);
+      int ret = TransposeMatrix(static_cast<const uint8_t *>(input) + in_offset * SizeToLong(data_size_),
+                                static_cast<uint8_t *>(output) + out_offset * SizeToLong(data_size_), row, col,
+                                in_strides_[last], out_strides_[contiguous], SizeToInt(data_size_));
+      if (ret != NNACL_OK) {
+        MS_LOG(EXCEPTION) << "The transpose does not support the data size " << data_size_;
+      }
+    }
+  };
+  ParallelLaunch(task, LongToSize(units), 1.0);
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_TRANSPOSE_ENGINE_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_TRANSPOSE_ENGINE_H_
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mindspore {
+namespace kernel {
+// TransposeEngine copies the input to the contiguous output, whose dim i reads the input by in_strides[i] elements: a
+// transpose takes the strides of the input dims in the perm, and a broadcast takes 0 for the broadcast dims. The dims
+// of size 1 are dropped and the adjacent dims contiguous in the input are merged. Then the output rows are copied when
+// they are contiguous in the input, filled when they are broadcast from one element, or else the innermost input and
+// output dims are transposed by the blocks of nnacl TransposeMatrix. The work is split by ParallelLaunch.
+class TransposeEngine {
+ public:
+  TransposeEngine() = default;
+  ~TransposeEngine() = default;
+
+  // The input of in_shape transposed by perm, whose values are in [0, rank).
+  void InitTranspose(const std::vector<int64_t> &in_shape, const std::vector<int64_t> &perm, size_t data_size);
+  // The input of in_shape broadcast to out_shape, which are aligned to the last dim.
+  void InitBroadcast(const std::vector<int64_t> &in_shape, const std::vector<int64_t> &out_shape, size_t data_size);
+  void Init(const std::vector<int64_t> &out_shape, const std::vector<int64_t> &in_strides, size_t data_size);
+
+  void Run(const void *input, void *output) const;
+
+ private:
+  enum class Mode { kEmpty, kCopy, kCopyRows, kFillRows, kGatherRows, kTranspose };
+
+  template <typename T>
+  void RunRows(const T *input, T *output) const;
+  void RunTranspose(const void *input, void *output) const;
+
+  Mode mode_{Mode::kEmpty};
+  size_t data_size_{0};
+  // The merged output shape, the input strides and the output strides of its dims.
+  std::vector<int64_t> shape_;
+  std::vector<int64_t> in_strides_;
+  std::vector<int64_t> out_strides_;
+  // The output dim of kTranspose which is contiguous in the input.
+  size_t contiguous_dim_{0};
+};
+}  // namespace kernel
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_UTILS_TRANSPOSE_ENGINE_H_
@@ -46,6 +46,7 @@ void GPUPinMemPool::PinnedMemAlloc(DeviceMemPtr *addr, size_t alloc_size) {
 
 bool GPUPinMemPool::FreeDeviceMem(const DeviceMemPtr &addr) {
   MS_EXCEPTION_IF_NULL(addr);
+  OnMemBlockFree(addr);
   if (pinned_mem_) {
     CudaDriver::CudaHostUnregister(addr);
   }
@@ -31,29 +31,30 @@ constexpr size_t kFileHeadOffset = 0;
 constexpr char kReadFileMode[] = "r+";
 constexpr size_t kAlignSize = 0x1ff;
 
-void IOHandle::LoadAio(const std::string &aio_shared_lib_name, const std::string &instance_func_name) {
+bool IOHandle::LoadAio(const std::string &aio_shared_lib_name, const std::string &instance_func_name) {
 #ifdef _MSC_VER
   auto handle = LoadLibrary(aio_shared_lib_name.c_str());
   if (handle == nullptr) {
     MS_LOG(WARNING) << "Loading " << aio_shared_lib_name << " failed.";
+    return false;
   }
   auto get_aio_instance = reinterpret_cast<AsyncIO *(*)()>(GetProcAddress(handle, instance_func_name.c_str()));
   if (get_aio_instance == nullptr) {
     MS_LOG(WARNING) << "Getting function " << instance_func_name << " from " << aio_shared_lib_name << " failed.";
-    return;
+    return false;
   }
 #else
   auto handle = dlopen(aio_shared_lib_name.c_str(), RTLD_NOW);
   if (handle == nullptr) {
     MS_LOG(WARNING) << "Loading " << aio_shared_lib_name << " failed. Error message: " << dlerror();
-    return;
+    return false;
   }
   void *get_aio_instance_ptr = dlsym(handle, instance_func_name.c_str());
   auto get_aio_instance = reinterpret_cast<AsyncIO *(*)()>(get_aio_instance_ptr);
   if (get_aio_instance == nullptr) {
     MS_LOG(WARNING) << "Getting function " << instance_func_name << " from " << aio_shared_lib_name
                     << " failed. Error message: " << dlerror();
-    return;
+    return false;
   }
 #endif
   aio_ = get_aio_instance();
@@ -64,7 +65,9 @@ void IOHandle::LoadAio(const std::string &aio_shared_lib_name, const std::string
     MS_LOG(WARNING) << "Init aio plugin failed, block size: " << offload_context->aio_block_size()
                     << ", queue depth: " << offload_context->aio_queue_depth();
     aio_ = nullptr;
+    return false;
   }
+  return true;
 }
 
 bool IOHandle::Read(const std::string &file_name, void *data, size_t byte_num) const {
@@ -118,6 +121,18 @@ bool IOHandle::IsAligned(const void *data, const size_t byte_num) const {
 
 bool IOHandle::Wait(AsyncIOToken token) const { return aio_ == nullptr || aio_->Wait(token); }
 
+void IOHandle::RegisterBuffer(void *addr, size_t size) const {
+  if (aio_ != nullptr && aio_->RegisterBuffer(addr, size)) {
+    MS_LOG(INFO) << "Register buffer addr = " << addr << " and size = " << size << " for aio.";
+  }
+}
+
+void IOHandle::UnregisterBuffer(void *addr) const {
+  if (aio_ != nullptr) {
+    aio_->UnregisterBuffer(addr);
+  }
+}
+
 bool IOHandle::DeleteSwapFile(const std::string &file_name) const {
   const auto &fs = system::Env::GetFileSystem();
   MS_EXCEPTION_IF_NULL(fs);
@@ -44,6 +44,9 @@ class AsyncIO {
   virtual bool ReadAsync(const std::string &file_name, void *data, size_t byte_num, AsyncIOToken *token) = 0;
   virtual bool WriteAsync(const std::string &file_name, const void *data, size_t byte_num, AsyncIOToken *token) = 0;
   virtual bool Wait(AsyncIOToken token) = 0;
+  // Register the host memory which is read and written frequently, the implementation may pin it for io.
+  virtual bool RegisterBuffer(void * /* addr */, size_t /* size */) { return false; }
+  virtual void UnregisterBuffer(void * /* addr */) {}
 };
 
 class BACKEND_EXPORT IOHandle {
@@ -52,12 +55,14 @@ class BACKEND_EXPORT IOHandle {
   ~IOHandle() = default;
   bool DeleteSwapFile(const std::string &file_name) const;
   bool CreateSwapFile(const std::string &file_name) const;
-  void LoadAio(const std::string &aio_shared_lib_name, const std::string &instance_func_name);
+  bool LoadAio(const std::string &aio_shared_lib_name, const std::string &instance_func_name);
   bool Read(const std::string &file_name, void *data, size_t byte_num) const;
   bool Write(const std::string &file_name, const void *data, size_t byte_num) const;
   bool ReadAsync(const std::string &file_name, void *data, size_t byte_num, AsyncIOToken *token) const;
   bool WriteAsync(const std::string &file_name, const void *data, size_t byte_num, AsyncIOToken *token) const;
   bool Wait(AsyncIOToken sync_token) const;
+  void RegisterBuffer(void *addr, size_t size) const;
+  void UnregisterBuffer(void *addr) const;
 
  private:
   bool IsAligned(const void *data, size_t byte_num) const;
@@ -0,0 +1,616 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "runtime/device/gsm/io_uring_plugin.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+namespace mindspore {
+namespace device {
+namespace {
+// The kernel thread polling the submission queue sleeps after being idle for the time.
+constexpr unsigned kSqThreadIdleMs = 10;
+// The last block of a write and the fsync linked to it are in flight together.
+constexpr size_t kMinQueueDepth = 2;
+// Kernel limits the size of a registered buffer to 1GB, and the number of registered buffers to UIO_MAXIOV.
+constexpr size_t kMaxRegisteredBufferSize = 1UL << 30;
+constexpr size_t kMaxRegisteredBufferNum = 1024;
+// The low bits of user data tell which part of a request a completion belongs to.
+constexpr uint64_t kUserDataKindBits = 2;
+constexpr uint64_t kUserDataKindMask = (1UL << kUserDataKindBits) - 1;
+constexpr uint64_t kFullBlock = 0;
+constexpr uint64_t kLastBlock = 1;
+constexpr uint64_t kFsync = 2;
+// IORING_REGISTER_BUFFERS_UPDATE and struct io_uring_rsrc_update2 of linux 5.13, which are missing in older headers.
+constexpr unsigned kRegisterBuffersUpdate = 16;
+struct RsrcUpdate {
+  uint32_t offset;
+  uint32_t resv;
+  uint64_t data;
+  uint64_t tags;
+  uint32_t nr;
+  uint32_t resv2;
+};
+
+int IoUringSetup(unsigned entries, io_uring_params *params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  int ret;
+  do {
+    ret = static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+  } while (ret < 0 && errno == EINTR);
+  return ret;
+}
+
+int IoUringRegister(int fd, unsigned opcode, const void *arg, unsigned nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+inline unsigned LoadAcquire(const unsigned *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+inline void StoreRelease(unsigned *p, unsigned v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+inline uint64_t EncodeUserData(AsyncIOToken token, uint64_t kind) {
+  return (static_cast<uint64_t>(token) << kUserDataKindBits) | kind;
+}
+
+template <typename T>
+T *Offset(void *base, size_t offset) {
+  return reinterpret_cast<T *>(static_cast<uint8_t *>(base) + offset);
+}
+}  // namespace
+
+bool UringQueue::Initialize(size_t queue_depth, bool sq_poll) {
+  if (queue_depth == 0) {
+    return false;
+  }
+  if (sq_poll && Setup(queue_depth, true)) {
+    return true;
+  }
+  return Setup(queue_depth, false);
+}
+
+bool UringQueue::Setup(size_t queue_depth, bool sq_poll) {
+  Finalize();
+  io_uring_params params;
+  (void)memset(&params, 0, sizeof(params));
+  if (sq_poll) {
+    params.flags = IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = kSqThreadIdleMs;
+  }
+  ring_fd_ = IoUringSetup(static_cast<unsigned>(queue_depth), &params);
+  if (ring_fd_ < 0) {
+    return false;
+  }
+  sq_poll_ = sq_poll;
+#ifdef IORING_FEAT_SQPOLL_NONFIXED
+  const bool sq_poll_supported = (params.features & IORING_FEAT_SQPOLL_NONFIXED) != 0;
+#else
+  const bool sq_poll_supported = false;
+#endif
+  // The kernel thread only polls the registered files before linux 5.11, the swap files are not registered.
+  if (sq_poll && !sq_poll_supported) {
+    Finalize();
+    return false;
+  }
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single_mmap) {
+    sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    cq_ring_size_ = sq_ring_size_;
+  }
+  sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                  IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    Finalize();
+    return false;
+  }
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+  } else {
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                    IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      cq_ring_ = nullptr;
+      Finalize();
+      return false;
+    }
+  }
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  auto sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    Finalize();
+    return false;
+  }
+  sqes_ = static_cast<io_uring_sqe *>(sqes);
+  sq_head_ = Offset<unsigned>(sq_ring_, params.sq_off.head);
+  sq_tail_ = Offset<unsigned>(sq_ring_, params.sq_off.tail);
+  sq_flags_ = Offset<unsigned>(sq_ring_, params.sq_off.flags);
+  sq_array_ = Offset<unsigned>(sq_ring_, params.sq_off.array);
+  sq_mask_ = *Offset<unsigned>(sq_ring_, params.sq_off.ring_mask);
+  sq_entries_ = params.sq_entries;
+  cq_head_ = Offset<unsigned>(cq_ring_, params.cq_off.head);
+  cq_tail_ = Offset<unsigned>(cq_ring_, params.cq_off.tail);
+  cqes_ = Offset<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+  cq_mask_ = *Offset<unsigned>(cq_ring_, params.cq_off.ring_mask);
+  sq_local_tail_ = *sq_tail_;
+  to_submit_ = 0;
+  return true;
+}
+
+void UringQueue::Finalize() {
+  if (sqes_ != nullptr) {
+    (void)munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+    (void)munmap(cq_ring_, cq_ring_size_);
+  }
+  cq_ring_ = nullptr;
+  if (sq_ring_ != nullptr) {
+    (void)munmap(sq_ring_, sq_ring_size_);
+    sq_ring_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    (void)close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  sq_poll_ = false;
+}
+
+size_t UringQueue::SqSpace() const { return sq_entries_ - (sq_local_tail_ - LoadAcquire(sq_head_)); }
+
+io_uring_sqe *UringQueue::GetSqe() {
+  if (SqSpace() == 0) {
+    return nullptr;
+  }
+  const auto index = sq_local_tail_ & sq_mask_;
+  sq_array_[index] = index;
+  ++sq_local_tail_;
+  ++to_submit_;
+  auto sqe = &sqes_[index];
+  (void)memset(sqe, 0, sizeof(io_uring_sqe));
+  return sqe;
+}
+
+bool UringQueue::Submit() {
+  // The kernel thread may be left asleep with the entries unseen if waking it up failed before.
+  if (to_submit_ == 0 && (!sq_poll_ || LoadAcquire(sq_head_) == sq_local_tail_)) {
+    return true;
+  }
+  StoreRelease(sq_tail_, sq_local_tail_);
+  if (sq_poll_) {
+    to_submit_ = 0;
+    // The kernel thread sets the flag before sleeping and checks the tail again, the fence orders the tail store
+    // before the flag load so that the thread does not sleep with the new entries unseen.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if ((__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP) != 0) {
+      return IoUringEnter(ring_fd_, 0, 0, IORING_ENTER_SQ_WAKEUP) >= 0;
+    }
+    return true;
+  }
+  const auto ret = IoUringEnter(ring_fd_, to_submit_, 0, 0);
+  if (ret < 0) {
+    return false;
+  }
+  to_submit_ -= std::min(to_submit_, static_cast<unsigned>(ret));
+  return true;
+}
+
+bool UringQueue::WaitCqe() const {
+  // The kernel returns at once if there are completions not consumed yet, so none of them is missed.
+  const unsigned flags = IORING_ENTER_GETEVENTS | (sq_poll_ ? IORING_ENTER_SQ_WAKEUP : 0);
+  return IoUringEnter(ring_fd_, 0, 1, flags) >= 0;
+}
+
+template <typename Func>
+size_t UringQueue::ForEachCqe(const Func &func) {
+  auto head = *cq_head_;
+  const auto tail = LoadAcquire(cq_tail_);
+  size_t count = 0;
+  for (; head != tail; ++head, ++count) {
+    func(cqes_[head & cq_mask_]);
+  }
+  StoreRelease(cq_head_, head);
+  return count;
+}
+
+template <typename Func>
+size_t UringQueue::CancelPending(const Func &func) {
+  if (sq_poll_) {
+    return 0;
+  }
+  // Without the kernel thread, the entries are only taken in io_uring_enter called by the owner of the queue.
+  size_t count = 0;
+  for (auto head = LoadAcquire(sq_head_); head != sq_local_tail_; ++head, ++count) {
+    auto sqe = &sqes_[sq_array_[head & sq_mask_]];
+    func(sqe->user_data);
+    (void)memset(sqe, 0, sizeof(io_uring_sqe));
+    sqe->opcode = IORING_OP_NOP;
+  }
+  return count;
+}
+
+bool UringQueue::RegisterBuffers(const std::vector<iovec> &buffers) {
+  return IoUringRegister(ring_fd_, IORING_REGISTER_BUFFERS, buffers.data(), static_cast<unsigned>(buffers.size())) ==
+         0;
+}
+
+bool UringQueue::UpdateBuffer(unsigned index, const iovec &buffer) {
+  RsrcUpdate update;
+  (void)memset(&update, 0, sizeof(update));
+  update.offset = index;
+  update.data = reinterpret_cast<uint64_t>(&buffer);
+  update.nr = 1;
+  // Returns the number of slots updated. The requests in flight keep the buffer replaced until they are done.
+  return IoUringRegister(ring_fd_, kRegisterBuffersUpdate, &update, sizeof(update)) == 1;
+}
+
+IoUringPlugin &IoUringPlugin::GetInstance() {
+  static IoUringPlugin instance;
+  return instance;
+}
+
+bool IoUringPlugin::Init(const AsyncIOConf &conf) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (inited_) {
+    return true;
+  }
+  if (conf.block_size == 0 || conf.queue_depth < kMinQueueDepth || !queue_.Initialize(conf.queue_depth, true)) {
+    return false;
+  }
+  config_ = conf;
+  // The empty buffers are sparse slots since linux 5.13, the buffers are read and written without them before.
+  slots_registered_ = queue_.RegisterBuffers(std::vector<iovec>(kMaxRegisteredBufferNum, iovec{nullptr, 0}));
+  for (size_t i = kMaxRegisteredBufferNum; slots_registered_ && i > 0; --i) {
+    free_slots_.push_back(static_cast<unsigned>(i - 1));
+  }
+  inited_ = true;
+  return true;
+}
+
+int IoUringPlugin::FindBuffer(const void *data, size_t byte_num) const {
+  auto iter = buffers_.upper_bound(const_cast<void *>(data));
+  if (iter == buffers_.begin()) {
+    return -1;
+  }
+  --iter;
+  auto begin = static_cast<const uint8_t *>(data);
+  auto buffer_begin = static_cast<const uint8_t *>(iter->first);
+  if (begin + byte_num > buffer_begin + iter->second.size) {
+    return -1;
+  }
+  return iter->second.slot;
+}
+
+void IoUringPlugin::UpdateRegisteredBuffers() {
+  std::vector<std::pair<void *, size_t>> changes;
+  {
+    std::lock_guard<std::mutex> lock(buffer_changes_mutex_);
+    changes.swap(buffer_changes_);
+  }
+  if (changes.empty()) {
+    return;
+  }
+  std::vector<void *> added;
+  for (const auto &[addr, size] : changes) {
+    auto iter = buffers_.find(addr);
+    if (iter != buffers_.end()) {
+      if (iter->second.slot >= 0) {
+        stale_slots_.push_back(static_cast<unsigned>(iter->second.slot));
+      }
+      (void)buffers_.erase(iter);
+    }
+    if (size != 0) {
+      buffers_[addr] = {size, -1};
+      added.push_back(addr);
+    }
+  }
+  if (!slots_registered_) {
+    return;
+  }
+  // The slot keeps mapping the pages of the old buffer until it is cleared, it is cleared again later if failed.
+  std::vector<unsigned> stale_slots;
+  for (auto slot : stale_slots_) {
+    if (queue_.UpdateBuffer(slot, iovec{nullptr, 0})) {
+      free_slots_.push_back(slot);
+    } else {
+      stale_slots.push_back(slot);
+    }
+  }
+  stale_slots_.swap(stale_slots);
+  // Registering a buffer fails when it exceeds RLIMIT_MEMLOCK, the blocks are read and written without it then.
+  for (auto addr : added) {
+    auto iter = buffers_.find(addr);
+    if (iter == buffers_.end() || iter->second.size > kMaxRegisteredBufferSize || free_slots_.empty()) {
+      continue;
+    }
+    const auto slot = free_slots_.back();
+    if (queue_.UpdateBuffer(slot, iovec{addr, iter->second.size})) {
+      iter->second.slot = static_cast<int>(slot);
+      free_slots_.pop_back();
+    }
+  }
+}
+
+bool IoUringPlugin::RegisterBuffer(void *addr, size_t size) {
+  if (size == 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(buffer_changes_mutex_);
+  buffer_changes_.emplace_back(addr, size);
+  return true;
+}
+
+void IoUringPlugin::UnregisterBuffer(void *addr) {
+  std::lock_guard<std::mutex> lock(buffer_changes_mutex_);
+  buffer_changes_.emplace_back(addr, 0);
+}
+
+size_t IoUringPlugin::fixed_block_num() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return fixed_block_num_;
+}
+
+bool IoUringPlugin::IsFinished(const UringRequest &request) const {
+  return (request.last_submitted || request.failed) && request.inflight == 0;
+}
+
+void IoUringPlugin::CloseIfFinished(std::map<AsyncIOToken, UringRequest>::iterator iter) {
+  auto &request = iter->second;
+  if (!IsFinished(request)) {
+    return;
+  }
+  if (request.fd >= 0) {
+    (void)close(request.fd);
+    request.fd = -1;
+  }
+  if (request.detached) {
+    (void)requests_.erase(iter);
+  }
+}
+
+bool IoUringPlugin::PrepareBlock(AsyncIOToken token, UringRequest *request) {
+  if (request->last_submitted || request->failed) {
+    return false;
+  }
+  const size_t remain = request->byte_num - request->submitted;
+  const bool last = remain <= config_.block_size;
+  const size_t block_size = last ? remain : config_.block_size;
+  // The last block of a write is linked with fsync, which is submitted after the other blocks are done so that the
+  // fsync covers the whole file.
+  const bool fsync = !request->read && last;
+  if (fsync && request->inflight != 0) {
+    return false;
+  }
+  const size_t sqe_num = (block_size != 0 ? 1 : 0) + (fsync ? 1 : 0);
+  // The completions of the blocks in flight should not overflow the completion queue.
+  if (queue_.SqSpace() < sqe_num || inflight_ + sqe_num > config_.queue_depth) {
+    return false;
+  }
+  if (block_size != 0) {
+    auto sqe = queue_.GetSqe();
+    const bool fixed = request->buf_index >= 0;
+    fixed_block_num_ += fixed ? 1 : 0;
+    if (request->read) {
+      sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    } else {
+      sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    }
+    sqe->fd = request->fd;
+    sqe->addr = reinterpret_cast<uint64_t>(request->buf + request->submitted);
+    sqe->len = static_cast<uint32_t>(block_size);
+    sqe->off = request->submitted;
+    sqe->buf_index = fixed ? static_cast<uint16_t>(request->buf_index) : 0;
+    sqe->flags = fsync ? IOSQE_IO_LINK : 0;
+    sqe->user_data = EncodeUserData(token, last ? kLastBlock : kFullBlock);
+    request->submitted += block_size;
+    ++request->inflight;
+    ++inflight_;
+  }
+  if (fsync) {
+    auto sqe = queue_.GetSqe();
+    sqe->opcode = IORING_OP_FSYNC;
+    sqe->fd = request->fd;
+    sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+    sqe->user_data = EncodeUserData(token, kFsync);
+    ++request->inflight;
+    ++inflight_;
+  }
+  request->last_submitted = last;
+  return true;
+}
+
+bool IoUringPlugin::SubmitBlocks() {
+  for (auto &[token, request] : requests_) {
+    while (PrepareBlock(token, &request)) {
+    }
+  }
+  if (queue_.Submit()) {
+    return true;
+  }
+  CancelPendingBlocks();
+  return false;
+}
+
+void IoUringPlugin::CancelPendingBlocks() {
+  // The nops left in the queue are still submitted and completed later, so inflight_ counts them until then.
+  (void)queue_.CancelPending([this](uint64_t user_data) {
+    auto iter = requests_.find(static_cast<AsyncIOToken>(user_data >> kUserDataKindBits));
+    if (iter == requests_.end()) {
+      return;
+    }
+    --iter->second.inflight;
+    iter->second.failed = true;
+    CloseIfFinished(iter);
+  });
+}
+
+bool IoUringPlugin::Progress() {
+  // The completions may let the last blocks of the writes be prepared, so prepare again until nothing completes. The
+  // completions are consumed even if submitting fails, the blocks taken by kernel are done as usual.
+  bool ok;
+  size_t completed_num;
+  do {
+    ok = SubmitBlocks();
+    completed_num = queue_.ForEachCqe([this](const io_uring_cqe &cqe) { OnComplete(cqe); });
+  } while (ok && completed_num != 0);
+  return ok;
+}
+
+void IoUringPlugin::OnComplete(const io_uring_cqe &cqe) {
+  --inflight_;
+  auto iter = requests_.find(static_cast<AsyncIOToken>(cqe.user_data >> kUserDataKindBits));
+  if (iter == requests_.end()) {
+    return;
+  }
+  auto &request = iter->second;
+  --request.inflight;
+  const auto kind = cqe.user_data & kUserDataKindMask;
+  size_t expected = 0;
+  if (kind == kFullBlock) {
+    expected = config_.block_size;
+  } else if (kind == kLastBlock) {
+    expected = (request.byte_num - 1) % config_.block_size + 1;
+  }
+  if (cqe.res < 0 || static_cast<size_t>(cqe.res) != expected) {
+    request.failed = true;
+  }
+  CloseIfFinished(iter);
+}
+
+bool IoUringPlugin::Submit(bool read, const std::string &file_name, void *data, size_t byte_num,
+                           AsyncIOToken *token) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!inited_) {
+    return false;
+  }
+  const auto fd = open(file_name.c_str(), O_CREAT | O_RDWR | O_DIRECT, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  UpdateRegisteredBuffers();
+  if (++next_token_ == kInvalidAsyncIOToken) {
+    ++next_token_;
+  }
+  *token = next_token_;
+  auto &request = requests_[*token];
+  request.read = read;
+  request.fd = fd;
+  request.buf = static_cast<uint8_t *>(data);
+  request.byte_num = byte_num;
+  request.buf_index = FindBuffer(data, byte_num);
+  // Consume the completions as well unless a waiter is doing it.
+  std::unique_lock<std::mutex> completion_lock(completion_mutex_, std::try_to_lock);
+  if (!(completion_lock.owns_lock() ? Progress() : SubmitBlocks()) && request.inflight == 0) {
+    // None of the blocks is taken by kernel. Otherwise the file and the buffer are still in use, the request is kept
+    // until its blocks are done and the failure is reported by Wait.
+    if (request.fd >= 0) {
+      (void)close(request.fd);
+    }
+    (void)requests_.erase(*token);
+    return false;
+  }
+  return true;
+}
+
+bool IoUringPlugin::Wait(AsyncIOToken token) {
+  if (token == kInvalidAsyncIOToken) {
+    return true;
+  }
+  std::lock_guard<std::mutex> completion_lock(completion_mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto iter = requests_.find(token);
+  if (iter == requests_.end()) {
+    return false;
+  }
+  auto &request = iter->second;
+  while (true) {
+    // A failed submission only fails the requests whose blocks are dropped, the others are waited for as usual.
+    (void)Progress();
+    if (IsFinished(request)) {
+      break;
+    }
+    // Nothing left to complete, which does not happen unless the request is stuck.
+    if (inflight_ == 0) {
+      request.failed = true;
+      break;
+    }
+    // The other requests are submitted while waiting, their completions are consumed here in the next round.
+    lock.unlock();
+    const bool waited = queue_.WaitCqe();
+    lock.lock();
+    if (!waited) {
+      // Kernel may still access the file and the buffer of the blocks in flight.
+      request.failed = true;
+      request.detached = true;
+      CloseIfFinished(iter);
+      return false;
+    }
+  }
+  const bool ok = !request.failed;
+  if (request.fd >= 0) {
+    (void)close(request.fd);
+  }
+  (void)requests_.erase(iter);
+  // Release the pages of the buffers unregistered meanwhile.
+  UpdateRegisteredBuffers();
+  return ok;
+}
+
+bool IoUringPlugin::Read(const std::string &file_name, void *data, size_t byte_num) {
+  AsyncIOToken token = kInvalidAsyncIOToken;
+  return Submit(true, file_name, data, byte_num, &token) && Wait(token);
+}
+
+bool IoUringPlugin::Write(const std::string &file_name, const void *data, size_t byte_num) {
+  AsyncIOToken token = kInvalidAsyncIOToken;
+  return Submit(false, file_name, const_cast<void *>(data), byte_num, &token) && Wait(token);
+}
+
+bool IoUringPlugin::ReadAsync(const std::string &file_name, void *data, size_t byte_num, AsyncIOToken *token) {
+  return Submit(true, file_name, data, byte_num, token);
+}
+
+bool IoUringPlugin::WriteAsync(const std::string &file_name, const void *data, size_t byte_num,
+                               AsyncIOToken *token) {
+  return Submit(false, file_name, const_cast<void *>(data), byte_num, token);
+}
+
+AsyncIO *get_aio_instance() { return &IoUringPlugin::GetInstance(); }
+
+size_t get_io_uring_fixed_block_num() { return IoUringPlugin::GetInstance().fixed_block_num(); }
+}  // namespace device
+}  // namespace mindspore
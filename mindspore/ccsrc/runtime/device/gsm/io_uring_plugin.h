@@ -0,0 +1,172 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_IO_URING_PLUGIN_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_IO_URING_PLUGIN_H_
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "runtime/device/gsm/io_handle.h"
+
+#ifndef AIO_EXPORT
+#define AIO_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace mindspore {
+namespace device {
+// The submission queue and completion queue shared with kernel, operated by the raw io_uring syscalls.
+class UringQueue {
+ public:
+  UringQueue() = default;
+  ~UringQueue() { Finalize(); }
+  // Try to set up the queue with a kernel thread polling the submission queue, and set up the queue without it if
+  // the kernel does not support or does not allow it.
+  bool Initialize(size_t queue_depth, bool sq_poll);
+  void Finalize();
+  bool sq_poll() const { return sq_poll_; }
+  size_t SqSpace() const;
+  // Returns nullptr if the submission queue is full.
+  io_uring_sqe *GetSqe();
+  bool Submit();
+  // Block until there is a completion, the entries should be submitted before.
+  bool WaitCqe() const;
+  // Call func for each completion and consume them, returns the number of completions.
+  template <typename Func>
+  size_t ForEachCqe(const Func &func);
+  // Call func with the user data of each entry submitted but not taken by kernel yet, and turn the entry into a nop
+  // with user data 0. Nothing is cancelled with the kernel thread polling, which may be reading the entries anytime.
+  template <typename Func>
+  size_t CancelPending(const Func &func);
+  bool RegisterBuffers(const std::vector<iovec> &buffers);
+  // Replace the registered buffer at index, an empty buffer leaves the slot sparse.
+  bool UpdateBuffer(unsigned index, const iovec &buffer);
+
+ private:
+  bool Setup(size_t queue_depth, bool sq_poll);
+
+  int ring_fd_{-1};
+  bool sq_poll_{false};
+  void *sq_ring_{nullptr};
+  size_t sq_ring_size_{0};
+  void *cq_ring_{nullptr};
+  size_t cq_ring_size_{0};
+  io_uring_sqe *sqes_{nullptr};
+  size_t sqes_size_{0};
+  unsigned *sq_head_{nullptr};
+  unsigned *sq_tail_{nullptr};
+  unsigned *sq_flags_{nullptr};
+  unsigned *sq_array_{nullptr};
+  unsigned sq_mask_{0};
+  unsigned sq_entries_{0};
+  unsigned *cq_head_{nullptr};
+  unsigned *cq_tail_{nullptr};
+  io_uring_cqe *cqes_{nullptr};
+  unsigned cq_mask_{0};
+  // The tail of the submission queue which is not published to kernel yet.
+  unsigned sq_local_tail_{0};
+  unsigned to_submit_{0};
+};
+
+// A read or write of a file split into blocks of AsyncIOConf::block_size.
+struct UringRequest {
+  bool read{false};
+  int fd{-1};
+  uint8_t *buf{nullptr};
+  size_t byte_num{0};
+  size_t submitted{0};
+  size_t inflight{0};
+  // Whether the last block, and the fsync linked to it for a write, is submitted.
+  bool last_submitted{false};
+  // The slot of the registered buffer which contains the whole data, -1 if not registered.
+  int buf_index{-1};
+  bool failed{false};
+  // The waiter gave up on the request, which is erased once kernel is done with its blocks.
+  bool detached{false};
+};
+
+// A buffer registered by user and the slot of it registered to kernel, -1 if not registered to kernel.
+struct UringBuffer {
+  size_t size{0};
+  int slot{-1};
+};
+
+class AIO_EXPORT IoUringPlugin : public AsyncIO {
+ public:
+  IoUringPlugin() = default;
+  ~IoUringPlugin() override = default;
+  static IoUringPlugin &GetInstance();
+  bool Init(const AsyncIOConf &conf) override;
+  bool Read(const std::string &file_name, void *data, size_t byte_num) override;
+  bool Write(const std::string &file_name, const void *data, size_t byte_num) override;
+  bool ReadAsync(const std::string &file_name, void *data, size_t byte_num, AsyncIOToken *token) override;
+  bool WriteAsync(const std::string &file_name, const void *data, size_t byte_num, AsyncIOToken *token) override;
+  bool Wait(AsyncIOToken token) override;
+  bool RegisterBuffer(void *addr, size_t size) override;
+  void UnregisterBuffer(void *addr) override;
+  // The number of blocks read or written with the registered buffers.
+  size_t fixed_block_num();
+
+ private:
+  bool Submit(bool read, const std::string &file_name, void *data, size_t byte_num, AsyncIOToken *token);
+  // Fill the submission queue with the blocks of the requests and submit them.
+  bool SubmitBlocks();
+  // Submit the blocks and consume the completions, the caller should hold completion_mutex_.
+  bool Progress();
+  void OnComplete(const io_uring_cqe &cqe);
+  // Drop the blocks not taken by kernel and fail their requests.
+  void CancelPendingBlocks();
+  void CloseIfFinished(std::map<AsyncIOToken, UringRequest>::iterator iter);
+  bool PrepareBlock(AsyncIOToken token, UringRequest *request);
+  bool IsFinished(const UringRequest &request) const;
+  int FindBuffer(const void *data, size_t byte_num) const;
+  // Apply the buffers registered and unregistered by user to the slots registered to kernel.
+  void UpdateRegisteredBuffers();
+
+  bool inited_{false};
+  AsyncIOConf config_{};
+  UringQueue queue_;
+  // Only the holder of completion_mutex_ consumes the completions, and it waits for them without holding mutex_ so
+  // that the requests are submitted meanwhile. completion_mutex_ is locked before mutex_.
+  std::mutex completion_mutex_;
+  std::mutex mutex_;
+  AsyncIOToken next_token_{kInvalidAsyncIOToken};
+  std::map<AsyncIOToken, UringRequest> requests_;
+  size_t inflight_{0};
+  size_t fixed_block_num_{0};
+  // Kernel has a table of sparse slots for the buffers, which are updated one by one while the requests are being
+  // processed. The slots are not registered if the kernel does not support it.
+  bool slots_registered_{false};
+  std::map<void *, UringBuffer> buffers_;
+  std::vector<unsigned> free_slots_;
+  // The slots of the buffers unregistered by user, which are cleared before being used again.
+  std::vector<unsigned> stale_slots_;
+  // The buffers registered by user, with size 0 if unregistered, which are applied in the next submission. The buffers
+  // are registered in the callbacks of memory pool, so buffer_changes_mutex_ is held only to record the changes.
+  std::mutex buffer_changes_mutex_;
+  std::vector<std::pair<void *, size_t>> buffer_changes_;
+};
+
+extern "C" AIO_EXPORT AsyncIO *get_aio_instance();
+extern "C" AIO_EXPORT size_t get_io_uring_fixed_block_num();
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_IO_URING_PLUGIN_H_
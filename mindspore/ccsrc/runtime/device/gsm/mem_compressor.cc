@@ -0,0 +1,456 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "runtime/device/gsm/mem_compressor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+// Segments are compressed in parallel, chunks in a segment are compressed independently, so a match offset always
+// fits in 16 bits.
+constexpr size_t kSegmentSize = 4UL << 20;
+constexpr size_t kChunkSize = 64UL << 10;
+constexpr size_t kMaxWorkerNum = 4;
+// Keep the data uncompressed if it does not shrink to less than 7/8 of the original size.
+constexpr size_t kMinSavingRatio = 8;
+// Every chunk starts with a 4 bytes header: the highest bit marks a raw chunk, the others are the stored size.
+constexpr size_t kChunkHeaderSize = 4;
+constexpr uint32_t kRawChunkFlag = 1U << 31;
+// Parameters of the LZ4 block format.
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;
+constexpr size_t kMatchFindLimit = 12;
+constexpr size_t kHashLog = 12;
+constexpr size_t kMaxOffset = 65535;
+constexpr uint8_t kRunMask = 15;
+constexpr uint8_t kLengthExtend = 255;
+constexpr size_t kTokenShift = 4;
+constexpr size_t kSkipTrigger = 6;
+
+uint32_t Read32(const uint8_t *ptr) {
+  uint32_t value;
+  (void)memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+uint32_t Hash(uint32_t sequence) {
+  constexpr uint32_t kPrime = 2654435761U;
+  constexpr uint32_t kHashShift = 32 - kHashLog;
+  return (sequence * kPrime) >> kHashShift;
+}
+
+template <size_t kElemSize>
+void ShuffleImpl(const uint8_t *src, size_t elem_num, uint8_t *dst) {
+  for (size_t i = 0; i < elem_num; ++i) {
+    for (size_t b = 0; b < kElemSize; ++b) {
+      dst[b * elem_num + i] = src[i * kElemSize + b];
+    }
+  }
+}
+
+template <size_t kElemSize>
+void UnshuffleImpl(const uint8_t *src, size_t elem_num, uint8_t *dst) {
+  for (size_t i = 0; i < elem_num; ++i) {
+    for (size_t b = 0; b < kElemSize; ++b) {
+      dst[i * kElemSize + b] = src[b * elem_num + i];
+    }
+  }
+}
+
+// Put the n-th bytes of all the elements together, the bytes after the last whole element are copied as they are.
+void Shuffle(const uint8_t *src, size_t size, size_t elem_size, uint8_t *dst) {
+  const size_t elem_num = size / elem_size;
+  switch (elem_size) {
+    case sizeof(uint16_t):
+      ShuffleImpl<sizeof(uint16_t)>(src, elem_num, dst);
+      break;
+    case sizeof(uint32_t):
+      ShuffleImpl<sizeof(uint32_t)>(src, elem_num, dst);
+      break;
+    case sizeof(uint64_t):
+      ShuffleImpl<sizeof(uint64_t)>(src, elem_num, dst);
+      break;
+    default:
+      for (size_t i = 0; i < elem_num; ++i) {
+        for (size_t b = 0; b < elem_size; ++b) {
+          dst[b * elem_num + i] = src[i * elem_size + b];
+        }
+      }
+  }
+  const size_t tail = elem_num * elem_size;
+  (void)memcpy(dst + tail, src + tail, size - tail);
+}
+
+void Unshuffle(const uint8_t *src, size_t size, size_t elem_size, uint8_t *dst) {
+  const size_t elem_num = size / elem_size;
+  switch (elem_size) {
+    case sizeof(uint16_t):
+      UnshuffleImpl<sizeof(uint16_t)>(src, elem_num, dst);
+      break;
+    case sizeof(uint32_t):
+      UnshuffleImpl<sizeof(uint32_t)>(src, elem_num, dst);
+      break;
+    case sizeof(uint64_t):
+      UnshuffleImpl<sizeof(uint64_t)>(src, elem_num, dst);
+      break;
+    default:
+      for (size_t i = 0; i < elem_num; ++i) {
+        for (size_t b = 0; b < elem_size; ++b) {
+          dst[i * elem_size + b] = src[b * elem_num + i];
+        }
+      }
+  }
+  const size_t tail = elem_num * elem_size;
+  (void)memcpy(dst + tail, src + tail, size - tail);
+}
+
+uint8_t *WriteLength(size_t length, uint8_t *op) {
+  while (length >= kLengthExtend) {
+    *op++ = kLengthExtend;
+    length -= kLengthExtend;
+  }
+  *op++ = static_cast<uint8_t>(length);
+  return op;
+}
+
+// Write a sequence of literals and a match, returns nullptr if it exceeds the end of the output.
+uint8_t *WriteSequence(const uint8_t *literal, size_t literal_len, size_t offset, size_t match_len, uint8_t *op,
+                       const uint8_t *op_end) {
+  // Token, literal length, literals, offset and match length.
+  const size_t max_len = 1 + literal_len / kLengthExtend + 1 + literal_len + 2 + match_len / kLengthExtend + 1;
+  if (max_len > static_cast<size_t>(op_end - op)) {
+    return nullptr;
+  }
+  uint8_t *token = op++;
+  *token = static_cast<uint8_t>(std::min<size_t>(literal_len, kRunMask) << kTokenShift);
+  if (literal_len >= kRunMask) {
+    op = WriteLength(literal_len - kRunMask, op);
+  }
+  (void)memcpy(op, literal, literal_len);
+  op += literal_len;
+  if (match_len == 0 && offset == 0) {
+    return op;
+  }
+  *op++ = static_cast<uint8_t>(offset & 0xFF);
+  *op++ = static_cast<uint8_t>(offset >> 8);
+  *token |= static_cast<uint8_t>(std::min<size_t>(match_len, kRunMask));
+  if (match_len >= kRunMask) {
+    op = WriteLength(match_len - kRunMask, op);
+  }
+  return op;
+}
+
+// Compress a chunk, returns the compressed size, or 0 if it does not fit in the capacity.
+size_t Lz4Compress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity) {
+  uint16_t table[1 << kHashLog] = {0};
+  const uint8_t *ip = src;
+  const uint8_t *anchor = src;
+  const uint8_t *src_end = src + size;
+  uint8_t *op = dst;
+  const uint8_t *op_end = dst + capacity;
+  if (size >= kMatchFindLimit) {
+    const uint8_t *match_limit = src_end - kLastLiterals;
+    const uint8_t *ip_limit = src_end - kMatchFindLimit;
+    size_t search = 1 << kSkipTrigger;
+    while (ip <= ip_limit) {
+      const uint32_t sequence = Read32(ip);
+      const uint32_t hash = Hash(sequence);
+      const uint8_t *ref = src + table[hash];
+      table[hash] = static_cast<uint16_t>(ip - src);
+      if (ref >= ip || static_cast<size_t>(ip - ref) > kMaxOffset || Read32(ref) != sequence) {
+        // Step faster over the data without matches.
+        ip += search++ >> kSkipTrigger;
+        continue;
+      }
+      search = 1 << kSkipTrigger;
+      const uint8_t *match_end = ip + kMinMatch;
+      const uint8_t *ref_end = ref + kMinMatch;
+      while (match_end < match_limit && *match_end == *ref_end) {
+        ++match_end;
+        ++ref_end;
+      }
+      op = WriteSequence(anchor, ip - anchor, ip - ref, match_end - ip - kMinMatch, op, op_end);
+      if (op == nullptr) {
+        return 0;
+      }
+      ip = match_end;
+      anchor = ip;
+    }
+  }
+  op = WriteSequence(anchor, src_end - anchor, 0, 0, op, op_end);
+  return op == nullptr ? 0 : op - dst;
+}
+
+bool ReadLength(const uint8_t **ip, const uint8_t *ip_end, size_t *length) {
+  uint8_t value;
+  do {
+    if (*ip >= ip_end) {
+      return false;
+    }
+    value = *(*ip)++;
+    *length += value;
+  } while (value == kLengthExtend);
+  return true;
+}
+
+bool Lz4Decompress(const uint8_t *src, size_t src_size, uint8_t *dst, size_t size) {
+  const uint8_t *ip = src;
+  const uint8_t *ip_end = src + src_size;
+  uint8_t *op = dst;
+  const uint8_t *op_end = dst + size;
+  while (ip < ip_end) {
+    const uint8_t token = *ip++;
+    size_t literal_len = token >> kTokenShift;
+    if (literal_len == kRunMask && !ReadLength(&ip, ip_end, &literal_len)) {
+      return false;
+    }
+    if (literal_len > static_cast<size_t>(ip_end - ip) || literal_len > static_cast<size_t>(op_end - op)) {
+      return false;
+    }
+    (void)memcpy(op, ip, literal_len);
+    ip += literal_len;
+    op += literal_len;
+    // The last sequence has only literals.
+    if (ip == ip_end) {
+      break;
+    }
+    if (ip_end - ip < 2) {
+      return false;
+    }
+    const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+    ip += 2;
+    size_t match_len = token & kRunMask;
+    if (match_len == kRunMask && !ReadLength(&ip, ip_end, &match_len)) {
+      return false;
+    }
+    match_len += kMinMatch;
+    if (offset == 0 || offset > static_cast<size_t>(op - dst) || match_len > static_cast<size_t>(op_end - op)) {
+      return false;
+    }
+    const uint8_t *ref = op - offset;
+    if (offset >= match_len) {
+      (void)memcpy(op, ref, match_len);
+    } else {
+      // The match overlaps the output and repeats the last offset bytes, copy the repeated bytes which are already
+      // written, whose length doubles every time.
+      size_t copied = 0;
+      while (copied < match_len) {
+        const size_t copy_len = std::min(copied + offset, match_len - copied);
+        (void)memcpy(op + copied, ref, copy_len);
+        copied += copy_len;
+      }
+    }
+    op += match_len;
+  }
+  return op == op_end;
+}
+}  // namespace
+
+size_t CompressedData::CompressedSize() const {
+  size_t compressed_size = 0;
+  for (const auto &segment : segments_) {
+    compressed_size += segment.size();
+  }
+  return compressed_size;
+}
+
+MemCompressor &MemCompressor::GetInstance() {
+  static MemCompressor instance;
+  return instance;
+}
+
+MemCompressor::MemCompressor() {
+  // Leave most of the cores to the kernels and the swap io.
+  const size_t worker_num =
+    std::max<size_t>(1, std::min<size_t>(kMaxWorkerNum, std::thread::hardware_concurrency() / kMaxWorkerNum));
+  for (size_t i = 0; i < worker_num; ++i) {
+    (void)workers_.emplace_back(&MemCompressor::WorkerLoop, this);
+  }
+}
+
+MemCompressor::~MemCompressor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void MemCompressor::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+std::shared_future<bool> MemCompressor::Dispatch(size_t task_num, const std::function<bool(size_t)> &task,
+                                                 const std::function<bool()> &finish) {
+  struct DispatchState {
+    std::atomic<size_t> remaining{0};
+    std::atomic<bool> success{true};
+    std::promise<bool> promise;
+  };
+  auto state = std::make_shared<DispatchState>();
+  auto future = state->promise.get_future().share();
+  if (task_num == 0) {
+    state->promise.set_value(finish());
+    return future;
+  }
+  state->remaining = task_num;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < task_num; ++i) {
+      tasks_.emplace([state, task, finish, i]() {
+        if (!task(i)) {
+          state->success = false;
+        }
+        if (--state->remaining == 0) {
+          state->promise.set_value(state->success && finish());
+        }
+      });
+    }
+  }
+  cv_.notify_all();
+  return future;
+}
+
+std::shared_future<bool> MemCompressor::CompressAsync(const void *src, size_t size, size_t elem_size,
+                                                      const CompressedDataPtr &dst) {
+  MS_EXCEPTION_IF_NULL(src);
+  MS_EXCEPTION_IF_NULL(dst);
+  dst->size_ = size;
+  dst->elem_size_ = elem_size == 0 ? 1 : elem_size;
+  dst->segments_.clear();
+  dst->segments_.resize((size + kSegmentSize - 1) / kSegmentSize);
+  const auto src_data = static_cast<const uint8_t *>(src);
+  // Hold the compressed data until all the segments are compressed.
+  return Dispatch(
+    dst->segments_.size(),
+    [src_data, dst](size_t i) {
+      const size_t offset = i * kSegmentSize;
+      CompressSegment(src_data + offset, std::min(kSegmentSize, dst->size_ - offset), dst->elem_size_,
+                      &dst->segments_[i]);
+      return true;
+    },
+    [dst]() {
+      const size_t compressed_size = dst->CompressedSize();
+      MS_LOG(DEBUG) << "Compress " << dst->size_ << " bytes to " << compressed_size << " bytes.";
+      return compressed_size < dst->size_ - dst->size_ / kMinSavingRatio;
+    });
+}
+
+std::shared_future<bool> MemCompressor::DecompressAsync(const CompressedDataPtr &src, void *dst) {
+  MS_EXCEPTION_IF_NULL(src);
+  MS_EXCEPTION_IF_NULL(dst);
+  const auto dst_data = static_cast<uint8_t *>(dst);
+  // Hold the compressed data until all the segments are decompressed.
+  return Dispatch(
+    src->segments_.size(),
+    [src, dst_data](size_t i) {
+      const size_t offset = i * kSegmentSize;
+      return DecompressSegment(src->segments_[i], src->elem_size_, dst_data + offset,
+                               std::min(kSegmentSize, src->size_ - offset));
+    },
+    []() { return true; });
+}
+
+void MemCompressor::CompressSegment(const uint8_t *src, size_t size, size_t elem_size, std::vector<uint8_t> *dst) {
+  MS_EXCEPTION_IF_NULL(src);
+  MS_EXCEPTION_IF_NULL(dst);
+  const size_t chunk_num = (size + kChunkSize - 1) / kChunkSize;
+  dst->resize(size + chunk_num * kChunkHeaderSize);
+  std::vector<uint8_t> shuffled(elem_size > 1 ? std::min(size, kChunkSize) : 0);
+  size_t pos = 0;
+  for (size_t offset = 0; offset < size; offset += kChunkSize) {
+    const size_t chunk_size = std::min(kChunkSize, size - offset);
+    const uint8_t *chunk = src + offset;
+    if (elem_size > 1) {
+      Shuffle(chunk, chunk_size, elem_size, shuffled.data());
+      chunk = shuffled.data();
+    }
+    uint8_t *header = dst->data() + pos;
+    pos += kChunkHeaderSize;
+    // Store the chunk raw if it does not shrink.
+    uint32_t stored_size = static_cast<uint32_t>(Lz4Compress(chunk, chunk_size, dst->data() + pos, chunk_size - 1));
+    uint32_t header_value = stored_size;
+    if (stored_size == 0) {
+      (void)memcpy(dst->data() + pos, chunk, chunk_size);
+      stored_size = static_cast<uint32_t>(chunk_size);
+      header_value = stored_size | kRawChunkFlag;
+    }
+    (void)memcpy(header, &header_value, kChunkHeaderSize);
+    pos += stored_size;
+  }
+  dst->resize(pos);
+  dst->shrink_to_fit();
+}
+
+bool MemCompressor::DecompressSegment(const std::vector<uint8_t> &src, size_t elem_size, uint8_t *dst, size_t size) {
+  MS_EXCEPTION_IF_NULL(dst);
+  std::vector<uint8_t> shuffled(elem_size > 1 ? std::min(size, kChunkSize) : 0);
+  size_t pos = 0;
+  for (size_t offset = 0; offset < size; offset += kChunkSize) {
+    const size_t chunk_size = std::min(kChunkSize, size - offset);
+    if (src.size() - pos < kChunkHeaderSize) {
+      MS_LOG(WARNING) << "The compressed data is truncated.";
+      return false;
+    }
+    uint32_t header_value;
+    (void)memcpy(&header_value, src.data() + pos, kChunkHeaderSize);
+    pos += kChunkHeaderSize;
+    const size_t stored_size = header_value & ~kRawChunkFlag;
+    if (src.size() - pos < stored_size) {
+      MS_LOG(WARNING) << "The compressed data is truncated.";
+      return false;
+    }
+    uint8_t *chunk = elem_size > 1 ? shuffled.data() : dst + offset;
+    if ((header_value & kRawChunkFlag) != 0) {
+      if (stored_size != chunk_size) {
+        MS_LOG(WARNING) << "The size of raw chunk " << stored_size << " is not " << chunk_size;
+        return false;
+      }
+      (void)memcpy(chunk, src.data() + pos, chunk_size);
+    } else if (!Lz4Decompress(src.data() + pos, stored_size, chunk, chunk_size)) {
+      MS_LOG(WARNING) << "The compressed data is corrupted.";
+      return false;
+    }
+    pos += stored_size;
+    if (elem_size > 1) {
+      Unshuffle(chunk, chunk_size, elem_size, dst + offset);
+    }
+  }
+  return pos == src.size();
+}
+}  // namespace device
+}  // namespace mindspore
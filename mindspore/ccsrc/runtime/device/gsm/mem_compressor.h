@@ -0,0 +1,75 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_MEM_COMPRESSOR_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_MEM_COMPRESSOR_H_
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+// The compressed data of a tensor in host memory. The data is split into segments which are compressed and
+// decompressed in parallel.
+struct CompressedData {
+  size_t CompressedSize() const;
+  size_t size_{0};
+  size_t elem_size_{1};
+  std::vector<std::vector<uint8_t>> segments_;
+};
+using CompressedDataPtr = std::shared_ptr<CompressedData>;
+
+// MemCompressor compresses the cold tensors swapped out to host memory on background threads, so they take less host
+// memory. The bytes of each element are shuffled before compressing, which groups the sign and exponent bytes of
+// float data together, then the data is compressed by a LZ4 block style codec.
+class BACKEND_EXPORT MemCompressor {
+ public:
+  static MemCompressor &GetInstance();
+  ~MemCompressor();
+
+  // Compress the data on background threads, src must be alive until the returned future is ready. The future is false
+  // if the data does not shrink enough to be worth decompressing later.
+  std::shared_future<bool> CompressAsync(const void *src, size_t size, size_t elem_size, const CompressedDataPtr &dst);
+  // Decompress the data to dst on background threads, the future is false if the data is corrupted.
+  std::shared_future<bool> DecompressAsync(const CompressedDataPtr &src, void *dst);
+
+  // Compress and decompress a segment on the current thread.
+  static void CompressSegment(const uint8_t *src, size_t size, size_t elem_size, std::vector<uint8_t> *dst);
+  static bool DecompressSegment(const std::vector<uint8_t> &src, size_t elem_size, uint8_t *dst, size_t size);
+
+ private:
+  MemCompressor();
+  // Run task(0) ... task(task_num - 1) on the workers, the future is the result of finish if all the tasks succeed.
+  std::shared_future<bool> Dispatch(size_t task_num, const std::function<bool(size_t)> &task,
+                                    const std::function<bool()> &finish);
+  void WorkerLoop();
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::queue<std::function<void()>> tasks_;
+  std::vector<std::thread> workers_;
+  bool stop_{false};
+};
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_MEM_COMPRESSOR_H_
@@ -83,6 +83,13 @@ size_t PinMemPool::AllocDeviceMem(size_t alloc_size, DeviceMemPtr *addr) {
     return 0;
   }
   total_used_memory_ += alloc_size;
+  {
+    std::lock_guard<std::mutex> lock(mem_block_mutex_);
+    mem_blocks_[*addr] = alloc_size;
+    for (const auto &[id, callback] : mem_block_callbacks_) {
+      callback.first(*addr, alloc_size);
+    }
+  }
   MS_LOG(INFO) << "Current PinMemPool alloc size[" << alloc_size << "], total used size[" << total_used_memory_
                << "], available host mem size [" << max_size_ - total_used_memory_ << "].";
   return alloc_size;
@@ -116,5 +123,40 @@ void PinMemPool::SetMemPoolBlockSize(size_t available_pin_mem_size) {
 }
 
 size_t PinMemPool::free_mem_size() { return max_size_ - total_used_memory_; }
+
+size_t PinMemPool::AddMemBlockCallback(const MemBlockAllocCallback &alloc_callback,
+                                       const MemBlockFreeCallback &free_callback) {
+  MS_EXCEPTION_IF_NULL(alloc_callback);
+  MS_EXCEPTION_IF_NULL(free_callback);
+  std::lock_guard<std::mutex> lock(mem_block_mutex_);
+  for (const auto &[addr, size] : mem_blocks_) {
+    alloc_callback(addr, size);
+  }
+  const size_t callback_id = next_callback_id_++;
+  mem_block_callbacks_[callback_id] = std::make_pair(alloc_callback, free_callback);
+  return callback_id;
+}
+
+void PinMemPool::RemoveMemBlockCallback(size_t callback_id) {
+  std::lock_guard<std::mutex> lock(mem_block_mutex_);
+  auto iter = mem_block_callbacks_.find(callback_id);
+  if (iter == mem_block_callbacks_.end()) {
+    return;
+  }
+  for (const auto &[addr, size] : mem_blocks_) {
+    iter->second.second(addr);
+  }
+  (void)mem_block_callbacks_.erase(iter);
+}
+
+void PinMemPool::OnMemBlockFree(void *addr) {
+  std::lock_guard<std::mutex> lock(mem_block_mutex_);
+  if (mem_blocks_.erase(addr) == 0) {
+    return;
+  }
+  for (const auto &[id, callback] : mem_block_callbacks_) {
+    callback.second(addr);
+  }
+}
 }  // namespace device
 }  // namespace mindspore
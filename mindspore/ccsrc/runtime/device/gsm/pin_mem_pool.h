@@ -16,8 +16,12 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_PIN_MEM_POOL_H_
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_PIN_MEM_POOL_H_
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 #include "include/backend/visible.h"
 #include "include/backend/mem_reuse/mem_dynamic_allocator.h"
 #include "ir/tensor.h"
@@ -38,17 +42,31 @@ class BACKEND_EXPORT PinMemPool : public DynamicMemPoolBestFit, public PinnedMem
     MS_LOG(INFO) << "Default unregister pinned mem addr = " << addr << ".";
   };
 
+  using MemBlockAllocCallback = std::function<void(void *addr, size_t size)>;
+  using MemBlockFreeCallback = std::function<void(void *addr)>;
+  // The callbacks are called when the pool allocates a memory block and before it frees a memory block, such as
+  // registering the blocks to the swap io. The blocks allocated already are passed to alloc_callback at once.
+  // Returns the id to remove the callbacks, which passes the blocks allocated to free_callback at once.
+  size_t AddMemBlockCallback(const MemBlockAllocCallback &alloc_callback, const MemBlockFreeCallback &free_callback);
+  void RemoveMemBlockCallback(size_t callback_id);
+
  protected:
   PinMemPool();
   void Init();
   size_t free_mem_size() override;
   size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override;
   void SetMemPoolBlockSize(size_t available_pin_mem_size) override;
+  // Called by FreeDeviceMem of the derived pools before the memory block is freed.
+  void OnMemBlockFree(void *addr);
   size_t max_size_{0};
   size_t total_used_memory_{0};
   bool pinned_mem_{false};
   bool inited_{false};
   std::mutex mutex_;
+  std::mutex mem_block_mutex_;
+  std::map<void *, size_t> mem_blocks_;
+  std::map<size_t, std::pair<MemBlockAllocCallback, MemBlockFreeCallback>> mem_block_callbacks_;
+  size_t next_callback_id_{0};
 };
 }  // namespace device
 }  // namespace mindspore
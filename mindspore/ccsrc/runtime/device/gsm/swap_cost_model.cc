@@ -0,0 +1,316 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "runtime/device/gsm/swap_cost_model.h"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include "nlohmann/json.hpp"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+constexpr char kGraphHashKey[] = "graph_hash";
+constexpr char kKernelCostsKey[] = "kernel_costs";
+constexpr char kBandwidthsKey[] = "bandwidths";
+// Bytes per microsecond used before the bandwidth of an action type is measured.
+constexpr double kDefaultDDRBandwidth = 10000.0;
+constexpr double kDefaultDiskBandwidth = 2000.0;
+constexpr double kDefaultCompressBandwidth = 2000.0;
+// Weight of the latest step when updating the measured costs.
+constexpr double kLatestCostFactor = 0.3;
+constexpr size_t kSaveProfileInterval = 10;
+
+double DefaultBandwidth(SwapActionType action_type) {
+  switch (action_type) {
+    case SwapActionType::kHBM2DDR:
+    case SwapActionType::kDDR2HBM:
+      return kDefaultDDRBandwidth;
+    case SwapActionType::kDDRCompress:
+    case SwapActionType::kDDRDecompress:
+      return kDefaultCompressBandwidth;
+    default:
+      return kDefaultDiskBandwidth;
+  }
+}
+
+double UpdateCost(double old_cost, double new_cost, bool measured) {
+  return measured ? old_cost * (1 - kLatestCostFactor) + new_cost * kLatestCostFactor : new_cost;
+}
+}  // namespace
+
+SwapCostModel::SwapCostModel(const SwapCostProfile &profile)
+    : kernel_costs_(profile.kernel_costs_),
+      prefix_costs_(profile.kernel_costs_.size() + 1, 0),
+      bandwidths_(profile.bandwidths_),
+      link_busy_(profile.kernel_costs_.size(), 0) {
+  for (size_t i = 0; i < kernel_costs_.size(); ++i) {
+    kernel_costs_[i] = std::max(kernel_costs_[i], 0.0);
+    prefix_costs_[i + 1] = prefix_costs_[i] + kernel_costs_[i];
+  }
+}
+
+double SwapCostModel::KernelTime(size_t begin, size_t end) const {
+  const size_t kernel_num = kernel_costs_.size();
+  if (begin >= end || kernel_num == 0) {
+    return 0;
+  }
+  const auto time_before = [this, kernel_num](size_t index) {
+    return static_cast<double>(index / kernel_num) * prefix_costs_[kernel_num] + prefix_costs_[index % kernel_num];
+  };
+  return time_before(end) - time_before(begin);
+}
+
+double SwapCostModel::TransferTime(SwapActionType action_type, size_t size) const {
+  const auto iter = bandwidths_.find(action_type);
+  const double bandwidth =
+    (iter != bandwidths_.end() && iter->second > 0) ? iter->second : DefaultBandwidth(action_type);
+  return static_cast<double>(size) / bandwidth;
+}
+
+size_t SwapCostModel::OffloadWeight(size_t size, size_t last_index, size_t current_index) const {
+  const double idle_time = KernelTime(last_index + 1, current_index);
+  const double exposed_time =
+    OffloadTime(SwapActionType::kHBM2DDR, SwapActionType::kDDR2HBM, size, last_index, current_index, true);
+  const double weight = static_cast<double>(size) * idle_time / (exposed_time + 1);
+  if (weight >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(weight);
+}
+
+double SwapCostModel::OffloadTime(SwapActionType store_type, SwapActionType load_type, size_t size, size_t last_index,
+                                 size_t current_index, bool need_load) const {
+  const double store_time = TransferTime(store_type, size);
+  if (!need_load) {
+    return store_time;
+  }
+  // The load may overlap with the kernels after the one running the store.
+  const double load_time = TransferTime(load_type, size);
+  return store_time + std::max(0.0, load_time - KernelTime(last_index + 2, current_index));
+}
+
+size_t SwapCostModel::PlanLoad(size_t begin, size_t end, double transfer_time) const {
+  const size_t kernel_num = kernel_costs_.size();
+  if (begin >= end || kernel_num == 0) {
+    return end;
+  }
+  double idle_time = 0;
+  for (size_t start = end; start > begin; --start) {
+    const size_t index = (start - 1) % kernel_num;
+    idle_time += std::max(0.0, kernel_costs_[index] - link_busy_[index]);
+    if (idle_time >= transfer_time) {
+      return start - 1;
+    }
+  }
+  return begin;
+}
+
+double SwapCostModel::ReserveLoad(size_t start, size_t end, double transfer_time) {
+  const size_t kernel_num = kernel_costs_.size();
+  for (size_t i = start; i < end && kernel_num != 0 && transfer_time > 0; ++i) {
+    const size_t index = i % kernel_num;
+    const double used_time = std::min(std::max(0.0, kernel_costs_[index] - link_busy_[index]), transfer_time);
+    link_busy_[index] += used_time;
+    transfer_time -= used_time;
+  }
+  return transfer_time;
+}
+
+std::shared_ptr<SwapCostProfile> LoadSwapCostProfile(const std::string &file_name, const std::string &graph_hash) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    return nullptr;
+  }
+  try {
+    nlohmann::json profile_json;
+    file >> profile_json;
+    auto profile = std::make_shared<SwapCostProfile>();
+    profile->graph_hash_ = profile_json.at(kGraphHashKey).get<std::string>();
+    if (profile->graph_hash_ != graph_hash) {
+      MS_LOG(WARNING) << "The swap cost profile " << file_name << " is measured on the graph of hash "
+                      << profile->graph_hash_ << ", but the graph hash is " << graph_hash << ", ignore it.";
+      return nullptr;
+    }
+    profile->kernel_costs_ = profile_json.at(kKernelCostsKey).get<std::vector<double>>();
+    for (const auto &item : profile_json.at(kBandwidthsKey).items()) {
+      profile->bandwidths_[static_cast<SwapActionType>(std::stoi(item.key()))] = item.value().get<double>();
+    }
+    return profile;
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Parse swap cost profile " << file_name << " failed: " << e.what();
+    return nullptr;
+  }
+}
+
+bool SaveSwapCostProfile(const SwapCostProfile &profile, const std::string &file_name) {
+  nlohmann::json profile_json;
+  profile_json[kGraphHashKey] = profile.graph_hash_;
+  profile_json[kKernelCostsKey] = profile.kernel_costs_;
+  nlohmann::json bandwidths_json = nlohmann::json::object();
+  for (const auto &bandwidth : profile.bandwidths_) {
+    bandwidths_json[std::to_string(static_cast<int>(bandwidth.first))] = bandwidth.second;
+  }
+  profile_json[kBandwidthsKey] = bandwidths_json;
+  std::ofstream file(file_name, std::ios::out | std::ios::trunc);
+  if (!file.is_open()) {
+    MS_LOG(WARNING) << "Open file " << file_name << " for saving swap cost profile failed.";
+    return false;
+  }
+  file << profile_json.dump();
+  file.close();
+  return true;
+}
+
+SwapCostRecorder::SwapCostRecorder(size_t graph_id, std::string graph_hash, size_t kernel_num, size_t action_num,
+                                   double predicted_stall, std::string profile_file)
+    : graph_id_(graph_id),
+      action_num_(action_num),
+      predicted_stall_(predicted_stall),
+      profile_file_(std::move(profile_file)),
+      measured_(kernel_num, false) {
+  profile_.graph_hash_ = std::move(graph_hash);
+  profile_.kernel_costs_.resize(kernel_num, 0);
+}
+
+SwapCostRecorder::~SwapCostRecorder() {
+  if (step_ != 0 && !profile_file_.empty()) {
+    (void)SaveSwapCostProfile(profile_, profile_file_);
+  }
+}
+
+void SwapCostRecorder::Record(SwapActionRecord &&record) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.emplace_back(std::move(record));
+  if (records_.size() < action_num_) {
+    return;
+  }
+  FinishStep();
+  records_.clear();
+}
+
+void SwapCostRecorder::FinishStep() {
+  ++step_;
+  UpdateKernelCosts();
+  const double actual_stall = ActualStall();
+  UpdateBandwidths();
+  MS_LOG(INFO) << "Memory swap of graph " << graph_id_ << " step " << step_ << ", predicted stall: " << predicted_stall_
+               << "us, actual stall: " << actual_stall << "us.";
+  if (step_ % kSaveProfileInterval == 0 && !profile_file_.empty()) {
+    (void)SaveSwapCostProfile(profile_, profile_file_);
+  }
+}
+
+void SwapCostRecorder::UpdateKernelCosts() {
+  const size_t kernel_num = profile_.kernel_costs_.size();
+  std::vector<const SwapActionRecord *> blocking_records;
+  for (const auto &record : records_) {
+    if (record.to_ == record.from_ + 1) {
+      (void)blocking_records.emplace_back(&record);
+    }
+  }
+  std::sort(blocking_records.begin(), blocking_records.end(),
+            [](const SwapActionRecord *left, const SwapActionRecord *right) { return left->from_ < right->from_; });
+  double measured_time = 0;
+  size_t measured_num = 0;
+  for (size_t i = 1; i < blocking_records.size(); ++i) {
+    // Node i + 1 of the strategy is kernel i, so the kernels between the actions are [from of the first one, from of
+    // the second one).
+    const size_t begin = blocking_records[i - 1]->from_;
+    const size_t end = std::min(blocking_records[i]->from_, kernel_num);
+    if (begin >= end) {
+      continue;
+    }
+    const double segment_time = std::max(0.0, blocking_records[i]->start_ - blocking_records[i - 1]->end_);
+    // Split the time of the segment by the former costs of the kernels if they have been measured.
+    double former_time = 0;
+    bool all_measured = true;
+    for (size_t kernel = begin; kernel < end; ++kernel) {
+      former_time += profile_.kernel_costs_[kernel];
+      all_measured = all_measured && measured_[kernel];
+    }
+    for (size_t kernel = begin; kernel < end; ++kernel) {
+      const double ratio = (all_measured && former_time > 0) ? profile_.kernel_costs_[kernel] / former_time
+                                                             : 1.0 / static_cast<double>(end - begin);
+      profile_.kernel_costs_[kernel] = UpdateCost(profile_.kernel_costs_[kernel], segment_time * ratio,
+                                                  measured_[kernel]);
+      measured_[kernel] = true;
+    }
+    measured_time += segment_time;
+    measured_num += end - begin;
+  }
+  if (measured_num == 0) {
+    return;
+  }
+  // The kernels before the first action and after the last action are not measured, take the average ones.
+  const double average_time = measured_time / static_cast<double>(measured_num);
+  for (size_t kernel = 0; kernel < kernel_num; ++kernel) {
+    if (!measured_[kernel]) {
+      profile_.kernel_costs_[kernel] = average_time;
+    }
+  }
+}
+
+double SwapCostRecorder::ActualStall() const {
+  const size_t kernel_num = profile_.kernel_costs_.size();
+  double stall = 0;
+  for (const auto &record : records_) {
+    const double run_time = std::max(0.0, record.end_ - record.start_);
+    if (record.to_ == record.from_ + 1) {
+      stall += run_time;
+      continue;
+    }
+    // The load runs after node from and before node to, which are kernel from - 1 and kernel to - 1.
+    double window_time = 0;
+    for (size_t kernel = record.from_; kernel + 1 < record.to_ && kernel < kernel_num; ++kernel) {
+      window_time += profile_.kernel_costs_[kernel];
+    }
+    stall += std::max(0.0, run_time - window_time);
+  }
+  return stall;
+}
+
+void SwapCostRecorder::UpdateBandwidths() {
+  std::map<SwapActionType, std::pair<double, double>> moved_bytes_and_time;
+  for (const auto &record : records_) {
+    if (record.moved_sizes_.empty() || record.end_ <= record.start_) {
+      continue;
+    }
+    const auto action_type = record.moved_sizes_.front().first;
+    const bool single_type =
+      std::all_of(record.moved_sizes_.begin(), record.moved_sizes_.end(),
+                  [action_type](const std::pair<SwapActionType, size_t> &item) { return item.first == action_type; });
+    if (!single_type) {
+      continue;
+    }
+    auto &bytes_and_time = moved_bytes_and_time[action_type];
+    for (const auto &item : record.moved_sizes_) {
+      bytes_and_time.first += static_cast<double>(item.second);
+    }
+    bytes_and_time.second += record.end_ - record.start_;
+  }
+  for (const auto &item : moved_bytes_and_time) {
+    if (item.second.first <= 0) {
+      continue;
+    }
+    const double bandwidth = item.second.first / item.second.second;
+    const auto iter = profile_.bandwidths_.find(item.first);
+    const bool measured = iter != profile_.bandwidths_.end();
+    profile_.bandwidths_[item.first] = UpdateCost(measured ? iter->second : 0, bandwidth, measured);
+  }
+}
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_SWAP_COST_MODEL_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_SWAP_COST_MODEL_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "runtime/device/gsm/swap_strategy.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+// SwapCostModel predicts the time of moving tensors and of the kernels overlapping with them. Stores run between two
+// kernels, so their time is always exposed. Loads can start some kernels ahead of the kernel using the tensor, and
+// share the link to device memory with each other, their time is exposed if the link is not idle enough in the kernels.
+// Kernel index not less than the kernel num belongs to the next step.
+class BACKEND_EXPORT SwapCostModel {
+ public:
+  explicit SwapCostModel(const SwapCostProfile &profile);
+  ~SwapCostModel() = default;
+
+  size_t kernel_num() const { return kernel_costs_.size(); }
+  // Time of the kernels in [begin, end).
+  double KernelTime(size_t begin, size_t end) const;
+  double TransferTime(SwapActionType action_type, size_t size) const;
+  // The memory time freed by offloading a tensor idle in (last_index, current_index) per exposed time.
+  size_t OffloadWeight(size_t size, size_t last_index, size_t current_index) const;
+  // The exposed time of storing a tensor idle in (last_index, current_index) by store_type and loading it back by
+  // load_type if need_load.
+  double OffloadTime(SwapActionType store_type, SwapActionType load_type, size_t size, size_t last_index,
+                     size_t current_index, bool need_load) const;
+  // The latest kernel in [begin, end) before which the load should start to finish before kernel end, by the idle time
+  // of the link. Returns begin if the load can not be hidden entirely.
+  size_t PlanLoad(size_t begin, size_t end, double transfer_time) const;
+  // Occupy the link in the kernels [start, end) for the load, returns the exposed time.
+  double ReserveLoad(size_t start, size_t end, double transfer_time);
+
+ private:
+  std::vector<double> kernel_costs_;
+  // Sum of the kernel costs before each kernel, the last one is the time of a step.
+  std::vector<double> prefix_costs_;
+  std::map<SwapActionType, double> bandwidths_;
+  // The time of each kernel in which the link is occupied by the loads.
+  std::vector<double> link_busy_;
+};
+
+// Read and write the profile of costs in json, LoadSwapCostProfile returns nullptr if the file does not exist or the
+// profile is measured on a graph of another hash.
+BACKEND_EXPORT std::shared_ptr<SwapCostProfile> LoadSwapCostProfile(const std::string &file_name,
+                                                                     const std::string &graph_hash);
+BACKEND_EXPORT bool SaveSwapCostProfile(const SwapCostProfile &profile, const std::string &file_name);
+
+struct SwapActionRecord {
+  // The action runs after node from_ and before node to_ of the strategy.
+  size_t from_{0};
+  size_t to_{0};
+  double start_{0};
+  double end_{0};
+  // The size of tensors moved by each type of actions.
+  std::vector<std::pair<SwapActionType, size_t>> moved_sizes_;
+};
+
+// SwapCostRecorder collects the time measured by the swap actors of a graph. Once all the actors run in a step, it
+// reports the predicted and actual stall time of the step, and updates the profile which the strategy is built from
+// next time:
+// - The time between two actions which block the next kernel is the time of the kernels between them.
+// - An action which blocks the next kernel stalls for all of its time, a load ahead of its kernel stalls for the time
+//   beyond the kernels between them.
+// - The bandwidth of an action type comes from the actions which only move tensors by this type.
+class BACKEND_EXPORT SwapCostRecorder {
+ public:
+  SwapCostRecorder(size_t graph_id, std::string graph_hash, size_t kernel_num, size_t action_num,
+                   double predicted_stall, std::string profile_file);
+  ~SwapCostRecorder();
+  void Record(SwapActionRecord &&record);
+
+ private:
+  void FinishStep();
+  void UpdateKernelCosts();
+  double ActualStall() const;
+  void UpdateBandwidths();
+
+  std::mutex mutex_;
+  size_t graph_id_;
+  size_t action_num_;
+  double predicted_stall_;
+  std::string profile_file_;
+  size_t step_{0};
+  std::vector<SwapActionRecord> records_;
+  SwapCostProfile profile_;
+  // Whether the cost of each kernel has been measured.
+  std::vector<bool> measured_;
+};
+using SwapCostRecorderPtr = std::shared_ptr<SwapCostRecorder>;
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_SWAP_COST_MODEL_H_
@@ -28,6 +28,8 @@ namespace mindspore {
 namespace device {
 constexpr char kLinuxAioLibName[] = "libaio_plugin.so";
 constexpr char kLinuxAioInstanceFuncName[] = "get_aio_instance";
+constexpr char kIoUringLibName[] = "libio_uring_plugin.so";
+constexpr char kIoUringBackend[] = "io_uring";
 constexpr size_t kFirstSizeLevel = 0xFFFFFFFFFFFFFFFF << 24;  // 16M
 constexpr size_t kSizeLevelNum = 8;
 constexpr size_t kSwapMemAlignSize = 512;
@@ -149,7 +151,18 @@ SwapManager::SwapManager(size_t stream_id, mindspore::device::DynamicMemPoolBest
   io_handle_ = std::make_shared<IOHandle>();
   if (offload_context != nullptr) {
     if (offload_context->enable_aio()) {
-      io_handle_->LoadAio(kLinuxAioLibName, kLinuxAioInstanceFuncName);
+      // Fall back to libaio if io_uring is not supported by the kernel.
+      if (offload_context->aio_backend() != kIoUringBackend ||
+          !io_handle_->LoadAio(kIoUringLibName, kLinuxAioInstanceFuncName)) {
+        (void)io_handle_->LoadAio(kLinuxAioLibName, kLinuxAioInstanceFuncName);
+      }
+      if (pin_mem_pool_ != nullptr) {
+        // The io_uring plugin reads and writes the memory blocks of pin memory pool as registered buffers.
+        auto io_handle = io_handle_;
+        mem_block_callback_id_ = pin_mem_pool_->AddMemBlockCallback(
+          [io_handle](void *addr, size_t size) { io_handle->RegisterBuffer(addr, size); },
+          [io_handle](void *addr) { io_handle->UnregisterBuffer(addr); });
+      }
     }
     max_file_size_ = offload_context->offload_disk_size();
   }
@@ -157,6 +170,13 @@ SwapManager::SwapManager(size_t stream_id, mindspore::device::DynamicMemPoolBest
   (void)FileUtils::CreateNotExistDirs(offload_context->offload_path(), true);
 }
 
+SwapManager::~SwapManager() {
+  // The memory blocks stay in pin memory pool, so stop the io_uring plugin from using them as registered buffers.
+  if (pin_mem_pool_ != nullptr && mem_block_callback_id_.has_value()) {
+    pin_mem_pool_->RemoveMemBlockCallback(mem_block_callback_id_.value());
+  }
+}
+
 template <class Input, class Output>
 bool SwapManager::TryAllocate(std::queue<const DeviceAddress *> queue, const Input &input, uint32_t stream_id,
                               Output (SwapManager::*allocate_func)(const Input &, uint32_t),
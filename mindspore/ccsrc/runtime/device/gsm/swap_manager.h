@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_GSM_SWAP_MANAGER_H_
 
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <utility>
@@ -66,7 +67,7 @@ class SwappableTensorCandidates {
 class BACKEND_EXPORT SwapManager {
  public:
   SwapManager(size_t stream_id, DynamicMemPoolBestFit *device_memory_pool, PinMemPool *pin_mem_pool);
-  ~SwapManager() = default;
+  ~SwapManager();
   // Device memory
   void *AllocDeviceMemory(size_t size, uint32_t stream_id = kDefaultStreamIndex);
   std::vector<void *> AllocDeviceContinuousMem(const std::vector<size_t> &size_list,
@@ -131,6 +132,7 @@ class BACKEND_EXPORT SwapManager {
   std::mutex swapping_tensors_file_mutex_;
   std::queue<const DeviceAddress *> swapping_tensors_file_;
   IOHandlePtr io_handle_;
+  std::optional<size_t> mem_block_callback_id_;
 };
 }  // namespace device
 }  // namespace mindspore
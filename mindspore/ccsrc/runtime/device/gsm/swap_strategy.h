@@ -54,6 +54,9 @@ enum class SwapActionType {
   kDDR2DISK,
   kDISK2DDR,
   kAllocHBM,
+  // Compress the tensor in ddr, and decompress it ahead of moving it to hbm.
+  kDDRCompress,
+  kDDRDecompress,
 };
 
 struct TensorAction {
@@ -77,6 +80,8 @@ struct SwapLink {
 struct SwapStrategy {
   size_t kernel_num_{0};
   size_t virtual_node_num_{0};
+  // The swap time in microseconds of a step which is not hidden by the kernels, predicted by the cost model.
+  double predicted_stall_{0};
   std::map<size_t, AnfNodePtr> nodes_;
   std::map<size_t, std::shared_ptr<SwapAction>> actions_;
   std::vector<std::shared_ptr<SwapLink>> links_;
@@ -114,13 +119,16 @@ struct SwapStrategy {
     }
 
     buffer << "Action-actor num: " << actions_.size() << "\n"
-           << "Action num: " << action_num << "\n";
+           << "Action num: " << action_num << "\n"
+           << "Predicted stall: " << predicted_stall_ << "us\n";
 
     static const std::map<SwapActionType, std::string> kActionTips = {
       {SwapActionType::kHBM2DDR, "HBM2DDR"},   {SwapActionType::kHBM2DISK, "HBM2DISK"},
       {SwapActionType::kDDR2HBM, "DDR2HBM"},   {SwapActionType::kDISK2HBM, "DISK2HBM"},
       {SwapActionType::kDDR2DISK, "DDR2DISK"}, {SwapActionType::kDISK2DDR, "DISK2DDR"},
       {SwapActionType::kAllocHBM, "AllocHBM"},
+      {SwapActionType::kDDRCompress, "DDRCompress"},
+      {SwapActionType::kDDRDecompress, "DDRDecompress"},
     };
     static const size_t kBytesPerGB = 1 << 30;
     for (auto const &swap_mem : swap_mem_sizes) {
@@ -136,6 +144,15 @@ struct SwapStrategy {
   }
 };
 
+// The costs measured by the swap actors of a graph, times are in microseconds and bandwidths are in bytes per
+// microsecond.
+struct SwapCostProfile {
+  // The hash of the kernels and their shapes of the graph which the costs are measured on.
+  std::string graph_hash_;
+  std::vector<double> kernel_costs_;
+  std::map<SwapActionType, double> bandwidths_;
+};
+
 class SwapContext {
  public:
   size_t hbm_mem_size_{0};
@@ -146,6 +163,9 @@ class SwapContext {
   bool offload_param_to_disk_{false};
   bool offload_checkpoint_to_cpu_{false};
   bool offload_checkpoint_to_disk_{false};
+  bool compress_host_{false};
+  // Build the strategy by the cost model if the costs of the graph have been measured.
+  std::shared_ptr<SwapCostProfile> cost_profile_{nullptr};
 };
 }  // namespace device
 }  // namespace mindspore
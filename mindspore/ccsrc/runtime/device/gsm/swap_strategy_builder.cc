@@ -14,10 +14,12 @@
  * limitations under the License.
  */
 #include "runtime/device/gsm/swap_strategy_builder.h"
+#include <algorithm>
 #include <memory>
 #include <queue>
 #include <set>
 #include <functional>
+#include <utility>
 #include "include/common/utils/anfalgo.h"
 #include "runtime/device/gsm/swap_strategy.h"
 #include "runtime/device/gsm/mem_usage_analyzer.h"
@@ -80,6 +82,12 @@ size_t GetFirstKernelIndex(const std::shared_ptr<MemUsageTensorInfo> &info,
 }
 }  // namespace
 const size_t kSwapVirtualNodeNum = 2;  // Mark graph start and end node as virtual node
+// A tensor in ddr is cold enough to be compressed if it is large and not used by the kernels for a long time.
+const size_t kMinCompressTensorSize = 1 << 20;
+const size_t kMinCompressIdleKernels = 16;
+// Decompressing starts this proportion of the idle kernels, and no less than the minimum kernels, ahead of the load.
+const size_t kDecompressPrefetchRatio = 4;
+const size_t kMinDecompressPrefetchKernels = 4;
 void SwapStrategyBuilder::ResetState(const KernelGraphPtr &graph, const std::shared_ptr<SwapContext> &context) {
   MS_EXCEPTION_IF_NULL(graph);
   MS_EXCEPTION_IF_NULL(context);
@@ -104,6 +112,18 @@ void SwapStrategyBuilder::ResetState(const KernelGraphPtr &graph, const std::sha
 
   kernel_actions_.clear();
   kernel_actions_.resize(kernel_num_ + kSwapVirtualNodeNum);
+
+  prefetch_actions_.clear();
+  predicted_stall_ = 0;
+  cost_model_ = nullptr;
+  if (context->cost_profile_ != nullptr) {
+    if (context->cost_profile_->kernel_costs_.size() == kernel_num_) {
+      cost_model_ = std::make_shared<SwapCostModel>(*context->cost_profile_);
+    } else {
+      MS_LOG(WARNING) << "The swap cost profile has " << context->cost_profile_->kernel_costs_.size()
+                      << " kernels, but the graph has " << kernel_num_ << " kernels, ignore it.";
+    }
+  }
 }
 
 void SwapStrategyBuilder::AnalyzeGraph(const KernelGraphPtr &graph) {
@@ -130,7 +150,9 @@ void SwapStrategyBuilder::RecordSpan(const std::shared_ptr<MemUsageTensorInfo> &
   span->tensor_size_ = info->tensor_size_;
   span->last_index_ = last_index;
   span->current_index_ = current_index;
-  span->weight_ = (dist - 1) * info->tensor_size_;
+  span->weight_ = cost_model_ == nullptr
+                   ? (dist - 1) * info->tensor_size_
+                   : cost_model_->OffloadWeight(info->tensor_size_, last_index, current_index);
   span->output_span_ = output_span;
 
   bool offload_param = context_->offload_param_to_cpu_ || context_->offload_param_to_disk_;
@@ -244,19 +266,40 @@ void SwapStrategyBuilder::ClassifySpanLevel() {
   ClassifyOffloadSpanLevel(offload_checkpoint_spans_, context_->offload_checkpoint_to_cpu_);
   offload_checkpoint_spans_.clear();
 
+  std::vector<std::shared_ptr<Span>> offload_spans;
   while (!span_queue_.empty()) {
     auto span = span_queue_.top();
-    bool enough = EnoughSpaceForSpan(span, &mem_used_level0_, total_mem_level0_);
-    if (!enough) {
-      enough = EnoughSpaceForSpan(span, &mem_used_level1_, total_mem_level1_);
-      if (enough) {
-        (void)span_level1_.emplace_back(span);
-      } else {
-        (void)span_level2_.emplace_back(span);
-      }
+    if (!EnoughSpaceForSpan(span, &mem_used_level0_, total_mem_level0_)) {
+      (void)offload_spans.emplace_back(span);
     }
     span_queue_.pop();
   }
+  if (cost_model_ != nullptr) {
+    // The ddr is given to the spans which would expose the most time per byte if offloaded to disk instead.
+    std::vector<std::pair<double, std::shared_ptr<Span>>> ddr_gains;
+    for (const auto &span : offload_spans) {
+      const double ddr_time = cost_model_->OffloadTime(SwapActionType::kHBM2DDR, SwapActionType::kDDR2HBM,
+                                                       span->tensor_size_, span->last_index_, span->current_index_,
+                                                       !span->output_span_);
+      const double disk_time = cost_model_->OffloadTime(SwapActionType::kHBM2DISK, SwapActionType::kDISK2HBM,
+                                                        span->tensor_size_, span->last_index_, span->current_index_,
+                                                        !span->output_span_);
+      const double size = static_cast<double>(std::max<size_t>(span->tensor_size_, 1));
+      (void)ddr_gains.emplace_back((disk_time - ddr_time) / size, span);
+    }
+    std::stable_sort(ddr_gains.begin(), ddr_gains.end(),
+                     [](const auto &left, const auto &right) { return left.first > right.first; });
+    for (size_t i = 0; i < ddr_gains.size(); ++i) {
+      offload_spans[i] = ddr_gains[i].second;
+    }
+  }
+  for (const auto &span : offload_spans) {
+    if (EnoughSpaceForSpan(span, &mem_used_level1_, total_mem_level1_)) {
+      (void)span_level1_.emplace_back(span);
+    } else {
+      (void)span_level2_.emplace_back(span);
+    }
+  }
 }
 
 void SwapStrategyBuilder::AddTensorAction(SwapActionType action_type, size_t tensor_id, size_t kernel_id) {
@@ -279,6 +322,62 @@ void SwapStrategyBuilder::AddTensorAction(SwapActionType action_type, size_t ten
   (void)kernel_actions_[kernel_id].emplace_back(action);
 }
 
+void SwapStrategyBuilder::AddCompressTensorAction(const std::shared_ptr<Span> &span, size_t load_index) {
+  MS_EXCEPTION_IF_NULL(span);
+  MS_EXCEPTION_IF_NULL(context_);
+  if (!context_->compress_host_ || span->tensor_size_ < kMinCompressTensorSize) {
+    return;
+  }
+  // Compress after the kernel following the move to ddr, the end virtual node can not be followed by an action.
+  const size_t compress_index = span->last_index_ + 2;
+  if (compress_index > kernel_num_ || load_index < compress_index + kMinCompressIdleKernels) {
+    return;
+  }
+  const size_t idle_kernels = load_index - compress_index;
+  const size_t prefetch_kernels = std::max(kMinDecompressPrefetchKernels, idle_kernels / kDecompressPrefetchRatio);
+  AddTensorAction(SwapActionType::kDDRCompress, span->tensor_id_, compress_index);
+  AddTensorAction(SwapActionType::kDDRDecompress, span->tensor_id_, (load_index - prefetch_kernels) % kernel_num_);
+}
+
+size_t SwapStrategyBuilder::AddLoadTensorAction(const std::shared_ptr<Span> &span, SwapActionType load_type) {
+  MS_EXCEPTION_IF_NULL(span);
+  const size_t current_index = span->current_index_;
+  if (cost_model_ == nullptr) {
+    AddTensorAction(load_type, span->tensor_id_, current_index % kernel_num_);
+    return current_index;
+  }
+  const double load_time = cost_model_->TransferTime(load_type, span->tensor_size_);
+  // The load starts after the kernel following the store, and can not cross the end of the step.
+  const size_t begin = span->last_index_ + 2;
+  const bool cross_step = begin < kernel_num_ && current_index >= kernel_num_;
+  const size_t end = cross_step ? kernel_num_ : current_index;
+  // The tensor takes hbm since the load starts, start after the last kernel without enough memory.
+  size_t start = cost_model_->PlanLoad(begin, end, load_time);
+  for (size_t index = end; index > start; --index) {
+    if (mem_used_level0_[(index - 1) % kernel_num_] + span->tensor_size_ > total_mem_level0_) {
+      start = index;
+      break;
+    }
+  }
+  auto prefetch_span = std::make_shared<Span>(*span);
+  prefetch_span->last_index_ = start - 1;
+  if (start >= end || !EnoughSpaceForSpan(prefetch_span, &mem_used_level0_, total_mem_level0_)) {
+    AddTensorAction(load_type, span->tensor_id_, current_index % kernel_num_);
+    predicted_stall_ += load_time;
+    return current_index;
+  }
+  predicted_stall_ += cost_model_->ReserveLoad(start, end, load_time);
+  auto action = std::make_shared<TensorAction>();
+  action->action_ = load_type;
+  action->tensor_id_ = span->tensor_id_;
+  // Node i + 1 is kernel i, the load runs after kernel start - 1 and before the kernel using the tensor.
+  const size_t from_node = start % kernel_num_;
+  // The load crossing the end of the step runs before the end virtual node.
+  const size_t to_node = cross_step ? kernel_num_ + 1 : current_index % kernel_num_ + 1;
+  (void)prefetch_actions_[std::make_pair(from_node, to_node)].emplace_back(action);
+  return start;
+}
+
 void SwapStrategyBuilder::AddFusedTensorSpan(const std::shared_ptr<MemUsageTensorInfo> &info, size_t start_index,
                                              size_t current_kernel_id) {
   MS_EXCEPTION_IF_NULL(analyzer_);
@@ -426,16 +525,23 @@ void SwapStrategyBuilder::SpanToTensorAction() {
   for (auto span : span_level1_) {
     MS_EXCEPTION_IF_NULL(span);
     AddTensorAction(SwapActionType::kHBM2DDR, span->tensor_id_, span->last_index_ + 1);
+    if (cost_model_ != nullptr) {
+      predicted_stall_ += cost_model_->TransferTime(SwapActionType::kHBM2DDR, span->tensor_size_);
+    }
     if (!span->output_span_) {
-      AddTensorAction(SwapActionType::kDDR2HBM, span->tensor_id_, span->current_index_ % kernel_num_);
+      const auto load_index = AddLoadTensorAction(span, SwapActionType::kDDR2HBM);
+      AddCompressTensorAction(span, load_index);
     }
   }
 
   for (auto span : span_level2_) {
     MS_EXCEPTION_IF_NULL(span);
     AddTensorAction(SwapActionType::kHBM2DISK, span->tensor_id_, span->last_index_ + 1);
+    if (cost_model_ != nullptr) {
+      predicted_stall_ += cost_model_->TransferTime(SwapActionType::kHBM2DISK, span->tensor_size_);
+    }
     if (!span->output_span_) {
-      AddTensorAction(SwapActionType::kDISK2HBM, span->tensor_id_, span->current_index_ % kernel_num_);
+      (void)AddLoadTensorAction(span, SwapActionType::kDISK2HBM);
     }
   }
 }
@@ -478,6 +584,15 @@ std::shared_ptr<SwapStrategy> SwapStrategyBuilder::BuildStrategy(const KernelGra
     (void)strategy->links_.emplace_back(std::make_shared<SwapLink>(action_id, i + 1));
     ++action_id;
   }
+  for (const auto &prefetch : prefetch_actions_) {
+    auto swap_action = std::make_shared<SwapAction>();
+    swap_action->actions_ = prefetch.second;
+    strategy->actions_[action_id] = swap_action;
+    (void)strategy->links_.emplace_back(std::make_shared<SwapLink>(prefetch.first.first, action_id));
+    (void)strategy->links_.emplace_back(std::make_shared<SwapLink>(action_id, prefetch.first.second));
+    ++action_id;
+  }
+  strategy->predicted_stall_ = predicted_stall_;
 
   strategy->kernel_infos_ = analyzer_->GetMemUsageKernelInfos();
   strategy->tensor_infos_ = analyzer_->GetMemUsageTensorInfos();
@@ -21,6 +21,7 @@
 #include <map>
 #include <utility>
 #include "runtime/device/gsm/swap_strategy.h"
+#include "runtime/device/gsm/swap_cost_model.h"
 #include "runtime/device/gsm/mem_usage_analyzer.h"
 #include "include/backend/visible.h"
 namespace mindspore {
@@ -70,6 +71,9 @@ class BACKEND_EXPORT SwapStrategyBuilder {
                   bool output_span = false);
 
   void AddTensorAction(SwapActionType action_type, size_t tensor_id, size_t kernel_id);
+  void AddCompressTensorAction(const std::shared_ptr<Span> &span, size_t load_index);
+  // Add the action loading the tensor of span back to hbm, returns the index of the kernel before which it starts.
+  size_t AddLoadTensorAction(const std::shared_ptr<Span> &span, SwapActionType load_type);
   std::shared_ptr<SwapStrategy> BuildStrategy(const KernelGraphPtr &graph);
 
  protected:
@@ -87,6 +91,11 @@ class BACKEND_EXPORT SwapStrategyBuilder {
   size_t total_mem_level1_{0};
   std::vector<std::vector<std::shared_ptr<TensorAction>>> kernel_actions_;
   std::map<size_t, std::pair<size_t, size_t>> parallel_comm_ids_;
+  // Created only if the costs of the graph have been measured.
+  std::shared_ptr<SwapCostModel> cost_model_{nullptr};
+  double predicted_stall_{0};
+  // The loads running ahead of their kernels, keyed by the nodes they run after and before.
+  std::map<std::pair<size_t, size_t>, std::vector<std::shared_ptr<TensorAction>>> prefetch_actions_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -17,6 +17,7 @@
 #include "runtime/device/loadable_device_address.h"
 #include "include/common/debug/common.h"
 #include "include/common/utils/offload_context.h"
+#include "abstract/utils.h"
 #include "utils/file_utils.h"
 
 namespace mindspore {
@@ -95,11 +96,20 @@ bool LoadableDeviceAddress::MoveTo(mindspore::device::StorageType dst, bool asyn
       MS_LOG(WARNING) << "Move data to file failed.";
       return false;
     }
+  } else if (dst == StorageType::kCompressedHost) {
+    if (!MoveToCompressedHost(async, stream_id)) {
+      MS_LOG(WARNING) << "Move data to compressed host memory failed.";
+      return false;
+    }
   }
   return true;
 }
 
 bool LoadableDeviceAddress::MoveToHost(bool async, size_t stream_id) const {
+  // The data stays in host when its compression is skipped or rejected.
+  if (status_ == DeviceAddressStatus::kInHost) {
+    return true;
+  }
   const auto device_context = GetDeviceContext();
   MS_EXCEPTION_IF_NULL(device_context);
   const auto swap_manager = device_context->device_res_manager_->swap_manager();
@@ -112,7 +122,16 @@ bool LoadableDeviceAddress::MoveToHost(bool async, size_t stream_id) const {
       return false;
     }
   }
-  if (status_ == DeviceAddressStatus::kInFile) {
+  if (status_ == DeviceAddressStatus::kInCompressedHost) {
+    MS_EXCEPTION_IF_NULL(compressed_host_);
+    swap_event_.compress_future_ =
+      MemCompressor::GetInstance().DecompressAsync(compressed_host_, storage_info_.host_ptr_);
+    status_ = DeviceAddressStatus::kInCompressedHostToHost;
+    if (!async) {
+      return Wait();
+    }
+    swap_manager->AddSwappingTensor(this);
+  } else if (status_ == DeviceAddressStatus::kInFile) {
     if (!CopyFileToHost(storage_info_.host_ptr_, storage_info_.file_name_, GetSize(), async)) {
       MS_LOG(WARNING) << "Copy data from file to host failed.";
       return false;
@@ -153,6 +172,10 @@ bool LoadableDeviceAddress::MoveToDevice(bool async, size_t stream_id) const {
   const auto swap_manager = device_context->device_res_manager_->swap_manager();
   MS_EXCEPTION_IF_NULL(swap_manager);
   std::lock_guard<std::recursive_mutex> lock(ptr_mutex_);
+  // The host memory may be compressed or decompressed on background threads.
+  if (swap_event_.compress_future_.valid() && !Wait()) {
+    return false;
+  }
   if (status_ == DeviceAddressStatus::kInFile) {
 #if defined(RT_MEMORY_P2PDMA)
     if (GetDevicePtr() == nullptr) {
@@ -176,6 +199,9 @@ bool LoadableDeviceAddress::MoveToDevice(bool async, size_t stream_id) const {
       return false;
     }
   }
+  if (status_ == DeviceAddressStatus::kInCompressedHost && !MoveToHost(false, stream_id)) {
+    return false;
+  }
   if (GetDevicePtr() == nullptr) {
     SetDevicePtr(swap_manager->AllocDeviceMemory(GetSize(), stream_id));
     if (GetDevicePtr() == nullptr) {
@@ -210,6 +236,9 @@ bool LoadableDeviceAddress::MoveToFile(bool async, size_t stream_id) const {
   const auto swap_manager = device_context->device_res_manager_->swap_manager();
   MS_EXCEPTION_IF_NULL(swap_manager);
   std::lock_guard<std::recursive_mutex> lock(ptr_mutex_);
+  if (status_ == DeviceAddressStatus::kInCompressedHost && !MoveToHost(false, stream_id)) {
+    return false;
+  }
   if (status_ == DeviceAddressStatus::kInDevice) {
 #if defined(RT_MEMORY_P2PDMA)
     if (storage_info_.file_name_.empty() || storage_info_.file_name_mutable_) {
@@ -256,6 +285,62 @@ bool LoadableDeviceAddress::MoveToFile(bool async, size_t stream_id) const {
   return true;
 }
 
+bool LoadableDeviceAddress::MoveToCompressedHost(bool async, size_t stream_id) const {
+  if (status_ == DeviceAddressStatus::kInCompressedHost) {
+    return true;
+  }
+  const auto device_context = GetDeviceContext();
+  MS_EXCEPTION_IF_NULL(device_context);
+  const auto swap_manager = device_context->device_res_manager_->swap_manager();
+  MS_EXCEPTION_IF_NULL(swap_manager);
+  std::lock_guard<std::recursive_mutex> lock(ptr_mutex_);
+  if (status_ != DeviceAddressStatus::kInHost && !MoveToHost(false, stream_id)) {
+    return false;
+  }
+  // Only the host memory owned by the device address can be replaced by the compressed data.
+  if (storage_info_.host_ptr_ == nullptr || !storage_info_.host_ptr_mutable_ || GetSize() == 0) {
+    return true;
+  }
+  compressed_host_ = std::make_shared<CompressedData>();
+  swap_event_.compress_future_ = MemCompressor::GetInstance().CompressAsync(
+    storage_info_.host_ptr_, GetSize(), abstract::TypeIdSize(type_id()), compressed_host_);
+  status_ = DeviceAddressStatus::kInHostToCompressedHost;
+  if (!async) {
+    return Wait();
+  }
+  swap_manager->AddSwappingTensor(this);
+  return true;
+}
+
+bool LoadableDeviceAddress::FinishCompression(bool success) const {
+  const auto device_context = GetDeviceContext();
+  MS_EXCEPTION_IF_NULL(device_context);
+  const auto swap_manager = device_context->device_res_manager_->swap_manager();
+  MS_EXCEPTION_IF_NULL(swap_manager);
+  if (status_ == DeviceAddressStatus::kInHostToCompressedHost) {
+    if (success) {
+      swap_manager->FreeHostMemory(storage_info_.host_ptr_);
+      storage_info_.host_ptr_ = nullptr;
+      status_ = DeviceAddressStatus::kInCompressedHost;
+    } else {
+      MS_LOG(DEBUG) << "The data is not compressible enough and kept in host memory, size: " << GetSize();
+      compressed_host_ = nullptr;
+      status_ = DeviceAddressStatus::kInHost;
+    }
+    return true;
+  }
+  if (!success) {
+    MS_LOG(WARNING) << "Decompress data in host memory failed, size: " << GetSize();
+    swap_manager->FreeHostMemory(storage_info_.host_ptr_);
+    storage_info_.host_ptr_ = nullptr;
+    status_ = DeviceAddressStatus::kInCompressedHost;
+    return false;
+  }
+  compressed_host_ = nullptr;
+  status_ = DeviceAddressStatus::kInHost;
+  return true;
+}
+
 bool LoadableDeviceAddress::CopyHostToFile(const std::string &dst, const void *src, size_t size, bool async) const {
   MS_EXCEPTION_IF_NULL(src);
   const auto device_context = GetDeviceContext();
@@ -293,6 +378,10 @@ bool LoadableDeviceAddress::CopyFileToHost(void *dst, const std::string &src, si
 }
 
 void LoadableDeviceAddress::ReleaseResource() {
+  // The background threads may still read or write the host memory.
+  if (swap_event_.compress_future_.valid()) {
+    swap_event_.compress_future_.wait();
+  }
   if (status_ == DeviceAddressStatus::kInDevice) {
     return;
   }
@@ -360,6 +449,7 @@ void LoadableDeviceAddress::Swap(mindspore::device::DeviceAddress *other) {
     loadable_device_address->status_ = status_;
     loadable_device_address->offload_ptr_ = offload_ptr_;
     loadable_device_address->mem_offloaded_ = mem_offloaded_;
+    loadable_device_address->compressed_host_ = compressed_host_;
     storage_info_.host_ptr_ = nullptr;
     storage_info_.file_name_ = "";
     storage_info_.host_ptr_mutable_ = true;
@@ -367,6 +457,7 @@ void LoadableDeviceAddress::Swap(mindspore::device::DeviceAddress *other) {
     status_ = DeviceAddressStatus::kInDevice;
     offload_ptr_ = nullptr;
     mem_offloaded_ = false;
+    compressed_host_ = nullptr;
   }
 }
 
@@ -375,6 +466,11 @@ bool LoadableDeviceAddress::Wait() const {
     return true;
   }
   std::lock_guard<std::recursive_mutex> lock(ptr_mutex_);
+  if (swap_event_.compress_future_.valid()) {
+    const bool success = swap_event_.compress_future_.get();
+    swap_event_.compress_future_ = std::shared_future<bool>();
+    return FinishCompression(success);
+  }
   const auto device_context = GetDeviceContext();
   MS_EXCEPTION_IF_NULL(device_context);
   const auto swap_manager = device_context->device_res_manager_->swap_manager();
@@ -427,7 +523,7 @@ void *LoadableDeviceAddress::GetOffloadPtr() const {
 bool LoadableDeviceAddress::IsPtrValid() const {
   std::lock_guard<std::recursive_mutex> lock(ptr_mutex_);
   return GetDevicePtr() != nullptr || offload_ptr_ != nullptr || storage_info_.host_ptr_ != nullptr ||
-         !storage_info_.file_name_.empty();
+         !storage_info_.file_name_.empty() || compressed_host_ != nullptr;
 }
 
 // Load first if data is offloaded and return the device ptr.
@@ -17,9 +17,11 @@
 #ifndef MINDSPORE_MINDSPORE_CCSRC_RUNTIME_DEVICE_LOADABLE_DEVICE_ADDRESS_H_
 #define MINDSPORE_MINDSPORE_CCSRC_RUNTIME_DEVICE_LOADABLE_DEVICE_ADDRESS_H_
 
+#include <future>
 #include <memory>
 #include <string>
 #include "include/backend/device_address.h"
+#include "runtime/device/gsm/mem_compressor.h"
 #include "runtime/hardware/device_context.h"
 #include "runtime/hardware/device_context_manager.h"
 
@@ -27,10 +29,13 @@ namespace mindspore {
 namespace device {
 struct SwapEvent {
   bool NeedWait() const {
-    return aio_token_ != kInvalidAsyncIOToken || (device_event_ != nullptr && device_event_->NeedWait());
+    return aio_token_ != kInvalidAsyncIOToken || (device_event_ != nullptr && device_event_->NeedWait()) ||
+           compress_future_.valid();
   }
   AsyncIOToken aio_token_{kInvalidAsyncIOToken};
   std::shared_ptr<DeviceEvent> device_event_{nullptr};
+  // Result of compressing or decompressing the data in host memory.
+  std::shared_future<bool> compress_future_;
 };
 using SwapEventPtr = std::shared_ptr<SwapEvent>;
 
@@ -105,6 +110,9 @@ class BACKEND_EXPORT LoadableDeviceAddress : public DeviceAddress {
   bool MoveToDevice(bool async, size_t stream_id = kDefaultStreamIndex) const;
   bool MoveToHost(bool async, size_t stream_id = kDefaultStreamIndex) const;
   bool MoveToFile(bool async, size_t stream_id = kDefaultStreamIndex) const;
+  bool MoveToCompressedHost(bool async, size_t stream_id = kDefaultStreamIndex) const;
+  // Release the source data of the finished compression or decompression.
+  bool FinishCompression(bool success) const;
 
   virtual bool CopyDeviceToHost(void *dst, const void *src, size_t size, bool async, size_t stream_id) const {
     return false;
@@ -124,6 +132,8 @@ class BACKEND_EXPORT LoadableDeviceAddress : public DeviceAddress {
   void *offload_ptr_{nullptr};
   mutable SwapEvent swap_event_;
   mutable StorageInfo storage_info_;
+  // The data in host memory compressed by MemCompressor, host_ptr_ of storage_info_ is freed once it is compressed.
+  mutable CompressedDataPtr compressed_host_{nullptr};
   bool swappable_{false};
 };
 }  // namespace device
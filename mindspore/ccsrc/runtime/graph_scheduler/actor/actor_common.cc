@@ -16,6 +16,7 @@
 
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include <memory>
+#include <sstream>
 #include "ops/framework_op_name.h"
 #include "ops/framework_ops.h"
 #include "ops/structure_op_name.h"
@@ -40,6 +41,32 @@ bool ActorDispatcher::enable_runtime_multi_pipeline_ = false;
 bool ActorDispatcher::enable_async_launch_kernel_ = false;
 bool ActorDispatcher::enable_static_shape_ = false;
 
+RuntimePipelineStats &RuntimePipelineStats::GetInstance() {
+  static RuntimePipelineStats instance;
+  return instance;
+}
+
+void RuntimePipelineStats::DumpAndClear(const std::string &actor_set_name) {
+  static const std::vector<std::string> kStageNames = {"infer", "resize", "launch", "wait"};
+  std::ostringstream oss;
+  uint64_t stage_time_us = 0;
+  uint64_t wait_time_us = 0;
+  for (size_t i = 0; i < kStageNum; ++i) {
+    auto task_num = task_nums_[i].exchange(0);
+    auto time_us = times_us_[i].exchange(0);
+    oss << " " << kStageNames[i] << " " << task_num << " tasks " << time_us << " us,";
+    if (i == static_cast<size_t>(RuntimePipelineStage::kWait)) {
+      wait_time_us = time_us;
+    } else {
+      stage_time_us += time_us;
+    }
+  }
+  // The stage time not waited by the actors is overlapped with the actors and the other stages of the same step.
+  MS_LOG(INFO) << "Runtime pipeline stats of actor set " << actor_set_name << ":" << oss.str()
+               << " hidden time within the step "
+               << (stage_time_us > wait_time_us ? stage_time_us - wait_time_us : 0) << " us.";
+}
+
 bool IsRunningFailed(const OpContext<DeviceTensor> *context) { return (context->error_info_ != ""); }
 
 void ComputeThreadNums(size_t *actor_thread_num, size_t *actor_and_kernel_thread_num) {
@@ -245,16 +272,32 @@ bool EnableKbkSubGraphExecute() {
   if (disable_sub_graph_execute_mode) {
     return false;
   }
-  // Only support sub graph execution mode for inference.
-  // static const bool enable_internal_kernels = common::GetEnv("MS_ENABLE_INTERNAL_KERNELS") == "on";
   auto ms_context = MsContext::GetInstance();
   MS_EXCEPTION_IF_NULL(ms_context);
+  // The env enables the sub graph execution mode for training, and the sub graph replay on CPU is built on it.
+  static bool enable_sub_graph_execute_mode = common::GetEnv(kEnableKbkSubGraphExecutedEnv) == "1";
+  if (enable_sub_graph_execute_mode ||
+      (EnableKbkSubGraphReplay() && ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice)) {
+    return true;
+  }
+  // Only support sub graph execution mode for inference.
+  // static const bool enable_internal_kernels = common::GetEnv("MS_ENABLE_INTERNAL_KERNELS") == "on";
   static const bool enable_internal_kernels = ms_context->IsEnableInferBoost();
   return enable_internal_kernels;
 }
 
+bool EnableKbkSubGraphReplay() {
+  static const char kEnableKbkSubGraphReplayEnv[] = "MS_ENABLE_KBK_SUBGRAPH_REPLAY";
+  static bool ret = common::GetEnv(kEnableKbkSubGraphReplayEnv) == "1";
+  return ret;
+}
+
 bool WaitRuntimePipelineFinish(const OpContext<DeviceTensor> *context, bool wait_kernel_launch_finish) {
 #ifndef BUILD_LITE
+  if (!ActorDispatcher::enable_runtime_multi_pipeline() && !ActorDispatcher::enable_async_launch_kernel()) {
+    return true;
+  }
+  RuntimePipelineStageRecorder recorder(RuntimePipelineStage::kWait);
   if (ActorDispatcher::enable_runtime_multi_pipeline()) {
     KernelAsyncInferActor::GetInstance()->Wait();
     KernelAsyncResizeActor::GetInstance()->Wait();
@@ -25,6 +25,9 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include "utils/hash_map.h"
 #include "mindrt/include/actor/op_actor.h"
 #include "include/backend/device_address.h"
@@ -293,6 +296,52 @@ class ActorDispatcher {
   static bool enable_async_launch_kernel_;
 };
 
+enum class RuntimePipelineStage { kInfer = 0, kResize, kLaunch, kWait, kStageNum };
+
+// The accumulated time of the stages of the runtime pipeline. The infer, resize and launch stages run on their own
+// threads, so their time is hidden from the kernel actors except the time the actors wait for the pipeline to finish.
+// The stages only overlap within a step: the loop count actor waits for the pipeline to finish at the end of every
+// step, so the leading kernels of the next step are not inferred or resized while the last ones are launched.
+class RuntimePipelineStats {
+ public:
+  static RuntimePipelineStats &GetInstance();
+
+  void Record(RuntimePipelineStage stage, uint64_t time_us) {
+    auto index = static_cast<size_t>(stage);
+    (void)task_nums_[index].fetch_add(1, std::memory_order_relaxed);
+    (void)times_us_[index].fetch_add(time_us, std::memory_order_relaxed);
+  }
+  uint64_t task_num(RuntimePipelineStage stage) const { return task_nums_[static_cast<size_t>(stage)].load(); }
+  uint64_t time_us(RuntimePipelineStage stage) const { return times_us_[static_cast<size_t>(stage)].load(); }
+
+  // Log the time of the stages recorded since the last call and clear them.
+  void DumpAndClear(const std::string &actor_set_name);
+
+ private:
+  RuntimePipelineStats() = default;
+  DISABLE_COPY_AND_ASSIGN(RuntimePipelineStats);
+
+  static constexpr size_t kStageNum = static_cast<size_t>(RuntimePipelineStage::kStageNum);
+  std::array<std::atomic<uint64_t>, kStageNum> task_nums_{};
+  std::array<std::atomic<uint64_t>, kStageNum> times_us_{};
+};
+
+// Record the time of a stage of the runtime pipeline in the scope.
+class RuntimePipelineStageRecorder {
+ public:
+  explicit RuntimePipelineStageRecorder(RuntimePipelineStage stage)
+      : stage_(stage), start_(std::chrono::steady_clock::now()) {}
+  ~RuntimePipelineStageRecorder() {
+    auto time_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_).count();
+    RuntimePipelineStats::GetInstance().Record(stage_, static_cast<uint64_t>(time_us));
+  }
+
+ private:
+  RuntimePipelineStage stage_;
+  std::chrono::steady_clock::time_point start_;
+};
+
 bool IsRunningFailed(const OpContext<DeviceTensor> *context);
 
 void ComputeThreadNums(size_t *actor_thread_num, size_t *actor_and_kernel_thread_num);
@@ -338,6 +387,10 @@ bool EnableAsyncInfer();
 // kernel actor directly.
 bool EnableKbkSubGraphExecute();
 
+// Whether the super kernel actor captures the kernel launches of the static shape sub graph on CPU at the first step,
+// and replays them directly in the later steps, enabled by the env MS_ENABLE_KBK_SUBGRAPH_REPLAY.
+bool EnableKbkSubGraphReplay();
+
 // If enable async launch kernel, wait all kernels launch task finish.
 // If enable infer->resize->launch pipeline, also wait all infer, resize and launch task finish.
 bool WaitRuntimePipelineFinish(const OpContext<DeviceTensor> *context, bool wait_kernel_launch_finish = true);
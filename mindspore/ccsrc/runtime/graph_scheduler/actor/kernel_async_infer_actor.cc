@@ -31,6 +31,7 @@ void KernelAsyncInferActor::Initialize() {
 }
 
 void KernelAsyncInferActor::InferShape(OpContext<DeviceTensor> *const context, KernelActor *kernel_actor) {
+  RuntimePipelineStageRecorder recorder(RuntimePipelineStage::kInfer);
   try {
     kernel_actor->ExecuteInferShapeTask(context);
   } catch (const std::exception &e) {
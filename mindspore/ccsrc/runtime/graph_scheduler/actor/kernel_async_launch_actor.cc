@@ -31,6 +31,7 @@ void KernelAsyncLaunchActor::Initialize() {
 }
 
 void KernelAsyncLaunchActor::LaunchKernel(OpContext<DeviceTensor> *const context, KernelActor *kernel_actor) {
+  RuntimePipelineStageRecorder recorder(RuntimePipelineStage::kLaunch);
   try {
     kernel_actor->ExecuteLaunchKernelTask(context);
   } catch (const std::exception &e) {
@@ -31,6 +31,7 @@ void KernelAsyncResizeActor::Initialize() {
 }
 
 void KernelAsyncResizeActor::ResizeKernelMod(OpContext<DeviceTensor> *const context, KernelActor *kernel_actor) {
+  RuntimePipelineStageRecorder recorder(RuntimePipelineStage::kResize);
   try {
     kernel_actor->ExecuteResizeKernelModTask(context);
   } catch (const std::exception &e) {
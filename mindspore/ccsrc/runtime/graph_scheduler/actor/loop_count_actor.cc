@@ -56,6 +56,7 @@ void LoopCountActor::IncreaseLoopCount(OpContext<DeviceTensor> *const context) {
   current_count_++;
   MS_LOG(INFO) << "Loop count actor(" << GetAID().Name() << ") running, loop count: " << loop_count_
                << ", current count: " << current_count_ << ", total running count: " << total_running_count_;
+  // The runtime pipeline is drained at the end of every step, the next step does not overlap with this one.
   if (!WaitRuntimePipelineFinish(context)) {
     MS_LOG(INFO) << "Run graph failed and please check error log.";
   }
@@ -16,6 +16,7 @@
 
 #include "runtime/graph_scheduler/actor/memory/memory_swap_actor.h"
 
+#include <chrono>
 #include <map>
 
 #include "runtime/graph_scheduler/device_tensor_store.h"
@@ -103,10 +104,10 @@ void MemorySwapActor::AllocDeviceContinuousMem(const std::vector<DeviceTensor *>
 }
 
 void MemorySwapActor::Swap(OpContext<mindspore::runtime::DeviceTensor> *const context, device::StorageType to,
-                           const std::vector<DeviceTensor *> &device_tensors) {
+                           bool async, const std::vector<DeviceTensor *> &device_tensors) {
   for (const auto &device_tensor : device_tensors) {
     MS_EXCEPTION_IF_NULL(device_tensor);
-    if (!device_tensor->MoveTo(to, false, kDefaultStreamIndex)) {
+    if (!device_tensor->MoveTo(to, async, kDefaultStreamIndex)) {
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR(*context, "Swap tensor failed.");
     }
   }
@@ -120,8 +121,12 @@ void MemorySwapActor::Run(OpContext<mindspore::runtime::DeviceTensor> *const con
     {device::SwapActionType::kDDR2DISK, device::StorageType::kFile},
     {device::SwapActionType::kDISK2DDR, device::StorageType::kHost},
     {device::SwapActionType::kHBM2DISK, device::StorageType::kFile},
-    {device::SwapActionType::kDISK2HBM, device::StorageType::kDevice}};
+    {device::SwapActionType::kDISK2HBM, device::StorageType::kDevice},
+    {device::SwapActionType::kDDRCompress, device::StorageType::kCompressedHost},
+    {device::SwapActionType::kDDRDecompress, device::StorageType::kHost}};
   UpdateDeviceTensors(context);
+  device::SwapActionRecord record;
+  const auto start_time = std::chrono::steady_clock::now();
   for (const auto &action : swap_actions_) {
     const auto action_type = action.first;
     const auto &device_tensor_indexes = action.second;
@@ -129,11 +134,32 @@ void MemorySwapActor::Run(OpContext<mindspore::runtime::DeviceTensor> *const con
     if (action_type == device::SwapActionType::kAllocHBM) {
       AllocDeviceContinuousMem(device_tensors);
     } else if (action_type != device::SwapActionType::kUnDefined) {
-      Swap(context, swap_to_map[action_type], device_tensors);
+      // Compressing and decompressing run on background threads, the later actions of the tensors wait for them.
+      const bool async = action_type == device::SwapActionType::kDDRCompress ||
+                         action_type == device::SwapActionType::kDDRDecompress;
+      Swap(context, swap_to_map[action_type], async, device_tensors);
+      if (cost_recorder_ != nullptr && !async) {
+        size_t moved_size = 0;
+        for (const auto &device_tensor : device_tensors) {
+          moved_size += device_tensor->GetSize();
+        }
+        (void)record.moved_sizes_.emplace_back(action_type, moved_size);
+      }
     } else {
       MS_LOG(WARNING) << "Unknown swap action type, skip.";
     }
   }
+  if (cost_recorder_ != nullptr) {
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto to_us = [](const std::chrono::steady_clock::time_point &time) {
+      return std::chrono::duration<double, std::micro>(time.time_since_epoch()).count();
+    };
+    record.from_ = strategy_from_;
+    record.to_ = strategy_to_;
+    record.start_ = to_us(start_time);
+    record.end_ = to_us(end_time);
+    cost_recorder_->Record(std::move(record));
+  }
   EraseInput(context);
   SendOutput(context);
 }
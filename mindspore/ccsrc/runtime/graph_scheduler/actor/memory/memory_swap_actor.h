@@ -24,6 +24,7 @@
 #include "runtime/graph_scheduler/actor/abstract_actor.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "runtime/device/gsm/swap_strategy.h"
+#include "runtime/device/gsm/swap_cost_model.h"
 
 namespace mindspore {
 namespace runtime {
@@ -46,13 +47,20 @@ class MemorySwapActor : public AbstractActor {
   }
   ~MemorySwapActor() override = default;
 
+  // Report the time of running to the recorder, the actor runs after node from and before node to of the strategy.
+  void set_cost_recorder(const device::SwapCostRecorderPtr &cost_recorder, size_t from, size_t to) {
+    cost_recorder_ = cost_recorder;
+    strategy_from_ = from;
+    strategy_to_ = to;
+  }
+
  protected:
   void Run(OpContext<DeviceTensor> *context) override;
   void FetchRealParameters(OpContext<DeviceTensor> *context);
 
  private:
   void AllocDeviceContinuousMem(const std::vector<DeviceTensor *> &device_tensors);
-  static void Swap(OpContext<mindspore::runtime::DeviceTensor> *const context, device::StorageType to,
+  static void Swap(OpContext<mindspore::runtime::DeviceTensor> *const context, device::StorageType to, bool async,
                    const std::vector<DeviceTensor *> &device_tensors);
   void UpdateDeviceTensors(OpContext<DeviceTensor> *context);
   std::vector<DeviceTensor *> GetDeviceTensors(const std::vector<size_t> &indexes);
@@ -63,6 +71,9 @@ class MemorySwapActor : public AbstractActor {
   std::vector<std::pair<device::SwapActionType, vector<size_t>>> swap_actions_;
   std::vector<DeviceTensor *> real_parameters_;
   size_t fixed_device_tensor_num_{0};
+  device::SwapCostRecorderPtr cost_recorder_{nullptr};
+  size_t strategy_from_{0};
+  size_t strategy_to_{0};
 };
 
 class MemorySwapInActor : public MemorySwapActor {
@@ -28,6 +28,9 @@
 namespace mindspore {
 namespace runtime {
 namespace {
+// The graph is not replayed any more if its capture is dropped in these steps in a row.
+constexpr size_t kMaxInvalidCaptureCount = 3;
+
 bool InputDataNoNeedCopy(DeviceTensor *input_device_tensor, DeviceTensorPtr node_device_tensor) {
   if (TEST_FLAG(node_device_tensor->flag(), device::kDeviceAddressFlagNotUsed) || (input_device_tensor == nullptr) ||
       (input_device_tensor->GetPtr() == node_device_tensor->GetPtr())) {
@@ -112,6 +115,7 @@ void SuperKernelActor::Init() {
     BuildKernelActors();
     ParseInputIndex();
     CalcRefCount();
+    enable_kbk_sub_graph_replay_ = EnableKbkSubGraphReplay() && CanReplayGraph();
   }
 }
 
@@ -269,12 +273,37 @@ void SuperKernelActor::RunGraphKernelByKernel(OpContext<DeviceTensor> *const con
     already_fetch_persistent_device_tensor_ = true;
   }
 
+  if (is_graph_captured_ && !IsCaptureValid()) {
+    DropCapture();
+  }
+
   // 2. Allocate somas memory for graph
   if ((somas_info_ != nullptr) && (somas_info_->whole_block_size_ != 0)) {
     MemoryManagerActor::GetInstance()->AllocateSomasMemory(somas_info_, device_contexts_[0], context, GetAID());
   }
 
   // 3. Launch all kernels
+  if (is_graph_captured_) {
+    // The kernels of other actors may be still in the launch queue.
+    if (!WaitRuntimePipelineFinish(context)) {
+      MS_LOG(INFO) << "Run failed and early stop.";
+      return;
+    }
+    ReplayGraph(context);
+  } else if (!LaunchAllKernels(context)) {
+    return;
+  }
+
+  // 4. Free somas memory for graph
+  if ((somas_info_ != nullptr) && (somas_info_->whole_block_size_ != 0)) {
+    MemoryManagerActor::GetInstance()->FreeSomasMemory(somas_info_, device_contexts_[0], context, GetAID());
+  }
+
+  // Free input data.
+  PostRun(context);
+}
+
+bool SuperKernelActor::LaunchAllKernels(OpContext<DeviceTensor> *const context) {
   size_t kernel_num = kernel_actors_.size();
   const auto &execution_order = graph_->execution_order();
   for (size_t i = 0; i < kernel_num; i++) {
@@ -304,7 +333,7 @@ void SuperKernelActor::RunGraphKernelByKernel(OpContext<DeviceTensor> *const con
         MS_LOG(DEBUG) << "Begin wait runtime pipeline for kernel: " << kernel_actor->kernel_->fullname_with_scope();
         if (!WaitRuntimePipelineFinish(context)) {
           MS_LOG(INFO) << "Run failed and early stop for kernel: " << kernel_actor->kernel_->fullname_with_scope();
-          return;
+          return false;
         }
         MS_LOG(DEBUG) << "End wait runtime pipeline for kernel: " << kernel_actor->kernel_->fullname_with_scope();
       }
@@ -319,14 +348,132 @@ void SuperKernelActor::RunGraphKernelByKernel(OpContext<DeviceTensor> *const con
   }
 
   WaitRuntimePipelineFinish(context);
+  if (enable_kbk_sub_graph_replay_ && !IsRunningFailed(context)) {
+    CaptureGraph();
+  }
+  return true;
+}
 
-  // 4. Free somas memory for graph
-  if ((somas_info_ != nullptr) && (somas_info_->whole_block_size_ != 0)) {
-    MemoryManagerActor::GetInstance()->FreeSomasMemory(somas_info_, device_contexts_[0], context, GetAID());
+bool SuperKernelActor::CanReplayGraph() const {
+  MS_EXCEPTION_IF_NULL(graph_);
+  MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  if ((device_contexts_[0]->GetDeviceType() != device::DeviceType::kCPU) || graph_->is_dynamic_shape() ||
+      (debug_aid_ != nullptr) || (recorder_aid_ != nullptr)) {
+    MS_LOG(INFO) << "Not replay the graph: " << graph_->graph_id() << " for actor: " << GetAID().Name()
+                 << ", is dynamic shape: " << graph_->is_dynamic_shape();
+    return false;
   }
 
-  // Free input data.
-  PostRun(context);
+  for (const auto &kernel_actor : kernel_actors_) {
+    if (kernel_actor == nullptr) {
+      continue;
+    }
+    // The launch of these kernels depends on the infer, memory management or ref copy of each step.
+    if (kernel_actor->has_dynamic_ || kernel_actor->has_computed_depend_input_ ||
+        kernel_actor->kernel_mod_->need_user_data() || !kernel_actor->memory_alloc_list_.empty() ||
+        !kernel_actor->memory_free_list_.empty() || !kernel_actor->modifiable_ref_input_indexes_.empty() ||
+        !kernel_actor->modifiable_ref_output_indexes_.empty() || IsSkippedLaunch(kernel_actor->kernel_, nullptr)) {
+      MS_LOG(INFO) << "Not replay the graph: " << graph_->graph_id() << " for actor: " << GetAID().Name()
+                   << ", because of the kernel: " << kernel_actor->kernel_->fullname_with_scope();
+      return false;
+    }
+  }
+  MS_LOG(INFO) << "Enable replay the graph: " << graph_->graph_id() << " for actor: " << GetAID().Name();
+  return true;
+}
+
+void SuperKernelActor::CaptureGraph() {
+  captured_kernel_launches_.clear();
+  for (const auto &kernel_actor : kernel_actors_) {
+    if ((kernel_actor == nullptr) || kernel_actor->is_launch_skipped_) {
+      continue;
+    }
+    (void)captured_kernel_launches_.emplace_back(CapturedKernelLaunch{
+      kernel_actor.get(), kernel_actor->kernel_mod_, kernel_actor->input_kernel_tensors_,
+      kernel_actor->workspace_kernel_tensors_, kernel_actor->output_kernel_tensors_, kernel_actor->stream_,
+      !kernel_actor->somas_graph_output_indexes_.empty()});
+  }
+
+  size_t input_num = input_device_tensors_.size();
+  captured_input_device_tensors_ = input_device_tensors_;
+  captured_input_kernel_tensors_.assign(input_num, nullptr);
+  captured_input_shapes_.assign(input_num, ShapeVector());
+  for (size_t i = 0; i < input_num; ++i) {
+    const auto input_device_tensor = input_device_tensors_[i];
+    if ((input_device_tensor == nullptr) || (input_device_tensor->kernel_tensor() == nullptr)) {
+      continue;
+    }
+    captured_input_kernel_tensors_[i] = input_device_tensor->kernel_tensor().get();
+    captured_input_shapes_[i] = input_device_tensor->kernel_tensor()->GetShapeVector();
+  }
+  captured_somas_base_address_ = (somas_info_ != nullptr) ? somas_info_->base_address_ : nullptr;
+  is_graph_captured_ = true;
+  MS_LOG(INFO) << "Capture " << captured_kernel_launches_.size() << " kernel launches of graph: " << graph_->graph_id()
+               << " for actor: " << GetAID().Name();
+}
+
+bool SuperKernelActor::IsCaptureValid() const {
+  for (size_t i = 0; i < input_device_tensors_.size(); ++i) {
+    const auto input_device_tensor = input_device_tensors_[i];
+    if (input_device_tensor != captured_input_device_tensors_[i]) {
+      return false;
+    }
+    if ((input_device_tensor == nullptr) || (input_device_tensor->kernel_tensor() == nullptr)) {
+      continue;
+    }
+    // The captured kernel tensors read the device address at launch, so the input may be reallocated in place.
+    if ((input_device_tensor->kernel_tensor().get() != captured_input_kernel_tensors_[i]) ||
+        (input_device_tensor->kernel_tensor()->GetShapeVector() != captured_input_shapes_[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SuperKernelActor::DropCapture() {
+  is_graph_captured_ = false;
+  captured_kernel_launches_.clear();
+  // The graph whose input is changed before every replay is launched by the kernel actors instead of recapturing.
+  if (++invalid_capture_count_ >= kMaxInvalidCaptureCount) {
+    enable_kbk_sub_graph_replay_ = false;
+    MS_LOG(INFO) << "The graph input is changed in " << invalid_capture_count_
+                 << " steps after capturing, disable replay the graph: " << graph_->graph_id()
+                 << " for actor: " << GetAID().Name();
+    return;
+  }
+  MS_LOG(INFO) << "The graph input is changed, recapture the graph: " << graph_->graph_id()
+               << " for actor: " << GetAID().Name();
+}
+
+void SuperKernelActor::ReplayGraph(OpContext<DeviceTensor> *const context) {
+  ProfilerRecorder profiler(ProfilerModule::kKernel, ProfilerEvent::kGraphLaunch, GetAID().Name());
+  // The somas block may be allocated at another address, and the merged blocks are not captured, so the somas memory
+  // of kernels need be set again in these cases.
+  void *somas_base_address = (somas_info_ != nullptr) ? somas_info_->base_address_ : nullptr;
+  bool is_somas_address_changed =
+    (somas_base_address == nullptr) || (somas_base_address != captured_somas_base_address_);
+  device_contexts_[0]->device_res_manager_->BindDeviceToCurrentThread(false);
+  for (const auto &launch : captured_kernel_launches_) {
+    if (is_somas_address_changed || launch.has_somas_graph_output) {
+      launch.kernel_actor->SetSomasMemory(context);
+    }
+    bool ret = false;
+    try {
+      ret = launch.kernel_mod->Launch(launch.inputs, launch.workspaces, launch.outputs, launch.stream);
+    } catch (const std::exception &e) {
+      MsException::Instance().SetException();
+      MS_LOG(ERROR) << "Failed to replay kernel: " << launch.kernel_actor->kernel_->fullname_with_scope()
+                    << " and catch exception: " << e.what();
+      SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), e.what());
+    }
+    if (!ret) {
+      std::string error_info =
+        "#umsg#Kernel error:#umsg#Launch kernel failed: " + launch.kernel_actor->kernel_->fullname_with_scope();
+      SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+    }
+  }
+  captured_somas_base_address_ = somas_base_address;
+  invalid_capture_count_ = 0;
 }
 
 void SuperKernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
@@ -42,6 +42,18 @@ struct OutputMemoryInfo {
   std::string node_full_name;
 };
 
+// The kernel launch captured by the super kernel actor, the kernel tensors keep the resolved device addresses.
+struct CapturedKernelLaunch {
+  KernelActor *kernel_actor;
+  KernelMod *kernel_mod;
+  std::vector<KernelTensor *> inputs;
+  std::vector<KernelTensor *> workspaces;
+  std::vector<KernelTensor *> outputs;
+  void *stream;
+  // The graph output in somas is released by the ref count after the step, so its address needs to be set every step.
+  bool has_somas_graph_output;
+};
+
 // The Super kernel actor is used to represent the sink executing of graph which is the combination of kernels.
 class SuperKernelActor : public DebugAwareActor {
  public:
@@ -90,9 +102,20 @@ class SuperKernelActor : public DebugAwareActor {
   bool CopyInputDataPersistedHandle(const DeviceContext *device_context, DeviceTensor *input_device_tensor,
                                     const DeviceTensorPtr &node_device_tensor, size_t i);
   void RunGraphKernelByKernel(OpContext<DeviceTensor> *const context);
+  // Launch the kernels by kernel actors, return false if the pipeline is stopped by failure.
+  bool LaunchAllKernels(OpContext<DeviceTensor> *const context);
 
   void FetchPersistentDeviceTensor();
 
+  // Capture and replay the kernel launches of the static shape sub graph, which skips the actor messages, the input
+  // setting and the memory management of kernel actors in the later steps.
+  bool CanReplayGraph() const;
+  void CaptureGraph();
+  // The capture is invalid when the device tensor, kernel tensor or shape of graph input is changed.
+  bool IsCaptureValid() const;
+  void DropCapture();
+  void ReplayGraph(OpContext<DeviceTensor> *const context);
+
   friend class GraphScheduler;
   KernelGraphPtr graph_;
 
@@ -123,6 +146,17 @@ class SuperKernelActor : public DebugAwareActor {
   mindspore::HashMap<AnfNode *, std::vector<std::pair<size_t, size_t>>> kernel_input_to_graph_input_indices_;
   SomasInfo *somas_info_;
 
+  bool enable_kbk_sub_graph_replay_{false};
+  bool is_graph_captured_{false};
+  std::vector<CapturedKernelLaunch> captured_kernel_launches_;
+  // The graph input device tensors, kernel tensors and shapes when the graph is captured.
+  std::vector<DeviceTensor *> captured_input_device_tensors_;
+  std::vector<KernelTensor *> captured_input_kernel_tensors_;
+  std::vector<ShapeVector> captured_input_shapes_;
+  void *captured_somas_base_address_{nullptr};
+  // The times the capture is dropped in a row before it is replayed.
+  size_t invalid_capture_count_{0};
+
   AID kernel_async_infer_aid_;
   AID kernel_async_resize_aid_;
   AID kernel_async_launch_aid_;
@@ -669,7 +669,7 @@ void GraphScheduler::SpawnMultiPipelineActor(ActorSet *const actor_set, ActorThr
 
     auto &kernel_async_launch_actor = KernelAsyncLaunchActor::GetInstance();
     MS_EXCEPTION_IF_NULL(kernel_async_launch_actor);
-    (void)actor_manager->Spawn(kernel_async_launch_actor, false);
+    (void)actor_manager->Spawn(kernel_async_launch_actor, false, true);
     already_spawn_kernel_async_launch_actor_ = true;
 
     kernel_async_launch_actor->Initialize();
@@ -691,11 +691,11 @@ void GraphScheduler::SpawnMultiPipelineActor(ActorSet *const actor_set, ActorThr
 
     auto &kernel_async_infer_actor = KernelAsyncInferActor::GetInstance();
     MS_EXCEPTION_IF_NULL(kernel_async_infer_actor);
-    (void)actor_manager->Spawn(kernel_async_infer_actor, false);
+    (void)actor_manager->Spawn(kernel_async_infer_actor, false, true);
 
     auto &kernel_async_resize_actor = KernelAsyncResizeActor::GetInstance();
     MS_EXCEPTION_IF_NULL(kernel_async_resize_actor);
-    (void)actor_manager->Spawn(kernel_async_resize_actor, false);
+    (void)actor_manager->Spawn(kernel_async_resize_actor, false, true);
 
     already_spawn_kernel_async_infer_resize_actor_ = true;
 
@@ -841,6 +841,9 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<std::vecto
     MS_LOG(EXCEPTION) << op_context.error_info_;
   }
 
+  if (ActorDispatcher::enable_async_launch_kernel() && IS_OUTPUT_ON(mindspore::kInfo)) {
+    RuntimePipelineStats::GetInstance().DumpAndClear(actor_set->name_);
+  }
   ActorDispatcher::set_enable_async_launch_kernel(false);
   ActorDispatcher::set_enable_runtime_multi_pipeline(false);
   MsException::Instance().CheckException();
@@ -3171,6 +3174,7 @@ bool GraphScheduler::HaveRpcActors(const ActorSet *actor_set) const {
 bool GraphScheduler::EnableRuntimePipeline() {
   static const char kEnableRuntimePipeline[] = "MS_ENABLE_RUNTIME_PIPELINE";
   static bool disable = common::GetEnv(kEnableRuntimePipeline) == "0";
+  static bool enable = common::GetEnv(kEnableRuntimePipeline) == "1";
   if (disable) {
     return false;
   }
@@ -3181,7 +3185,9 @@ bool GraphScheduler::EnableRuntimePipeline() {
     return false;
   }
 
-  if (ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice) {
+  // The threads of the pipeline stages take cores from the cpu kernels, so the cpu backend only enables the pipeline by
+  // MS_ENABLE_RUNTIME_PIPELINE=1.
+  if (ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice && !enable) {
     return false;
   }
 
@@ -16,8 +16,10 @@
 #include "runtime/graph_scheduler/mem_swap_scheduler.h"
 
 #include <algorithm>
+#include <iomanip>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <set>
 #include <utility>
@@ -27,9 +29,12 @@
 #include "include/backend/distributed/collective/collective_manager.h"
 #include "include/common/utils/comm_manager.h"
 #include "runtime/device/gsm/swap_strategy_builder.h"
+#include "runtime/device/gsm/swap_cost_model.h"
 #include "runtime/device/memory_offload_strategy.h"
 #include "runtime/graph_scheduler/scheduler_helper.h"
 #include "runtime/graph_scheduler/control_node_parser.h"
+#include "utils/file_utils.h"
+#include "utils/shape_utils.h"
 
 namespace mindspore {
 namespace runtime {
@@ -37,6 +42,8 @@ constexpr size_t kFirstVirtualNode = 0;
 constexpr size_t kSecondVirtualNodeOffset = 1;
 constexpr char kOffloadTargetCPU[] = "cpu";
 constexpr char kOffloadTargetDisk[] = "disk";
+constexpr char kSwapCostProfilePrefix[] = "swap_cost_profile_";
+constexpr int kGraphHashWidth = 16;
 namespace {
 constexpr char HCCL_WORLD_GROUP[] = "hccl_world_group";
 constexpr char NCCL_WORLD_GROUP[] = "nccl_world_group";
@@ -189,6 +196,7 @@ std::shared_ptr<device::SwapContext> GetSwapContext() {
   }
   swap_context->cpu_mem_size_ = static_cast<size_t>(cpu_mem_size * offload_context->cpu_ratio());
   swap_context->disk_mem_size_ = offload_context->offload_disk_size();
+  swap_context->compress_host_ = offload_context->enable_host_compression();
   MS_LOG(INFO) << "Hbm size:" << swap_context->hbm_mem_size_ << ", cpu memory size:" << swap_context->cpu_mem_size_
                << ", disk size:" << swap_context->disk_mem_size_ << " to generate the offload strategy";
   if (!offload_context->auto_offload()) {
@@ -201,6 +209,57 @@ std::shared_ptr<device::SwapContext> GetSwapContext() {
   }
   return swap_context;
 }
+
+// The hash of the kernels of the graph in execution order and their shapes and types, the graph id of the same network
+// differs between the runs and the costs measured on another graph are useless.
+std::string GetGraphHash(const KernelGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  std::ostringstream buf;
+  for (const auto &kernel : graph->execution_order()) {
+    buf << common::AnfAlgo::GetCNodeName(kernel) << "(";
+    for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(kernel); ++i) {
+      buf << ShapeVectorToString(common::AnfAlgo::GetPrevNodeOutputInferShape(kernel, i));
+    }
+    buf << ")";
+    for (size_t i = 0; i < AnfAlgo::GetOutputTensorNum(kernel); ++i) {
+      buf << TypeIdToString(common::AnfAlgo::GetOutputInferDataType(kernel, i))
+          << ShapeVectorToString(common::AnfAlgo::GetOutputInferShape(kernel, i));
+    }
+    buf << ";";
+  }
+  std::ostringstream hash;
+  hash << std::hex << std::setw(kGraphHashWidth) << std::setfill('0') << std::hash<std::string>{}(buf.str());
+  return hash.str();
+}
+
+// The costs measured in the former runs are saved in the offload path, empty if the offload path is invalid.
+std::string GetSwapCostProfileFile(const std::string &graph_hash, const DeviceContext *device_context) {
+  MS_EXCEPTION_IF_NULL(device_context);
+  const auto &offload_context = OffloadContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(offload_context);
+  const auto real_dir = FileUtils::GetRealPath(offload_context->offload_path().c_str());
+  if (!real_dir.has_value()) {
+    MS_LOG(INFO) << "Invalid offload path[" << offload_context->offload_path() << "], skip the swap cost profile.";
+    return "";
+  }
+  const auto device_id = device_context->device_context_key().device_id_;
+  return real_dir.value() + "/" + kSwapCostProfilePrefix + std::to_string(device_id) + "_" + graph_hash + ".json";
+}
+
+// The nodes of the strategy which the action runs after and before.
+std::pair<size_t, size_t> GetActionNodes(size_t action_id, const std::shared_ptr<device::SwapStrategy> &strategy) {
+  MS_EXCEPTION_IF_NULL(strategy);
+  std::pair<size_t, size_t> nodes{0, 0};
+  for (const auto &link : strategy->links_) {
+    MS_EXCEPTION_IF_NULL(link);
+    if (link->to_ == action_id) {
+      nodes.first = link->from_;
+    } else if (link->from_ == action_id) {
+      nodes.second = link->to_;
+    }
+  }
+  return nodes;
+}
 }  // namespace
 
 void MemSwapScheduler::GetRealParameters(const KernelGraphPtr &graph, const ControlNodeParserPtr &parser) {
@@ -307,6 +366,11 @@ void MemSwapScheduler::BuildSwapActorForGraph(const KernelGraphPtr &graph, const
   }
   device::SwapStrategyBuilder builder;
   const auto &swap_context = GetSwapContext();
+  const auto &graph_hash = GetGraphHash(graph);
+  const auto &profile_file = GetSwapCostProfileFile(graph_hash, device_context);
+  if (!profile_file.empty()) {
+    swap_context->cost_profile_ = device::LoadSwapCostProfile(profile_file, graph_hash);
+  }
   auto swap_strategy = builder.Build(graph, swap_context);
   MS_EXCEPTION_IF_NULL(swap_strategy);
   MS_LOG(INFO) << "Graph " << graph->graph_id() << ": " << swap_strategy->GetStatisticInfo();
@@ -320,6 +384,10 @@ void MemSwapScheduler::BuildSwapActorForGraph(const KernelGraphPtr &graph, const
 
   static size_t swap_actor_num = 0;
   const auto graph_id = graph->graph_id();
+  const auto &cost_recorder =
+    std::make_shared<device::SwapCostRecorder>(graph_id, graph_hash, swap_strategy->kernel_num_,
+                                               swap_strategy->actions_.size(), swap_strategy->predicted_stall_,
+                                               profile_file);
   for (const auto &iter : swap_strategy->actions_) {
     // Fixed DeviceAddress in MemorySwapActor.
     std::vector<DeviceTensor *> fixed_device_address;
@@ -335,6 +403,8 @@ void MemSwapScheduler::BuildSwapActorForGraph(const KernelGraphPtr &graph, const
     const string swap_actor_name = kMemSwapActorNamePrefix + std::to_string(swap_actor_num++);
     auto swap_actor = std::make_shared<MemorySwapActor>(swap_actor_name, recorder_aid_, kDefaultStreamIndex,
                                                         fixed_device_address, device_context, actor_actions);
+    const auto &action_nodes = GetActionNodes(iter.first, swap_strategy);
+    swap_actor->set_cost_recorder(cost_recorder, action_nodes.first, action_nodes.second);
     (void)actors->emplace_back(swap_actor);
     // Link data arrow from EntranceActor to MemorySwapActor later in Link
     data_dependency_[graph_id][swap_actor].swap(real_parameter_index);
@@ -30,6 +30,7 @@
 namespace mindspore {
 namespace runtime {
 constexpr size_t kThreadNameThreshold = 15;
+constexpr size_t kMaxWaitSpinCount = 2000;
 thread_local kThreadWaitLevel current_level_{kThreadWaitLevel::kLevelUnknown};
 
 AsyncRQueue::~AsyncRQueue() {
@@ -133,7 +134,10 @@ void AsyncRQueue::Wait() {
   }
 
   MS_LOG(DEBUG) << "Start to wait thread " << name_;
-  while (!tasks_queue_.IsEmpty()) {
+  for (size_t spin = 0; !tasks_queue_.IsEmpty(); ++spin) {
+    if (spin >= kMaxWaitSpinCount) {
+      std::this_thread::yield();
+    }
   }
   MsException::Instance().CheckException();
   MS_LOG(DEBUG) << "End to wait thread " << name_;
@@ -19,53 +19,94 @@
 
 #include <atomic>
 #include <array>
+#include <condition_variable>
 #include <cstddef>
+#include <mutex>
 #include <thread>
 
 namespace mindspore {
-// A simple ring buffer (or circular queue) with atomic operations for
-// thread-safe enqueue, dequeue, and check for emptiness.
-// RingQueue is only applicable to single-producer and single-consumer scenarios.
+// A bounded ring buffer (or circular queue) with atomic operations for thread-safe enqueue, dequeue, and check for
+// emptiness. RingQueue is applicable to multi-producer and single-consumer scenarios.
+// Each producer takes a ticket and publishes its value by the sequence of the slot, so the producers do not lock each
+// other. The consumer spins for a while when the queue is empty and then sleeps, the producers only wake up a sleeping
+// consumer, so the values pushed while the consumer is running are taken without any system call.
 template <typename T, std::size_t Capacity>
 class RingQueue {
  public:
-  RingQueue() : head_(0), tail_(0) {}
+  RingQueue() : head_(0), tail_(0) {
+    for (std::size_t i = 0; i < Capacity; ++i) {
+      buffer_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
 
   void Enqueue(const T &value) {
-    std::size_t current_tail = tail_.load(std::memory_order_relaxed);
-    std::size_t next_tail = (current_tail + 1) % Capacity;
-
-    while (next_tail == head_.load(std::memory_order_acquire)) {
+    std::size_t ticket = tail_.fetch_add(1, std::memory_order_acq_rel);
+    auto &slot = buffer_[ticket % Capacity];
+    // Wait for the consumer to release the slot when the queue is full.
+    for (std::size_t spin = 0; slot.sequence.load(std::memory_order_acquire) != ticket; ++spin) {
+      if (spin >= kMaxSpinCount) {
+        std::this_thread::yield();
+      }
     }
 
-    buffer_[current_tail] = value;
-    tail_.store(next_tail, std::memory_order_release);
+    slot.value = value;
+    // The publishing and the sleeping flag are sequentially consistent, so either the consumer sees the value before it
+    // sleeps or the producer sees it sleeping.
+    slot.sequence.store(ticket + 1, std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_seq_cst)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cond_.notify_one();
+    }
   }
 
   void Dequeue() {
     std::size_t current_head = head_.load(std::memory_order_relaxed);
-    while (current_head == tail_.load(std::memory_order_acquire)) {
-    }
+    auto &slot = WaitPublished(current_head);
 
     // Free memory when task is finished.
-    buffer_[current_head] = nullptr;
-    head_.store((current_head + 1) % Capacity, std::memory_order_release);
+    slot.value = nullptr;
+    slot.sequence.store(current_head + Capacity, std::memory_order_release);
+    head_.store(current_head + 1, std::memory_order_release);
   }
 
   const T &Head() {
     std::size_t current_head = head_.load(std::memory_order_acquire);
-    while (current_head == tail_.load(std::memory_order_acquire)) {
-    }
-    return buffer_[current_head];
+    return WaitPublished(current_head).value;
   }
 
   bool IsEmpty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
 
  private:
-  std::array<T, Capacity> buffer_;
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  Slot &WaitPublished(std::size_t ticket) {
+    auto &slot = buffer_[ticket % Capacity];
+    auto published = [&slot, ticket]() { return slot.sequence.load(std::memory_order_seq_cst) == ticket + 1; };
+    for (std::size_t spin = 0; spin < kMaxSpinCount; ++spin) {
+      if (published()) {
+        return slot;
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.store(true, std::memory_order_seq_cst);
+    cond_.wait(lock, published);
+    sleeping_.store(false, std::memory_order_relaxed);
+    return slot;
+  }
+
+  static constexpr std::size_t kMaxSpinCount = 2000;
+
+  std::array<Slot, Capacity> buffer_;
   // CPU cache line size is 64.
   alignas(64) std::atomic<std::size_t> head_;
   alignas(64) std::atomic<std::size_t> tail_;
+  alignas(64) std::atomic<bool> sleeping_{false};
+  std::mutex mutex_;
+  std::condition_variable cond_;
 };
 }  // namespace mindspore
 
@@ -29,6 +29,7 @@ constexpr char kOffloadPath[] = "./offload/";
 constexpr char kOffloadParam[] = "";
 constexpr size_t kAioBlockSize = 1 << 20;
 constexpr size_t kAioQueueDepth = 1024;
+constexpr char kAioBackend[] = "libaio";
 constexpr size_t kGBToByte = 1024 << 20;
 constexpr float kMemRetentionTate = 0.2f;
 }  // namespace
@@ -94,6 +95,12 @@ void OffloadContext::set_aio_block_size(size_t aio_block_size) { aio_block_size_
 
 void OffloadContext::set_aio_queue_depth(size_t aio_queue_depth) { aio_queue_depth_ = aio_queue_depth; }
 
+void OffloadContext::set_aio_backend(const std::string &aio_backend) { aio_backend_ = aio_backend; }
+
+void OffloadContext::set_enable_host_compression(bool enable_host_compression) {
+  enable_host_compression_ = enable_host_compression;
+}
+
 void OffloadContext::set_enable_pinned_mem(bool enable_pinned_mem) { enable_pinned_mem_ = enable_pinned_mem; }
 
 void OffloadContext::set_auto_offload(bool auto_offload) { auto_offload_ = auto_offload; }
@@ -113,6 +120,8 @@ OffloadContext::OffloadContext()
       enable_aio_(true),
       aio_block_size_(kAioBlockSize),
       aio_queue_depth_(kAioQueueDepth),
+      aio_backend_(kAioBackend),
+      enable_host_compression_(false),
       enable_pinned_mem_(true),
       auto_offload_(true),
       host_mem_block_size_(kGBToByte),
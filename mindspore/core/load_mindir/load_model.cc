@@ -16,14 +16,24 @@
 #include "load_mindir/load_model.h"
 #include <sys/stat.h>
 #include <sys/types.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include <cstring>
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <stack>
 #include <list>
+#include <thread>
 #include <utility>
 #include <nlohmann/json.hpp>
 #include "mindspore/core/ops/structure_ops.h"
@@ -44,6 +54,7 @@
 #include "utils/check_convert_utils.h"
 #include "utils/ms_utils_secure.h"
 #include "abstract/abstract_function.h"
+#include "abstract/utils.h"
 #include "load_mindir/infer_mindir.h"
 #include "include/common/debug/common.h"
 #include "proto/mind_ir.pb.h"
@@ -57,6 +68,10 @@ namespace {
 static constexpr char kConstantValueNode[] = "Constant";
 static constexpr char kQuantParam[] = "quant_param";
 static constexpr char kGraphInputQuantParam[] = "graph_input_quant_param";
+// Map the model and external data files instead of reading them if set to "on".
+static constexpr char kMindIRMmapLoadEnv[] = "MS_DEV_MINDIR_MMAP_LOAD";
+static constexpr size_t kMaxParallelLoadThreadNum = 8;
+static constexpr size_t kMinParallelLoadParameterNum = 16;
 
 enum ParseForm : int {
   FORM_PARSE_TYPE = 0,
@@ -319,6 +334,127 @@ bool CheckModelConfigureInfo(const mind_ir::ModelProto &model_proto) {
   }
   return true;
 }
+
+TypeId GetTensorTypeId(int data_type) {
+  // Do not insert to the map, so that it can be used by several threads.
+  auto iter = kDefaultValueSwitchMap.find(data_type);
+  return iter == kDefaultValueSwitchMap.end() ? kTypeUnknown : iter->second;
+}
+
+// MappedFile maps a file privately, the pages are read from the file when they are accessed at the first time, and
+// writing them does not change the file.
+class MappedFile {
+ public:
+  // Returns nullptr if mapping is not supported or fails.
+  static std::shared_ptr<MappedFile> Map(const std::string &file_name) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    auto fd = open(file_name.c_str(), O_RDONLY);
+    if (fd == -1) {
+      MS_LOG(WARNING) << "Open file " << file_name << " failed, errno is: " << ErrnoToString(errno);
+      return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      (void)close(fd);
+      return nullptr;
+    }
+    const auto size = static_cast<size_t>(file_stat.st_size);
+    auto addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED) {
+      MS_LOG(WARNING) << "Map file " << file_name << " failed, errno is: " << ErrnoToString(errno);
+      return nullptr;
+    }
+    return std::shared_ptr<MappedFile>(new MappedFile(static_cast<uint8_t *>(addr), size));
+#else
+    return nullptr;
+#endif
+  }
+
+  ~MappedFile() {
+#if !defined(_WIN32) && !defined(_WIN64)
+    (void)munmap(data_, size_);
+#endif
+  }
+
+  uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedFile(uint8_t *data, size_t size) : data_(data), size_(size) {}
+  uint8_t *data_;
+  size_t size_;
+};
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+// MappedTensorData borrows the data of a tensor from a mapped file instead of copying it, the file is kept mapped
+// until all the tensors borrowing it are released.
+class MappedTensorData : public tensor::TensorData {
+ public:
+  MappedTensorData(const MappedFilePtr &file, size_t offset, size_t elem_num, size_t elem_size, size_t ndim)
+      : file_(file), offset_(offset), elem_num_(elem_num), elem_size_(elem_size), ndim_(ndim) {}
+  ~MappedTensorData() override = default;
+
+  ssize_t size() const override { return static_cast<ssize_t>(elem_num_); }
+  ssize_t itemsize() const override { return static_cast<ssize_t>(elem_size_); }
+  ssize_t nbytes() const override { return static_cast<ssize_t>(elem_num_ * elem_size_); }
+  ssize_t ndim() const override { return static_cast<ssize_t>(ndim_); }
+  void *data() override { return file_->data() + offset_; }
+  const void *const_data() const override { return file_->data() + offset_; }
+  bool is_sub_data() const override { return false; }
+  bool has_sub_data() const override { return false; }
+  std::string ToString(TypeId type, const ShapeVector &shape, bool use_comma) const override {
+    // Only for display, stringify a copy of the data.
+    tensor::Tensor tensor(type, shape, file_->data() + offset_, elem_num_ * elem_size_);
+    return tensor.data().ToString(type, shape, use_comma);
+  }
+
+ private:
+  MappedFilePtr file_;
+  size_t offset_;
+  size_t elem_num_;
+  size_t elem_size_;
+  size_t ndim_;
+};
+
+// Run task(0) ... task(task_num - 1) on several threads, and rethrow the first exception thrown by the tasks.
+void ParallelRun(size_t task_num, const std::function<void(size_t)> &task) {
+  const size_t thread_num =
+    std::min({kMaxParallelLoadThreadNum, task_num, static_cast<size_t>(std::thread::hardware_concurrency())});
+  if (thread_num <= 1) {
+    for (size_t i = 0; i < task_num; ++i) {
+      task(i);
+    }
+    return;
+  }
+  std::atomic<size_t> next_task{0};
+  std::exception_ptr exception = nullptr;
+  std::mutex exception_mutex;
+  auto worker = [&]() {
+    for (size_t i = next_task++; i < task_num; i = next_task++) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (exception == nullptr) {
+          exception = std::current_exception();
+        }
+        next_task = task_num;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    (void)threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
 }  // namespace
 
 namespace {
@@ -340,6 +476,7 @@ class MSANFModelParser {
   void SetMindIRDecKey(const unsigned char *dec_key) { mindir_dec_key_ = dec_key; }
   void SetMindIRKeySize(size_t size) { mindir_key_size_ = size; }
   void SetMindIRDecMode(const std::string &dec_mode) { mindir_dec_mode_ = dec_mode; }
+  void SetMmapLoad(bool mmap_load) { mmap_load_ = mmap_load; }
 
  private:
   void TrytoBuildCNodeAbstract();
@@ -353,7 +490,8 @@ class MSANFModelParser {
   bool ImportParametersForGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::GraphProto &importProto);
   bool ImportMapParametersForGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::GraphProto &importProto);
   bool ImportNodesForGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::GraphProto &importProto);
-  bool BuildParameterForFuncGraph(const ParameterPtr &node, const mind_ir::TensorProto &parameter_proto);
+  bool BuildParameterForFuncGraph(const ParameterPtr &node, const mind_ir::TensorProto &parameter_proto,
+                                  const tensor::TensorPtr &tensor);
   bool BuildMapParameterFromMapTensorProto(const ParameterPtr &node,
                                            const mind_ir::MapTensorProto &map_parameter_proto);
   abstract::AbstractMapTensorPtr BuildAbstractMapTensorFromAttrProto(const mind_ir::AttributeProto &attr_proto);
@@ -363,6 +501,9 @@ class MSANFModelParser {
   abstract::AbstractScalarPtr BuildAbstractScalar(const mind_ir::AttributeProto &attr_proto) const;
   bool SetValueForTopGraphParameter(const FuncGraphPtr &topGraph, const std::map<std::string, ValuePtr> &weights);
   bool GetTensorDataFromExternal(const mind_ir::TensorProto &tensor_proto, const tensor::TensorPtr &tensor_info);
+  const unsigned char *GetExternalData(const std::string &location);
+  tensor::TensorPtr GenerateMappedTensor(const mind_ir::TensorProto &tensor_proto, TypeId type_id,
+                                         const ShapeVector &shape);
   bool BuildInputForFuncGraph(const ParameterPtr &node, const mind_ir::ValueInfoProto &value_proto);
   abstract::AbstractTensorPtr GetAbsTensorFromTensorProto(const mind_ir::TensorProto &tensor_proto);
   CNodePtr BuildCNodeForFuncGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::NodeProto &node_proto);
@@ -414,6 +555,8 @@ class MSANFModelParser {
   std::string mindir_dec_mode_;
   bool little_endian_ = common::IsLittleByteOrder();
   std::map<std::string, std::unique_ptr<Byte[]>> tenor_data_;
+  bool mmap_load_{false};
+  std::map<std::string, MappedFilePtr> mapped_files_;
   bool is_kernel_graph_{false};
   std::list<std::pair<const CNodePtr, const mind_ir::AttributeProto *>> node_abstract_protos_;
 };
@@ -513,9 +656,14 @@ tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_
     shape.push_back(attr_tensor.dims(i));
   }
   tensor::TensorPtr tensor = nullptr;
+  bool data_mapped = false;
   if (!attr_tensor.has_compression_type() ||
       attr_tensor.compression_type() == mind_ir::TensorProto_CompressionType_NO_COMPRESSION) {
-    tensor = std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape);
+    tensor = GenerateMappedTensor(attr_tensor, GetTensorTypeId(attr_tensor_type), shape);
+    data_mapped = tensor != nullptr;
+    if (!data_mapped) {
+      tensor = std::make_shared<tensor::Tensor>(GetTensorTypeId(attr_tensor_type), shape);
+    }
   } else {
     auto compression_type = static_cast<TensorCompressionType>(static_cast<int>(attr_tensor.compression_type()));
     size_t data_size = 0;
@@ -525,7 +673,7 @@ tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_
       data_size = LongToSize(attr_tensor.external_data().length());
     }
     tensor =
-      std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape, data_size, compression_type);
+      std::make_shared<tensor::Tensor>(GetTensorTypeId(attr_tensor_type), shape, data_size, compression_type);
   }
 
   auto quantization_param_vector = GenerateQuantizationParam(attr_tensor);
@@ -542,6 +690,8 @@ tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_
       MS_LOG(ERROR) << "Failed to copy data from tensor proto.";
       return nullptr;
     }
+  } else if (data_mapped) {
+    MS_LOG(DEBUG) << "Tensor borrows the data of mapped file " << attr_tensor.external_data().location();
   } else if (attr_tensor.has_external_data()) {
     auto ret = GetTensorDataFromExternal(attr_tensor, tensor);
     if (!ret) {
@@ -720,7 +870,8 @@ abstract::AbstractTensorPtr MSANFModelParser::GetAbsTensorFromTensorProto(const
 }
 
 bool MSANFModelParser::BuildParameterForFuncGraph(const ParameterPtr &node,
-                                                  const mind_ir::TensorProto &parameter_proto) {
+                                                  const mind_ir::TensorProto &parameter_proto,
+                                                  const tensor::TensorPtr &tensor) {
   MS_EXCEPTION_IF_NULL(node);
 
   if (!parameter_proto.has_name()) {
@@ -737,7 +888,6 @@ bool MSANFModelParser::BuildParameterForFuncGraph(const ParameterPtr &node,
   param_info->set_name(debug_info_name);
 
   MS_LOG(DEBUG) << "Load parameter name: " << unique_name;
-  auto tensor = GenerateTensorPtrFromTensorProto(parameter_proto);
   if (tensor == nullptr) {
     MS_LOG(ERROR) << "Build tensor failed from the parameter proto.";
     return false;
@@ -927,58 +1077,106 @@ bool MSANFModelParser::BuildMapParameterFromMapTensorProto(const ParameterPtr &n
   return true;
 }
 
+const unsigned char *MSANFModelParser::GetExternalData(const std::string &location) {
+  auto it = tenor_data_.find(location);
+  if (it != tenor_data_.end()) {
+    return it->second.get();
+  }
+  auto mapped_iter = mapped_files_.find(location);
+  if (mapped_iter != mapped_files_.end()) {
+    return mapped_iter->second->data();
+  }
+  constexpr Byte is_little_endian = 1;
+  constexpr int byte_order_index = 0;
+  std::string file = mindir_path_ + "/" + location;
+  if (mindir_dec_key_ != nullptr) {
+    size_t plain_len;
+    auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
+    if (plain_data == nullptr) {
+      MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
+      return nullptr;
+    }
+    const unsigned char *data = plain_data.get();
+    (void)tenor_data_.emplace(location, std::move(plain_data));
+    return data;
+  }
+  if (mmap_load_) {
+    auto mapped_file = MappedFile::Map(file);
+    if (mapped_file != nullptr) {
+      // if byte order is not same return nullptr
+      if ((mapped_file->data()[byte_order_index] == is_little_endian) ^ little_endian()) {
+        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+        return nullptr;
+      }
+      (void)mapped_files_.emplace(location, mapped_file);
+      return mapped_file->data();
+    }
+    MS_LOG(WARNING) << "Map file '" << file << "' failed, read it instead.";
+  }
+  // Read file
+  std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
+  if (!fid) {
+    MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
+  }
+  (void)fid.seekg(0, std::ios_base::end);
+  size_t file_size = static_cast<size_t>(fid.tellg());
+  fid.clear();
+  (void)fid.seekg(0);
+  std::unique_ptr<char[]> plain_data(new (std::nothrow) char[file_size]);
+  if (plain_data == nullptr) {
+    MS_LOG(ERROR) << "Failed to create file buffer, file size: " << file_size << " bytes";
+    return nullptr;
+  }
+  (void)fid.read(plain_data.get(), SizeToLong(file_size));
+  fid.close();
+  // if byte order is not same return nullptr
+  if ((plain_data[byte_order_index] == is_little_endian) ^ little_endian()) {
+    MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+    return nullptr;
+  }
+  const auto *data = reinterpret_cast<const unsigned char *>(plain_data.get());
+  (void)tenor_data_.emplace(location, std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
+  return data;
+}
+
+tensor::TensorPtr MSANFModelParser::GenerateMappedTensor(const mind_ir::TensorProto &tensor_proto, TypeId type_id,
+                                                         const ShapeVector &shape) {
+  if (!mmap_load_ || tensor_proto.has_raw_data() || !tensor_proto.has_external_data()) {
+    return nullptr;
+  }
+  const auto &external_data = tensor_proto.external_data();
+  if (GetExternalData(external_data.location()) == nullptr) {
+    return nullptr;
+  }
+  auto mapped_iter = mapped_files_.find(external_data.location());
+  if (mapped_iter == mapped_files_.end()) {
+    return nullptr;
+  }
+  const auto &mapped_file = mapped_iter->second;
+  const size_t elem_size = abstract::TypeIdSize(type_id);
+  const size_t elem_num = SizeOf(shape);
+  const auto offset = LongToSize(external_data.offset());
+  // Copy the data if it is not complete or aligned in the file.
+  if (elem_size == 0 || elem_num == 0 || offset % elem_size != 0 ||
+      LongToSize(external_data.length()) != elem_num * elem_size || offset > mapped_file->size() ||
+      mapped_file->size() - offset < elem_num * elem_size) {
+    return nullptr;
+  }
+  auto tensor_data = std::make_shared<MappedTensorData>(mapped_file, offset, elem_num, elem_size, shape.size());
+  return std::make_shared<tensor::Tensor>(type_id, shape, tensor_data);
+}
+
 bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &tensor_proto,
                                                  const tensor::TensorPtr &tensor_info) {
   if (!tensor_proto.has_external_data()) {
     return false;
   }
-  const unsigned char *data = nullptr;
-  auto it = tenor_data_.find(tensor_proto.external_data().location());
-  if (it != tenor_data_.end()) {
-    data = it->second.get();
-  } else {
-    std::string file = mindir_path_ + "/" + tensor_proto.external_data().location();
-    if (mindir_dec_key_ != nullptr) {
-      size_t plain_len;
-      auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
-      if (plain_data == nullptr) {
-        MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
-        return false;
-      }
-      data = plain_data.get();
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(), std::move(plain_data));
-    } else {
-      // Read file
-      std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
-      if (!fid) {
-        MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
-      }
-      (void)fid.seekg(0, std::ios_base::end);
-      size_t file_size = static_cast<size_t>(fid.tellg());
-      fid.clear();
-      (void)fid.seekg(0);
-      std::unique_ptr<char[]> plain_data(new (std::nothrow) char[file_size]);
-      if (plain_data == nullptr) {
-        MS_LOG(ERROR) << "Failed to create file buffer, file size: " << file_size << " bytes";
-        return false;
-      }
-      constexpr Byte is_little_endian = 1;
-      constexpr int byte_order_index = 0;
-      (void)fid.read(plain_data.get(), SizeToLong(file_size));
-      fid.close();
-      // if byte order is not same return false
-      if ((plain_data[byte_order_index] == is_little_endian) ^ little_endian()) {
-        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
-        return false;
-      }
-      data = reinterpret_cast<const unsigned char *>(plain_data.get());
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(),
-                                std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
-    }
+  const unsigned char *data = GetExternalData(tensor_proto.external_data().location());
+  if (data == nullptr) {
+    return false;
   }
   auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor_info->data_c());
   MS_EXCEPTION_IF_NULL(tensor_data_buf);
-  MS_EXCEPTION_IF_NULL(data);
 
   if (tensor_info->data().nbytes() == 0 || tensor_proto.external_data().length() == 0) {
     // no need to copy data
@@ -1079,13 +1277,41 @@ bool MSANFModelParser::ImportParametersForGraph(const FuncGraphPtr &outputFuncGr
   }
 
   MS_LOG(INFO) << "All Parameters size is: " << importProto.parameter_size();
+  std::vector<int> parameter_indexes;
+  bool parallel = importProto.parameter_size() >= SizeToInt(kMinParallelLoadParameterNum);
   for (int i = 0; i < importProto.parameter_size(); ++i) {
     const mind_ir::TensorProto &parameter_proto = importProto.parameter(i);
     if (is_kernel_graph_ && anfnode_build_map_.count(parameter_proto.name()) > 0) {
       continue;
     }
-    if (!BuildParameterForFuncGraph(outputFuncGraph->add_parameter(), parameter_proto)) {
-      MS_LOG(ERROR) << "Build parameter for funcgraph fail at index: " << i;
+    (void)parameter_indexes.emplace_back(i);
+    // Read or map the external data ahead, so generating the tensors does not change the parser.
+    if (parameter_proto.has_external_data() && GetExternalData(parameter_proto.external_data().location()) == nullptr) {
+      MS_LOG(ERROR) << "Failed to get external data of parameter " << parameter_proto.name();
+      return false;
+    }
+    // Parsing quantization params builds values by the parser.
+    parallel = parallel && parameter_proto.quant_params_size() == 0;
+  }
+  // Generating the tensors copies the data of parameters, which runs in parallel for large models.
+  std::vector<tensor::TensorPtr> tensors(parameter_indexes.size());
+  auto generate_tensor = [this, &importProto, &parameter_indexes, &tensors](size_t index) {
+    tensors[index] = GenerateTensorPtrFromTensorProto(importProto.parameter(parameter_indexes[index]));
+  };
+  if (parallel) {
+    ParallelRun(parameter_indexes.size(), generate_tensor);
+  } else {
+    for (size_t index = 0; index < parameter_indexes.size(); ++index) {
+      generate_tensor(index);
+    }
+  }
+  for (size_t index = 0; index < parameter_indexes.size(); ++index) {
+    const mind_ir::TensorProto &parameter_proto = importProto.parameter(parameter_indexes[index]);
+    if (is_kernel_graph_ && anfnode_build_map_.count(parameter_proto.name()) > 0) {
+      continue;
+    }
+    if (!BuildParameterForFuncGraph(outputFuncGraph->add_parameter(), parameter_proto, tensors[index])) {
+      MS_LOG(ERROR) << "Build parameter for funcgraph fail at index: " << parameter_indexes[index];
       return false;
     }
   }
@@ -2547,7 +2773,22 @@ bool get_all_files(const std::string &dir_in, std::vector<std::string> *files) {
 
 int endsWith(const string s, const string sub) { return s.rfind(sub) == (s.length() - sub.length()) ? 1 : 0; }
 
+bool MmapLoadEnabled(const MindIRLoader *loader) {
+  return loader->mmap_load() || common::GetEnv(kMindIRMmapLoadEnv) == "on";
+}
+
 bool ParseModelProto(mind_ir::ModelProto *model, const std::string &path, const MindIRLoader *loader) {
+  if (loader->dec_key() == nullptr && MmapLoadEnabled(loader)) {
+    // Parse from the mapped file to avoid reading it by stream, the file is unmapped once the model is parsed.
+    auto mapped_file = MappedFile::Map(path);
+    if (mapped_file != nullptr && mapped_file->size() <= static_cast<size_t>(INT32_MAX)) {
+      if (!model->ParseFromArray(mapped_file->data(), static_cast<int32_t>(mapped_file->size()))) {
+        MS_LOG(ERROR) << "Load MindIR file failed, please check the correctness of the file.";
+        return false;
+      }
+      return true;
+    }
+  }
   if (loader->dec_key() != nullptr) {
     size_t plain_len;
     auto plain_data = Decrypt(&plain_len, path, loader->dec_key(), loader->key_len(), loader->dec_mode());
@@ -2598,6 +2839,7 @@ void InitModelParser(MSANFModelParser *model_parser, const MindIRLoader *loader)
   model_parser->SetMindIRDecKey(loader->dec_key());
   model_parser->SetMindIRKeySize(loader->key_len());
   model_parser->SetMindIRDecMode(loader->dec_mode());
+  model_parser->SetMmapLoad(MmapLoadEnabled(loader));
 
   if (loader->is_lite()) {
     model_parser->SetLite();
@@ -79,6 +79,9 @@ class MS_CORE_API MindIRLoader {
     weights_value_map_ = weights_value_map;
   }
   const LayoutMap &layout_map() const { return layout_map_; }
+  // Map the model and external data files instead of reading them, the parameters borrow the mapped data if they can.
+  void set_mmap_load(bool mmap_load) { mmap_load_ = mmap_load; }
+  bool mmap_load() const { return mmap_load_; }
   FuncGraphPtr LoadMindIR(const void *buffer, const size_t &size);
   FuncGraphPtr LoadMindIR(const void *buffer, const size_t &size, const std::string &mindir_path);
   FuncGraphPtr LoadMindIR(const std::string &file_name,
@@ -103,6 +106,7 @@ class MS_CORE_API MindIRLoader {
   bool inc_load_ = false;
   std::map<string, ValuePtr> weights_value_map_;
   bool has_parallel_info_ = false;
+  bool mmap_load_ = false;
   LayoutMap layout_map_;
 };
 MS_CORE_API FuncGraphPtr ConvertStreamToFuncGraph(const char *buf, const size_t buf_size, bool is_lite = false);
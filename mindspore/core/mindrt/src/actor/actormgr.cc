@@ -242,7 +242,7 @@ int ActorMgr::Send(const AID &to, std::unique_ptr<MessageBase> msg, bool remoteL
   }
 }
 
-AID ActorMgr::Spawn(const ActorReference &actor, bool shareThread) {
+AID ActorMgr::Spawn(const ActorReference &actor, bool shareThread, bool lockFreeMailBox) {
   actorsMutex.lock();
   if (actors.find(actor->GetAID().Name()) != actors.end()) {
     actorsMutex.unlock();
@@ -267,7 +267,8 @@ AID ActorMgr::Spawn(const ActorReference &actor, bool shareThread) {
     mailbox->SetNotifyHook(std::move(hook));
     actor->Spawn(actor, std::move(mailbox));
   } else {
-    auto mailbox = std::unique_ptr<MailBox>(new (std::nothrow) BlockingMailBox());
+    auto mailbox = lockFreeMailBox ? std::unique_ptr<MailBox>(new (std::nothrow) LockFreeBlockingMailBox())
+                                   : std::unique_ptr<MailBox>(new (std::nothrow) BlockingMailBox());
     actor->Spawn(actor, std::move(mailbox));
     ActorMgr::GetActorMgrRef()->SetActorReady(actor);
   }
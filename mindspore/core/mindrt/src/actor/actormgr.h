@@ -63,7 +63,8 @@ class MS_CORE_API ActorMgr {
   void AddUrl(const std::string &protocol, const std::string &url);
   void AddIOMgr(const std::string &protocol, const std::shared_ptr<IOMgr> &ioMgr);
   int Send(const AID &to, std::unique_ptr<MessageBase> msg, bool remoteLink = false, bool isExactNotRemote = false);
-  AID Spawn(const ActorReference &actor, bool shareThread = true);
+  // lockFreeMailBox only takes effect for the actor with an exclusive thread
+  AID Spawn(const ActorReference &actor, bool shareThread = true, bool lockFreeMailBox = false);
   void Terminate(const AID &id);
   void TerminateAll();
   void Wait(const AID &pid);
@@ -85,4 +85,41 @@ std::unique_ptr<MessageBase> HQueMailBox::GetMsg() {
   std::unique_ptr<MessageBase> msg(mailbox.Dequeue());
   return msg;
 }
+
+LockFreeBlockingMailBox::~LockFreeBlockingMailBox() {
+  while (auto msg = mailbox.Dequeue()) {
+    delete msg;
+  }
+}
+
+int LockFreeBlockingMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  mailbox.Enqueue(msg.release());
+  // the actor sets the flag before it checks the mailbox for the last time, so either it sees the message or the
+  // sender sees the flag
+  if (sleeping.load()) {
+    std::unique_lock<std::mutex> ulk(lock);
+    cond.notify_one();
+  }
+  return 0;
+}
+
+std::unique_ptr<MessageBase> LockFreeBlockingMailBox::GetMsg() {
+  for (int32_t i = 0; i < MAX_SPIN_COUNT; ++i) {
+    std::unique_ptr<MessageBase> msg(mailbox.Dequeue());
+    if (msg != nullptr) {
+      return msg;
+    }
+  }
+  while (true) {
+    std::unique_ptr<MessageBase> msg(mailbox.Dequeue());
+    if (msg != nullptr) {
+      return msg;
+    }
+    // a message being enqueued makes the mailbox not empty, the actor spins until it can be dequeued
+    std::unique_lock<std::mutex> ulk(lock);
+    sleeping = true;
+    cond.wait(ulk, [this] { return !this->mailbox.Empty(); });
+    sleeping = false;
+  }
+}
 }  // namespace mindspore
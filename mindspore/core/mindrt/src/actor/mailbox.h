@@ -24,6 +24,7 @@
 #include <utility>
 #include "actor/msg.h"
 #include "thread/hqueue.h"
+#include "thread/mpsc_queue.h"
 
 namespace mindspore {
 class MailBox {
@@ -94,6 +95,25 @@ class HQueMailBox : public MailBox {
   HQueue<MessageBase> mailbox;
   static const int32_t MAX_MSG_QUE_SIZE = 4096;
 };
+
+// Mailbox of an actor with an exclusive thread which is fed at a high rate, such as a stage of the runtime pipeline.
+// The senders never take a lock, the actor spins for a while before sleeping when the mailbox is empty, and the
+// senders only wake the actor up when it sleeps.
+class LockFreeBlockingMailBox : public MailBox {
+ public:
+  LockFreeBlockingMailBox() { takeAllMsgsEachTime = false; }
+  ~LockFreeBlockingMailBox() override;
+  int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
+  std::list<std::unique_ptr<MessageBase>> *GetMsgs() override { return nullptr; }
+  std::unique_ptr<MessageBase> GetMsg() override;
+
+ private:
+  MpscQueue<MessageBase> mailbox;
+  std::atomic_bool sleeping{false};
+  std::mutex lock;
+  std::condition_variable cond;
+  static const int32_t MAX_SPIN_COUNT = 2000;
+};
 }  // namespace mindspore
 
 #endif  // MINDSPORE_MAILBOX_H
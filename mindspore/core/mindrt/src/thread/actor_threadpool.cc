@@ -42,11 +42,13 @@ void ActorWorker::RunWithSpin() {
   while (alive_) {
     // only run either local KernelTask or PoolQueue ActorTask
     if (RunLocalKernelTask() || RunQueueActorTask()) {
+      AdaptSpinCount(true);
       spin_count_ = 0;
     } else {
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > MaxSpinCount()) {
+      AdaptSpinCount(false);
       WaitUntilActive();
       spin_count_ = 0;
     }
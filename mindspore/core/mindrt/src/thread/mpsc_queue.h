@@ -0,0 +1,78 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_RUNTIME_MPSC_QUEUE_H_
+#define MINDSPORE_CORE_MINDRT_RUNTIME_MPSC_QUEUE_H_
+#include <atomic>
+
+namespace mindspore {
+// implement an unbounded lock-free queue with multiple producers and a single consumer
+// refer to https://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
+// Enqueue is wait-free and keeps the order of the values pushed by each producer, Dequeue and Empty can only be called
+// by the consumer. The queue does not own the values.
+template <typename T>
+class MpscQueue {
+ public:
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+  MpscQueue() {
+    auto stub = new MpscNode();
+    head_ = stub;
+    tail_ = stub;
+  }
+  virtual ~MpscQueue() {
+    while (Dequeue() != nullptr) {
+    }
+    delete tail_;
+  }
+
+  void Enqueue(T *t) {
+    auto node = new MpscNode();
+    node->value = t;
+    auto prev = head_.exchange(node);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  // returns nullptr when the queue is empty, or when the value being pushed is not linked yet
+  T *Dequeue() {
+    auto tail = tail_;
+    auto next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return nullptr;
+    }
+    T *ret = next->value;
+    next->value = nullptr;
+    tail_ = next;
+    delete tail;
+    return ret;
+  }
+
+  // a value being pushed makes the queue not empty even if it can not be dequeued yet
+  bool Empty() const { return head_.load() == tail_; }
+
+ private:
+  struct MpscNode {
+    std::atomic<MpscNode *> next = {nullptr};
+    T *value = nullptr;
+  };
+
+  // CPU cache line size is 64.
+  alignas(64) std::atomic<MpscNode *> head_;
+  alignas(64) MpscNode *tail_;
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_MINDRT_RUNTIME_MPSC_QUEUE_H_
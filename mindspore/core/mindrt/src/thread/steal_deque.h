@@ -0,0 +1,106 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_RUNTIME_STEAL_DEQUE_H_
+#define MINDSPORE_CORE_MINDRT_RUNTIME_STEAL_DEQUE_H_
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace mindspore {
+// implement a bounded work-stealing deque
+// refer to https://www.dre.vanderbilt.edu/~schmidt/PDF/work-stealing-dequeue.pdf (Chase and Lev, SPAA 2005)
+// Producers are serialized by the owner worker's mutex, so Push never races with itself. Every consumer,
+// the owner included, takes items from the top with a CAS, which keeps Push safe against concurrent Steal
+// even when the producer is the thread that launched the task rather than the worker owning the deque.
+template <typename T>
+class StealDeque {
+ public:
+  StealDeque(const StealDeque &) = delete;
+  StealDeque &operator=(const StealDeque &) = delete;
+  StealDeque() {}
+  virtual ~StealDeque() {}
+
+  bool IsInit() const { return buffer_ != nullptr; }
+
+  bool Init(int64_t sz) {
+    if (IsInit() || sz <= 0) {
+      return false;
+    }
+    int64_t capacity = 1;
+    while (capacity < sz) {
+      capacity <<= 1;
+    }
+    buffer_ = std::make_unique<std::atomic<T *>[]>(static_cast<size_t>(capacity));
+    for (int64_t i = 0; i < capacity; ++i) {
+      buffer_[i].store(nullptr, std::memory_order_relaxed);
+    }
+    capacity_ = capacity;
+    mask_ = capacity - 1;
+    top_ = 0;
+    bottom_ = 0;
+    return true;
+  }
+
+  void Clean() {
+    buffer_.reset();
+    capacity_ = 0;
+    mask_ = 0;
+  }
+
+  bool Push(T *t) {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_acquire);
+    if (bottom - top >= capacity_) {
+      return false;
+    }
+    buffer_[bottom & mask_].store(t, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_release);
+    return true;
+  }
+
+  T *Steal() {
+    while (true) {
+      int64_t top = top_.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t bottom = bottom_.load(std::memory_order_acquire);
+      if (top >= bottom) {
+        return nullptr;
+      }
+      T *ret = buffer_[top & mask_].load(std::memory_order_relaxed);
+      if (top_.compare_exchange_weak(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return ret;
+      }
+    }
+  }
+
+  bool Empty() const { return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire); }
+
+  int64_t Size() const {
+    int64_t size = bottom_.load(std::memory_order_acquire) - top_.load(std::memory_order_acquire);
+    return size > 0 ? size : 0;
+  }
+
+ private:
+  alignas(64) std::atomic<int64_t> top_{0};
+  alignas(64) std::atomic<int64_t> bottom_{0};
+  std::unique_ptr<std::atomic<T *>[]> buffer_{nullptr};
+  int64_t capacity_{0};
+  int64_t mask_{0};
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_MINDRT_RUNTIME_STEAL_DEQUE_H_
@@ -43,12 +43,21 @@ Worker::~Worker() {
       (void)TryRunTask(task_split);
     }
   }
+  count = 0;
+  while (steal_queue_ && count++ < kMaxCount) {
+    auto task_split = steal_queue_->Steal();
+    if (task_split == nullptr) {
+      break;
+    }
+    ThreadPool::RunTaskSplit(task_split);
+  }
 
   if (thread_->joinable()) {
     thread_->join();
   }
   pool_ = nullptr;
   local_task_queue_ = nullptr;
+  steal_queue_ = nullptr;
 }
 
 void Worker::CreateThread() { thread_ = std::make_unique<std::thread>(&Worker::Run, this); }
@@ -134,12 +143,14 @@ void Worker::Run() {
 #endif
   while (alive_) {
     if (RunLocalKernelTask()) {
+      AdaptSpinCount(true);
       spin_count_ = 0;
     } else {
       RunOtherKernelTask();
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > MaxSpinCount()) {
+      AdaptSpinCount(false);
       WaitUntilActive();
       spin_count_ = 1;
     }
@@ -172,9 +183,64 @@ bool Worker::RunLocalKernelTask() {
     auto task_split = local_task_queue_->Dequeue();
     res |= TryRunTask(task_split);
   }
+  if (WorkStealing()) {
+    res |= RunStealTask();
+  }
   return res;
 }
 
+bool Worker::RunStealTask() {
+  bool res = false;
+  if (steal_queue_ != nullptr) {
+    for (auto task_split = steal_queue_->Steal(); task_split != nullptr; task_split = steal_queue_->Steal()) {
+      ThreadPool::RunTaskSplit(task_split);
+      res = true;
+    }
+  }
+  if (res) {
+    return true;
+  }
+  // the own deque is drained, take one split from a busy worker so that a straggler does not hold the launch
+  return pool_->StealAndRunTask(worker_id_ + 1);
+}
+
+bool Worker::WorkStealing() const { return pool_ != nullptr && pool_->work_stealing(); }
+
+int Worker::MaxSpinCount() const { return WorkStealing() ? steal_spin_count_ : max_spin_count_.load(); }
+
+void Worker::AdaptSpinCount(bool found_task) {
+  if (!WorkStealing()) {
+    return;
+  }
+  if (found_task) {
+    // the task arrived while spinning, a longer budget would have saved a wake up
+    if (spin_count_ > 0 && steal_spin_count_ < kDefaultSpinCount) {
+      steal_spin_count_ = steal_spin_count_ * 2 < kDefaultSpinCount ? steal_spin_count_ * 2 : kDefaultSpinCount;
+    }
+    backoff_pause_ = 1;
+    return;
+  }
+  // the whole budget was spent in vain, spin less before sleeping next time
+  steal_spin_count_ = steal_spin_count_ / 2 > kMinStealSpinCount ? steal_spin_count_ / 2 : kMinStealSpinCount;
+  backoff_pause_ = 1;
+}
+
+void Worker::Backoff() {
+  // exponential back-off: a few cpu pauses at first, then give up the core once the pause gets long
+  if (backoff_pause_ < kMaxBackoffPause) {
+    for (int i = 0; i < backoff_pause_; ++i) {
+#ifdef PLATFORM_86
+      _mm_pause();
+#else
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+    backoff_pause_ <<= 1;
+    return;
+  }
+  std::this_thread::yield();
+}
+
 void Worker::RunOtherKernelTask() {
   if (pool_ == nullptr || pool_->actor_thread_num() <= kMinActorRunOther) {
     return;
@@ -195,13 +261,17 @@ void Worker::YieldAndDeactive() {
   // deactivate this worker only on the first entry
   if (spin_count_ == 0) {
     std::lock_guard<std::mutex> _l(mutex_);
-    if (local_task_queue_->Empty()) {
+    if (local_task_queue_->Empty() && (steal_queue_ == nullptr || steal_queue_->Empty())) {
       status_.store(kThreadIdle);
     } else {
       return;
     }
   }
   spin_count_++;
+  if (WorkStealing()) {
+    Backoff();
+    return;
+  }
   std::this_thread::yield();
 }
 
@@ -228,16 +298,24 @@ void Worker::Active(std::vector<TaskSplit> *task_list, int task_id_start, int ta
     std::lock_guard<std::mutex> _l(mutex_);
     // add the first to task_, and others to queue.
     status_ = kThreadBusy;
-    Task *task = task_.load(std::memory_order_consume);
-    int to_atomic_task = 0;
-    if (task == nullptr) {
-      task_id_.store(task_id_start, std::memory_order_relaxed);
-      THREAD_TEST_TRUE(task_ == nullptr);
-      task_.store((*task_list)[0].task_, std::memory_order_release);
-      to_atomic_task = 1;
-    }
-    for (int i = task_id_start + to_atomic_task; i < task_id_end; ++i) {
-      while (!local_task_queue_->Enqueue(&(*task_list)[i])) {
+    if (WorkStealing() && steal_queue_ != nullptr) {
+      // all splits go to the deque, so that the other threads are able to steal them
+      for (int i = task_id_start; i < task_id_end; ++i) {
+        while (!steal_queue_->Push(&(*task_list)[i])) {
+        }
+      }
+    } else {
+      Task *task = task_.load(std::memory_order_consume);
+      int to_atomic_task = 0;
+      if (task == nullptr) {
+        task_id_.store(task_id_start, std::memory_order_relaxed);
+        THREAD_TEST_TRUE(task_ == nullptr);
+        task_.store((*task_list)[0].task_, std::memory_order_release);
+        to_atomic_task = 1;
+      }
+      for (int i = task_id_start + to_atomic_task; i < task_id_end; ++i) {
+        while (!local_task_queue_->Enqueue(&(*task_list)[i])) {
+        }
       }
     }
     status_ = kThreadBusy;
@@ -278,6 +356,10 @@ ThreadPool::~ThreadPool() {
     task_queue->Clean();
   }
   task_queues_.clear();
+  for (auto &steal_queue : steal_queues_) {
+    steal_queue->Clean();
+  }
+  steal_queues_.clear();
   THREAD_INFO("destruct success");
 }
 
@@ -291,6 +373,14 @@ int ThreadPool::TaskQueuesInit(size_t thread_num) {
       return THREAD_ERROR;
     }
   }
+  for (size_t i = 0; i < thread_num; ++i) {
+    auto steal_queue = std::make_unique<StealDeque<TaskSplit>>();
+    if (steal_queue->Init(kMaxHqueueSize) != true) {
+      THREAD_ERROR("init steal queue failed.");
+      return THREAD_ERROR;
+    }
+    (void)steal_queues_.emplace_back(std::move(steal_queue));
+  }
   THREAD_INFO("init task queues success.");
   return THREAD_OK;
 }
@@ -305,6 +395,7 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
   // if the task num is greater than the KernelThread num
   THREAD_DEBUG("launch: %d", task_num);
   Task task = {func, content};
+  task.task_num = task_num;
   std::vector<TaskSplit> task_list;
   for (int i = 0; i < task_num; ++i) {
     (void)task_list.emplace_back(TaskSplit{&task, i});
@@ -313,9 +404,13 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
   DistributeTask(&task_list, &task, task_num, curr);
   // synchronization
   // wait until the finished is equal to task_num
+  bool work_stealing = work_stealing_;
   while (task.finished != task_num) {
     if (curr != nullptr) {
       (void)curr->RunLocalKernelTask();
+    } else if (work_stealing && StealAndRunTask(0)) {
+      // help the assigned workers instead of waiting for the slowest one
+      continue;
     }
     std::this_thread::yield();
   }
@@ -377,6 +472,11 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
     assigned.push_back(curr);
     sum_frequency += curr->frequency();
   } else if (assigned.size() != static_cast<size_t>(task_num)) {
+    if (work_stealing_ && !assigned.empty()) {
+      // hand all splits to the assigned workers, the caller steals its share while waiting
+      ActiveWorkers(assigned, task_list, task_num, curr);
+      return;
+    }
     CalculateScales(assigned, sum_frequency);
     ActiveWorkers(assigned, task_list, assigned.size(), curr);
     SyncRunTask(task, assigned.size(), task_num);
@@ -387,6 +487,37 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
   ActiveWorkers(assigned, task_list, task_num, curr);
 }
 
+bool ThreadPool::StealAndRunTask(size_t start) const {
+  size_t queues_length = steal_queues_.size();
+  for (size_t i = 0; i < queues_length; ++i) {
+    auto &steal_queue = steal_queues_[(start + i) % queues_length];
+    if (steal_queue->Empty()) {
+      continue;
+    }
+    auto task_split = steal_queue->Steal();
+    if (task_split != nullptr) {
+      RunTaskSplit(task_split);
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::RunTaskSplit(TaskSplit *task_split) {
+  auto task = task_split->task_;
+  auto task_id = task_split->task_id_;
+  // a split may run on any thread, so its scales follow the task id instead of the frequency of the worker
+  float lhs_scale = 0;
+  float rhs_scale = kMaxScale;
+  if (task->task_num > 1) {
+    float per_scale = kMaxScale / task->task_num;
+    lhs_scale = task_id * per_scale;
+    rhs_scale = task_id == task->task_num - 1 ? kMaxScale : (task_id + 1) * per_scale;
+  }
+  task->status |= task->func(task->content, task_id, lhs_scale, rhs_scale);
+  (void)++task->finished;
+}
+
 void ThreadPool::CalculateScales(const std::vector<Worker *> &assigned, int sum_frequency) const {
   // divide task according to computing power(core frequency)
   float lhs_scale = 0;
@@ -38,6 +38,7 @@
 #endif
 #include "mindapi/base/macros.h"
 #include "thread/hqueue.h"
+#include "thread/steal_deque.h"
 
 #define USE_HQUEUE
 namespace mindspore {
@@ -49,6 +50,9 @@ constexpr int kDefaultFrequency = 1;
 constexpr float kMaxScale = 1.;
 constexpr size_t kMaxHqueueSize = 8192;
 constexpr size_t kMinActorRunOther = 2;
+/* Work-stealing back-off */
+constexpr int kMinStealSpinCount = 64;
+constexpr int kMaxBackoffPause = 1024;
 /* Thread status */
 constexpr int kThreadBusy = 0;  // busy, the thread is running task
 constexpr int kThreadHeld = 1;  // held, the thread has been marked as occupied
@@ -65,6 +69,7 @@ typedef struct Task {
   Task(Func f, Content c) : func(f), content(c) {}
   Func func;
   Content content;
+  int task_num{0};  // total splits, used to derive the scales of a stolen split
   std::atomic_int finished{0};
   std::atomic_int status{THREAD_OK};  // return status, RET_OK
 } Task;
@@ -100,6 +105,7 @@ class Worker {
   void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
   void InitLocalTaskQueue(HQueue<TaskSplit> *task_queue) { local_task_queue_ = task_queue; }
+  void InitStealQueue(StealDeque<TaskSplit> *steal_queue) { steal_queue_ = steal_queue; }
 
   void set_frequency(int frequency) { frequency_ = frequency; }
   int frequency() const { return frequency_; }
@@ -108,6 +114,7 @@ class Worker {
   float lhs_scale() const { return lhs_scale_; }
   float rhs_scale() const { return rhs_scale_; }
   HQueue<TaskSplit> *local_task_queue() { return local_task_queue_; }
+  StealDeque<TaskSplit> *steal_queue() { return steal_queue_; }
 
   std::thread::id thread_id() const {
     THREAD_TEST_TRUE(thread_ == nullptr);
@@ -131,6 +138,13 @@ class Worker {
   void SetAffinity();
   void YieldAndDeactive();
   virtual void WaitUntilActive();
+  // work-stealing mode: run splits of the own deque first, then steal from the other workers
+  bool RunStealTask();
+  bool WorkStealing() const;
+  int MaxSpinCount() const;
+  // grow the spin budget when work shows up while spinning, shrink it when the worker falls asleep
+  void AdaptSpinCount(bool found_task);
+  void Backoff();
 
   bool alive_{true};
   std::unique_ptr<std::thread> thread_{nullptr};
@@ -152,8 +166,11 @@ class Worker {
   int frequency_{kDefaultFrequency};
   int spin_count_{0};
   std::atomic_int max_spin_count_{kMinSpinCount};
+  int steal_spin_count_{kDefaultKernelSpinCount};
+  int backoff_pause_{1};
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_{nullptr};
+  StealDeque<TaskSplit> *steal_queue_{nullptr};
   size_t worker_id_{0};
   std::vector<int> core_list_;
 
@@ -168,6 +185,7 @@ class MS_CORE_API ThreadPool {
 
   size_t thread_num() const { return workers_.size(); }
   const std::vector<std::unique_ptr<HQueue<TaskSplit>>> &task_queues() { return task_queues_; }
+  const std::vector<std::unique_ptr<StealDeque<TaskSplit>>> &steal_queues() { return steal_queues_; }
 
   int SetCpuAffinity(const std::vector<int> &core_list);
   int SetCpuAffinity(BindMode bind_mode);
@@ -187,6 +205,13 @@ class MS_CORE_API ThreadPool {
   void SetSpinCountMinValue();
   void SetMaxSpinCount(int spin_count);
   void SetMinSpinCount(int spin_count);
+  // opt-in: splits of ParallelLaunch are pushed to per-worker deques and idle threads steal from busy ones,
+  // only switch it when no ParallelLaunch is in flight
+  void SetWorkStealing(bool enable) { work_stealing_ = enable; }
+  bool work_stealing() const { return work_stealing_; }
+  // steal one split from the deques starting at index start and run it, return false if all deques are empty
+  bool StealAndRunTask(size_t start) const;
+  static void RunTaskSplit(TaskSplit *task_split);
   void ActiveWorkers();
   void SetWorkerIdMap();
   // init task queues
@@ -212,11 +237,12 @@ class MS_CORE_API ThreadPool {
       THREAD_ERROR_IF_NULL(worker);
       worker->InitWorkerMask(core_list, workers_.size());
       size_t queues_idx = start + i;
-      if (queues_idx >= task_queues_.size()) {
+      if (queues_idx >= task_queues_.size() || queues_idx >= steal_queues_.size()) {
         THREAD_ERROR("task_queues out of range.");
         return THREAD_ERROR;
       }
       worker->InitLocalTaskQueue(task_queues_[queues_idx].get());
+      worker->InitStealQueue(steal_queues_[queues_idx].get());
       workers_.push_back(worker);
     }
     for (size_t i = 0; i < thread_num; ++i) {
@@ -242,11 +268,13 @@ class MS_CORE_API ThreadPool {
   std::mutex pool_mutex_;
   std::vector<Worker *> workers_;
   std::vector<std::unique_ptr<HQueue<TaskSplit>>> task_queues_;
+  std::vector<std::unique_ptr<StealDeque<TaskSplit>>> steal_queues_;
   std::unordered_map<std::thread::id, size_t> worker_ids_;
   CoreAffinity *affinity_{nullptr};
   std::atomic<size_t> actor_thread_num_{0};
   std::atomic<size_t> kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  std::atomic_bool work_stealing_{false};
   std::atomic_int max_spin_count_{kDefaultSpinCount};
   std::atomic_int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -16,6 +16,7 @@
 
 #include "ops/flash_attention_score.h"
 
+#include <set>
 #include <string>
 
 #include "abstract/ops/primitive_infer_map.h"
@@ -23,6 +24,7 @@
 #include "utils/check_convert_utils.h"
 #include "ops/primitive_c.h"
 #include "mindapi/src/helper.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace ops {
@@ -181,7 +183,13 @@ abstract::TupleShapePtr FlashAttentionScoreInferShape(const PrimitivePtr &primit
 }
 
 TuplePtr FlashAttentionScoreInferType(const PrimitivePtr &prim, const std::vector<AbstractBasePtr> &input_args) {
-  const std::set valid_types = {kFloat16, kBFloat16};
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  // Only the CPU kernel computes in float32.
+  std::set<TypePtr> valid_types = {kFloat16, kBFloat16};
+  if (context_ptr->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice) {
+    (void)valid_types.insert(kFloat32);
+  }
   auto op_name = prim->name();
   std::map<std::string, TypePtr> types;
   // "x", "kernel_query", "kernel_key", "kernel_value", "gamma", " beta", "bias_query", "bias_key", "bias_value"
@@ -153,7 +153,8 @@ class MatMulInfer : public abstract::OpInferBase {
     std::string device_target = context_ptr->get_param<std::string>(MS_CTX_DEVICE_TARGET);
     std::set<TypePtr> valid_types;
     if (device_target == kCPUDevice) {
-      valid_types = {kUInt8, kInt8, kInt16, kInt32, kInt64, kFloat16, kFloat32, kFloat64, kComplex64, kComplex128};
+      valid_types = {kUInt8,   kInt8,    kInt16,     kInt32,      kInt64,   kFloat16,
+                     kFloat32, kFloat64, kComplex64, kComplex128, kBFloat16};
     } else if (device_target == kGPUDevice) {
       valid_types = {kInt32, kFloat16, kFloat32, kFloat64, kComplex64, kComplex128};
     } else {
@@ -15,7 +15,10 @@
  */
 
 #include "ops/ops_func_impl/paged_attention.h"
+#include <set>
+#include <string>
 #include "utils/check_convert_utils.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace ops {
@@ -31,7 +34,13 @@ BaseShapePtr PagedAttentionFuncImpl::InferShape(const PrimitivePtr &primitive,
 
 TypePtr PagedAttentionFuncImpl::InferType(const PrimitivePtr &primitive,
                                           const std::vector<AbstractBasePtr> &input_args) const {
-  const std::set valid_types = {kFloat16, kBFloat16};
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  // Only the CPU kernel computes in float32.
+  std::set<TypePtr> valid_types = {kFloat16, kBFloat16};
+  if (context_ptr->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice) {
+    (void)valid_types.insert(kFloat32);
+  }
   auto op_name = primitive->name();
   std::map<std::string, TypePtr> types;
 
@@ -15,9 +15,12 @@
  */
 
 #include "ops/ops_func_impl/reshape_and_cache.h"
+#include <set>
+#include <string>
 #include <utility>
 #include "ops/op_utils.h"
 #include "utils/check_convert_utils.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace ops {
@@ -41,7 +44,13 @@ BaseShapePtr ReshapeAndCacheFuncImpl::InferShape(const PrimitivePtr &primitive,
 
 TypePtr ReshapeAndCacheFuncImpl::InferType(const PrimitivePtr &primitive,
                                            const std::vector<AbstractBasePtr> &input_args) const {
-  const std::set valid_types = {kFloat16, kBFloat16};
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  // Only the CPU kernel computes in float32.
+  std::set<TypePtr> valid_types = {kFloat16, kBFloat16};
+  if (context_ptr->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice) {
+    (void)valid_types.insert(kFloat32);
+  }
   auto op_name = primitive->name();
   std::map<std::string, TypePtr> types;
 
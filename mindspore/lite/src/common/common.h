@@ -79,6 +79,13 @@ static const char *const kSharedThreadPoolSection = "shared_thread_pool";
 static const char *const kEnableSharedThreadPoolKey = "enable_shared_thread_pool";
 static const char *const kThreadNumLimitPerWorkerKey = "thread_num_limit_per_worker";
 static const char *const kThreadNumRemainingPerWorkerKey = "thread_num_remaining_per_worker";
+// dynamic batching of model pool
+static const char *const kDynamicBatchingSection = "dynamic_batching";
+static const char *const kMaxBatchSizeKey = "max_batch_size";
+static const char *const kMaxQueueDelayUsKey = "max_queue_delay_us";
+// packed weights shared by the processes through a mapped file
+static const char *const kPackWeightSection = "pack_weight";
+static const char *const kPackWeightFileKey = "pack_weight_file";
 // model pool inner section and key
 static const char *const kInnerModelParallelRunnerSection = "inner_model_parallel_runner";
 static const char *const kInnerSharingWeightCopyBufKey = "sharing_weight_copy_buf";
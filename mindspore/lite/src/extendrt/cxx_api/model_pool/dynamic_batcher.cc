@@ -0,0 +1,230 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/extendrt/cxx_api/model_pool/dynamic_batcher.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "src/common/log_adapter.h"
+#include "securec/include/securec.h"
+namespace mindspore {
+DynamicBatcher::DynamicBatcher(size_t max_batch_size, int64_t max_queue_delay_us, RunFunc run_func)
+    : max_batch_size_(max_batch_size),
+      max_queue_delay_(std::max<int64_t>(max_queue_delay_us, 0)),
+      run_func_(std::move(run_func)) {}
+
+bool DynamicBatcher::CanBatch(const std::vector<MSTensor> &inputs) const {
+  if (inputs.empty() || inputs.front().Shape().empty()) {
+    return false;
+  }
+  auto batch_dim = inputs.front().Shape()[0];
+  if (batch_dim <= 0 || static_cast<size_t>(batch_dim) > max_batch_size_) {
+    return false;
+  }
+  return std::all_of(inputs.begin(), inputs.end(), [batch_dim](const MSTensor &input) {
+    return !input.Shape().empty() && input.Shape()[0] == batch_dim && !input.IsDevice() && input.Data() != nullptr &&
+           input.DataType() != DataType::kObjectTypeString;
+  });
+}
+
+bool DynamicBatcher::IsCompatible(const Batch &batch, const std::vector<MSTensor> &inputs) {
+  const auto &batch_inputs = *batch.requests.front()->inputs;
+  if (batch_inputs.size() != inputs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const auto &shape = inputs[i].Shape();
+    const auto &batch_shape = batch_inputs[i].Shape();
+    if (inputs[i].DataType() != batch_inputs[i].DataType() || shape.size() != batch_shape.size() ||
+        !std::equal(shape.begin() + 1, shape.end(), batch_shape.begin() + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status DynamicBatcher::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs) {
+  Request request;
+  request.inputs = &inputs;
+  request.outputs = outputs;
+  request.batch_dim = inputs.front().Shape()[0];
+  auto batch_dim = static_cast<size_t>(request.batch_dim);
+  std::unique_lock<std::mutex> lock(mutex_);
+  stats_.request_num++;
+  if (open_batch_ != nullptr && open_batch_->sample_num + batch_dim <= max_batch_size_ &&
+      IsCompatible(*open_batch_, inputs)) {
+    open_batch_->requests.push_back(&request);
+    open_batch_->sample_num += batch_dim;
+    if (open_batch_->sample_num >= max_batch_size_) {
+      batch_full_cond_.notify_all();
+    }
+    batch_done_cond_.wait(lock, [&request] { return request.done; });
+    return request.status;
+  }
+  // lead a new batch, a full or incompatible open batch is still run by its own leader
+  auto batch = std::make_shared<Batch>();
+  batch->requests.push_back(&request);
+  batch->sample_num = batch_dim;
+  batch->open_time = std::chrono::steady_clock::now();
+  open_batch_ = batch;
+  (void)batch_full_cond_.wait_for(lock, max_queue_delay_,
+                                  [this, &batch] { return batch->sample_num >= max_batch_size_; });
+  if (open_batch_ == batch) {
+    open_batch_ = nullptr;
+  }
+  auto queue_delay =
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - batch->open_time).count();
+  stats_.batch_num++;
+  stats_.sample_num += batch->sample_num;
+  stats_.max_batch_samples = std::max<uint64_t>(stats_.max_batch_samples, batch->sample_num);
+  stats_.total_queue_delay_us += static_cast<uint64_t>(queue_delay);
+  stats_.max_queue_delay_us = std::max<uint64_t>(stats_.max_queue_delay_us, static_cast<uint64_t>(queue_delay));
+  lock.unlock();
+
+  RunBatch(batch.get());
+
+  lock.lock();
+  for (auto *item : batch->requests) {
+    item->done = true;
+  }
+  batch_done_cond_.notify_all();
+  return request.status;
+}
+
+void DynamicBatcher::RunBatch(Batch *batch) {
+  if (batch->requests.size() == 1) {
+    auto *request = batch->requests.front();
+    request->status = run_func_(*request->inputs, request->outputs);
+    return;
+  }
+  std::vector<bool> user_outputs;
+  (void)std::transform(batch->requests.begin(), batch->requests.end(), std::back_inserter(user_outputs),
+                       [](const Request *request) { return !request->outputs->empty(); });
+  std::vector<MSTensor> batch_inputs;
+  std::vector<std::vector<uint8_t>> buffers;
+  std::vector<MSTensor> batch_outputs;
+  auto status = ConcatInputs(*batch, &batch_inputs, &buffers);
+  if (status == kSuccess) {
+    status = run_func_(batch_inputs, &batch_outputs);
+  }
+  if (status == kSuccess) {
+    status = ScatterOutputs(batch_outputs, *batch);
+  }
+  if (status == kSuccess) {
+    for (auto *request : batch->requests) {
+      request->status = kSuccess;
+    }
+    return;
+  }
+  // the model may not keep the samples on dim 0, fall back to running the requests one by one
+  MS_LOG(WARNING) << "Run " << batch->requests.size() << " requests as a batch failed, run them one by one.";
+  for (size_t i = 0; i < batch->requests.size(); i++) {
+    auto *request = batch->requests[i];
+    if (!user_outputs[i]) {
+      request->outputs->clear();
+    }
+    request->status = run_func_(*request->inputs, request->outputs);
+  }
+}
+
+Status DynamicBatcher::ConcatInputs(const Batch &batch, std::vector<MSTensor> *batch_inputs,
+                                    std::vector<std::vector<uint8_t>> *buffers) {
+  const auto &first_inputs = *batch.requests.front()->inputs;
+  buffers->resize(first_inputs.size());
+  for (size_t i = 0; i < first_inputs.size(); i++) {
+    auto &buffer = buffers->at(i);
+    for (auto *request : batch.requests) {
+      const auto &input = request->inputs->at(i);
+      auto data = input.Data();
+      if (data == nullptr) {
+        MS_LOG(ERROR) << "The data of input " << input.Name() << " is nullptr.";
+        return kLiteNullptr;
+      }
+      auto begin = static_cast<const uint8_t *>(data.get());
+      (void)buffer.insert(buffer.end(), begin, begin + input.DataSize());
+    }
+    auto shape = first_inputs[i].Shape();
+    shape[0] = static_cast<int64_t>(batch.sample_num);
+    // the buffers are kept by the caller until the batch is run
+    auto tensor = MSTensor::CreateRefTensor(first_inputs[i].Name(), first_inputs[i].DataType(), shape, buffer.data(),
+                                            buffer.size(), false);
+    if (tensor == nullptr) {
+      MS_LOG(ERROR) << "Create batched input " << first_inputs[i].Name() << " failed.";
+      return kLiteNullptr;
+    }
+    tensor->SetFormat(first_inputs[i].format());
+    batch_inputs->push_back(*tensor);
+    MSTensor::DestroyTensorPtr(tensor);
+  }
+  return kSuccess;
+}
+
+Status DynamicBatcher::ScatterOutputs(const std::vector<MSTensor> &batch_outputs, const Batch &batch) {
+  for (const auto &output : batch_outputs) {
+    if (output.Shape().empty() || output.Shape()[0] != static_cast<int64_t>(batch.sample_num) ||
+        output.DataSize() % batch.sample_num != 0 || output.Data() == nullptr) {
+      MS_LOG(INFO) << "Output " << output.Name() << " with shape " << output.Shape() << " does not keep the "
+                   << batch.sample_num << " samples of the batch on dim 0.";
+      return kLiteError;
+    }
+  }
+  for (auto *request : batch.requests) {
+    if (!request->outputs->empty() && request->outputs->size() != batch_outputs.size()) {
+      MS_LOG(ERROR) << "The number of outputs is " << batch_outputs.size() << ", but the user gives "
+                    << request->outputs->size();
+      return kLiteError;
+    }
+  }
+  int64_t offset = 0;
+  for (auto *request : batch.requests) {
+    bool user_outputs = !request->outputs->empty();
+    for (size_t i = 0; i < batch_outputs.size(); i++) {
+      const auto &output = batch_outputs[i];
+      auto sample_size = output.DataSize() / batch.sample_num;
+      auto size = sample_size * static_cast<size_t>(request->batch_dim);
+      auto src = static_cast<const uint8_t *>(output.Data().get()) + sample_size * static_cast<size_t>(offset);
+      auto shape = output.Shape();
+      shape[0] = request->batch_dim;
+      if (user_outputs) {
+        auto &user_output = request->outputs->at(i);
+        if (user_output.DataSize() != size || user_output.MutableData() == nullptr) {
+          MS_LOG(ERROR) << "The size of user output " << user_output.Name() << " is " << user_output.DataSize()
+                        << ", but the output size is " << size;
+          return kLiteError;
+        }
+        if (memcpy_s(user_output.MutableData(), user_output.DataSize(), src, size) != EOK) {
+          MS_LOG(ERROR) << "Copy output " << output.Name() << " to the user output failed.";
+          return kLiteError;
+        }
+        continue;
+      }
+      auto tensor = MSTensor::CreateTensor(output.Name(), output.DataType(), shape, src, size);
+      if (tensor == nullptr) {
+        MS_LOG(ERROR) << "Create output " << output.Name() << " failed.";
+        return kLiteNullptr;
+      }
+      request->outputs->push_back(*tensor);
+      MSTensor::DestroyTensorPtr(tensor);
+    }
+    offset += request->batch_dim;
+  }
+  return kSuccess;
+}
+
+DynamicBatcherStats DynamicBatcher::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+}  // namespace mindspore
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_DYNAMIC_BATCHER_H_
+#define MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_DYNAMIC_BATCHER_H_
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "include/api/types.h"
+#include "include/api/status.h"
+namespace mindspore {
+struct DynamicBatcherStats {
+  uint64_t request_num = 0;
+  uint64_t batch_num = 0;
+  uint64_t sample_num = 0;
+  uint64_t max_batch_samples = 0;
+  // time the requests waited for their batch to fill
+  uint64_t total_queue_delay_us = 0;
+  uint64_t max_queue_delay_us = 0;
+};
+
+// Coalesces concurrent Predict calls of small batches into one batched run. The first request of a batch leads it: it
+// waits until the batch has max_batch_size samples or max_queue_delay_us has passed, concatenates the inputs of all
+// the requests along dim 0, runs them once, and slices the outputs back to the requests along dim 0. The requests
+// joining the batch wait for the leader, so no thread is added to the model pool.
+class DynamicBatcher {
+ public:
+  using RunFunc = std::function<Status(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs)>;
+
+  DynamicBatcher(size_t max_batch_size, int64_t max_queue_delay_us, RunFunc run_func);
+
+  ~DynamicBatcher() = default;
+
+  // whether the request can be batched: all inputs are host tensors with the samples on dim 0, and there are at most
+  // max_batch_size samples
+  bool CanBatch(const std::vector<MSTensor> &inputs) const;
+
+  Status Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs);
+
+  DynamicBatcherStats GetStats();
+
+ private:
+  struct Request {
+    const std::vector<MSTensor> *inputs = nullptr;
+    std::vector<MSTensor> *outputs = nullptr;
+    int64_t batch_dim = 0;
+    Status status = kSuccess;
+    bool done = false;
+  };
+
+  struct Batch {
+    std::vector<Request *> requests;
+    size_t sample_num = 0;
+    std::chrono::steady_clock::time_point open_time;
+  };
+
+  // the inputs of the requests in a batch only differ on dim 0
+  static bool IsCompatible(const Batch &batch, const std::vector<MSTensor> &inputs);
+
+  void RunBatch(Batch *batch);
+
+  static Status ConcatInputs(const Batch &batch, std::vector<MSTensor> *batch_inputs,
+                             std::vector<std::vector<uint8_t>> *buffers);
+
+  static Status ScatterOutputs(const std::vector<MSTensor> &batch_outputs, const Batch &batch);
+
+  size_t max_batch_size_;
+  std::chrono::microseconds max_queue_delay_;
+  RunFunc run_func_;
+  std::mutex mutex_;
+  std::condition_variable batch_full_cond_;
+  std::condition_variable batch_done_cond_;
+  // the batch new requests join, nullptr when its leader stopped waiting
+  std::shared_ptr<Batch> open_batch_ = nullptr;
+  DynamicBatcherStats stats_;
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_DYNAMIC_BATCHER_H_
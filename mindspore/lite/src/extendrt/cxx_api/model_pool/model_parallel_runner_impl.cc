@@ -106,6 +106,16 @@ Status ModelParallelRunnerImpl::Predict(const std::vector<MSTensor> &inputs, std
   }
   return kSuccess;
 }
+
+DynamicBatcherStats ModelParallelRunnerImpl::GetDynamicBatcherStats() {
+  std::shared_lock<std::shared_mutex> l(model_parallel_runner_impl_mutex_);
+  if (model_pool_ == nullptr) {
+    MS_LOG(ERROR) << "Please initialize ModelParallelRunner before calling GetDynamicBatcherStats API.";
+    return DynamicBatcherStats();
+  }
+  return model_pool_->GetDynamicBatcherStats();
+}
+
 ModelParallelRunnerImpl::~ModelParallelRunnerImpl() {
   MS_LOG(INFO) << "delete model pool begin.";
   std::unique_lock<std::shared_mutex> l(model_parallel_runner_impl_mutex_);
@@ -44,6 +44,7 @@ constexpr int kInvalidNumaId = -1;
 constexpr int kNumDefaultInterOpParallel = 4;
 constexpr int kNumCoreNumTimes = 5;
 constexpr int kDefaultThreadNumTimes = 2;
+constexpr int64_t kDefaultMaxQueueDelayUs = 1000;
 }  // namespace
 
 int ModelPool::GetDefaultThreadNum(int worker_num) {
@@ -939,12 +940,71 @@ Status ModelPool::ParseSharedThreadPoolParam(const std::shared_ptr<RunnerConfig>
   return ParseParamByConfigInfo(runner_config->GetConfigInfo());
 }
 
+Status ModelPool::ParseDynamicBatchingParam(const std::shared_ptr<RunnerConfig> &runner_config) {
+  if (runner_config == nullptr) {
+    return kSuccess;
+  }
+  // the config info set by the user overwrites the config file
+  std::map<std::string, std::string> batching_param;
+  std::map<std::string, std::map<std::string, std::string>> config_file_info;
+  if (!runner_config->GetConfigPath().empty()) {
+    int ret = lite::GetAllSectionInfoFromConfigFile(runner_config->GetConfigPath(), &config_file_info);
+    if (ret != lite::RET_OK) {
+      MS_LOG(ERROR) << "GetAllSectionInfoFromConfigFile failed.";
+      return kLiteError;
+    }
+  }
+  for (const auto &config_info : {config_file_info, runner_config->GetConfigInfo()}) {
+    auto section = config_info.find(lite::kDynamicBatchingSection);
+    if (section != config_info.end()) {
+      for (const auto &item : section->second) {
+        batching_param[item.first] = item.second;
+      }
+    }
+  }
+  if (batching_param.find(lite::kMaxBatchSizeKey) == batching_param.end()) {
+    MS_LOG(INFO) << "not set dynamic batching.";
+    return kSuccess;
+  }
+  int max_batch_size = std::atoi(batching_param[lite::kMaxBatchSizeKey].c_str());
+  if (max_batch_size <= 0) {
+    MS_LOG(WARNING) << "max_batch_size is invalid, max_batch_size: " << batching_param[lite::kMaxBatchSizeKey];
+    return kLiteParamInvalid;
+  }
+  int64_t max_queue_delay_us = kDefaultMaxQueueDelayUs;
+  if (batching_param.find(lite::kMaxQueueDelayUsKey) != batching_param.end()) {
+    max_queue_delay_us = std::atoll(batching_param[lite::kMaxQueueDelayUsKey].c_str());
+    if (max_queue_delay_us < 0) {
+      MS_LOG(WARNING) << "max_queue_delay_us is invalid, max_queue_delay_us: "
+                      << batching_param[lite::kMaxQueueDelayUsKey];
+      return kLiteParamInvalid;
+    }
+  }
+  if (max_batch_size == 1) {
+    MS_LOG(INFO) << "max_batch_size is 1, not use dynamic batching.";
+    return kSuccess;
+  }
+  dynamic_batcher_ = std::make_shared<DynamicBatcher>(
+    max_batch_size, max_queue_delay_us,
+    [this](const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs) {
+      return DispatchPredict(inputs, outputs, nullptr, nullptr);
+    });
+  MS_LOG(INFO) << "use dynamic batching, max batch size: " << max_batch_size
+               << " | max queue delay: " << max_queue_delay_us << "us";
+  return kSuccess;
+}
+
 ModelPoolConfig ModelPool::Init(const std::shared_ptr<RunnerConfig> &runner_config) {
   auto status = ParseSharedThreadPoolParam(runner_config);
   if (status != kSuccess) {
     MS_LOG(WARNING) << "ParseSharedThreadPoolParam failed, Not use thread pool shared.";
     enable_shared_thread_pool_ = false;
   }
+  status = ParseDynamicBatchingParam(runner_config);
+  if (status != kSuccess) {
+    MS_LOG(WARNING) << "ParseDynamicBatchingParam failed, Not use dynamic batching.";
+    dynamic_batcher_ = nullptr;
+  }
   ModelPoolConfig model_pool_config = {};
   status = CanUseAllPhysicalResources();
   if (status != kSuccess) {
@@ -1115,6 +1175,15 @@ Status ModelPool::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTen
       return kSuccess;
     }
   }
+  // the callbacks are given per request, a request with them is not batched with the others
+  if (dynamic_batcher_ != nullptr && before == nullptr && after == nullptr && dynamic_batcher_->CanBatch(inputs)) {
+    return dynamic_batcher_->Predict(inputs, outputs);
+  }
+  return DispatchPredict(inputs, outputs, before, after);
+}
+
+Status ModelPool::DispatchPredict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs,
+                                  const MSKernelCallBack &before, const MSKernelCallBack &after) {
   int max_wait_worker_node_id = 0;
   int max_wait_worker_num = 0;
   auto available_worker = GetMaxWaitWorkerNum(&max_wait_worker_node_id, &max_wait_worker_num);
@@ -1142,8 +1211,33 @@ Status ModelPool::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTen
   return kSuccess;
 }
 
+std::vector<ModelWorkerStats> ModelPool::GetWorkerStats() {
+  std::vector<ModelWorkerStats> stats;
+  for (auto &item : all_model_workers_) {
+    for (auto &worker : item.second) {
+      stats.push_back(worker->GetStats());
+    }
+  }
+  return stats;
+}
+
+DynamicBatcherStats ModelPool::GetDynamicBatcherStats() {
+  return dynamic_batcher_ == nullptr ? DynamicBatcherStats() : dynamic_batcher_->GetStats();
+}
+
 ModelPool::~ModelPool() {
   MS_LOG(INFO) << "free model pool.";
+  if (dynamic_batcher_ != nullptr) {
+    auto stats = GetDynamicBatcherStats();
+    MS_LOG(INFO) << "dynamic batching requests: " << stats.request_num << " | batches: " << stats.batch_num
+                 << " | samples: " << stats.sample_num << " | max batch samples: " << stats.max_batch_samples
+                 << " | total queue delay: " << stats.total_queue_delay_us
+                 << "us | max queue delay: " << stats.max_queue_delay_us << "us";
+  }
+  for (const auto &stats : GetWorkerStats()) {
+    MS_LOG(INFO) << "worker id: " << stats.worker_id << " | predict num: " << stats.predict_num
+                 << " | sample num: " << stats.sample_num;
+  }
   if (predict_task_queue_ != nullptr) {
     predict_task_queue_->SetPredictTaskDone();
   }
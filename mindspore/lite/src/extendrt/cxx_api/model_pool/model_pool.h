@@ -30,6 +30,7 @@
 #include "include/api/model_parallel_runner.h"
 #include "src/extendrt/cxx_api/model_pool/model_worker.h"
 #include "src/extendrt/cxx_api/model_pool/predict_task_queue.h"
+#include "src/extendrt/cxx_api/model_pool/dynamic_batcher.h"
 namespace mindspore {
 using ModelPoolConfig = std::vector<std::shared_ptr<WorkerConfig>>;
 
@@ -62,6 +63,11 @@ class ModelPool {
   Status Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs,
                  const MSKernelCallBack &before = nullptr, const MSKernelCallBack &after = nullptr);
 
+  std::vector<ModelWorkerStats> GetWorkerStats();
+
+  // the counters are zero when dynamic batching is disabled
+  DynamicBatcherStats GetDynamicBatcherStats();
+
  private:
   ModelPoolConfig CreateModelPoolConfig(const std::shared_ptr<RunnerConfig> &runner_config);
   std::shared_ptr<Context> GetInitContext(const std::shared_ptr<RunnerConfig> &runner_config);
@@ -121,6 +127,12 @@ class ModelPool {
 
   Status ParseDeviceIds(const std::shared_ptr<RunnerConfig> &runner_config, ModelPoolConfig *model_pool_config);
 
+  Status ParseDynamicBatchingParam(const std::shared_ptr<RunnerConfig> &runner_config);
+
+  // run the request on an idle worker, or queue it until a worker is idle
+  Status DispatchPredict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs,
+                         const MSKernelCallBack &before, const MSKernelCallBack &after);
+
  private:
   // different workers get tasks from different task queues.
   // currently task queues are distinguished according to different numa node numbers.
@@ -156,6 +168,9 @@ class ModelPool {
   // split batch
   bool is_user_data_ = false;
 
+  // coalesce concurrent small requests into one batch, nullptr if dynamic batching is not configured
+  std::shared_ptr<DynamicBatcher> dynamic_batcher_ = nullptr;
+
   bool can_use_all_physical_core_ = true;
   int can_use_core_num_ = -1;
   int all_core_num_ = -1;
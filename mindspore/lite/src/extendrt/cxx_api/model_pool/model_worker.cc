@@ -267,6 +267,10 @@ Status ModelWorker::Predict(const std::vector<MSTensor> &inputs, std::vector<MST
       model_outputs[i].SetAllocator(nullptr);
     }
   }
+  predict_num_++;
+  if (!inputs.front().Shape().empty()) {
+    sample_num_ += static_cast<uint64_t>(inputs.front().Shape()[0]);
+  }
   available_ = true;
   predict_task_queue_->ActiveTaskQueue();
   return kSuccess;
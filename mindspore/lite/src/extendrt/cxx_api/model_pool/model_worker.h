@@ -37,6 +37,13 @@ struct WorkerConfig {
   int worker_id = -1;
 };
 
+struct ModelWorkerStats {
+  int worker_id = -1;
+  uint64_t predict_num = 0;
+  // samples on dim 0 of the first input, more than predict_num when the requests are batched
+  uint64_t sample_num = 0;
+};
+
 class ModelWorker {
  public:
   ModelWorker() = default;
@@ -66,6 +73,8 @@ class ModelWorker {
 
   inline int GetWorkerID() { return worker_id_; }
 
+  ModelWorkerStats GetStats() const { return {worker_id_, predict_num_, sample_num_}; }
+
   void Run();
 
  private:
@@ -91,6 +100,8 @@ class ModelWorker {
   std::atomic_bool available_ = true;
   bool model_is_nullptr_ = false;
   int worker_id_ = -1;
+  std::atomic<uint64_t> predict_num_ = 0;
+  std::atomic<uint64_t> sample_num_ = 0;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_MODEL_WORKER_H_
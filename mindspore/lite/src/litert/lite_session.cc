@@ -625,6 +625,7 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return ret;
   }
+  lite::PackWeightManager::GetInstance()->SavePackWeight(model);
 
   if (is_train_session_ || is_prepare_session_) {
     is_running_.store(false);
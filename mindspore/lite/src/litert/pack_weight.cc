@@ -18,7 +18,7 @@
 #include "src/extendrt/dynamic_mem_allocator.h"
 namespace mindspore::lite {
 STATUS PackWeight::InitPackWeight(const void *model_buf, size_t model_size, std::string id, int numa_id,
-                                  bool need_copy_buf) {
+                                  bool need_copy_buf, const std::string &weight_file_path) {
   std::lock_guard<std::mutex> lock(mtx_weight_);
   if (model_buf == nullptr || model_weights_.size() != shared_bufs_.size()) {
     MS_LOG(ERROR) << "model buf is nullptr in pack weight manager.";
@@ -44,6 +44,15 @@ STATUS PackWeight::InitPackWeight(const void *model_buf, size_t model_size, std:
     return RET_ERROR;
   }
   void *new_model_buf = const_cast<void *>(model_buf);
+  model_const_weight->model_size = model_size;
+  if (!weight_file_path.empty()) {
+    model_const_weight->weight_file = std::make_shared<PackWeightFile>(weight_file_path);
+    if (model_const_weight->weight_file->Load(model_buf, model_size) && need_copy_buf) {
+      // the model buf in the file is shared with the other processes, no need to copy it
+      new_model_buf = model_const_weight->weight_file->model_buf();
+      need_copy_buf = false;
+    }
+  }
   if (need_copy_buf) {
     new_model_buf = allocator->Malloc(model_size);
     if (new_model_buf == nullptr) {
@@ -184,6 +193,19 @@ void *PackWeight::GetPackData(const void *tensor_data, const size_t size, bool *
         *is_packed = true;
         return packed_tensor_data;
       } else {
+        PackWeightKey key;
+        auto &weight_file = model_weight->weight_file;
+        bool in_model_buf = weight_file != nullptr &&
+                            GetPackWeightKey(shared_bufs_[numa_item.first][item.first], *model_weight, tensor_data,
+                                             size, &key);
+        if (in_model_buf && weight_file->loaded()) {
+          packed_tensor_data = weight_file->GetPackData(key);
+          if (packed_tensor_data != nullptr) {
+            origin_packed_weight[tensor_data] = packed_tensor_data;
+            *is_packed = true;
+            return packed_tensor_data;
+          }
+        }
         auto weight_allocator = model_weight->allocator;
         packed_tensor_data = weight_allocator->Malloc(size);
         if (packed_tensor_data == nullptr) {
@@ -191,6 +213,9 @@ void *PackWeight::GetPackData(const void *tensor_data, const size_t size, bool *
           return nullptr;
         }
         origin_packed_weight[tensor_data] = packed_tensor_data;
+        if (in_model_buf) {
+          model_weight->unsaved_pack_data[packed_tensor_data] = {key, std::this_thread::get_id()};
+        }
         *is_packed = false;
         return packed_tensor_data;
       }
@@ -201,18 +226,70 @@ void *PackWeight::GetPackData(const void *tensor_data, const size_t size, bool *
   return nullptr;
 }
 
+bool PackWeight::GetPackWeightKey(const void *model_buf, const ModelConstWeight &weight, const void *tensor_data,
+                                  size_t size, PackWeightKey *key) {
+  auto begin = static_cast<const char *>(model_buf);
+  auto data = static_cast<const char *>(tensor_data);
+  if (begin == nullptr || data < begin || data >= begin + weight.model_size) {
+    return false;
+  }
+  *key = {static_cast<size_t>(data - begin), size};
+  return true;
+}
+
+STATUS PackWeight::SavePackWeight(const void *model_buf) {
+  std::shared_ptr<PackWeightFile> weight_file = nullptr;
+  size_t model_size = 0;
+  std::map<PackWeightKey, const void *> pack_data;
+  {
+    std::lock_guard<std::mutex> lock(mtx_weight_);
+    ModelConstWeight *model_weight = nullptr;
+    for (auto &item : shared_bufs_) {
+      for (auto &numa_item : item.second) {
+        if (numa_item.second == model_buf) {
+          model_weight = model_weights_[item.first][numa_item.first];
+        }
+      }
+    }
+    if (model_weight == nullptr || model_weight->weight_file == nullptr) {
+      return RET_OK;
+    }
+    auto &unsaved = model_weight->unsaved_pack_data;
+    for (auto iter = unsaved.begin(); iter != unsaved.end();) {
+      if (iter->second.packing_thread == std::this_thread::get_id()) {
+        pack_data[iter->second.key] = iter->first;
+        iter = unsaved.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    weight_file = model_weight->weight_file;
+    model_size = model_weight->model_size;
+  }
+  if (pack_data.empty()) {
+    return RET_OK;
+  }
+  // the packed data is freed with the model, which is not done while the session of this thread is compiling
+  return weight_file->Save(model_buf, model_size, pack_data) ? RET_OK : RET_ERROR;
+}
+
 void PackWeight::FreePackedWeight(ModelConstWeight *weight) {
   MS_CHECK_TRUE_RET_VOID(weight != nullptr);
   for (auto &origin_and_packed_pair : weight->origin_and_packed_pair) {
     auto &packed_data = origin_and_packed_pair.second;
     auto allocator = weight->allocator;
     MS_CHECK_TRUE_RET_VOID(allocator != nullptr);
+    if (weight->weight_file != nullptr && weight->weight_file->Contains(packed_data)) {
+      packed_data = nullptr;
+      continue;
+    }
     if (packed_data != nullptr) {
       allocator->Free(packed_data);
       packed_data = nullptr;
     }
   }
   weight->origin_and_packed_pair.clear();
+  weight->unsaved_pack_data.clear();
 }
 
 void PackWeight::FreeTensorData(ModelConstWeight *weight) {
@@ -25,9 +25,17 @@
 #include <mutex>
 #include <unordered_map>
 #include <memory>
+#include <thread>
 #include "src/tensor.h"
 #include "src/litert/lite_session.h"
+#include "src/litert/pack_weight_file.h"
 namespace mindspore::lite {
+struct UnsavedPackData {
+  PackWeightKey key;
+  // the packed data is complete once the session of the packing thread is compiled
+  std::thread::id packing_thread;
+};
+
 struct ModelConstWeight {
   // origin tensor data <-> packed tensor data
   std::map<const void *, void *> origin_and_packed_pair;
@@ -35,7 +43,12 @@ struct ModelConstWeight {
   int numa_id = -1;
   std::unordered_map<int, void *> tensors_data;
   std::set<void *> fp16_fp32_data;
-  bool copy_buf;
+  bool copy_buf = false;
+  size_t model_size = 0;
+  // nullptr when the packed weights are not shared through a file
+  std::shared_ptr<PackWeightFile> weight_file = nullptr;
+  // packed data <-> packed data not saved to the weight file yet
+  std::map<void *, UnsavedPackData> unsaved_pack_data;
 };
 
 class PackWeight {
@@ -43,10 +56,12 @@ class PackWeight {
   PackWeight() = default;
   ~PackWeight();
   STATUS InitPackWeight(const void *model_buf, size_t model_size, std::string id, int numa_id,
-                        bool need_copy_buf = true);
+                        bool need_copy_buf = true, const std::string &weight_file_path = "");
   char *GetSharedModelBuf(std::string id, int numa_id);
   STATUS StoreOriginTensorData(const void *model_buf, const void *origin_tensor_data);
   void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed);
+  // Saves the weights packed by the current thread to the weight file of the model.
+  STATUS SavePackWeight(const void *model_buf);
   STATUS ReplaceOriginTensorData(const void *model_buf, std::vector<Tensor *> *tensors, int tensor_index);
   void *ReplaceFp16Data(void *origin_fp16_data, size_t size);
   void FreePackWeight(std::string id, bool free_all = false);
@@ -55,6 +70,9 @@ class PackWeight {
   void FreePackedWeight(ModelConstWeight *weight);
   void FreeTensorData(ModelConstWeight *weight);
   void FreeFp16ToFp32Data(ModelConstWeight *weight);
+  // the key of the packed data in the weight file, false when the tensor data is not in the model buf
+  static bool GetPackWeightKey(const void *model_buf, const ModelConstWeight &weight, const void *tensor_data,
+                               size_t size, PackWeightKey *key);
 
   std::mutex mtx_weight_;
   std::unordered_map<void *, void *> fp16_fp32_data_pair_;
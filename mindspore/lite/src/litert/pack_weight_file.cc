@@ -0,0 +1,277 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/pack_weight_file.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "src/common/log_adapter.h"
+#include "src/common/utils.h"
+#include "src/litert/cpu_info.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr char kPackWeightFileMagic[] = "MSPACKW";
+constexpr uint64_t kPackWeightFileVersion = 2;
+constexpr size_t kModelBufAlignSize = 4096;
+constexpr size_t kPackDataAlignSize = 64;
+
+enum PackIsa : uint32_t {
+  kPackIsaBase = 0,
+  kPackIsaArm32,
+  kPackIsaArm64,
+  kPackIsaSse,
+  kPackIsaAvx,
+  kPackIsaAvx512,
+};
+
+enum PackFeature : uint32_t {
+  kPackFeatureSDot = 1 << 0,
+  kPackFeatureFp16 = 1 << 1,
+};
+
+// The weights are packed by the kernels selected for the build and the cpu, whose layout is not portable: a file
+// written on another isa or by another build is repacked.
+struct PackWeightFingerprint {
+  uint32_t isa = kPackIsaBase;
+  uint32_t row_tile = C12NUM;
+  uint32_t col_tile = C8NUM;
+  uint32_t features = 0;
+
+  bool operator==(const PackWeightFingerprint &other) const {
+    return isa == other.isa && row_tile == other.row_tile && col_tile == other.col_tile && features == other.features;
+  }
+};
+
+struct PackWeightFileHeader {
+  char magic[sizeof(kPackWeightFileMagic)];
+  uint64_t version;
+  PackWeightFingerprint fingerprint;
+  uint64_t model_size;
+  uint64_t model_offset;
+  uint64_t entry_num;
+};
+
+struct PackWeightFileEntry {
+  uint64_t origin_offset;
+  uint64_t size;
+  uint64_t data_offset;
+};
+
+// Follows the matmul kernel selection of nnacl, the other kernels pack for the same isa.
+PackWeightFingerprint GetPackWeightFingerprint() {
+  PackWeightFingerprint fingerprint;
+#if defined(ENABLE_AVX512)
+  if (X86_Avx512_Support()) {
+    fingerprint = {kPackIsaAvx512, C1NUM, C16NUM, 0};
+    return fingerprint;
+  }
+#endif
+#if defined(ENABLE_AVX)
+  fingerprint = {kPackIsaAvx, C1NUM, C8NUM, 0};
+#elif defined(ENABLE_SSE)
+  fingerprint = {kPackIsaSse, C4NUM, C8NUM, 0};
+#elif defined(ENABLE_ARM64)
+  fingerprint = {kPackIsaArm64, C12NUM, C8NUM, 0};
+#elif defined(ENABLE_ARM32)
+  fingerprint = {kPackIsaArm32, C12NUM, C4NUM, 0};
+#endif
+  if (IsSupportSDot()) {
+    fingerprint.features |= kPackFeatureSDot;
+  }
+#ifdef ENABLE_ARM
+  if (CpuInfo().ArmIsSupportFp16()) {
+    fingerprint.features |= kPackFeatureFp16;
+  }
+#endif
+  return fingerprint;
+}
+
+size_t AlignUp(size_t size, size_t align) { return (size + align - 1) / align * align; }
+
+bool WritePadding(std::ofstream *ofs, size_t *written, size_t align) {
+  auto aligned = AlignUp(*written, align);
+  std::vector<char> padding(aligned - *written, 0);
+  (void)ofs->write(padding.data(), static_cast<std::streamsize>(padding.size()));
+  *written = aligned;
+  return ofs->good();
+}
+}  // namespace
+
+PackWeightFile::~PackWeightFile() { Unmap(); }
+
+void PackWeightFile::Unmap() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (addr_ != nullptr) {
+    (void)munmap(addr_, file_size_);
+  }
+#endif
+  addr_ = nullptr;
+  file_size_ = 0;
+  model_buf_ = nullptr;
+  pack_data_.clear();
+}
+
+bool PackWeightFile::Load(const void *model_buf, size_t model_size) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  Unmap();
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(PackWeightFileHeader)) {
+    (void)close(fd);
+    return false;
+  }
+  auto file_size = static_cast<size_t>(file_stat.st_size);
+  auto addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(WARNING) << "mmap pack weight file " << path_ << " failed.";
+    return false;
+  }
+  addr_ = addr;
+  file_size_ = file_size;
+  auto base = static_cast<char *>(addr_);
+  auto header = reinterpret_cast<const PackWeightFileHeader *>(base);
+  auto entries_end = sizeof(PackWeightFileHeader) + header->entry_num * sizeof(PackWeightFileEntry);
+  if (memcmp(header->magic, kPackWeightFileMagic, sizeof(kPackWeightFileMagic)) != 0 ||
+      header->version != kPackWeightFileVersion || header->model_size != model_size ||
+      header->entry_num > file_size / sizeof(PackWeightFileEntry) || entries_end > header->model_offset ||
+      header->model_offset > file_size || model_size > file_size - header->model_offset ||
+      memcmp(base + header->model_offset, model_buf, model_size) != 0) {
+    MS_LOG(WARNING) << "pack weight file " << path_ << " is not written for the model, do not use it.";
+    Unmap();
+    return false;
+  }
+  if (!(header->fingerprint == GetPackWeightFingerprint())) {
+    MS_LOG(WARNING) << "pack weight file " << path_ << " is packed for another isa, repack the weights.";
+    Unmap();
+    return false;
+  }
+  auto entries = reinterpret_cast<const PackWeightFileEntry *>(base + sizeof(PackWeightFileHeader));
+  for (size_t i = 0; i < header->entry_num; i++) {
+    const auto &entry = entries[i];
+    if (entry.data_offset > file_size || entry.size > file_size - entry.data_offset) {
+      MS_LOG(WARNING) << "pack weight file " << path_ << " is broken, do not use it.";
+      Unmap();
+      return false;
+    }
+    pack_data_[{entry.origin_offset, entry.size}] = base + entry.data_offset;
+  }
+  model_buf_ = base + header->model_offset;
+  MS_LOG(INFO) << "map pack weight file " << path_ << " with " << pack_data_.size() << " packed weights.";
+  return true;
+#else
+  return false;
+#endif
+}
+
+void *PackWeightFile::GetPackData(const PackWeightKey &key) const {
+  auto iter = pack_data_.find(key);
+  return iter == pack_data_.end() ? nullptr : iter->second;
+}
+
+bool PackWeightFile::Contains(const void *data) const {
+  auto begin = static_cast<const char *>(addr_);
+  auto ptr = static_cast<const char *>(data);
+  return addr_ != nullptr && ptr >= begin && ptr < begin + file_size_;
+}
+
+bool PackWeightFile::Save(const void *model_buf, size_t model_size,
+                          const std::map<PackWeightKey, const void *> &pack_data) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  // Several processes may pack the model at the same time, merge under the lock so none of them drops the others.
+  auto lock_file = path_ + ".lock";
+  int fd = open(lock_file.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(WARNING) << "open lock file " << lock_file << " failed, the pack weight file is not saved.";
+    return false;
+  }
+  (void)flock(fd, LOCK_EX);
+  PackWeightFile written(path_);
+  std::map<PackWeightKey, const void *> merged;
+  if (written.Load(model_buf, model_size)) {
+    merged.insert(written.pack_data_.begin(), written.pack_data_.end());
+  }
+  auto written_num = merged.size();
+  merged.insert(pack_data.begin(), pack_data.end());
+  if (written.loaded() && merged.size() == written_num) {
+    (void)flock(fd, LOCK_UN);
+    (void)close(fd);
+    return true;
+  }
+
+  PackWeightFileHeader header;
+  (void)memcpy(header.magic, kPackWeightFileMagic, sizeof(kPackWeightFileMagic));
+  header.version = kPackWeightFileVersion;
+  header.fingerprint = GetPackWeightFingerprint();
+  header.model_size = model_size;
+  header.entry_num = merged.size();
+  header.model_offset =
+    AlignUp(sizeof(PackWeightFileHeader) + merged.size() * sizeof(PackWeightFileEntry), kModelBufAlignSize);
+  std::vector<PackWeightFileEntry> entries;
+  auto data_offset = header.model_offset + model_size;
+  for (const auto &item : merged) {
+    data_offset = AlignUp(data_offset, kPackDataAlignSize);
+    entries.push_back({item.first.first, item.first.second, data_offset});
+    data_offset += item.first.second;
+  }
+  // Write a temporary file and rename it, the processes mapping the old file keep their mapping.
+  auto tmp_path = path_ + ".tmp";
+  std::ofstream ofs(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  bool saved = ofs.is_open();
+  if (saved) {
+    size_t written_size = sizeof(PackWeightFileHeader) + entries.size() * sizeof(PackWeightFileEntry);
+    (void)ofs.write(reinterpret_cast<const char *>(&header), sizeof(PackWeightFileHeader));
+    (void)ofs.write(reinterpret_cast<const char *>(entries.data()),
+                    static_cast<std::streamsize>(entries.size() * sizeof(PackWeightFileEntry)));
+    saved = WritePadding(&ofs, &written_size, kModelBufAlignSize);
+    (void)ofs.write(static_cast<const char *>(model_buf), static_cast<std::streamsize>(model_size));
+    written_size += model_size;
+    for (const auto &item : merged) {
+      saved = saved && WritePadding(&ofs, &written_size, kPackDataAlignSize);
+      (void)ofs.write(static_cast<const char *>(item.second), static_cast<std::streamsize>(item.first.second));
+      written_size += item.first.second;
+    }
+    ofs.close();
+    saved = saved && !ofs.fail() && std::rename(tmp_path.c_str(), path_.c_str()) == 0;
+  }
+  if (saved) {
+    MS_LOG(INFO) << "save " << merged.size() - written_num << " new packed weights to " << path_;
+  } else {
+    MS_LOG(WARNING) << "write pack weight file " << path_ << " failed.";
+    (void)std::remove(tmp_path.c_str());
+  }
+  (void)flock(fd, LOCK_UN);
+  (void)close(fd);
+  return saved;
+#else
+  MS_LOG(WARNING) << "pack weight file is not supported on windows.";
+  return false;
+#endif
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_LITERT_PACK_WEIGHT_FILE_H_
+#define MINDSPORE_LITE_SRC_LITERT_PACK_WEIGHT_FILE_H_
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace mindspore::lite {
+// offset of the origin tensor data in the model buf, size of the packed data
+using PackWeightKey = std::pair<size_t, size_t>;
+
+// A file holding the model buf and the packed weights of one model, written once and mapped by every process running
+// the model, so the processes share one copy of the weights in the page cache and skip repacking. The file is
+// |header|entries|model buf|packed data|, the packed data is keyed by the offset of its origin tensor data in the model
+// buf. The file is mapped private: the pages stay shared until a kernel writes them, which then gets its own copy.
+class PackWeightFile {
+ public:
+  explicit PackWeightFile(std::string path) : path_(std::move(path)) {}
+  ~PackWeightFile();
+
+  // Maps the file, returns false when the file does not exist, is written for another model or is packed for another
+  // isa, whose weights are packed again then.
+  bool Load(const void *model_buf, size_t model_size);
+  bool loaded() const { return addr_ != nullptr; }
+
+  // the model buf in the file, nullptr when not loaded
+  char *model_buf() const { return model_buf_; }
+  // the packed data in the file, nullptr when not found
+  void *GetPackData(const PackWeightKey &key) const;
+  // whether the data is in the mapped file, which is not freed by the allocator
+  bool Contains(const void *data) const;
+
+  // Writes the model buf and the packed data to the file, keeping the packed data already written by other processes.
+  bool Save(const void *model_buf, size_t model_size, const std::map<PackWeightKey, const void *> &pack_data);
+
+ private:
+  void Unmap();
+
+  std::string path_;
+  void *addr_ = nullptr;
+  size_t file_size_ = 0;
+  char *model_buf_ = nullptr;
+  std::map<PackWeightKey, void *> pack_data_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_LITERT_PACK_WEIGHT_FILE_H_
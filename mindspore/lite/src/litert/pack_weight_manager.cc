@@ -74,6 +74,21 @@ bool ParseCopyBuf(const std::map<std::string, std::map<std::string, std::string>
   }
   return need_copy;
 }
+
+std::string ParsePackWeightFile(const std::map<std::string, std::map<std::string, std::string>> *config_info) {
+  std::string weight_file = "";
+  if (config_info == nullptr) {
+    return weight_file;
+  }
+  auto it_pack = config_info->find(kPackWeightSection);
+  if (it_pack != config_info->end()) {
+    auto item_file = it_pack->second.find(kPackWeightFileKey);
+    if (item_file != it_pack->second.end()) {
+      weight_file = item_file->second;
+    }
+  }
+  return weight_file;
+}
 #endif
 }  // namespace
 
@@ -121,7 +136,8 @@ STATUS PackWeightManager::InitPackWeightManager(
     id = *model_id;
   }
   bool need_copy_buf = ParseCopyBuf(config_info);
-  return pack_weight_->InitPackWeight(static_cast<const void *>(model_buf), model_size, id, numa_id, need_copy_buf);
+  return pack_weight_->InitPackWeight(static_cast<const void *>(model_buf), model_size, id, numa_id, need_copy_buf,
+                                      ParsePackWeightFile(config_info));
 #endif
   return RET_OK;
 }
@@ -182,6 +198,19 @@ STATUS PackWeightManager::StoreOriginTensorData(Model *model, std::vector<Tensor
   return RET_OK;
 }
 
+void PackWeightManager::SavePackWeight(const Model *model) {
+#ifdef SHARING_MODEL_WEIGHT
+  if (model == nullptr || pack_weight_ == nullptr) {
+    return;
+  }
+  auto lite_model = reinterpret_cast<const LiteModel *>(model);
+  if (pack_weight_->SavePackWeight(lite_model->buf) != RET_OK) {
+    MS_LOG(WARNING) << "save pack weight failed, the other processes pack the weights again.";
+  }
+#endif
+  return;
+}
+
 void *PackWeightManager::ReplaceFp16Data(void *origin_fp16_data, size_t size, bool *replace) {
 #ifdef SHARING_MODEL_WEIGHT
   *replace = true;
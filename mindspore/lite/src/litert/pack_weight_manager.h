@@ -39,6 +39,8 @@ class PackWeightManager {
                           bool *is_shared);
   STATUS StoreOriginTensorData(Model *model, std::vector<Tensor *> *all_tensors);
   void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed);
+  // saves the weights packed while compiling the model to the pack weight file configured for the model
+  void SavePackWeight(const Model *model);
   void Free(void *tensor_data);
   bool IsCopyTensor(int op_type);
   void *ReplaceFp16Data(void *origin_fp16_data, size_t size, bool *replace);
@@ -0,0 +1,185 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/dynamic_matmul_int8.h"
+#include "nnacl/int8/matmul_vnni_int8.h"
+#include "nnacl/int8/fixed_point.h"
+#include "nnacl/int8/quantize.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+
+namespace mindspore {
+class MatmulVnniInt8Test : public mindspore::CommonTest {
+ public:
+  MatmulVnniInt8Test() {}
+  void SetUp() override {
+#if defined(ENABLE_AVX) || defined(ENABLE_AVX512)
+    IntelX86CpuInfoInit();
+#endif
+  }
+};
+
+namespace {
+struct MatmulShape {
+  int row;
+  int col;
+  int deep;
+};
+
+// Odd shapes cover the tails of rows, columns and deep besides the whole tiles.
+const MatmulShape kShapes[] = {{1, 1, 1}, {4, 16, 16}, {5, 7, 33}, {13, 37, 100}, {64, 70, 513}, {3, 129, 2000}};
+
+std::vector<int8_t> RandomInt8(int size, std::mt19937 *gen) {
+  std::uniform_int_distribution<int> dist(INT8_MIN, INT8_MAX);
+  std::vector<int8_t> data(size);
+  for (auto &value : data) {
+    value = static_cast<int8_t>(dist(*gen));
+  }
+  return data;
+}
+
+// a of row * deep and b of col * deep, both row-major.
+std::vector<int32_t> NaiveMatmul(const std::vector<int8_t> &a, const std::vector<int8_t> &b, int row, int col,
+                                 int deep) {
+  std::vector<int32_t> dst(row * col, 0);
+  for (int r = 0; r < row; ++r) {
+    for (int c = 0; c < col; ++c) {
+      for (int d = 0; d < deep; ++d) {
+        dst[r * col + c] += a[r * deep + d] * b[c * deep + d];
+      }
+    }
+  }
+  return dst;
+}
+
+std::vector<int8_t> PackRow16x4(const std::vector<int8_t> &src, int row, int deep) {
+  std::vector<int8_t> packed(UP_ROUND(row, C4NUM) * UP_ROUND(deep, C16NUM), 0);
+  RowMajor2Row16x4MajorInt8(src.data(), packed.data(), row, deep);
+  return packed;
+}
+}  // namespace
+
+TEST_F(MatmulVnniInt8Test, MatmulInt8Opt) {
+  MS_LOG(INFO) << "Vnni int8 kernels supported: " << MatmulInt8VnniSupport();
+  std::mt19937 gen(0);
+  const int out_zp = 3;
+  for (const auto &shape : kShapes) {
+    int row = shape.row;
+    int col = shape.col;
+    int deep16 = UP_ROUND(shape.deep, C16NUM);
+    auto a = RandomInt8(row * shape.deep, &gen);
+    auto b = RandomInt8(col * shape.deep, &gen);
+    auto packed_a = PackRow16x4(a, row, shape.deep);
+    auto packed_b = PackRow16x4(b, col, shape.deep);
+    auto expect_int32 = NaiveMatmul(a, b, row, col, shape.deep);
+
+    int col4 = UP_ROUND(col, C4NUM);
+    std::vector<int32_t> a_sums(UP_ROUND(row, C4NUM));
+    std::vector<int32_t> bias(col4);
+    std::vector<int32_t> filter_zp(col4);
+    std::vector<int32_t> multiplier(col4);
+    std::vector<int32_t> left_shift(col4);
+    std::vector<int32_t> right_shift(col4);
+    for (size_t i = 0; i < a_sums.size(); ++i) {
+      a_sums[i] = static_cast<int32_t>(gen() % 1000) - 500;
+    }
+    for (int i = 0; i < col4; ++i) {
+      bias[i] = static_cast<int32_t>(gen() % 10000) - 5000;
+      filter_zp[i] = i % 5 - 2;
+      QuantizeRoundParameterWithDoublePrecision(0.0005 + 0.0001 * (i % 7), &multiplier[i], &left_shift[i],
+                                                &right_shift[i]);
+    }
+    for (size_t peroc = 0; peroc < 2; ++peroc) {
+      std::vector<int8_t> out(row * col);
+      MatmulInt8Opt(packed_a.data(), packed_b.data(), out.data(), row, col, deep16, a_sums.data(), bias.data(),
+                    INT8_MIN, INT8_MAX, out_zp, multiplier.data(), left_shift.data(), right_shift.data(), col, peroc,
+                    filter_zp.data());
+      for (int r = 0; r < row; ++r) {
+        for (int c = 0; c < col; ++c) {
+          int index = peroc ? c : 0;
+          int32_t value = expect_int32[r * col + c] - (peroc ? a_sums[r] * filter_zp[c] : a_sums[r]) + bias[c];
+          value =
+            MultiplyByQuantizedMultiplier(value, multiplier[index], left_shift[index], right_shift[index]) + out_zp;
+          value = MSMAX(INT8_MIN, MSMIN(INT8_MAX, value));
+          ASSERT_EQ(out[r * col + c], static_cast<int8_t>(value));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(MatmulVnniInt8Test, DynamicMatmul4x16x4AIWI) {
+  std::mt19937 gen(1);
+  for (const auto &shape : kShapes) {
+    int row = shape.row;
+    int col = shape.col;
+    int deep = shape.deep;
+    auto a = RandomInt8(row * deep, &gen);
+    auto b = RandomInt8(col * deep, &gen);
+    auto packed_a = PackRow16x4(a, row, deep);
+    auto packed_b = PackRow16x4(b, col, deep);
+    auto expect_int32 = NaiveMatmul(a, b, row, col, deep);
+
+    std::vector<float> input_scale(row);
+    std::vector<float> filter_scale(col);
+    std::vector<float> bias(col);
+    for (int i = 0; i < row; ++i) {
+      input_scale[i] = 0.01f + i * 0.001f;
+    }
+    for (int i = 0; i < col; ++i) {
+      filter_scale[i] = 0.02f + i * 0.0007f;
+      bias[i] = i * 0.1f - 3.0f;
+    }
+    for (int input_zp : {0, -3}) {
+      for (int filter_zp : {0, 2}) {
+        for (int64_t act_type : {ActType_No, ActType_Relu, ActType_Relu6}) {
+          bool per_channel = act_type != ActType_No;
+          std::vector<float> out(row * col);
+          DynamicMatmul4x16x4AIWI(packed_a.data(), packed_b.data(), bias.data(), out.data(), row, col, deep,
+                                  UP_ROUND(deep, C16NUM), col, input_zp, input_scale.data(), filter_scale.data(),
+                                  filter_zp, per_channel, per_channel, act_type);
+          for (int r = 0; r < row; ++r) {
+            int32_t a_sum = 0;
+            for (int d = 0; d < deep; ++d) {
+              a_sum += a[r * deep + d];
+            }
+            for (int c = 0; c < col; ++c) {
+              int32_t b_sum = 0;
+              for (int d = 0; d < deep; ++d) {
+                b_sum += b[c * deep + d];
+              }
+              int32_t value = expect_int32[r * col + c] - filter_zp * a_sum - input_zp * b_sum +
+                              deep * input_zp * filter_zp;
+              float multi_scale = input_scale[per_channel ? r : 0] * filter_scale[per_channel ? c : 0];
+              float expect = multi_scale * value;
+              expect += bias[c];
+              if (act_type != ActType_No) {
+                expect = MSMAX(0, expect);
+              }
+              if (act_type == ActType_Relu6) {
+                expect = MSMIN(C6NUM, expect);
+              }
+              ASSERT_EQ(out[r * col + c], expect);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace mindspore
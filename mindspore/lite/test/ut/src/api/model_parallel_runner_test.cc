@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 #include "include/api/model_parallel_runner.h"
+#include <cmath>
 #include <memory>
+#include <thread>
 #include "common/common_test.h"
 #include "src/common/file_utils.h"
+#include "src/extendrt/cxx_api/model_pool/model_parallel_runner_impl.h"
 
 namespace mindspore {
 namespace {
@@ -193,6 +196,73 @@ TEST_F(ModelParallelRunnerTest, RunnerPredict) {
   }
 }
 
+TEST_F(ModelParallelRunnerTest, RunnerPredictWithDynamicBatching) {
+  auto config = std::make_shared<RunnerConfig>();
+  ASSERT_NE(nullptr, config);
+
+  auto context = std::make_shared<Context>();
+  ASSERT_NE(nullptr, context);
+  auto &device_list = context->MutableDeviceInfo();
+  auto device_info = std::make_shared<mindspore::CPUDeviceInfo>();
+  ASSERT_NE(nullptr, device_info);
+  device_list.push_back(device_info);
+  ASSERT_EQ(device_list.size(), 1);
+
+  config->SetContext(context);
+  config->SetWorkersNum(1);
+  // the delay is long enough for the concurrent requests to fill the batch
+  config->SetConfigInfo("dynamic_batching", {{"max_batch_size", "4"}, {"max_queue_delay_us", "100000"}});
+  // the runner impl exposes the batcher stats
+  ModelParallelRunnerImpl runner;
+  auto status = runner.Init(model_path, config);
+  ASSERT_EQ(status, kSuccess);
+
+  auto inputs = runner.GetInputs();
+  SetInputTensorData(&inputs);
+  // the first predict warms up the workers
+  std::vector<MSTensor> outputs;
+  status = runner.Predict(inputs, &outputs);
+  ASSERT_EQ(status, kSuccess);
+  std::vector<MSTensor> expect_outputs;
+  status = runner.Predict(inputs, &expect_outputs);
+  ASSERT_EQ(status, kSuccess);
+  ASSERT_EQ(expect_outputs.size(), 1);
+  ASSERT_EQ(expect_outputs[0].DataSize(), kOutputDataSize);
+
+  // the concurrent requests are batched, each of them gets the output of its own sample
+  const size_t kRequestNum = 4;
+  std::vector<std::vector<MSTensor>> all_outputs(kRequestNum);
+  std::vector<Status> all_status(kRequestNum);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kRequestNum; i++) {
+    threads.emplace_back([&, i]() { all_status[i] = runner.Predict(inputs, &all_outputs[i]); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto expect_data = static_cast<const float *>(expect_outputs[0].Data().get());
+  for (size_t i = 0; i < kRequestNum; i++) {
+    ASSERT_EQ(all_status[i], kSuccess);
+    ASSERT_EQ(all_outputs[i].size(), 1);
+    ASSERT_EQ(all_outputs[i][0].Shape(), expect_outputs[0].Shape());
+    auto data = static_cast<const float *>(all_outputs[i][0].Data().get());
+    for (size_t j = 0; j < kOutputDataSize / sizeof(float); j++) {
+      ASSERT_LE(std::fabs(data[j] - expect_data[j]), 1e-4);
+    }
+  }
+  auto stats = runner.GetDynamicBatcherStats();
+  ASSERT_EQ(stats.request_num, kRequestNum + 2);
+  ASSERT_EQ(stats.sample_num, kRequestNum + 2);
+  ASSERT_GT(stats.max_batch_samples, 1);
+  ASSERT_LT(stats.batch_num, stats.request_num);
+  // free user data
+  for (auto &tensor : inputs) {
+    char *data = static_cast<char *>(tensor.MutableData());
+    delete[] data;
+    tensor.SetData(nullptr);
+  }
+}
+
 TEST_F(ModelParallelRunnerTest, RunnerInitByBuf) {
   auto config = std::make_shared<RunnerConfig>();
   ASSERT_NE(nullptr, config);
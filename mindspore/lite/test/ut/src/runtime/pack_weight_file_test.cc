@@ -0,0 +1,98 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef SHARING_MODEL_WEIGHT
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/pack_weight_file.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kModelSize = 10000;
+constexpr size_t kPackSize = 400;
+constexpr size_t kPackSize2 = 132;
+constexpr size_t kOriginOffset = 16;
+constexpr size_t kOriginOffset2 = 32;
+}  // namespace
+class PackWeightFileTest : public mindspore::CommonTest {
+ public:
+  PackWeightFileTest() = default;
+
+  void SetUp() override {
+    RemoveFiles();
+    model_.resize(kModelSize);
+    for (size_t i = 0; i < model_.size(); i++) {
+      model_[i] = static_cast<char>(i);
+    }
+    pack_.resize(kPackSize, 1);
+    pack2_.resize(kPackSize2, 2);
+  }
+  void TearDown() override { RemoveFiles(); }
+
+  void RemoveFiles() {
+    (void)std::remove(path_.c_str());
+    (void)std::remove((path_ + ".lock").c_str());
+  }
+
+  std::string path_ = "./pack_weight_file_test.bin";
+  std::vector<char> model_;
+  std::vector<char> pack_;
+  std::vector<char> pack2_;
+};
+
+TEST_F(PackWeightFileTest, TestSaveAndLoad) {
+  {
+    lite::PackWeightFile weight_file(path_);
+    ASSERT_FALSE(weight_file.Load(model_.data(), model_.size()));
+    ASSERT_TRUE(weight_file.Save(model_.data(), model_.size(), {{{kOriginOffset, kPackSize}, pack_.data()}}));
+  }
+  lite::PackWeightFile weight_file(path_);
+  ASSERT_TRUE(weight_file.Load(model_.data(), model_.size()));
+  ASSERT_EQ(memcmp(weight_file.model_buf(), model_.data(), model_.size()), 0);
+  auto data = weight_file.GetPackData({kOriginOffset, kPackSize});
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(memcmp(data, pack_.data(), kPackSize), 0);
+  ASSERT_TRUE(weight_file.Contains(data));
+  ASSERT_FALSE(weight_file.Contains(pack_.data()));
+  ASSERT_EQ(weight_file.GetPackData({kOriginOffset, kPackSize2}), nullptr);
+}
+
+TEST_F(PackWeightFileTest, TestMergeOnSave) {
+  lite::PackWeightFile first(path_);
+  lite::PackWeightFile second(path_);
+  ASSERT_TRUE(first.Save(model_.data(), model_.size(), {{{kOriginOffset, kPackSize}, pack_.data()}}));
+  ASSERT_TRUE(second.Save(model_.data(), model_.size(), {{{kOriginOffset2, kPackSize2}, pack2_.data()}}));
+  lite::PackWeightFile weight_file(path_);
+  ASSERT_TRUE(weight_file.Load(model_.data(), model_.size()));
+  ASSERT_NE(weight_file.GetPackData({kOriginOffset, kPackSize}), nullptr);
+  auto data = weight_file.GetPackData({kOriginOffset2, kPackSize2});
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(memcmp(data, pack2_.data(), kPackSize2), 0);
+}
+
+TEST_F(PackWeightFileTest, TestOtherModel) {
+  lite::PackWeightFile writer(path_);
+  ASSERT_TRUE(writer.Save(model_.data(), model_.size(), {{{kOriginOffset, kPackSize}, pack_.data()}}));
+  auto other_model = model_;
+  other_model[kModelSize / 2] += 1;
+  lite::PackWeightFile weight_file(path_);
+  ASSERT_FALSE(weight_file.Load(other_model.data(), other_model.size()));
+  ASSERT_EQ(weight_file.model_buf(), nullptr);
+}
+}  // namespace mindspore
+#endif
@@ -0,0 +1,163 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""Lazy eager mode of cell in PyNative mode."""
+from mindspore import log as logger
+from mindspore.common.api import _pynative_executor, _MindsporeFunctionExecutor
+from mindspore.common.tensor import Tensor
+from mindspore.common._stub_tensor import StubTensor
+
+# The compiled graph is replayed for the number of calls before the cell runs eagerly again to check its op trace.
+_VALIDATE_STEPS = 100
+
+
+def _get_signature(args):
+    """The shapes and types of tensors and the values of scalars, None if an input can not be a guard."""
+    signature = []
+    for arg in args:
+        if isinstance(arg, (Tensor, StubTensor)):
+            signature.append((tuple(arg.shape), arg.dtype))
+        elif arg is None or isinstance(arg, (bool, int, float, str)):
+            signature.append((type(arg), arg))
+        elif isinstance(arg, (tuple, list)):
+            sub_signature = _get_signature(arg)
+            if sub_signature is None:
+                return None
+            signature.append((type(arg), sub_signature))
+        else:
+            return None
+    return tuple(signature)
+
+
+def _get_cell_state(cell):
+    """The training flag and the public scalar attributes of cell, which the compiled graph takes as constants."""
+    state = [cell.training]
+    for name, value in vars(cell).items():
+        if name.startswith('_'):
+            continue
+        if value is None or isinstance(value, (bool, int, float, str)):
+            state.append((name, value))
+        elif isinstance(value, tuple):
+            sub_signature = _get_signature(value)
+            if sub_signature is not None:
+                state.append((name, sub_signature))
+    return tuple(state)
+
+
+class _ConstructExecutor(_MindsporeFunctionExecutor):
+    """The jit executor of the construct of cell, whose graph is cached apart from the other graphs of the cell."""
+
+    def __init__(self, cell, graph_id):
+        super().__init__(type(cell).construct, 0, None, cell)
+        self.graph_id = graph_id
+
+    def compile_construct(self, args):
+        """Compile the construct of cell as jit does, the later calls of the executor reuse the compiled graph."""
+        _pynative_executor.set_jit_compile_status(True, "")
+        try:
+            phase = self.compile("construct", *args)
+        except Exception as err:
+            _pynative_executor.set_jit_compile_status(False, "")
+            _pynative_executor.clear_res()
+            raise err
+        _pynative_executor.set_jit_compile_status(False, phase)
+
+    def _get_generate_name(self):
+        generate_name, echo_function_name = super()._get_generate_name()
+        return f"{generate_name}.lazy_eager.{self.graph_id}", echo_function_name
+
+
+class _CompiledGraph:
+    """The executor of a compiled graph, the op trace it is compiled from and the number of calls replaying it."""
+
+    def __init__(self, executor, trace):
+        self.executor = executor
+        self.trace = trace
+        self.replay_times = 0
+
+
+class LazyEager:
+    """
+    Run a cell eagerly and record the types of the ops it runs for each signature of inputs and state of the cell. Once
+    the cell runs the same ops for `warmup_steps` calls in a row with a signature and a state, the cell is compiled and
+    the later calls with them replay the compiled graph. The calls with a new signature or state run eagerly, and the
+    ones whose graph fails to compile keep running eagerly.
+
+    The control flow of the cell may also depend on the attributes of its sub cells or the global variables, which are
+    not guarded. So the cell runs eagerly once every `validate_steps` replays of a graph, and the graph is dropped and
+    warmed up again if the op trace differs from the one it is compiled from.
+    """
+
+    def __init__(self, warmup_steps, validate_steps=_VALIDATE_STEPS):
+        self.warmup_steps = warmup_steps
+        self.validate_steps = validate_steps
+        # (signature, state) -> (hash of op trace, number of calls in a row with the trace)
+        self.traces = {}
+        self.graphs = {}
+        self.failed = set()
+        # Each graph is compiled with a new phase so that a graph dropped for a stale trace is not reused.
+        self.graph_num = 0
+
+    def run_construct(self, cell, args, kwargs):
+        """Run the construct of cell eagerly or by the compiled graph."""
+        signature = None if kwargs else _get_signature(args)
+        if signature is None:
+            return cell._run_construct(args, kwargs)  # pylint: disable=protected-access
+        key = (signature, _get_cell_state(cell))
+        if key in self.failed:
+            return cell._run_construct(args, kwargs)  # pylint: disable=protected-access
+        graph = self.graphs.get(key)
+        if graph is not None and graph.replay_times < self.validate_steps:
+            graph.replay_times += 1
+            return graph.executor(cell, *args)
+        if graph is None and key in self.traces and self.traces[key][1] >= self.warmup_steps:
+            return self._run_first_graph(cell, key, args, kwargs)
+
+        _pynative_executor.begin_op_trace()
+        try:
+            output = cell._run_construct(args, kwargs)  # pylint: disable=protected-access
+        finally:
+            trace = _pynative_executor.end_op_trace()
+        if graph is not None:
+            if trace == graph.trace:
+                graph.replay_times = 0
+                return output
+            logger.info(f"The lazy eager mode of cell '{cell.cls_name}' drops the compiled graph whose op trace is "
+                        f"changed, and warms up again.")
+            del self.graphs[key]
+        last_trace, run_times = self.traces.get(key, (None, 0))
+        run_times = run_times + 1 if trace == last_trace else 1
+        self.traces[key] = (trace, run_times)
+        return output
+
+    def _run_first_graph(self, cell, key, args, kwargs):
+        """
+        Compile and run the construct of cell for the key. Only the failure of compiling falls back to eager, since the
+        graph may have run partly, such as updating the parameters, when it fails to run.
+        """
+        trace, _ = self.traces.pop(key)
+        self.graph_num += 1
+        executor = _ConstructExecutor(cell, self.graph_num)
+        try:
+            executor.compile_construct(args)
+        except Exception as err:  # pylint: disable=broad-except
+            logger.warning(f"The lazy eager mode of cell '{cell.cls_name}' fails to compile the graph and runs "
+                           f"eagerly, error: {err}")
+            self.failed.add(key)
+            return cell._run_construct(args, kwargs)  # pylint: disable=protected-access
+        logger.info(f"The lazy eager mode of cell '{cell.cls_name}' replays the compiled graph for the inputs.")
+        graph = _CompiledGraph(executor, trace)
+        self.graphs[key] = graph
+        graph.replay_times += 1
+        return executor(cell, *args)
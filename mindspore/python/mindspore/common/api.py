@@ -1420,6 +1420,24 @@ class _PyNativeExecutor:
         """
         self._executor.set_jit_compile_status(status, phase)
 
+    def begin_op_trace(self):
+        """
+        Begin to record the types of the ops run, the traces can be nested.
+
+        Return:
+            None.
+        """
+        self._executor.begin_op_trace()
+
+    def end_op_trace(self):
+        """
+        End the latest op trace.
+
+        Return:
+            int, the hash of the types of the ops run in the trace.
+        """
+        return self._executor.end_op_trace()
+
     def set_dynamic_input(self, obj, *args):
         """
         Set dynamic shape tensor of input arguments.
@@ -1045,6 +1045,12 @@ def set_offload_context(offload_config):
             - enable_aio (bool): The flag of whether enabling aio. Default: ``True``.
             - aio_block_size (str): The size of aio block. The format is "xxGB".
             - aio_queue_depth (int): The depth of aio queue.
+            - aio_backend (str): The backend of aio, ``"libaio"`` or ``"io_uring"``. ``"io_uring"`` submits the
+              io with fewer syscalls and falls back to ``"libaio"`` if the kernel does not support it.
+              Default: ``"libaio"``.
+            - enable_host_compression (bool): The flag of whether compressing the large tensors which stay in cpu
+              memory for a long time, they are decompressed on background threads ahead of being used.
+              Default: ``False``.
             - offload_param (str):  The param for offload destination, cpu or disk, Default: ``""``.
             - offload_checkpoint (str):  The checkpoint for offload destination, only valid if recompute is turned on,
               cpu or disk, Default: ``""``.
@@ -25,6 +25,7 @@ import numpy
 
 from mindspore._checkparam import args_type_check, check_hook_fn
 from mindspore.common._auto_dynamic import is_auto_dynamic, convert_inputs_to_dynamic
+from mindspore.common._lazy_eager import LazyEager
 from mindspore import log as logger
 from mindspore.common.parameter import PARAMETER_NAME_DEFAULT
 from mindspore.common.hook_handle import HookHandle
@@ -104,7 +105,7 @@ class Cell(Cell_):
                    '_func_graph_flags', '_parameter_layout_dict', '_params_list', '_phase',
                    '_forward_pre_hook', '_forward_hook', '_enable_forward_pre_hook', '_enable_forward_hook',
                    '_bprop_debug', '_enable_backward_hook', '_cell_backward_hook', '_is_run', '_param_prefix',
-                   '_attr_synced', 'pynative', 'requires_grad', 'cell_type']
+                   '_attr_synced', 'pynative', 'requires_grad', 'cell_type', '_lazy_eager']
 
     def __init__(self, auto_prefix=True, flags=None):
         Cell_.__init__(self, self._cell_tag)
@@ -161,6 +162,7 @@ class Cell(Cell_):
         self.ge_sync_data = False
         self._is_check_and_refresh = False
         self._amp_level = ""
+        self._lazy_eager = None
         self._init_flag = False
 
     def __getstate__(self):
@@ -708,7 +710,11 @@ class Cell(Cell_):
 
         try:
             _pynative_executor.new_graph(self, *args, **kwargs)
-            output = self._run_construct(args, kwargs)
+            if self._lazy_eager is not None and not (self._enable_forward_pre_hook or self._enable_forward_hook or
+                                                     self._enable_backward_hook):
+                output = self._lazy_eager.run_construct(self, args, kwargs)
+            else:
+                output = self._run_construct(args, kwargs)
             _pynative_executor.end_graph(self, output, *args, **kwargs)
         except Exception as err:
             _pynative_executor.clear_res()
@@ -1919,6 +1925,43 @@ class Cell(Cell_):
         else:
             self._jit_config_dict = jit_config.jit_config_dict
 
+    def set_lazy_eager(self, enable=True, warmup_steps=2):
+        """
+        Set the lazy eager mode of cell in PyNative mode.
+
+        In lazy eager mode, the cell runs eagerly and the types of the ops it runs are recorded for each signature of
+        inputs, which consists of the shapes and types of the input tensors and the values of the input scalars, and
+        for each state of the cell, which consists of the training flag and the public scalar attributes of the cell.
+        Once the cell runs the same ops for `warmup_steps` calls in a row with a signature and a state, the cell is
+        compiled to a graph, in which the ops are fused and the memory is reused, and the later calls with them run the
+        graph. The calls with a new signature or state, with keyword arguments or with hooks run eagerly, and the ones
+        whose graph fails to compile keep running eagerly.
+
+        Note:
+            - The control flow of the construct depending on the other states, such as the attributes of the sub cells
+              or the global variables, is only checked by running the cell eagerly once every 100 replays of a graph,
+              which is compiled again if the cell runs different ops.
+            - It only takes effect in PyNative mode.
+
+        Args:
+            enable (bool): Whether to enable the lazy eager mode. Default: ``True`` .
+            warmup_steps (int): The number of calls in a row running the same ops before the cell is compiled,
+                which should be positive. Default: ``2`` .
+
+        Supported Platforms:
+            ``Ascend`` ``GPU`` ``CPU``
+
+        Examples:
+            >>> import mindspore as ms
+            >>> from mindspore import nn
+            >>> ms.set_context(mode=ms.PYNATIVE_MODE)
+            >>> net = nn.Dense(3, 4)
+            >>> net.set_lazy_eager(warmup_steps=2)
+        """
+        Validator.check_bool(enable, "enable", self.cls_name)
+        Validator.check_positive_int(warmup_steps, "warmup_steps", self.cls_name)
+        self._lazy_eager = LazyEager(warmup_steps) if enable else None
+
     def flatten_weights(self, fusion_size=0):
         """
         Reset data for weight parameters so that they are using contiguous memory chunks grouped by data type.
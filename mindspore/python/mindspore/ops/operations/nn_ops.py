@@ -10130,8 +10130,13 @@ class FlashAttentionScore(Primitive):
         - **attention_out** (Tensor[float16, bfloat16]) - The output of attention, its shape, and data type
           are the same as the query.
 
+    Note:
+        On CPU, `query`, `key` and `value` can also be float32, the sparse_mode should be in [0, 4], keep_prob should be
+        1.0, and `real_shift`, `drop_mask`, `padding_mask` and `prefix` should be None. The content of the optimized
+        attn_mask is not read, the mask is computed from sparse_mode, pre_tokens and next_tokens.
+
     Supported Platforms:
-        ``Ascend910B``
+        ``Ascend910B`` ``CPU``
     """
 
     @prim_attr_register
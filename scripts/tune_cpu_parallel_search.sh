@@ -0,0 +1,80 @@
+#!/bin/bash
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+# Pre-tunes the parallel search cache of the CPU kernels offline: runs a representative job in tune mode, which
+# searches the block size of every kernel configuration again and appends the results to the cache file, then
+# compacts the file to one line per kernel configuration. The file is then shipped with
+# MS_CPU_PARALLEL_SEARCH_CACHE=<cache_file> MS_CPU_PARALLEL_SEARCH_CACHE_MODE=read_only.
+
+set -e
+
+usage()
+{
+    echo "Usage:"
+    echo "bash tune_cpu_parallel_search.sh [-n run_times] cache_file command [args...]"
+    echo ""
+    echo "    -n  Run the command n times to tune more shapes, default 1"
+}
+
+RUN_TIMES=1
+while getopts 'n:h' opt; do
+    case "${opt}" in
+        n)
+            RUN_TIMES="${OPTARG}"
+            ;;
+        *)
+            usage
+            exit 1
+            ;;
+    esac
+done
+shift $((OPTIND - 1))
+if [[ $# -lt 2 ]]; then
+    usage
+    exit 1
+fi
+CACHE_FILE=$(realpath "$1")
+shift
+
+for ((i = 1; i <= RUN_TIMES; i++)); do
+    echo "Tune the parallel search cache ${CACHE_FILE}, run ${i} of ${RUN_TIMES}: $*"
+    MS_CPU_PARALLEL_SEARCH_CACHE="${CACHE_FILE}" MS_CPU_PARALLEL_SEARCH_CACHE_MODE=tune "$@"
+done
+
+if [[ ! -f "${CACHE_FILE}" ]]; then
+    echo "No kernel is tuned, the command may not run any CPU kernel searching the parallel block size."
+    exit 1
+fi
+
+# The job compacts the file when it shuts down normally, compact it again in case it exited early. A later line of the
+# same key overrides the earlier ones, the same as the file is loaded.
+exec 9>"${CACHE_FILE}.lock"
+flock 9
+awk 'match($0, /^[0-9]+[ \t]+/) && RLENGTH < length($0) {
+         key = substr($0, RLENGTH + 1)
+         if (!(key in pows)) {
+             keys[n++] = key
+         }
+         pows[key] = substr($0, 1, RLENGTH)
+     }
+     END {
+         for (i = 0; i < n; i++) {
+             print pows[keys[i]] keys[i]
+         }
+     }' "${CACHE_FILE}" > "${CACHE_FILE}.tmp"
+mv "${CACHE_FILE}.tmp" "${CACHE_FILE}"
+flock -u 9
+echo "Tuned $(wc -l < "${CACHE_FILE}") kernel configurations in ${CACHE_FILE}"
@@ -0,0 +1,49 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""PyNative op dispatch throughput test."""
+
+import time
+import numpy as np
+
+from mindspore import Tensor, ops
+from mindspore import context
+from mindspore.common.api import _pynative_executor
+
+context.set_context(mode=context.PYNATIVE_MODE)
+
+warmup_op_num = 1000
+op_num = 20000
+
+
+def dispatch_ops(x, zero, num):
+    for _ in range(num):
+        x = ops.add(x, zero)
+    return x
+
+
+def test_pynative_op_dispatch():
+    """Ops per second of a tiny op through the forward, backend and device queues of the pynative pipeline"""
+    x = Tensor(np.ones([1]).astype(np.float32))
+    zero = Tensor(np.zeros([1]).astype(np.float32))
+    dispatch_ops(x, zero, warmup_op_num)
+    _pynative_executor.sync()
+
+    start = time.perf_counter()
+    y = dispatch_ops(x, zero, op_num)
+    _pynative_executor.sync()
+    cost = time.perf_counter() - start
+    print("pynative dispatch {} ops in {:.3f} s, {:.0f} ops/s".format(op_num, cost, op_num / cost))
+    assert np.allclose(y.asnumpy(), x.asnumpy())
@@ -0,0 +1,51 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""Float32 reduce bandwidth test on CPU, sweeping the shapes and the reduced axes."""
+
+import time
+import numpy as np
+
+from mindspore import Tensor
+from mindspore import context
+from mindspore.ops import operations as P
+
+context.set_context(mode=context.PYNATIVE_MODE, device_target="CPU")
+
+warmup_num = 5
+run_num = 50
+
+# The last axis, the leading axis, the middle axes, all axes and the long axis of few outputs.
+cases = [((4096, 1024), -1), ((4096, 1024), 0), ((64, 128, 128), (1,)), ((32, 64, 64, 16), (1, 2)),
+         ((1 << 24,), 0), ((4, 1 << 22), -1), ((1 << 22, 4), 0)]
+
+ops = [(P.ReduceSum(), np.sum), (P.ReduceMean(), np.mean), (P.ReduceMax(), np.max), (P.ReduceMin(), np.min)]
+
+
+def test_reduce_cpu_perf():
+    """GB/s of the float32 ReduceSum, ReduceMean, ReduceMax and ReduceMin for every shape and axes"""
+    for shape, axis in cases:
+        x_np = np.random.uniform(-1, 1, shape).astype(np.float32)
+        x = Tensor(x_np)
+        for op, np_op in ops:
+            for _ in range(warmup_num):
+                y = op(x, axis).asnumpy()
+            start = time.perf_counter()
+            for _ in range(run_num):
+                y = op(x, axis).asnumpy()
+            cost = (time.perf_counter() - start) / run_num
+            print("{} {} axis {}: {:.3f} ms, {:.2f} GB/s".format(op.name, shape, axis, cost * 1e3,
+                                                                 x_np.nbytes / cost / 1e9))
+            assert np.allclose(y, np_op(x_np.astype(np.float64), axis=axis), rtol=1e-4, atol=1e-3)
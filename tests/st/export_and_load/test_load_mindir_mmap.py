@@ -0,0 +1,104 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""test loading the mindir with external data by mmap"""
+
+import multiprocessing
+import os
+import resource
+import shutil
+import time
+
+import numpy as np
+import pytest
+
+from mindspore import Tensor, Parameter, ParameterTuple, context, export, load, nn
+from mindspore.train import serialization
+
+PARAM_NUM = 32
+PARAM_SHAPE = (1024, 1024)
+
+
+class LargeNet(nn.Cell):
+    def __init__(self):
+        super(LargeNet, self).__init__()
+        self.params = ParameterTuple([Parameter(Tensor(np.full(PARAM_SHAPE, i / PARAM_NUM, np.float32)),
+                                                name="w" + str(i)) for i in range(PARAM_NUM)])
+
+    def construct(self, x):
+        out = x
+        for param in self.params:
+            out = out + param
+        return out
+
+
+def load_and_run(mindir_name, mmap_load, queue):
+    """Load the mindir in a new process, report the load time, increased peak rss and the output."""
+    if mmap_load:
+        os.environ["MS_DEV_MINDIR_MMAP_LOAD"] = "on"
+    context.set_context(mode=context.GRAPH_MODE)
+    rss_before = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    start = time.time()
+    graph = load(mindir_name)
+    load_time = time.time() - start
+    rss_increased = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss - rss_before
+    output = nn.GraphCell(graph)(Tensor(np.zeros(PARAM_SHAPE, np.float32)))
+    queue.put((load_time, rss_increased, output.asnumpy()[0, 0]))
+
+
+def run_in_process(mindir_name, mmap_load):
+    ctx = multiprocessing.get_context("spawn")
+    queue = ctx.Queue()
+    process = ctx.Process(target=load_and_run, args=(mindir_name, mmap_load, queue))
+    process.start()
+    result = queue.get()
+    process.join()
+    assert process.exitcode == 0
+    return result
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_load_large_mindir_by_mmap():
+    """
+    Feature: Load MindIR by mmap.
+    Description: Export a synthetic model of 128MB parameters to external data files, then load it by reading and by
+        mmap, and compare the load time and increased peak rss.
+    Expectation: The outputs are the same, and loading by mmap takes less peak rss.
+    """
+    context.set_context(mode=context.GRAPH_MODE)
+    file_prefix = "large_net"
+    origin_total_save = serialization.TOTAL_SAVE
+    # Save the parameters to external data files as a large model.
+    serialization.TOTAL_SAVE = 0
+    try:
+        export(LargeNet(), Tensor(np.zeros(PARAM_SHAPE, np.float32)), file_name=file_prefix, file_format='MINDIR')
+    finally:
+        serialization.TOTAL_SAVE = origin_total_save
+    mindir_name = file_prefix + "_graph.mindir"
+    try:
+        read_time, read_rss, read_output = run_in_process(mindir_name, False)
+        mmap_time, mmap_rss, mmap_output = run_in_process(mindir_name, True)
+        print(f"Load by reading: {read_time:.3f}s, peak rss increased {read_rss}KB; "
+              f"load by mmap: {mmap_time:.3f}s, peak rss increased {mmap_rss}KB.")
+        expect = sum(i / PARAM_NUM for i in range(PARAM_NUM))
+        assert np.isclose(read_output, expect)
+        assert np.isclose(mmap_output, expect)
+        assert mmap_rss < read_rss
+    finally:
+        if os.path.exists(mindir_name):
+            os.remove(mindir_name)
+        shutil.rmtree(file_prefix + "_variables", ignore_errors=True)
@@ -0,0 +1,206 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.ops import operations as P
+from mindspore.common import dtype as mstype
+
+np.random.seed(1)
+
+
+def round_to_bf16(x):
+    """Rounds float32 to the nearest even bfloat16, which is kept in float32."""
+    bits = x.astype(np.float32).view(np.uint32).astype(np.uint64)
+    bits = (bits + 0x7fff + ((bits >> 16) & 1)) >> 16 << 16
+    return bits.astype(np.uint32).view(np.float32)
+
+
+class Bf16Net(nn.Cell):
+    """Runs op on the inputs cast to bfloat16, and casts the first output back to float32."""
+
+    def __init__(self, op):
+        super(Bf16Net, self).__init__()
+        self.op = op
+        self.cast = P.Cast()
+
+    def construct(self, *inputs):
+        bf16_inputs = ()
+        for x in inputs:
+            bf16_inputs += (self.cast(x, mstype.bfloat16),)
+        out = self.op(*bf16_inputs)
+        if isinstance(out, tuple):
+            out = out[0]
+        return self.cast(out, mstype.float32)
+
+
+def bf16_allclose(result, expect):
+    assert result.shape == expect.shape
+    assert np.allclose(result, round_to_bf16(expect), rtol=1e-2, atol=1e-2)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('transpose_a', [False, True])
+@pytest.mark.parametrize('transpose_b', [False, True])
+def test_matmul_bf16(transpose_a, transpose_b):
+    """
+    Feature: MatMul of bfloat16 on CPU.
+    Description: Tail rows, columns and odd deep of the tiles, with the transposed inputs.
+    Expectation: The result is float32 matmul of the bfloat16 inputs rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    m, k, n = 37, 67, 83
+    x_np = round_to_bf16(np.random.randn(k, m) if transpose_a else np.random.randn(m, k))
+    y_np = round_to_bf16(np.random.randn(n, k) if transpose_b else np.random.randn(k, n))
+    net = Bf16Net(P.MatMul(transpose_a, transpose_b))
+    output = net(Tensor(x_np), Tensor(y_np))
+    expect = np.matmul(x_np.T if transpose_a else x_np, y_np.T if transpose_b else y_np)
+    bf16_allclose(output.asnumpy(), expect)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_batch_matmul_bf16():
+    """
+    Feature: BatchMatMul of bfloat16 on CPU.
+    Description: Batch of matmul with transposed b.
+    Expectation: The result is float32 matmul of the bfloat16 inputs rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    x_np = round_to_bf16(np.random.randn(2, 3, 9, 48))
+    y_np = round_to_bf16(np.random.randn(2, 3, 70, 48))
+    net = Bf16Net(P.BatchMatMul(transpose_b=True))
+    output = net(Tensor(x_np), Tensor(y_np))
+    expect = np.matmul(x_np, np.swapaxes(y_np, -1, -2))
+    bf16_allclose(output.asnumpy(), expect)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('x_shape, y_shape', [((2, 3, 9, 48), (48, 70)), ((9, 48), (2, 3, 48, 70)),
+                                              ((2, 1, 9, 48), (1, 3, 48, 70)), ((3, 9, 48), (2, 1, 48, 70))])
+def test_batch_matmul_broadcast_bf16(x_shape, y_shape):
+    """
+    Feature: BatchMatMul of bfloat16 on CPU.
+    Description: The batch dims of the inputs broadcast to each other.
+    Expectation: The result is float32 matmul of the bfloat16 inputs rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    x_np = round_to_bf16(np.random.randn(*x_shape))
+    y_np = round_to_bf16(np.random.randn(*y_shape))
+    net = Bf16Net(P.BatchMatMul())
+    output = net(Tensor(x_np), Tensor(y_np))
+    bf16_allclose(output.asnumpy(), np.matmul(x_np, y_np))
+
+
+class ConstWeightMatMulNet(nn.Cell):
+    """MatMul of the input cast to bfloat16 and a constant bfloat16 weight."""
+
+    def __init__(self, weight):
+        super(ConstWeightMatMulNet, self).__init__()
+        self.weight = Tensor(weight, mstype.bfloat16)
+        self.matmul = P.MatMul()
+        self.cast = P.Cast()
+
+    def construct(self, x):
+        out = self.matmul(self.cast(x, mstype.bfloat16), self.weight)
+        return self.cast(out, mstype.float32)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_matmul_const_weight_bf16():
+    """
+    Feature: MatMul of bfloat16 on CPU.
+    Description: A constant weight, which is packed at the first launch only, multiplied by different inputs.
+    Expectation: The result is float32 matmul of the bfloat16 inputs rounded to bfloat16 at every launch.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    y_np = round_to_bf16(np.random.randn(67, 150))
+    net = ConstWeightMatMulNet(y_np)
+    for _ in range(3):
+        x_np = round_to_bf16(np.random.randn(37, 67))
+        output = net(Tensor(x_np))
+        bf16_allclose(output.asnumpy(), np.matmul(x_np, y_np))
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('op, np_op', [(P.Add(), np.add), (P.Mul(), np.multiply)])
+def test_arithmetic_bf16(op, np_op):
+    """
+    Feature: Add and Mul of bfloat16 on CPU.
+    Description: The same shapes, a scalar input and a broadcast input.
+    Expectation: The result is float32 op of the bfloat16 inputs rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    net = Bf16Net(op)
+    x_np = round_to_bf16(np.random.randn(4, 5, 19))
+    for y_shape in [(4, 5, 19), (1,), (5, 1)]:
+        y_np = round_to_bf16(np.random.randn(*y_shape))
+        output = net(Tensor(x_np), Tensor(y_np))
+        bf16_allclose(output.asnumpy(), np_op(x_np, y_np))
+        output = net(Tensor(y_np), Tensor(x_np))
+        bf16_allclose(output.asnumpy(), np_op(y_np, x_np))
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('axis', [-1, 1])
+def test_softmax_bf16(axis):
+    """
+    Feature: Softmax of bfloat16 on CPU.
+    Description: Softmax on the last axis and on an inner axis.
+    Expectation: The result is float32 softmax of the bfloat16 input rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    x_np = round_to_bf16(np.random.randn(3, 7, 35))
+    net = Bf16Net(P.Softmax(axis=axis))
+    output = net(Tensor(x_np))
+    exp = np.exp(x_np - np.max(x_np, axis=axis, keepdims=True))
+    expect = exp / np.sum(exp, axis=axis, keepdims=True)
+    bf16_allclose(output.asnumpy(), expect)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_layer_norm_bf16():
+    """
+    Feature: LayerNorm of bfloat16 on CPU.
+    Description: LayerNorm on the last axis with gamma and beta.
+    Expectation: The result is float32 layer norm of the bfloat16 inputs rounded to bfloat16.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    x_np = round_to_bf16(np.random.randn(6, 4, 45))
+    gamma_np = round_to_bf16(np.random.randn(45))
+    beta_np = round_to_bf16(np.random.randn(45))
+    net = Bf16Net(P.LayerNorm(begin_norm_axis=-1, begin_params_axis=-1, epsilon=1e-7))
+    output = net(Tensor(x_np), Tensor(gamma_np), Tensor(beta_np))
+    mean = np.mean(x_np, axis=-1, keepdims=True)
+    var = np.var(x_np, axis=-1, keepdims=True)
+    expect = (x_np - mean) / np.sqrt(var + 1e-7) * gamma_np + beta_np
+    bf16_allclose(output.asnumpy(), expect)
@@ -195,3 +195,22 @@ def test_broadcast_exception():
         assert "ValueError: For 'BroadcastTo', each dimension pair, input_x shape and target shape must be equal or \
         input dimension is 1 or target dimension is -1. But got input_x shape: [const vector][], target shape: \
         [const vector][0]." in str(info.value)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('dtype', [np.int8, np.float16, np.int32, np.float64])
+@pytest.mark.parametrize('in_shape, shape', [((1, 37), (5, 3, 37)),
+                                             ((6, 1), (2, 6, 19)),
+                                             ((4, 1, 3), (4, 7, 3)),
+                                             ((1,), (3, 4))])
+def test_broadcast_to_rows(dtype, in_shape, shape):
+    """
+    Feature: BroadcastTo of the rows copied and filled on CPU.
+    Description: The input broadcast in the leading, inner and last dims.
+    Expectation: The result is the same as numpy broadcast_to.
+    """
+    x_np = (np.random.randn(*in_shape) * 100).astype(dtype)
+    output = P.BroadcastTo(shape)(Tensor(x_np))
+    assert (output.asnumpy() == np.broadcast_to(x_np, shape)).all()
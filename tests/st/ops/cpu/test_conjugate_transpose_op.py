@@ -59,3 +59,22 @@ def test_conjugate_transpose_dyn():
     dyn_case()
     context.set_context(mode=context.PYNATIVE_MODE, device_target='CPU')
     dyn_case()
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_conjugate_transpose_complex():
+    """
+    Feature: ConjugateTranspose of complex64 on CPU.
+    Description: Launch twice on the same input.
+    Expectation: The result is the conjugate of numpy transpose, and the input is not changed.
+    """
+    context.set_context(mode=context.PYNATIVE_MODE, device_target='CPU')
+    x_np = (np.random.randn(3, 10, 17) + 1j * np.random.randn(3, 10, 17)).astype(np.complex64)
+    x = Tensor(x_np)
+    net = Net()
+    for _ in range(2):
+        output = net(x, (2, 0, 1))
+        assert (output.asnumpy() == np.conj(np.transpose(x_np, (2, 0, 1)))).all()
+    assert (x.asnumpy() == x_np).all()
@@ -0,0 +1,200 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+import math
+import multiprocessing
+import resource
+import time
+
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.ops import operations as P
+from mindspore.ops.operations.nn_ops import FlashAttentionScore
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+
+
+class FlashAttentionNet(nn.Cell):
+    def __init__(self, head_num, head_dim, input_layout, sparse_mode=0, pre_tokens=2147483647,
+                 next_tokens=2147483647):
+        super().__init__()
+        self.flash_attention = FlashAttentionScore(head_num=head_num, scale_value=1.0 / math.sqrt(head_dim),
+                                                   pre_tokens=pre_tokens, next_tokens=next_tokens,
+                                                   input_layout=input_layout, sparse_mode=sparse_mode)
+
+    def construct(self, query, key, value, attn_mask):
+        return self.flash_attention(query, key, value, None, None, None, attn_mask, None)
+
+
+class UnfusedAttentionNet(nn.Cell):
+    """The attention of BNSD layout by BatchMatMul, Softmax and BatchMatMul, which keeps the whole scores."""
+
+    def __init__(self, head_dim):
+        super().__init__()
+        self.scale = 1.0 / math.sqrt(head_dim)
+        self.qk_matmul = P.BatchMatMul(transpose_b=True)
+        self.pv_matmul = P.BatchMatMul()
+        self.softmax = P.Softmax()
+
+    def construct(self, query, key, value):
+        scores = self.qk_matmul(query, key) * self.scale
+        return self.pv_matmul(self.softmax(scores), value)
+
+
+def attention_numpy(query, key, value, mask):
+    """Inputs of BNSD layout, mask of (S1, S2) with True to discard. Returns the output, row max and row sum."""
+    group = query.shape[1] // key.shape[1]
+    key = np.repeat(key.astype(np.float32), group, axis=1)
+    value = np.repeat(value.astype(np.float32), group, axis=1)
+    scores = np.matmul(query.astype(np.float32), key.transpose(0, 1, 3, 2)) / math.sqrt(query.shape[-1])
+    scores = np.where(mask, -np.inf, scores)
+    row_max = scores.max(axis=-1, keepdims=True)
+    probs = np.exp(scores - row_max)
+    row_sum = probs.sum(axis=-1, keepdims=True)
+    return np.matmul(probs / row_sum, value), row_max, row_sum
+
+
+def bnsd_to_bsh(x):
+    batch, head_num, seq_len, head_dim = x.shape
+    return x.transpose(0, 2, 1, 3).reshape(batch, seq_len, head_num * head_dim)
+
+
+def run_and_compare(dtype, input_layout, sparse_mode, mask, q_seq_len=100, kv_seq_len=100, head_num=4, kv_head_num=4,
+                    **kwargs):
+    batch, head_dim = 2, 32
+    np.random.seed(0)
+    query = np.random.randn(batch, head_num, q_seq_len, head_dim).astype(dtype)
+    key = np.random.randn(batch, kv_head_num, kv_seq_len, head_dim).astype(dtype)
+    value = np.random.randn(batch, kv_head_num, kv_seq_len, head_dim).astype(dtype)
+    expect, expect_max, expect_sum = attention_numpy(query, key, value, mask)
+
+    net = FlashAttentionNet(head_num, head_dim, input_layout, sparse_mode, **kwargs)
+    inputs = (query, key, value) if input_layout == "BNSD" else (bnsd_to_bsh(query), bnsd_to_bsh(key),
+                                                                 bnsd_to_bsh(value))
+    attn_mask = Tensor(mask.astype(np.uint8))
+    softmax_max, softmax_sum, _, output = net(*[Tensor(x) for x in inputs], attn_mask)
+    if input_layout == "BSH":
+        expect = bnsd_to_bsh(expect)
+    tolerance = 1e-5 if dtype == np.float32 else 2e-3
+    assert output.shape == inputs[0].shape
+    assert np.allclose(output.asnumpy().astype(np.float32), expect, rtol=tolerance, atol=tolerance)
+    assert softmax_max.shape == (batch, head_num, q_seq_len, 8)
+    assert np.allclose(softmax_max.asnumpy(), np.broadcast_to(expect_max, softmax_max.shape), rtol=1e-3, atol=1e-3)
+    assert np.allclose(softmax_sum.asnumpy(), np.broadcast_to(expect_sum, softmax_sum.shape), rtol=1e-3, atol=1e-3)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("input_layout", ["BSH", "BNSD"])
+def test_flash_attention_score_mask(dtype, input_layout):
+    """
+    Feature: FlashAttentionScore on CPU.
+    Description: Attention of the sequences longer than a tile of keys and values, with a random attn_mask in
+        sparse_mode 0.
+    Expectation: The output, softmax_max and softmax_sum are the same as numpy.
+    """
+    mask = np.random.RandomState(1).rand(100, 100) < 0.3
+    # Every query attends to the first key at least.
+    mask[:, 0] = False
+    run_and_compare(dtype, input_layout, 0, mask)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize("input_layout", ["BSH", "BNSD"])
+def test_flash_attention_score_causal_gqa(input_layout):
+    """
+    Feature: FlashAttentionScore on CPU.
+    Description: Causal attention aligned to the bottom right in sparse_mode 3, with the heads of query grouped to share
+        the heads of key and value.
+    Expectation: The output, softmax_max and softmax_sum are the same as numpy.
+    """
+    q_seq_len, kv_seq_len = 70, 150
+    mask = np.triu(np.ones((q_seq_len, kv_seq_len), np.bool_), k=kv_seq_len - q_seq_len + 1)
+    run_and_compare(np.float32, input_layout, 3, mask, q_seq_len, kv_seq_len, head_num=8, kv_head_num=2)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_flash_attention_score_band():
+    """
+    Feature: FlashAttentionScore on CPU.
+    Description: Attention of a band of keys around each query in sparse_mode 4 by pre_tokens and next_tokens.
+    Expectation: The output, softmax_max and softmax_sum are the same as numpy.
+    """
+    seq_len, pre_tokens, next_tokens = 200, 40, 10
+    distance = np.arange(seq_len)[None, :] - np.arange(seq_len)[:, None]
+    mask = (distance < -pre_tokens) | (distance > next_tokens)
+    run_and_compare(np.float32, "BNSD", 4, mask, seq_len, seq_len, pre_tokens=pre_tokens, next_tokens=next_tokens)
+
+
+def benchmark_attention(fused, queue):
+    """Run the attention in a new process, report the tokens per second, increased peak rss and the output."""
+    context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+    batch, head_num, seq_len, head_dim = 1, 16, 2048, 64
+    np.random.seed(0)
+    inputs = [Tensor(np.random.randn(batch, head_num, seq_len, head_dim).astype(np.float32)) for _ in range(3)]
+    net = FlashAttentionNet(head_num, head_dim, "BNSD") if fused else UnfusedAttentionNet(head_dim)
+
+    def run():
+        return net(*inputs, None)[3] if fused else net(*inputs)
+
+    rss_before = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Compile and warm up.
+    output = run().asnumpy()
+    steps = 5
+    start = time.time()
+    for _ in range(steps):
+        output = run().asnumpy()
+    tokens_per_second = steps * batch * seq_len / (time.time() - start)
+    # The peak includes the compilation, which is much less than the scores of the unfused graph.
+    rss_increased = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss - rss_before
+    queue.put((tokens_per_second, rss_increased, output))
+
+
+def run_in_process(fused):
+    ctx = multiprocessing.get_context("spawn")
+    queue = ctx.Queue()
+    process = ctx.Process(target=benchmark_attention, args=(fused, queue))
+    process.start()
+    result = queue.get()
+    process.join()
+    assert process.exitcode == 0
+    return result
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_flash_attention_score_benchmark():
+    """
+    Feature: FlashAttentionScore on CPU.
+    Description: Run the attention of 16 heads of 2048 tokens by FlashAttentionScore and by the unfused graph of
+        BatchMatMul, Softmax and BatchMatMul, and compare the tokens per second and increased peak rss.
+    Expectation: The outputs are the same, and the fused one takes less peak rss without keeping the whole scores.
+    """
+    unfused_speed, unfused_rss, unfused_output = run_in_process(False)
+    fused_speed, fused_rss, fused_output = run_in_process(True)
+    print(f"Unfused attention: {unfused_speed:.1f} tokens/s, peak rss increased {unfused_rss}KB; "
+          f"FlashAttentionScore: {fused_speed:.1f} tokens/s, peak rss increased {fused_rss}KB.")
+    assert np.allclose(fused_output, unfused_output, rtol=1e-4, atol=1e-4)
+    assert fused_rss < unfused_rss
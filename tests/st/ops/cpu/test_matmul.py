@@ -137,12 +137,9 @@ def test_matmul_dtypes():
     y_np.shape = k, n
     matmul = P.MatMul()
     valid_dtypes = (mstype.uint8, mstype.int8, mstype.int16, mstype.int32, mstype.int64, mstype.float16,
-                    mstype.float32, mstype.float64, mstype.complex64, mstype.complex128)
+                    mstype.float32, mstype.float64, mstype.complex64, mstype.complex128, mstype.bfloat16)
     all_dtypes = mstype.all_types
     for dtype in all_dtypes:
-        # bfloat16 is not supported yet
-        if dtype == mstype.bfloat16:
-            continue
         x_ms = Tensor(x_np).astype(dtype)
         y_ms = Tensor(y_np).astype(dtype)
         if dtype in valid_dtypes:
@@ -0,0 +1,109 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor, Parameter
+from mindspore.ops.auto_generate import PagedAttention, ReshapeAndCache
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+
+HEAD_NUM = 8
+KV_HEAD_NUM = 2
+HEAD_DIM = 40
+BLOCK_SIZE = 16
+NUM_BLOCKS = 12
+SCALE_VALUE = 1.0 / np.sqrt(HEAD_DIM)
+
+
+class CacheNet(nn.Cell):
+    def __init__(self, dtype):
+        super().__init__()
+        cache_shape = (NUM_BLOCKS, BLOCK_SIZE, KV_HEAD_NUM, HEAD_DIM)
+        self.key_cache = Parameter(Tensor(np.zeros(cache_shape, dtype)), name="key_cache")
+        self.value_cache = Parameter(Tensor(np.zeros(cache_shape, dtype)), name="value_cache")
+        self.reshape_and_cache = ReshapeAndCache()
+
+    def construct(self, key, value, slot_mapping):
+        return self.reshape_and_cache(key, value, self.key_cache, self.value_cache, slot_mapping)
+
+
+class DecodeNet(nn.Cell):
+    def __init__(self, cache_net):
+        super().__init__()
+        self.cache_net = cache_net
+        self.paged_attention = PagedAttention(HEAD_NUM, SCALE_VALUE, KV_HEAD_NUM)
+
+    def construct(self, query, key, value, slot_mapping, block_tables, context_lens):
+        self.cache_net(key, value, slot_mapping)
+        return self.paged_attention(query, self.cache_net.key_cache, self.cache_net.value_cache, block_tables,
+                                    context_lens)
+
+
+def attention_numpy(query, keys, values):
+    """query of (head_num, head_dim), keys and values of (seq_len, kv_head_num, head_dim)."""
+    group = HEAD_NUM // KV_HEAD_NUM
+    keys = np.repeat(keys.astype(np.float32), group, axis=1)
+    values = np.repeat(values.astype(np.float32), group, axis=1)
+    scores = np.einsum("nd,snd->ns", query.astype(np.float32), keys) * SCALE_VALUE
+    probs = np.exp(scores - scores.max(axis=-1, keepdims=True))
+    probs /= probs.sum(axis=-1, keepdims=True)
+    return np.einsum("ns,snd->nd", probs, values)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+def test_paged_attention_decode(dtype):
+    """
+    Feature: PagedAttention and ReshapeAndCache on CPU.
+    Description: Prefill the block-paged KV cache of three sequences by ReshapeAndCache, then decode a token of each of
+        them, whose key and value are cached and attended to in the same step.
+    Expectation: The cache and the attention output are the same as numpy.
+    """
+    np.random.seed(0)
+    context_lens = np.array([5, 17, 40], np.int32)
+    block_tables = np.array([[3, 0, 0, 0], [7, 1, 0, 0], [2, 9, 5, 0]], np.int32)
+    # Slots of all the tokens of the sequences, the last ones are decoded.
+    slots = [[table[pos // BLOCK_SIZE] * BLOCK_SIZE + pos % BLOCK_SIZE for pos in range(length)]
+             for table, length in zip(block_tables, context_lens)]
+    keys = [np.random.randn(length, KV_HEAD_NUM, HEAD_DIM).astype(dtype) for length in context_lens]
+    values = [np.random.randn(length, KV_HEAD_NUM, HEAD_DIM).astype(dtype) for length in context_lens]
+
+    cache_net = CacheNet(dtype)
+    prefill_slots = np.array([slot for seq in slots for slot in seq[:-1]] + [-1], np.int32)
+    prefill_keys = np.concatenate([key[:-1] for key in keys] + [np.zeros_like(keys[0][:1])])
+    prefill_values = np.concatenate([value[:-1] for value in values] + [np.zeros_like(values[0][:1])])
+    out = cache_net(Tensor(prefill_keys), Tensor(prefill_values), Tensor(prefill_slots))
+    assert np.array_equal(out.asnumpy(), prefill_keys)
+
+    query = np.random.randn(len(context_lens), HEAD_NUM, HEAD_DIM).astype(dtype)
+    decode_net = DecodeNet(cache_net)
+    output = decode_net(Tensor(query), Tensor(np.stack([key[-1] for key in keys])),
+                        Tensor(np.stack([value[-1] for value in values])),
+                        Tensor(np.array([seq[-1] for seq in slots], np.int32)), Tensor(block_tables),
+                        Tensor(context_lens)).asnumpy()
+
+    key_cache = cache_net.key_cache.asnumpy().reshape(NUM_BLOCKS * BLOCK_SIZE, KV_HEAD_NUM, HEAD_DIM)
+    value_cache = cache_net.value_cache.asnumpy().reshape(NUM_BLOCKS * BLOCK_SIZE, KV_HEAD_NUM, HEAD_DIM)
+    tolerance = 1e-5 if dtype == np.float32 else 2e-3
+    for i, seq in enumerate(slots):
+        assert np.array_equal(key_cache[seq], keys[i])
+        assert np.array_equal(value_cache[seq], values[i])
+        expect = attention_numpy(query[i], keys[i], values[i])
+        assert np.allclose(output[i].astype(np.float32), expect, rtol=tolerance, atol=tolerance)
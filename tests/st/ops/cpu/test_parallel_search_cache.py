@@ -0,0 +1,103 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+import os
+import re
+import subprocess
+import sys
+import pytest
+
+# Runs Addcmul, whose kernel searches the parallel block size, until the search converges, and exits the process
+# without the normal shutdown when asked, so that only the entries appended as the search converges are in the cache.
+RUN_NET_SCRIPT = """
+import os
+import sys
+import numpy as np
+import mindspore.context as context
+import mindspore.nn as nn
+import mindspore.ops as ops
+from mindspore import Tensor
+
+class Net(nn.Cell):
+    def construct(self, x, t1, t2, value):
+        return ops.addcmul(x, t1, t2, value)
+
+context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+np.random.seed(1)
+x_np, t1_np, t2_np = [np.random.randn(64, 1024).astype(np.float32) for _ in range(3)]
+value_np = np.array([0.5], np.float32)
+net = Net()
+for _ in range(50):
+    output = net(Tensor(x_np), Tensor(t1_np), Tensor(t2_np), Tensor(value_np))
+assert np.allclose(output.asnumpy(), x_np + t1_np * t2_np * value_np, rtol=1e-5, atol=1e-5)
+sys.stdout.flush()
+if sys.argv[1] == "exit":
+    os._exit(0)
+"""
+
+TUNE_SCRIPT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "../../../../scripts/tune_cpu_parallel_search.sh")
+
+
+def run_net(cache_path, mode, exit_early):
+    env = dict(os.environ, MS_CPU_PARALLEL_SEARCH_CACHE=cache_path, MS_CPU_PARALLEL_SEARCH_CACHE_MODE=mode, GLOG_v="1",
+               GLOG_logtostderr="1")
+    result = subprocess.run([sys.executable, "-c", RUN_NET_SCRIPT, "exit" if exit_early else "return"], env=env,
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True, check=False)
+    assert result.returncode == 0, result.stderr
+    return result.stderr
+
+
+def read_entries(cache_path):
+    with open(cache_path) as f:
+        return [line for line in f.read().splitlines() if "Addcmul" in line]
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_parallel_search_cache_survives_exit(tmp_path):
+    """
+    Feature: Persistent cache of the parallel search of the CPU kernels.
+    Description: Search in a process exiting without the normal shutdown, then reload the cache in a new process.
+    Expectation: The converged entry is in the file, and the new process loads it without writing the file.
+    """
+    cache_path = str(tmp_path / "parallel_search_cache.txt")
+    run_net(cache_path, "read_write", exit_early=True)
+    entries = read_entries(cache_path)
+    assert len(entries) == 1
+
+    log = run_net(cache_path, "read_only", exit_early=False)
+    loaded = re.search(r"Load (\d+) parallel search entries", log)
+    assert loaded and int(loaded.group(1)) >= 1
+    assert read_entries(cache_path) == entries
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_parallel_search_cache_offline_tune(tmp_path):
+    """
+    Feature: Offline tuning of the parallel search cache of the CPU kernels.
+    Description: Pre-tune a cache with the tuning script running the job twice, then reload it in read_only mode.
+    Expectation: The tuned file has one line per kernel configuration, and the job loads it without writing it.
+    """
+    cache_path = str(tmp_path / "parallel_search_cache.txt")
+    subprocess.run(["bash", TUNE_SCRIPT, "-n", "2", cache_path, sys.executable, "-c", RUN_NET_SCRIPT, "exit"],
+                   check=True)
+    entries = read_entries(cache_path)
+    assert len(entries) == 1
+
+    log = run_net(cache_path, "read_only", exit_early=False)
+    assert re.search(r"Load [1-9]\d* parallel search entries", log)
+    assert read_entries(cache_path) == entries
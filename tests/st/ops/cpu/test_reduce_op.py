@@ -320,3 +320,29 @@ def test_reduce_prod():
     assert (output[2].asnumpy() == expect_prod_2).all()
     assert (output[3].asnumpy() == expect_prod_3).all()
     assert (output[4].asnumpy() == expect_prod_4).all()
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('shape, axis', [((37, 1029), -1), ((1029, 37), 0), ((3, 5, 1, 7, 11), (1, 2, 3)),
+                                         ((2, 300001), (0, 1)), ((4, 70001), 1), ((70001, 3), 0),
+                                         ((5, 7, 9), (0, 2))])
+def test_reduce_float_axis_patterns(shape, axis):
+    """
+    /// Feature: Reduce of float32
+    /// Description: The last axis, the leading axes, the adjacent axes, all axes, the long axis of few outputs and
+    ///              the axes not adjacent
+    /// Expectation: Close to numpy results
+    """
+    x_np = np.random.uniform(0.5, 1.5, shape).astype(np.float32)
+    x = Tensor(x_np)
+    for op, np_op in [(P.ReduceSum(), np.sum), (P.ReduceMean(), np.mean), (P.ReduceMax(), np.max),
+                      (P.ReduceMin(), np.min)]:
+        output = op(x, axis)
+        expect = np_op(x_np.astype(np.float64), axis=axis)
+        assert np.allclose(output.asnumpy(), expect, rtol=1e-5, atol=1e-5)
+    x_np = np.random.uniform(0.999, 1.001, shape).astype(np.float32)
+    output = P.ReduceProd()(Tensor(x_np), axis)
+    expect = np.prod(x_np.astype(np.float64), axis=axis)
+    assert np.allclose(output.asnumpy(), expect, rtol=1e-4)
@@ -382,3 +382,26 @@ def test_transpose_uint8():
     assert (output[1].asnumpy() == expect1).all()
     assert (output[2].asnumpy() == expect2).all()
     assert (output[3].asnumpy() == expect3).all()
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('dtype', [np.uint8, np.float16, np.float32, np.float64, np.complex64])
+@pytest.mark.parametrize('shape, perm', [((37, 53), (1, 0)),
+                                         ((3, 19, 130), (0, 2, 1)),
+                                         ((2, 1, 9, 17, 5), (3, 1, 0, 4, 2)),
+                                         ((4, 6, 7, 33), (0, 3, 1, 2)),
+                                         ((5, 8, 11, 3), (2, 0, 1, 3)),
+                                         ((257, 300), (1, 0))])
+def test_transpose_blocks(dtype, shape, perm):
+    """
+    Feature: Transpose of the cache blocked engine on CPU.
+    Description: The dims merged, the rows copied and the blocks transposed, with the tails of the SIMD tiles.
+    Expectation: The result is the same as numpy transpose.
+    """
+    x_np = (np.random.randn(*shape) * 100).astype(dtype)
+    if dtype == np.complex64:
+        x_np = x_np + 1j * (np.random.randn(*shape) * 100).astype(dtype)
+    output = P.Transpose()(Tensor(x_np), perm)
+    assert (output.asnumpy() == np.transpose(x_np, perm)).all()
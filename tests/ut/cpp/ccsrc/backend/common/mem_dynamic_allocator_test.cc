@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <random>
+#include <thread>
 #include <unordered_set>
 
 #include "common/common_test.h"
@@ -64,6 +65,11 @@ class DummyPool : public DynamicMemPoolBestFit {
   std::unordered_set<DeviceMemPtr> allocated_mems_;
 };
 
+class DummyCachedPool : public DummyPool {
+ public:
+  const bool IsEnableMemCache() const override { return true; }
+};
+
 class TestMemDynamicAllocator : public UT::Common {
  public:
   TestMemDynamicAllocator() = default;
@@ -73,6 +79,7 @@ class TestMemDynamicAllocator : public UT::Common {
   void TearDown() override {}
 
   DummyPool mem_pool_;
+  DummyCachedPool cached_mem_pool_;
 };
 
 /// Feature: test basic memory allocation from mem dynamic allocator.
@@ -239,5 +246,82 @@ TEST_F(TestMemDynamicAllocator, test_malloc_with_multi_stream_id) {
   EXPECT_EQ(persitent_mem_pool->mem_bufs_[std::make_pair(stream1, DynamicMemBufStatus::kMemBufIdle)].size(),
             expected_size_two);
 }
+
+/// Feature: test small memory malloc through the memory cache.
+/// Description: alloc and free small tensors repeatedly, then flush the memory cache.
+/// Expectation: the freed address is reused from the cache, the cached memory is not counted in the used memory, and
+/// all memory goes back to the pool after flush.
+TEST_F(TestMemDynamicAllocator, test_malloc_with_mem_cache) {
+  const size_t small_size = 1024;
+  auto addr1 = cached_mem_pool_.AllocTensorMem(small_size);
+  EXPECT_NE(addr1, nullptr);
+  // The size class is refilled in batch, the rest of the batch stays in the cache.
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), small_size);
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), (kMemCacheBatchCount - 1) * small_size);
+  auto addr2 = cached_mem_pool_.AllocTensorMem(small_size);
+  EXPECT_NE(addr2, addr1);
+  cached_mem_pool_.FreeTensorMem(addr1);
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), small_size);
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), (kMemCacheBatchCount - 1) * small_size);
+  auto addr3 = cached_mem_pool_.AllocTensorMem(small_size);
+  EXPECT_EQ(addr3, addr1);
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), 2 * small_size);
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), (kMemCacheBatchCount - 2) * small_size);
+
+  // Large memory bypasses the memory cache.
+  auto large_addr = cached_mem_pool_.AllocTensorMem(kMemCacheMaxSize * 2);
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), 2 * small_size + kMemCacheMaxSize * 2);
+  cached_mem_pool_.FreeTensorMem(large_addr);
+
+  cached_mem_pool_.FreeTensorMem(addr2);
+  cached_mem_pool_.FreeTensorMem(addr3);
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), expected_size_zero);
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), kMemCacheBatchCount * small_size);
+  cached_mem_pool_.FlushMemCache();
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), expected_size_zero);
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), expected_size_zero);
+  EXPECT_EQ(cached_mem_pool_.TotalIdleMemStatistics(), cached_mem_pool_.TotalMemStatistics());
+}
+
+/// Feature: memory cache of dynamic memory pool.
+/// Description: alloc small tensors in some threads and free them in the others, then flush the memory cache.
+/// Expectation: the cached memory summed over the cache slots is all the freed memory, and all memory goes back to
+/// the pool after flush.
+TEST_F(TestMemDynamicAllocator, test_mem_cache_free_in_other_thread) {
+  const size_t small_size = 2048;
+  const size_t thread_num = 4;
+  const size_t addr_num = 16;
+  std::vector<std::vector<DeviceMemPtr>> addrs(thread_num);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_num; ++i) {
+    (void)threads.emplace_back([this, &addrs, i, small_size, addr_num]() {
+      for (size_t j = 0; j < addr_num; ++j) {
+        (void)addrs[i].emplace_back(cached_mem_pool_.AllocTensorMem(small_size));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), thread_num * addr_num * small_size);
+  size_t cache_size = cached_mem_pool_.TotalMemCacheStatistics();
+
+  threads.clear();
+  for (size_t i = 0; i < thread_num; ++i) {
+    (void)threads.emplace_back([this, &addrs, i, thread_num]() {
+      for (const auto &addr : addrs[(i + 1) % thread_num]) {
+        cached_mem_pool_.FreeTensorMem(addr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(cached_mem_pool_.TotalUsedMemStatistics(), expected_size_zero);
+  EXPECT_LE(cached_mem_pool_.TotalMemCacheStatistics(), cache_size + thread_num * addr_num * small_size);
+  cached_mem_pool_.FlushMemCache();
+  EXPECT_EQ(cached_mem_pool_.TotalMemCacheStatistics(), expected_size_zero);
+  EXPECT_EQ(cached_mem_pool_.TotalIdleMemStatistics(), cached_mem_pool_.TotalMemStatistics());
+}
 }  // namespace device
 }  // namespace mindspore
@@ -0,0 +1,178 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/common/somas/somas_solver_alg.h"
+#include "backend/common/somas/somas_solver_core.h"
+
+namespace mindspore::somas {
+namespace {
+constexpr size_t kTensorNum = 24;
+constexpr size_t kLifeTimeRange = 16;
+constexpr size_t kMaxLifeTime = 4;
+constexpr size_t kMaxSizeUnit = 8;
+constexpr int64_t kTimeLimit = 10000;
+
+struct LifeTime {
+  size_t start;
+  size_t end;
+};
+
+// tensors with random sizes and lifetimes, two tensors can share memory when their lifetimes don't overlap
+void GenModel(std::vector<LifeTime> *lifetimes, TensorsDescMap *tensors, std::vector<VectorBitSet> *constraints) {
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<size_t> start_dist(0, kLifeTimeRange - 1);
+  std::uniform_int_distribution<size_t> life_dist(0, kMaxLifeTime);
+  std::uniform_int_distribution<size_t> size_dist(1, kMaxSizeUnit);
+  for (size_t i = 0; i < kTensorNum; i++) {
+    auto start = start_dist(gen);
+    lifetimes->push_back({start, start + life_dist(gen)});
+    (void)tensors->emplace(i, std::make_shared<SomasSolverTensorDesc>(i, size_dist(gen) * kDefaultAlignmentSize, 0,
+                                                                      false));
+  }
+  constraints->assign(kTensorNum, VectorBitSet(kTensorNum));
+  for (size_t i = 0; i < kTensorNum; i++) {
+    for (size_t j = 0; j < kTensorNum; j++) {
+      bool overlap = (*lifetimes)[i].start <= (*lifetimes)[j].end && (*lifetimes)[j].start <= (*lifetimes)[i].end;
+      (*constraints)[i].SetBit(j, i != j && !overlap);
+    }
+  }
+}
+
+// the largest total size of the tensors alive at the same time, which no solution is below
+size_t MaxLiveSize(const std::vector<LifeTime> &lifetimes, const TensorsDescMap &tensors) {
+  size_t max_live_size = 0;
+  for (size_t time = 0; time < kLifeTimeRange + kMaxLifeTime; time++) {
+    size_t live_size = 0;
+    for (size_t i = 0; i < lifetimes.size(); i++) {
+      if (lifetimes[i].start <= time && time <= lifetimes[i].end) {
+        live_size += tensors.at(i)->size_;
+      }
+    }
+    max_live_size = std::max(max_live_size, live_size);
+  }
+  return max_live_size;
+}
+
+bool CheckOffsets(const TensorsDescMap &tensors, const std::vector<VectorBitSet> &constraints, size_t *footprint) {
+  *footprint = 0;
+  for (const auto &[i, t1] : tensors) {
+    *footprint = std::max(*footprint, t1->offset_ + t1->size_);
+    for (const auto &[j, t2] : tensors) {
+      if (i == j || constraints[i].IsBitTrue(j)) {
+        continue;
+      }
+      if (t1->offset_ < t2->offset_ + t2->size_ && t2->offset_ < t1->offset_ + t1->size_) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+class TestSomasSolver : public UT::Common {
+ public:
+  TestSomasSolver() {}
+};
+
+/// Feature: SOMAS branch and bound search.
+/// Description: search offsets of tensors with random lifetimes, seeded with the footprint of stacking all tensors.
+/// Expectation: the search finds a valid solution between the max live size and the seed, whether or not it exhausts
+/// its branches before the time limit.
+TEST_F(TestSomasSolver, test_branch_and_bound) {
+  std::vector<LifeTime> lifetimes;
+  TensorsDescMap tensors;
+  std::vector<VectorBitSet> constraints;
+  GenModel(&lifetimes, &tensors, &constraints);
+
+  std::vector<BlockTensor> blocks;
+  size_t upperbound = 0;
+  for (size_t i = 0; i < kTensorNum; i++) {
+    BlockTensor block;
+    block.m_start_tensor_ = tensors[i];
+    block.m_size_ = tensors[i]->size_;
+    upperbound += block.m_size_;
+    blocks.push_back(block);
+  }
+  std::sort(blocks.begin(), blocks.end(),
+            [](const BlockTensor &a, const BlockTensor &b) { return a.m_size_ > b.m_size_; });
+
+  auto seed = upperbound;
+  BranchAndBound bnb(kTimeLimit);
+  ASSERT_TRUE(bnb.Eval(&blocks, &constraints, &upperbound));
+  ASSERT_LT(upperbound, seed);
+  ASSERT_GE(upperbound, bnb.LowerBound());
+  ASSERT_GE(upperbound, MaxLiveSize(lifetimes, tensors));
+
+  size_t footprint = 0;
+  ASSERT_TRUE(CheckOffsets(tensors, constraints, &footprint));
+  ASSERT_EQ(footprint, upperbound);
+}
+
+/// Feature: SOMAS branch and bound solver mode.
+/// Description: run the search on top of the heuristic solution of the solver core.
+/// Expectation: the result is verified and never worse than the heuristic one.
+TEST_F(TestSomasSolver, test_branch_and_bound_solver) {
+  std::vector<LifeTime> lifetimes;
+  TensorsDescMap tensors;
+  std::vector<VectorBitSet> constraints;
+  GenModel(&lifetimes, &tensors, &constraints);
+
+  SomasSolverCore solver(tensors, &constraints, 0, false);
+  ASSERT_EQ(solver.MemoryAllocationSolver(), SUCCESS);
+  auto heuristic = solver.GetUpperbound();
+  ASSERT_EQ(solver.BranchAndBoundSolver(kTimeLimit), SUCCESS);
+  ASSERT_LE(solver.GetUpperbound(), heuristic);
+  ASSERT_TRUE(solver.Verify(solver.GetUpperbound()));
+
+  size_t footprint = 0;
+  ASSERT_TRUE(CheckOffsets(tensors, constraints, &footprint));
+  ASSERT_EQ(footprint, solver.GetUpperbound());
+}
+
+/// Feature: SOMAS branch and bound search.
+/// Description: search offsets of a large tensor alive with two small tensors which can share memory.
+/// Expectation: the search finds the optimal solution, the small tensors sharing memory on top of the large one.
+TEST_F(TestSomasSolver, test_branch_and_bound_optimal) {
+  const size_t size = kDefaultAlignmentSize;
+  TensorsDescMap tensors;
+  (void)tensors.emplace(0, std::make_shared<SomasSolverTensorDesc>(0, 2 * size, 0, false));
+  (void)tensors.emplace(1, std::make_shared<SomasSolverTensorDesc>(1, size, 0, false));
+  (void)tensors.emplace(2, std::make_shared<SomasSolverTensorDesc>(2, size, 0, false));
+  std::vector<VectorBitSet> constraints(tensors.size(), VectorBitSet(tensors.size()));
+  constraints[1].SetBitTrue(2);
+  constraints[2].SetBitTrue(1);
+
+  std::vector<BlockTensor> blocks;
+  for (size_t i = 0; i < tensors.size(); i++) {
+    BlockTensor block;
+    block.m_start_tensor_ = tensors[i];
+    block.m_size_ = tensors[i]->size_;
+    blocks.push_back(block);
+  }
+  size_t upperbound = 4 * size;
+  BranchAndBound bnb(kTimeLimit);
+  ASSERT_TRUE(bnb.Eval(&blocks, &constraints, &upperbound));
+  ASSERT_EQ(upperbound, 3 * size);
+  ASSERT_EQ(tensors[0]->offset_, 0U);
+  ASSERT_EQ(tensors[1]->offset_, 2 * size);
+  ASSERT_EQ(tensors[2]->offset_, 2 * size);
+}
+}  // namespace mindspore::somas
@@ -19,7 +19,7 @@
 // #include "minddata/dataset/core/pybind_support.h"
 // #include "minddata/dataset/core/tensor.h"
 // #include "minddata/dataset/core/tensor_shape.h"
-// #include "minddata/dataset/engine/datasetops/batch_op.h"
+#include "minddata/dataset/engine/datasetops/batch_op.h"
 #include "minddata/dataset/engine/datasetops/source/tf_reader_op.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
@@ -136,3 +136,84 @@ TEST_F(MindDataTestBatchOp, DISABLED_TestSimpleBatchPadding) {
     EXPECT_TRUE(rc.IsOk());
   }
 }
+
+namespace {
+std::shared_ptr<Tensor> MakeTensor(const std::vector<int32_t> &data, const TensorShape &shape) {
+  std::shared_ptr<Tensor> t;
+  (void)Tensor::CreateFromVector(data, shape, &t);
+  return t;
+}
+
+// rows with a 1-D int32 column, a 2-D int32 column and a scalar float column
+std::unique_ptr<TensorQTable> MakeTable() {
+  auto table = std::make_unique<TensorQTable>();
+  table->push_back(TensorRow(0, {MakeTensor({1, 2}, TensorShape({2})), MakeTensor({1, 2, 3, 4}, TensorShape({2, 2}))}));
+  table->push_back(TensorRow(0, {MakeTensor({3, 4, 5}, TensorShape({3})), MakeTensor({5, 6, 7}, TensorShape({1, 3}))}));
+  table->push_back(
+    TensorRow(0, {MakeTensor({6}, TensorShape({1})), MakeTensor({8, 9, 10, 11, 12, 13}, TensorShape({3, 2}))}));
+  for (auto &row : *table) {
+    std::shared_ptr<Tensor> scalar;
+    (void)Tensor::CreateScalar(1.5f, &scalar);
+    row.push_back(scalar);
+  }
+  return table;
+}
+
+void CheckPadAndBatch(const PadInfo &pad_info) {
+  std::unordered_map<std::string, int32_t> column_name_id_map = {{"col1", 0}, {"col2", 1}, {"col3", 2}};
+  auto expected_table = MakeTable();
+  TensorRow expected;
+  ASSERT_OK(BatchOp::PadColumns(&expected_table, pad_info, column_name_id_map));
+  ASSERT_OK(BatchOp::BatchRows(&expected_table, &expected));
+
+  auto table = MakeTable();
+  auto pool = std::make_shared<BatchBufferPool>(1024, 1024);
+  TensorRow batched;
+  ASSERT_OK(BatchOp::PadAndBatchRows(&table, pad_info, column_name_id_map, &batched, false, pool.get()));
+  ASSERT_EQ(batched.size(), expected.size());
+  for (size_t i = 0; i < batched.size(); i++) {
+    EXPECT_EQ(batched[i]->shape(), expected[i]->shape());
+    EXPECT_TRUE(*(batched[i]) == *(expected[i]));
+  }
+}
+}  // namespace
+
+// Feature: Batch op padding
+// Description: Pad and batch rows in one pass, with and without pad info
+// Expectation: The batched tensors are the same as padding the rows first and batching them
+TEST_F(MindDataTestBatchOp, TestPadAndBatchRows) {
+  CheckPadAndBatch(PadInfo());
+
+  // pad with -1, the second column is cut to 2 rows
+  std::shared_ptr<Tensor> pad_value;
+  ASSERT_OK(Tensor::CreateScalar(-1.0f, &pad_value));
+  PadInfo pad_info;
+  pad_info.insert({"col1", std::make_pair(TensorShape({4}), pad_value)});
+  pad_info.insert({"col2", std::make_pair(TensorShape({2, -1}), pad_value)});
+  CheckPadAndBatch(pad_info);
+}
+
+// Feature: Batch buffer pool
+// Description: Create batched tensors of the same size one after another
+// Expectation: The buffer of a destroyed tensor is reused by the next one, large tensors are not pooled
+TEST_F(MindDataTestBatchOp, TestBatchBufferPool) {
+  auto pool = std::make_shared<BatchBufferPool>(1024, 512);
+  std::shared_ptr<Tensor> t;
+  ASSERT_OK(pool->CreateTensor(TensorShape({4, 8}), DataType(DataType::DE_INT32), &t));
+  const uchar *buffer = t->GetBuffer();
+  EXPECT_EQ(pool->FreeBytes(), 0);
+  t.reset();
+  EXPECT_EQ(pool->FreeBytes(), 128);
+  ASSERT_OK(pool->CreateTensor(TensorShape({4, 8}), DataType(DataType::DE_INT32), &t));
+  EXPECT_EQ(t->GetBuffer(), buffer);
+  EXPECT_EQ(pool->FreeBytes(), 0);
+
+  std::shared_ptr<Tensor> large;
+  ASSERT_OK(pool->CreateTensor(TensorShape({1024}), DataType(DataType::DE_INT32), &large));
+  large.reset();
+  EXPECT_EQ(pool->FreeBytes(), 0);
+
+  // the tensor outlives the pool
+  pool.reset();
+  t.reset();
+}
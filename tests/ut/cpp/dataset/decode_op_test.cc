@@ -38,3 +38,31 @@ TEST_F(MindDataTestDecodeOp, TestOp) {
 
   CheckImageShapeAndData(output_tensor, kDecode);
 }
+
+/// Feature: Decode op
+/// Description: Test Decode op with the size hint of a following Resize
+/// Expectation: The JPEG image is downscaled while decoding but is not smaller than the hinted size
+TEST_F(MindDataTestDecodeOp, TestOpWithTargetSize) {
+  MS_LOG(INFO) << "Doing testDecodeWithTargetSize";
+  std::shared_ptr<Tensor> full_tensor;
+  DecodeOp full_op(true);
+  ASSERT_OK(full_op.Compute(raw_input_tensor_, &full_tensor));
+  dsize_t full_height = full_tensor->shape()[0];
+  dsize_t full_width = full_tensor->shape()[1];
+
+  const int32_t target_height = static_cast<int32_t>(full_height / 5);
+  const int32_t target_width = static_cast<int32_t>(full_width / 5);
+  std::shared_ptr<Tensor> output_tensor;
+  DecodeOp op(true, target_height, target_width);
+  ASSERT_OK(op.Compute(raw_input_tensor_, &output_tensor));
+  // downscaled by 1/4 in the DCT domain
+  EXPECT_EQ(output_tensor->shape()[0], (full_height + 3) / 4);
+  EXPECT_EQ(output_tensor->shape()[1], (full_width + 3) / 4);
+  EXPECT_GE(output_tensor->shape()[0], target_height);
+  EXPECT_GE(output_tensor->shape()[1], target_width);
+
+  // no downscale when the target is as large as the image
+  DecodeOp large_op(true, static_cast<int32_t>(full_height), static_cast<int32_t>(full_width));
+  ASSERT_OK(large_op.Compute(raw_input_tensor_, &output_tensor));
+  EXPECT_EQ(output_tensor->shape(), full_tensor->shape());
+}
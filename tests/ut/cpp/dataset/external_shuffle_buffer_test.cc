@@ -0,0 +1,110 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/datasetops/external_shuffle_buffer.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestExternalShuffleBuffer : public UT::Common {
+ public:
+  MindDataTestExternalShuffleBuffer() {}
+
+  // a row with an int32 tensor holding i and a string tensor holding its text
+  TensorRow MakeRow(int32_t i) {
+    std::shared_ptr<Tensor> value;
+    std::shared_ptr<Tensor> text;
+    (void)Tensor::CreateFromVector(std::vector<int32_t>{i, i + 1}, &value);
+    (void)Tensor::CreateScalar(std::to_string(i), &text);
+    TensorRow row(i, {value, text});
+    row.setPath({"path_" + std::to_string(i)});
+    return row;
+  }
+
+  // shuffle rows 0..num_rows-1 and return the ids in the order they are taken out
+  std::vector<int32_t> Shuffle(int32_t num_rows, int64_t memory_budget, uint32_t seed, size_t *num_runs) {
+    std::mt19937_64 rng(seed);
+    ExternalShuffleBuffer buffer(".", "ut_external_shuffle", memory_budget, &rng);
+    for (int32_t i = 0; i < num_rows; i++) {
+      EXPECT_OK(buffer.Add(MakeRow(i)));
+    }
+    EXPECT_OK(buffer.Seal());
+    *num_runs = buffer.NumSpilledRuns();
+    std::vector<int32_t> ids;
+    while (buffer.Size() > 0) {
+      TensorRow row;
+      EXPECT_OK(buffer.Next(&row));
+      int32_t value = 0;
+      std::string_view text;
+      EXPECT_OK(row[0]->GetItemAt(&value, {0}));
+      EXPECT_OK(row[1]->GetItemAt(&text, {}));
+      EXPECT_EQ(row.getId(), value);
+      EXPECT_EQ(std::string(text), std::to_string(value));
+      EXPECT_EQ(row.getPath()[0], "path_" + std::to_string(value));
+      ids.push_back(value);
+    }
+    return ids;
+  }
+};
+
+/// Feature: ExternalShuffleBuffer
+/// Description: Write rows in the format of the spill files and read them back
+/// Expectation: The rows read are the same as the rows written
+TEST_F(MindDataTestExternalShuffleBuffer, TestWriteReadRow) {
+  std::stringstream ss;
+  TensorRow row = MakeRow(7);
+  ASSERT_OK(ExternalShuffleBuffer::WriteRow(&ss, row));
+  TensorRow out;
+  ASSERT_OK(ExternalShuffleBuffer::ReadRow(&ss, &out));
+  ASSERT_EQ(out.size(), row.size());
+  for (size_t i = 0; i < row.size(); i++) {
+    EXPECT_TRUE(*(out[i]) == *(row[i]));
+  }
+  EXPECT_EQ(out.getId(), 7);
+  EXPECT_EQ(out.getPath(), row.getPath());
+}
+
+/// Feature: ExternalShuffleBuffer
+/// Description: Shuffle a window which is spilled to several files with the same seed twice
+/// Expectation: Every row comes out once, the order is shuffled and only depends on the seed
+TEST_F(MindDataTestExternalShuffleBuffer, TestSpillShuffle) {
+  const int32_t num_rows = 200;
+  const int64_t memory_budget = 256;
+  size_t num_runs = 0;
+  auto ids = Shuffle(num_rows, memory_budget, 1, &num_runs);
+  EXPECT_GT(num_runs, 1);
+  ASSERT_EQ(ids.size(), num_rows);
+  EXPECT_EQ(std::set<int32_t>(ids.begin(), ids.end()).size(), num_rows);
+  std::vector<int32_t> sorted(ids);
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_NE(ids, sorted);
+
+  size_t num_runs_again = 0;
+  EXPECT_EQ(Shuffle(num_rows, memory_budget, 1, &num_runs_again), ids);
+  EXPECT_EQ(num_runs_again, num_runs);
+  EXPECT_NE(Shuffle(num_rows, memory_budget, 2, &num_runs_again), ids);
+
+  // all the rows fit in memory
+  auto in_memory_ids = Shuffle(num_rows, 1024 * 1024, 1, &num_runs);
+  EXPECT_EQ(num_runs, 0);
+  EXPECT_EQ(std::set<int32_t>(in_memory_ids.begin(), in_memory_ids.end()).size(), num_rows);
+}
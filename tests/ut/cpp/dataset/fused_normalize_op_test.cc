@@ -0,0 +1,135 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/data/type_cast_op.h"
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/rescale_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestFusedNormalizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestFusedNormalizeOp() : CVOpCommon() {}
+
+  // Run the ops one by one, the way Map runs them without the fusion pass
+  static Status RunUnfused(const std::vector<std::shared_ptr<TensorOp>> &ops, const std::shared_ptr<Tensor> &input,
+                           std::shared_ptr<Tensor> *output) {
+    std::shared_ptr<Tensor> in = input;
+    for (const auto &op : ops) {
+      std::shared_ptr<Tensor> out;
+      RETURN_IF_NOT_OK(op->Compute(in, &out));
+      in = out;
+    }
+    *output = in;
+    return Status::OK();
+  }
+
+  static void ExpectNear(const std::shared_ptr<Tensor> &expected, const std::shared_ptr<Tensor> &actual,
+                         double tolerance) {
+    ASSERT_EQ(expected->shape(), actual->shape());
+    ASSERT_EQ(expected->type(), actual->type());
+    std::shared_ptr<Tensor> expected_f64;
+    std::shared_ptr<Tensor> actual_f64;
+    ASSERT_OK(TypeCastOp(DataType(DataType::DE_FLOAT64)).Compute(expected, &expected_f64));
+    ASSERT_OK(TypeCastOp(DataType(DataType::DE_FLOAT64)).Compute(actual, &actual_f64));
+    auto expected_itr = expected_f64->begin<double>();
+    auto actual_itr = actual_f64->begin<double>();
+    for (; expected_itr != expected_f64->end<double>(); ++expected_itr, ++actual_itr) {
+      ASSERT_LE(std::fabs(*expected_itr - *actual_itr), tolerance);
+    }
+  }
+};
+
+/// Feature: FusedNormalizeOp
+/// Description: Compare Resize, Normalize, HWC2CHW and TypeCast fused and unfused
+/// Expectation: The outputs are the same
+TEST_F(MindDataTestFusedNormalizeOp, TestResizeNormalizeHwcToChw) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestResizeNormalizeHwcToChw.";
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  std::shared_ptr<TensorOp> resize_op = std::make_shared<ResizeOp>(64, 48);
+  std::vector<std::shared_ptr<TensorOp>> ops = {resize_op, std::make_shared<NormalizeOp>(mean, std, true),
+                                                std::make_shared<HwcToChwOp>()};
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(RunUnfused(ops, input_tensor_, &expected));
+  FusedNormalizeOp fused_op(ops, resize_op, 1.0, 0.0, mean, std, true, DataType(DataType::DE_FLOAT32));
+  std::shared_ptr<Tensor> output;
+  ASSERT_OK(fused_op.Compute(input_tensor_, &output));
+  ExpectNear(expected, output, 0.0);
+
+  ops.push_back(std::make_shared<TypeCastOp>(DataType(DataType::DE_FLOAT16)));
+  ASSERT_OK(RunUnfused(ops, input_tensor_, &expected));
+  FusedNormalizeOp fused_fp16_op(ops, resize_op, 1.0, 0.0, mean, std, true, DataType(DataType::DE_FLOAT16));
+  ASSERT_OK(fused_fp16_op.Compute(input_tensor_, &output));
+  ExpectNear(expected, output, 0.0);
+
+  // the inferred output is the same as the computed one
+  std::vector<TensorShape> output_shapes;
+  ASSERT_OK(fused_fp16_op.OutputShape({input_tensor_->shape()}, output_shapes));
+  ASSERT_EQ(output_shapes.size(), 1);
+  ASSERT_EQ(output_shapes[0], output->shape());
+  std::vector<DataType> output_types;
+  ASSERT_OK(fused_fp16_op.OutputType({input_tensor_->type()}, output_types));
+  ASSERT_EQ(output_types.size(), 1);
+  ASSERT_EQ(output_types[0], output->type());
+}
+
+/// Feature: FusedNormalizeOp
+/// Description: Compare Rescale and Normalize fused and unfused, with one mean and std value for all the channels
+/// Expectation: The outputs are equal within float rounding
+TEST_F(MindDataTestFusedNormalizeOp, TestRescaleNormalize) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestRescaleNormalize.";
+  const float rescale = 1.0 / 255.0;
+  const float shift = 0.0;
+  std::vector<float> mean = {0.5};
+  std::vector<float> std = {0.25};
+  std::vector<std::shared_ptr<TensorOp>> ops = {std::make_shared<RescaleOp>(rescale, shift),
+                                                std::make_shared<NormalizeOp>(mean, std, true)};
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(RunUnfused(ops, input_tensor_, &expected));
+  FusedNormalizeOp fused_op(ops, nullptr, rescale, shift, mean, std, false, DataType(DataType::DE_FLOAT32));
+  std::shared_ptr<Tensor> output;
+  ASSERT_OK(fused_op.Compute(input_tensor_, &output));
+  ExpectNear(expected, output, 1e-5);
+}
+
+/// Feature: FusedNormalizeOp
+/// Description: Run FusedNormalizeOp on a batch of images, which the fused kernel does not handle
+/// Expectation: The original ops run and the output is the same as the unfused one
+TEST_F(MindDataTestFusedNormalizeOp, TestFallback) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestFallback.";
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateFromTensor(input_tensor_, &input));
+  ASSERT_OK(input->ExpandDim(0));
+  std::vector<std::shared_ptr<TensorOp>> ops = {std::make_shared<NormalizeOp>(mean, std, true)};
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(RunUnfused(ops, input, &expected));
+  FusedNormalizeOp fused_op(ops, nullptr, 1.0, 0.0, mean, std, false, DataType(DataType::DE_FLOAT32));
+  std::shared_ptr<Tensor> output;
+  ASSERT_OK(fused_op.Compute(input, &output));
+  ExpectNear(expected, output, 0.0);
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/util/io_service.h"
+#include "minddata/dataset/util/path.h"
+#include "minddata/dataset/util/services.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestIOService : public UT::Common {
+ public:
+  MindDataTestIOService() {}
+
+  void SetUp() override {
+    Services::CreateInstance();
+    ASSERT_OK(IOService::CreateInstance());
+  }
+
+  std::string WriteFile(const std::string &name, size_t size) {
+    std::string path = "./io_service_test_" + name;
+    std::ofstream fs(path, std::ios::binary | std::ios::trunc);
+    for (size_t i = 0; i < size; i++) {
+      fs.put(static_cast<char>(i % 251));
+    }
+    fs.close();
+    return path;
+  }
+};
+
+/// Feature: IOService
+/// Description: Prefetch whole files, flush them in one batch and read them back, including a file never prefetched
+/// Expectation: The content read matches the content written and nothing is left pending
+TEST_F(MindDataTestIOService, TestPrefetchRead) {
+  MS_LOG(INFO) << "IO engine: " << IOService::GetInstance().EngineName();
+  const size_t num_files = 8;
+  std::vector<std::string> paths;
+  for (size_t i = 0; i < num_files; i++) {
+    paths.push_back(WriteFile(std::to_string(i), 1000 * (i + 1)));
+  }
+  for (size_t i = 0; i + 1 < num_files; i++) {
+    ASSERT_OK(IOService::GetInstance().Prefetch(paths[i]));
+  }
+  IOService::GetInstance().Flush();
+  for (size_t i = 0; i < num_files; i++) {
+    std::shared_ptr<std::vector<uint8_t>> content;
+    ASSERT_OK(IOService::GetInstance().Read(paths[i], &content));
+    ASSERT_EQ(content->size(), 1000 * (i + 1));
+    for (size_t j = 0; j < content->size(); j++) {
+      ASSERT_EQ((*content)[j], static_cast<uint8_t>(j % 251));
+    }
+  }
+  EXPECT_EQ(IOService::GetInstance().NumPending(), 0);
+  for (auto &path : paths) {
+    (void)Path(path).Remove();
+  }
+}
+
+/// Feature: IOService
+/// Description: Prefetch and read a range of a file, and read a file which doesn't exist
+/// Expectation: The range is read correctly and reading the missing file fails
+TEST_F(MindDataTestIOService, TestRangeAndMissingFile) {
+  auto path = WriteFile("range", 4096);
+  // read before flushing, which submits the queued read itself
+  ASSERT_OK(IOService::GetInstance().Prefetch(path, 100, 200));
+  std::shared_ptr<std::vector<uint8_t>> content;
+  ASSERT_OK(IOService::GetInstance().Read(path, 100, 200, &content));
+  ASSERT_EQ(content->size(), 200);
+  for (size_t j = 0; j < content->size(); j++) {
+    ASSERT_EQ((*content)[j], static_cast<uint8_t>((j + 100) % 251));
+  }
+  (void)Path(path).Remove();
+
+  const std::string missing = "./io_service_test_missing";
+  ASSERT_OK(IOService::GetInstance().Prefetch(missing));
+  EXPECT_ERROR(IOService::GetInstance().Read(missing, &content));
+  EXPECT_EQ(IOService::GetInstance().NumPending(), 0);
+}
@@ -120,3 +120,80 @@ TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassPreBuiltTensorO
   ASSERT_EQ(fused_ops.size(), 1);
   ASSERT_EQ(fused_ops[0]->Name(), kRandomCropDecodeResizeOp);
 }
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass by fusing Resize, Normalize, HWC2CHW and TypeCast
+/// Expectation: The chain is replaced by one FusedNormalizeOp
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassNormalizeChain) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassNormalizeChain.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  auto decode_op = vision::Decode();
+  auto resize_op = vision::Resize({32, 32});
+  auto normalize_op = vision::Normalize({121.0, 115.0, 100.0}, {70.0, 68.0, 71.0});
+  auto hwc2chw_op = vision::HWC2CHW();
+  auto type_cast_op = transforms::TypeCast(mindspore::DataType::kNumberTypeFloat16);
+  std::shared_ptr<Dataset> root =
+    ImageFolder(folder_path, false)->Map({decode_op, resize_op, normalize_op, hwc2chw_op, type_cast_op}, {"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 2);
+  EXPECT_EQ(fused_ops[0]->Name(), vision::kDecodeOperation);
+  EXPECT_EQ(fused_ops[1]->Name(), kFusedNormalizeOp);
+}
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass with operations which can only be partly fused
+/// Expectation: Normalize in CHW layout is kept, the cast to int32 is not fused
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassNormalizeChainPartial) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassNormalizeChainPartial.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  auto rescale_op = vision::Rescale(1.0 / 255.0, 0.0);
+  auto normalize_chw_op = vision::Normalize({0.5}, {0.5}, false);
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Map({rescale_op, normalize_chw_op}, {"image"});
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, false);
+
+  auto normalize_op = vision::Normalize({0.5}, {0.5});
+  auto type_cast_op = transforms::TypeCast(mindspore::DataType::kNumberTypeInt32);
+  root = ImageFolder(folder_path, false)->Map({rescale_op, normalize_op, type_cast_op}, {"image"});
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 2);
+  EXPECT_EQ(fused_ops[0]->Name(), kFusedNormalizeOp);
+  EXPECT_EQ(fused_ops[1]->Name(), transforms::kTypeCastOperation);
+}
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass hinting Decode with the size of a following Resize
+/// Expectation: Decode is replaced by a hinted copy and Resize is kept
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassDecodeResizeHint) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassDecodeResizeHint.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  auto decode_op = vision::Decode();
+  auto resize_op = vision::Resize({32});
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Map({decode_op, resize_op}, {"image"});
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  auto original_ops = map_node->operations();
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto hinted_ops = map_node->operations();
+  ASSERT_EQ(hinted_ops.size(), 2);
+  EXPECT_EQ(hinted_ops[0]->Name(), vision::kDecodeOperation);
+  EXPECT_NE(hinted_ops[0], original_ops[0]);
+  EXPECT_EQ(hinted_ops[1], original_ops[1]);
+}
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "common/common_test.h"
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
+
+namespace mindspore {
+namespace kernel {
+class ParallelSearchCacheTest : public UT::Common {
+ public:
+  ParallelSearchCacheTest() = default;
+
+  void SetUp() override { RemoveFiles(); }
+  void TearDown() override { RemoveFiles(); }
+
+  void RemoveFiles() {
+    (void)std::remove(path_.c_str());
+    (void)std::remove((path_ + ".lock").c_str());
+  }
+
+  size_t LineCount() {
+    std::ifstream ifs(path_);
+    size_t count = 0;
+    std::string line;
+    while (std::getline(ifs, line)) {
+      ++count;
+    }
+    return count;
+  }
+
+  std::string path_ = "./parallel_search_cache_test.txt";
+};
+
+/// Feature: ParallelSearchCache
+/// Description: Put entries and load them in a new cache while the first one is alive and never saved
+/// Expectation: The new cache gets the entries, which are appended to the file by Put
+TEST_F(ParallelSearchCacheTest, put_and_load) {
+  ParallelSearchCache first(path_, ParallelSearchCache::Mode::kReadWrite);
+  size_t best_pow = 0;
+  EXPECT_FALSE(first.Get("Add|float32[2,3]", &best_pow));
+  first.Put("Add|float32[2,3]", 3);
+  first.Put("Mul|float32[4] with space", 1);
+  EXPECT_TRUE(first.Get("Add|float32[2,3]", &best_pow));
+  EXPECT_EQ(best_pow, 3U);
+
+  ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kReadWrite);
+  EXPECT_TRUE(cache.Get("Add|float32[2,3]", &best_pow));
+  EXPECT_EQ(best_pow, 3U);
+  EXPECT_TRUE(cache.Get("Mul|float32[4] with space", &best_pow));
+  EXPECT_EQ(best_pow, 1U);
+}
+
+/// Feature: ParallelSearchCache
+/// Description: Put the same key twice in tune mode, then save
+/// Expectation: The later entry overrides the earlier one, and Save compacts the file to one line per key
+TEST_F(ParallelSearchCacheTest, compact_on_save) {
+  ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kTune);
+  cache.Put("Add", 2);
+  cache.Put("Add", 3);
+  cache.Put("Mul", 1);
+  EXPECT_EQ(LineCount(), 3U);
+  size_t best_pow = 0;
+  EXPECT_TRUE(ParallelSearchCache(path_, ParallelSearchCache::Mode::kReadOnly).Get("Add", &best_pow));
+  EXPECT_EQ(best_pow, 3U);
+  cache.Save();
+  EXPECT_EQ(LineCount(), 2U);
+  EXPECT_TRUE(ParallelSearchCache(path_, ParallelSearchCache::Mode::kReadOnly).Get("Add", &best_pow));
+  EXPECT_EQ(best_pow, 3U);
+}
+
+/// Feature: ParallelSearchCache
+/// Description: Two caches of the same file save different entries
+/// Expectation: The file keeps the entries of both caches
+TEST_F(ParallelSearchCacheTest, merge_on_save) {
+  ParallelSearchCache first(path_, ParallelSearchCache::Mode::kReadWrite);
+  ParallelSearchCache second(path_, ParallelSearchCache::Mode::kReadWrite);
+  first.Put("Add", 2);
+  second.Put("Mul", 4);
+  first.Save();
+  second.Save();
+  ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kReadOnly);
+  size_t best_pow = 0;
+  EXPECT_TRUE(cache.Get("Add", &best_pow));
+  EXPECT_EQ(best_pow, 2U);
+  EXPECT_TRUE(cache.Get("Mul", &best_pow));
+  EXPECT_EQ(best_pow, 4U);
+}
+
+/// Feature: ParallelSearchCache
+/// Description: Use the read_only and tune modes
+/// Expectation: read_only never writes the file, tune ignores the existing entries and overwrites them
+TEST_F(ParallelSearchCacheTest, modes) {
+  {
+    ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kReadOnly);
+    cache.Put("Add", 2);
+  }
+  size_t best_pow = 0;
+  EXPECT_FALSE(ParallelSearchCache(path_, ParallelSearchCache::Mode::kReadWrite).Get("Add", &best_pow));
+  {
+    ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kReadWrite);
+    cache.Put("Add", 2);
+  }
+  {
+    ParallelSearchCache cache(path_, ParallelSearchCache::Mode::kTune);
+    EXPECT_FALSE(cache.Get("Add", &best_pow));
+    cache.Put("Add", 5);
+  }
+  EXPECT_TRUE(ParallelSearchCache(path_, ParallelSearchCache::Mode::kReadWrite).Get("Add", &best_pow));
+  EXPECT_EQ(best_pow, 5U);
+}
+
+/// Feature: ParallelSearchCache
+/// Description: Create a cache with an empty path
+/// Expectation: The cache is disabled and writes no file
+TEST_F(ParallelSearchCacheTest, disabled) {
+  ParallelSearchCache cache("", ParallelSearchCache::Mode::kReadWrite);
+  EXPECT_FALSE(cache.enabled());
+  size_t best_pow = 0;
+  cache.Put("Add", 2);
+  cache.Save();
+  EXPECT_FALSE(ParallelSearchCache(path_, ParallelSearchCache::Mode::kReadWrite).Get("Add", &best_pow));
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -239,5 +240,54 @@ TEST_F(TestShardReader, TestShardReaderConsumer) {
   }
   dataset.Close();
 }
+
+/// Feature: ShardReader mmap read.
+/// Description: read every row by id through file streams and through views of the mapped file.
+/// Expectation: the blobs and scalar fields are the same, the views stay valid after the reader is closed.
+TEST_F(TestShardReader, TestShardReaderMmapRead) {
+  MS_LOG(INFO) << FormatInfo("Test read imageNet by mmap");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+
+  ShardReader stream_reader;
+  ASSERT_TRUE(stream_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(stream_reader.Launch(true).IsOk());
+  ShardReader mmap_reader;
+  mmap_reader.SetMmapRead(true);
+  ASSERT_TRUE(mmap_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(mmap_reader.IsMmapRead());
+  ASSERT_TRUE(mmap_reader.Launch(true).IsOk());
+  ASSERT_EQ(stream_reader.GetNumRows(), mmap_reader.GetNumRows());
+
+  std::vector<std::shared_ptr<TASK_VIEW_CONTENT>> views;
+  for (int64_t task_id = 0; task_id < stream_reader.GetNumRows(); ++task_id) {
+    std::shared_ptr<TASK_CONTENT> content;
+    ASSERT_TRUE(stream_reader.GetNextById(task_id, 0, &content).IsOk());
+    std::shared_ptr<TASK_VIEW_CONTENT> view_content;
+    ASSERT_TRUE(mmap_reader.GetNextById(task_id, static_cast<int32_t>(task_id % 4), &view_content).IsOk());
+    ASSERT_EQ(content->second.size(), view_content->second.size());
+    for (size_t i = 0; i < content->second.size(); ++i) {
+      const auto &blob = std::get<0>(content->second[i]);
+      const auto &view = std::get<0>(view_content->second[i]);
+      ASSERT_EQ(blob.size(), view.size);
+      ASSERT_NE(view.holder, nullptr);
+      ASSERT_EQ(std::vector<uint8_t>(view.data, view.data + view.size), blob);
+      ASSERT_EQ(std::get<1>(content->second[i]), std::get<1>(view_content->second[i]));
+    }
+    views.push_back(view_content);
+  }
+  stream_reader.Close();
+  mmap_reader.Close();
+
+  // the views share the ownership of the mapping
+  uint64_t total = 0;
+  for (const auto &view_content : views) {
+    for (const auto &row : view_content->second) {
+      const auto &view = std::get<0>(row);
+      total += std::count(view.data, view.data + view.size, 0);
+    }
+  }
+  MS_LOG(INFO) << "Zero bytes in blobs: " << total;
+}
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "runtime/pipeline/ring_queue.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+class RingQueueTest : public UT::Common {
+ public:
+  RingQueueTest() {}
+};
+
+/// Feature: Multi-producer ring queue of the pynative pipeline.
+/// Description: Several threads push values to a small queue, which is full from time to time, and the consumer sleeps
+/// from time to time.
+/// Expectation: The consumer gets all the values in the order of each producer and the queue is empty at last.
+TEST_F(RingQueueTest, MultiProducers) {
+  constexpr int kProducerNum = 4;
+  constexpr int kValueNum = 20000;
+  constexpr int kSleepInterval = 5000;
+  RingQueue<std::shared_ptr<std::pair<int, int>>, 16> queue;
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < kProducerNum; ++producer) {
+    (void)producers.emplace_back([&queue, producer]() {
+      for (int i = 0; i < kValueNum; ++i) {
+        queue.Enqueue(std::make_shared<std::pair<int, int>>(producer, i));
+        if (i % kSleepInterval == 0) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+      }
+    });
+  }
+  std::vector<int> last_index(kProducerNum, -1);
+  for (int i = 0; i < kProducerNum * kValueNum; ++i) {
+    auto value = queue.Head();
+    ASSERT_NE(value, nullptr);
+    ASSERT_EQ(value->second, last_index[value->first] + 1);
+    last_index[value->first] = value->second;
+    queue.Dequeue();
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  ASSERT_TRUE(queue.IsEmpty());
+}
+}  // namespace mindspore
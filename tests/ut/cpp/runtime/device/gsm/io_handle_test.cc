@@ -0,0 +1,133 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dlfcn.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/device/gsm/io_handle.h"
+#include "utils/file_utils.h"
+
+namespace mindspore::device {
+namespace {
+constexpr size_t kBufferAlignSize = 4096;
+// A parameter and its two optimizer states.
+constexpr size_t kTensorNum = 3;
+constexpr size_t kTensorSize = 64 << 20;
+constexpr char kSwapPath[] = "./io_handle_test";
+
+struct AlignedBuffer {
+  explicit AlignedBuffer(size_t size) {
+    if (posix_memalign(&addr, kBufferAlignSize, size) != 0) {
+      addr = nullptr;
+    }
+  }
+  ~AlignedBuffer() { free(addr); }
+  void *addr{nullptr};
+};
+}  // namespace
+
+class TestIOHandle : public UT::Common {
+ public:
+  TestIOHandle() = default;
+
+  // Swap the tensors out to files and in again by the aio plugin, checks the data swapped in and logs the throughput.
+  void CheckSwap(const std::string &aio_lib_name) {
+    IOHandle io_handle;
+    if (!io_handle.LoadAio(aio_lib_name, "get_aio_instance")) {
+      GTEST_SKIP() << aio_lib_name << " is not available.";
+    }
+    (void)FileUtils::CreateNotExistDirs(kSwapPath, true);
+    AlignedBuffer host(kTensorNum * kTensorSize);
+    AlignedBuffer swap_in(kTensorNum * kTensorSize);
+    ASSERT_NE(host.addr, nullptr);
+    ASSERT_NE(swap_in.addr, nullptr);
+    auto host_data = static_cast<uint8_t *>(host.addr);
+    auto swap_in_data = static_cast<uint8_t *>(swap_in.addr);
+    for (size_t i = 0; i < kTensorNum * kTensorSize; ++i) {
+      host_data[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+    (void)memset(swap_in.addr, 0, kTensorNum * kTensorSize);
+    io_handle.RegisterBuffer(host.addr, kTensorNum * kTensorSize);
+    io_handle.RegisterBuffer(swap_in.addr, kTensorNum * kTensorSize);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<AsyncIOToken> tokens(kTensorNum);
+    for (size_t i = 0; i < kTensorNum; ++i) {
+      auto file_name = std::string(kSwapPath) + "/tensor_" + std::to_string(i);
+      ASSERT_TRUE(io_handle.WriteAsync(file_name, host_data + i * kTensorSize, kTensorSize, &tokens[i]));
+    }
+    for (auto token : tokens) {
+      ASSERT_TRUE(io_handle.Wait(token));
+    }
+    for (size_t i = 0; i < kTensorNum; ++i) {
+      auto file_name = std::string(kSwapPath) + "/tensor_" + std::to_string(i);
+      ASSERT_TRUE(io_handle.ReadAsync(file_name, swap_in_data + i * kTensorSize, kTensorSize, &tokens[i]));
+    }
+    for (auto token : tokens) {
+      ASSERT_TRUE(io_handle.Wait(token));
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    io_handle.UnregisterBuffer(host.addr);
+    io_handle.UnregisterBuffer(swap_in.addr);
+    for (size_t i = 0; i < kTensorNum; ++i) {
+      ASSERT_EQ(memcmp(host_data + i * kTensorSize, swap_in_data + i * kTensorSize, kTensorSize), 0)
+        << "Tensor " << i << " swapped in by " << aio_lib_name << " is different.";
+      (void)io_handle.DeleteSwapFile(std::string(kSwapPath) + "/tensor_" + std::to_string(i));
+    }
+    constexpr double kMB = 1 << 20;
+    MS_LOG(WARNING) << "Swap throughput of " << aio_lib_name << ": " << 2 * kTensorNum * kTensorSize / kMB / cost
+                    << " MB/s.";
+  }
+};
+
+/// Feature: Swap io of memory offload.
+/// Description: Swap a parameter and its optimizer states out to files and in again by the libaio plugin, run it on a
+/// NVMe disk to compare the throughput with the io_uring plugin.
+/// Expectation: The data swapped in is the same as the data swapped out.
+TEST_F(TestIOHandle, test_libaio_swap) { CheckSwap("libaio_plugin.so"); }
+
+/// Feature: Swap io of memory offload.
+/// Description: Swap a parameter and its optimizer states out to files and in again by the io_uring plugin, which is
+/// skipped if the kernel does not support io_uring.
+/// Expectation: The data swapped in is the same as the data swapped out.
+TEST_F(TestIOHandle, test_io_uring_swap) { CheckSwap("libio_uring_plugin.so"); }
+
+/// Feature: Swap io of memory offload.
+/// Description: Swap the tensors in the buffers registered to the io_uring plugin, which are read and written by
+/// READ_FIXED and WRITE_FIXED.
+/// Expectation: The blocks are read and written with the registered buffers.
+TEST_F(TestIOHandle, test_io_uring_fixed_buffer) {
+  auto handle = dlopen("libio_uring_plugin.so", RTLD_NOW);
+  if (handle == nullptr) {
+    GTEST_SKIP() << "libio_uring_plugin.so is not available.";
+  }
+  auto get_fixed_block_num = reinterpret_cast<size_t (*)()>(dlsym(handle, "get_io_uring_fixed_block_num"));
+  ASSERT_NE(get_fixed_block_num, nullptr);
+  const auto fixed_block_num = get_fixed_block_num();
+  CheckSwap("libio_uring_plugin.so");
+  if (IsSkipped()) {
+    (void)dlclose(handle);
+    return;
+  }
+  EXPECT_GT(get_fixed_block_num(), fixed_block_num);
+  (void)dlclose(handle);
+}
+}  // namespace mindspore::device
@@ -0,0 +1,189 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/device/loadable_device_address.h"
+#include "runtime/device/gsm/swap_manager.h"
+
+namespace mindspore::device {
+namespace {
+constexpr char kSwapTestDevice[] = "SwapTest";
+constexpr size_t kPoolSize = 64UL << 20;
+constexpr size_t kPoolBlockSize = 8UL << 20;
+constexpr size_t kDataSize = 1UL << 20;
+
+class TestDeviceMemPool : public DynamicMemPoolBestFit {
+ public:
+  TestDeviceMemPool() { SetMemAllocUintSize(kPoolBlockSize, kPoolBlockSize); }
+  ~TestDeviceMemPool() override = default;
+  size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override {
+    *addr = malloc(size);
+    return *addr == nullptr ? 0 : size;
+  }
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override {
+    free(addr);
+    return true;
+  }
+  size_t free_mem_size() override { return kPoolSize; }
+};
+
+class TestHostMemPool : public PinMemPool {
+ public:
+  TestHostMemPool() {
+    max_size_ = kPoolSize;
+    SetMemAllocUintSize(kPoolBlockSize, kPoolBlockSize);
+    inited_ = true;
+  }
+  ~TestHostMemPool() override = default;
+  void PinnedMemAlloc(DeviceMemPtr *addr, size_t size) override { *addr = malloc(size); }
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override {
+    OnMemBlockFree(addr);
+    free(addr);
+    return true;
+  }
+};
+
+class TestSwapResManager : public DeviceResManager {
+ public:
+  TestSwapResManager() { swap_manager_ = std::make_shared<SwapManager>(0, &device_pool_, &host_pool_); }
+  ~TestSwapResManager() override = default;
+  void *AllocateMemory(size_t size, uint32_t stream_id) const override { return nullptr; }
+  void FreeMemory(void *ptr) const override {}
+  void FreePartMemorys(const std::vector<void *> &free_addrs, const std::vector<void *> &keep_addrs,
+                       const std::vector<size_t> &keep_addr_sizes) const override {}
+
+ private:
+  TestDeviceMemPool device_pool_;
+  TestHostMemPool host_pool_;
+};
+
+class TestSwapDeviceContext : public DeviceInterface<TestSwapResManager> {
+ public:
+  explicit TestSwapDeviceContext(const DeviceContextKey &device_context_key) : DeviceInterface(device_context_key) {}
+  ~TestSwapDeviceContext() override = default;
+  void Initialize() override {}
+  RunMode GetRunMode(const FuncGraphPtr &func_graph) const override { return RunMode::kKernelMode; }
+};
+MS_REGISTER_DEVICE(kSwapTestDevice, TestSwapDeviceContext);
+
+// The device memory of the test device is host memory, so the copies are memcpy.
+class TestLoadableDeviceAddress : public LoadableDeviceAddress {
+ public:
+  TestLoadableDeviceAddress(void *ptr, size_t size)
+      : LoadableDeviceAddress(ptr, size, "DefaultFormat", kNumberTypeFloat32, kSwapTestDevice, 0) {}
+  ~TestLoadableDeviceAddress() override = default;
+
+ protected:
+  bool CopyDeviceToHost(void *dst, const void *src, size_t size, bool async, size_t stream_id) const override {
+    return dst != nullptr && src != nullptr && memcpy(dst, src, size) == dst;
+  }
+  bool CopyHostToDevice(void *dst, const void *src, size_t size, bool async, size_t stream_id) const override {
+    return dst != nullptr && src != nullptr && memcpy(dst, src, size) == dst;
+  }
+};
+}  // namespace
+
+class TestLoadableDeviceAddressSwap : public UT::Common {
+ public:
+  TestLoadableDeviceAddressSwap() = default;
+
+  SwapManager *GetSwapManager() {
+    auto device_context = DeviceContextManager::GetInstance().GetOrCreateDeviceContext({kSwapTestDevice, 0});
+    MS_EXCEPTION_IF_NULL(device_context);
+    return device_context->device_res_manager_->swap_manager().get();
+  }
+
+  // Creates the device address of the data in the device memory.
+  std::shared_ptr<TestLoadableDeviceAddress> CreateInDevice(const std::vector<float> &data) {
+    void *device_ptr = GetSwapManager()->AllocDeviceMemory(data.size() * sizeof(float));
+    EXPECT_NE(device_ptr, nullptr);
+    (void)memcpy(device_ptr, data.data(), data.size() * sizeof(float));
+    return std::make_shared<TestLoadableDeviceAddress>(device_ptr, data.size() * sizeof(float));
+  }
+
+  // Moves the device address from host to device as the swap actions do, and checks the data.
+  void CheckMoveToDevice(const std::shared_ptr<TestLoadableDeviceAddress> &address, const std::vector<float> &data) {
+    EXPECT_TRUE(address->MoveTo(StorageType::kDevice, false, 0));
+    EXPECT_EQ(address->status(), DeviceAddressStatus::kInDevice);
+    ASSERT_NE(address->GetDevicePtr(), nullptr);
+    EXPECT_EQ(memcmp(address->GetDevicePtr(), data.data(), data.size() * sizeof(float)), 0);
+  }
+};
+
+/// Feature: Compressed host memory tier of memory offload.
+/// Description: Compress the random data, which is rejected, then decompress and load it as the swap actions do.
+/// Expectation: The data stays in the same host memory and is loaded to device unchanged.
+TEST_F(TestLoadableDeviceAddressSwap, test_compress_rejected) {
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+  std::vector<float> data(kDataSize / sizeof(float));
+  for (auto &value : data) {
+    value = uniform(rng);
+  }
+  auto address = CreateInDevice(data);
+  EXPECT_TRUE(address->MoveTo(StorageType::kHost, false, 0));
+  EXPECT_EQ(address->status(), DeviceAddressStatus::kInHost);
+  EXPECT_EQ(address->GetDevicePtr(), nullptr);
+  void *host_ptr = address->GetStorageInfo().host_ptr_;
+  ASSERT_NE(host_ptr, nullptr);
+
+  EXPECT_TRUE(address->MoveTo(StorageType::kCompressedHost, true, 0));
+  EXPECT_TRUE(address->MoveTo(StorageType::kHost, true, 0));
+  EXPECT_EQ(address->status(), DeviceAddressStatus::kInHost);
+  EXPECT_EQ(address->GetStorageInfo().host_ptr_, host_ptr);
+  CheckMoveToDevice(address, data);
+}
+
+/// Feature: Compressed host memory tier of memory offload.
+/// Description: Compress the sparse data, then decompress and load it as the swap actions do.
+/// Expectation: The host memory is freed once compressed, and the data is loaded to device unchanged.
+TEST_F(TestLoadableDeviceAddressSwap, test_compress_accepted) {
+  std::vector<float> data(kDataSize / sizeof(float), 0.0f);
+  for (size_t i = 0; i < data.size(); i += 16) {
+    data[i] = static_cast<float>(i);
+  }
+  auto address = CreateInDevice(data);
+  EXPECT_TRUE(address->MoveTo(StorageType::kHost, false, 0));
+  EXPECT_TRUE(address->MoveTo(StorageType::kCompressedHost, false, 0));
+  EXPECT_EQ(address->status(), DeviceAddressStatus::kInCompressedHost);
+  EXPECT_EQ(address->GetStorageInfo().host_ptr_, nullptr);
+
+  EXPECT_TRUE(address->MoveTo(StorageType::kHost, true, 0));
+  CheckMoveToDevice(address, data);
+}
+
+/// Feature: Compressed host memory tier of memory offload.
+/// Description: Compress the data in the host memory not owned by the device address, which is skipped.
+/// Expectation: The data stays in the given host memory and is loaded to device unchanged.
+TEST_F(TestLoadableDeviceAddressSwap, test_compress_skipped) {
+  std::vector<float> data(kDataSize / sizeof(float), 1.0f);
+  std::vector<float> host(data);
+  auto address = std::make_shared<TestLoadableDeviceAddress>(nullptr, kDataSize);
+  address->SetStorageInfo({host.data(), "", false, true});
+  EXPECT_EQ(address->status(), DeviceAddressStatus::kInHost);
+
+  EXPECT_TRUE(address->MoveTo(StorageType::kCompressedHost, true, 0));
+  EXPECT_EQ(address->status(), DeviceAddressStatus::kInHost);
+  EXPECT_TRUE(address->MoveTo(StorageType::kHost, true, 0));
+  EXPECT_EQ(address->GetStorageInfo().host_ptr_, host.data());
+  CheckMoveToDevice(address, data);
+}
+}  // namespace mindspore::device
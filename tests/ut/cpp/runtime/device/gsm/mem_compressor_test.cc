@@ -0,0 +1,86 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/device/gsm/mem_compressor.h"
+
+namespace mindspore::device {
+class TestMemCompressor : public UT::Common {
+ public:
+  TestMemCompressor() = default;
+
+  // Compress and decompress the data by MemCompressor, returns whether the data is compressed enough.
+  bool RoundTrip(const std::vector<uint8_t> &data, size_t elem_size) {
+    auto compressed = std::make_shared<CompressedData>();
+    auto &compressor = MemCompressor::GetInstance();
+    bool compressed_enough = compressor.CompressAsync(data.data(), data.size(), elem_size, compressed).get();
+    std::vector<uint8_t> decompressed(data.size());
+    EXPECT_TRUE(compressor.DecompressAsync(compressed, decompressed.data()).get());
+    EXPECT_EQ(memcmp(data.data(), decompressed.data(), data.size()), 0);
+    return compressed_enough;
+  }
+};
+
+/// Feature: Compressed host memory tier of memory offload.
+/// Description: Compress and decompress the data of several segments, which is sparse, repeated or random.
+/// Expectation: The decompressed data is the same as the original data, only the random data is not compressed enough.
+TEST_F(TestMemCompressor, test_compress_round_trip) {
+  constexpr size_t kDataSize = (9UL << 20) + 3;
+  std::mt19937 rng(0);
+  std::normal_distribution<float> normal(0.0f, 0.02f);
+  std::vector<uint8_t> sparse(kDataSize, 0);
+  for (size_t i = 0; i + sizeof(float) <= kDataSize; i += 16 * sizeof(float)) {
+    float value = normal(rng);
+    (void)memcpy(sparse.data() + i, &value, sizeof(float));
+  }
+  std::vector<uint8_t> repeated(kDataSize);
+  for (size_t i = 0; i < kDataSize; ++i) {
+    repeated[i] = static_cast<uint8_t>(i % 13);
+  }
+  std::vector<uint8_t> random(kDataSize);
+  for (auto &value : random) {
+    value = static_cast<uint8_t>(rng());
+  }
+  for (size_t elem_size : {1, 2, 4}) {
+    EXPECT_TRUE(RoundTrip(sparse, elem_size));
+    EXPECT_TRUE(RoundTrip(repeated, elem_size));
+    EXPECT_FALSE(RoundTrip(random, elem_size));
+  }
+}
+
+/// Feature: Compressed host memory tier of memory offload.
+/// Description: Decompress the truncated data of a segment.
+/// Expectation: Decompressing fails instead of writing out of the destination.
+TEST_F(TestMemCompressor, test_decompress_truncated_segment) {
+  constexpr size_t kDataSize = 100000;
+  std::vector<uint8_t> data(kDataSize);
+  for (size_t i = 0; i < kDataSize; ++i) {
+    data[i] = static_cast<uint8_t>(i % 7);
+  }
+  std::vector<uint8_t> segment;
+  MemCompressor::CompressSegment(data.data(), kDataSize, 1, &segment);
+  EXPECT_LT(segment.size(), kDataSize);
+  std::vector<uint8_t> decompressed(kDataSize);
+  EXPECT_TRUE(MemCompressor::DecompressSegment(segment, 1, decompressed.data(), kDataSize));
+  EXPECT_EQ(data, decompressed);
+  segment.resize(segment.size() / 2);
+  EXPECT_FALSE(MemCompressor::DecompressSegment(segment, 1, decompressed.data(), kDataSize));
+}
+}  // namespace mindspore::device
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/device/gsm/swap_cost_model.h"
+
+namespace mindspore::device {
+class TestSwapCostModel : public UT::Common {
+ public:
+  TestSwapCostModel() = default;
+};
+
+/// Feature: Cost model of memory swap strategy.
+/// Description: Plan the loads of tensors by the idle time of the link in the kernels ahead of them.
+/// Expectation: The loads start as late as they can be hidden, and the time beyond the kernels is exposed.
+TEST_F(TestSwapCostModel, test_plan_load) {
+  SwapCostProfile profile;
+  profile.kernel_costs_ = {10, 10, 10, 10, 10};
+  profile.bandwidths_[SwapActionType::kDDR2HBM] = 100;
+  SwapCostModel model(profile);
+  EXPECT_DOUBLE_EQ(model.KernelTime(1, 3), 20);
+  EXPECT_DOUBLE_EQ(model.KernelTime(3, 7), 40);
+  EXPECT_DOUBLE_EQ(model.TransferTime(SwapActionType::kDDR2HBM, 1500), 15);
+
+  // The first load takes kernel 3 and half of kernel 2.
+  EXPECT_EQ(model.PlanLoad(0, 4, 15), 2);
+  EXPECT_DOUBLE_EQ(model.ReserveLoad(2, 4, 15), 0);
+  // The second load shares kernel 2 with the first one.
+  EXPECT_EQ(model.PlanLoad(0, 4, 10), 1);
+  EXPECT_DOUBLE_EQ(model.ReserveLoad(1, 4, 10), 0);
+  // The link is busy before kernel 4, the load can not be hidden.
+  EXPECT_EQ(model.PlanLoad(0, 4, 20), 0);
+  EXPECT_DOUBLE_EQ(model.ReserveLoad(0, 4, 20), 5);
+
+  // A tensor idle for longer is better to offload.
+  EXPECT_GT(model.OffloadWeight(1000, 0, 4), model.OffloadWeight(1000, 0, 2));
+}
+
+/// Feature: Cost model of memory swap strategy.
+/// Description: Record the time of the swap actions of two steps, save the profile, and load it by the graph hash.
+/// Expectation: The kernel costs and bandwidths are measured from the records, and the profile is only loaded for the
+/// graph of the same hash.
+TEST_F(TestSwapCostModel, test_record_cost_profile) {
+  const std::string profile_file = "./swap_cost_profile_test.json";
+  (void)std::remove(profile_file.c_str());
+  {
+    SwapCostRecorder recorder(0, "graph_hash", 4, 3, 0, profile_file);
+    for (size_t step = 0; step < 2; ++step) {
+      const double step_start = step * 1000.0;
+      // Blocking actions before kernel 0 and kernel 2, and a load running after kernel 1 and before kernel 3.
+      recorder.Record({0, 1, step_start, step_start + 10, {{SwapActionType::kHBM2DDR, 1000}}});
+      recorder.Record({2, 3, step_start + 50, step_start + 60, {{SwapActionType::kHBM2DDR, 1000}}});
+      recorder.Record({2, 4, step_start + 60, step_start + 100, {{SwapActionType::kDDR2HBM, 2000}}});
+    }
+  }
+  EXPECT_EQ(LoadSwapCostProfile(profile_file, "other_graph_hash"), nullptr);
+  auto profile = LoadSwapCostProfile(profile_file, "graph_hash");
+  ASSERT_NE(profile, nullptr);
+  EXPECT_EQ(profile->graph_hash_, "graph_hash");
+  EXPECT_EQ(profile->kernel_costs_, std::vector<double>({20, 20, 20, 20}));
+  EXPECT_DOUBLE_EQ(profile->bandwidths_[SwapActionType::kHBM2DDR], 100);
+  EXPECT_DOUBLE_EQ(profile->bandwidths_[SwapActionType::kDDR2HBM], 50);
+  (void)std::remove(profile_file.c_str());
+  EXPECT_EQ(LoadSwapCostProfile(profile_file, "graph_hash"), nullptr);
+}
+
+/// Feature: Cost model of memory swap strategy.
+/// Description: Get the exposed time of offloading tensors to ddr and disk.
+/// Expectation: The load overlaps with the kernels after the store, and the store of an output tensor is all exposed.
+TEST_F(TestSwapCostModel, test_offload_time) {
+  SwapCostProfile profile;
+  profile.kernel_costs_ = {10, 10, 10, 10, 10};
+  profile.bandwidths_[SwapActionType::kHBM2DDR] = 100;
+  profile.bandwidths_[SwapActionType::kDDR2HBM] = 100;
+  profile.bandwidths_[SwapActionType::kHBM2DISK] = 20;
+  profile.bandwidths_[SwapActionType::kDISK2HBM] = 20;
+  SwapCostModel model(profile);
+  // Stored in 10us, loaded in 10us overlapping with kernels 2 and 3.
+  EXPECT_DOUBLE_EQ(model.OffloadTime(SwapActionType::kHBM2DDR, SwapActionType::kDDR2HBM, 1000, 0, 4, true), 10);
+  // Stored in 50us, loaded in 50us of which 20us overlap with kernels 2 and 3.
+  EXPECT_DOUBLE_EQ(model.OffloadTime(SwapActionType::kHBM2DISK, SwapActionType::kDISK2HBM, 1000, 0, 4, true), 80);
+  EXPECT_DOUBLE_EQ(model.OffloadTime(SwapActionType::kHBM2DISK, SwapActionType::kDISK2HBM, 1000, 0, 4, false), 50);
+}
+}  // namespace mindspore::device
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "actor/mailbox.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace runtime {
+class LockFreeMailBoxTest : public UT::Common {
+ public:
+  LockFreeMailBoxTest() {}
+};
+
+/// Feature: Lock free mailbox of the runtime pipeline actors.
+/// Description: Several threads send messages to the mailbox and sleep from time to time, so the receiver sleeps too.
+/// Expectation: The receiver gets all the messages in the order of each sender.
+TEST_F(LockFreeMailBoxTest, MultiSenders) {
+  constexpr int kSenderNum = 4;
+  constexpr int kMessageNum = 10000;
+  constexpr int kSleepInterval = 1000;
+  LockFreeBlockingMailBox mailbox;
+  std::vector<std::thread> senders;
+  for (int sender = 0; sender < kSenderNum; ++sender) {
+    (void)senders.emplace_back([&mailbox, sender]() {
+      for (int i = 0; i < kMessageNum; ++i) {
+        auto name = std::to_string(sender) + ":" + std::to_string(i);
+        (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>(name, MessageBase::Type::KMSG));
+        if (i % kSleepInterval == 0) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+      }
+    });
+  }
+  std::vector<int> last_index(kSenderNum, -1);
+  for (int i = 0; i < kSenderNum * kMessageNum; ++i) {
+    auto msg = mailbox.GetMsg();
+    ASSERT_NE(msg, nullptr);
+    const auto &name = msg->Name();
+    auto pos = name.find(':');
+    auto sender = std::stoi(name.substr(0, pos));
+    auto index = std::stoi(name.substr(pos + 1));
+    ASSERT_EQ(index, last_index[sender] + 1);
+    last_index[sender] = index;
+  }
+  for (auto &sender : senders) {
+    sender.join();
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
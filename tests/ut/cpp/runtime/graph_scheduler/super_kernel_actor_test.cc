@@ -0,0 +1,167 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tests/ut/cpp/common/device_common_test.h"
+
+#include "mindspore/core/ops/math_ops.h"
+#include "runtime/graph_scheduler/actor/super_kernel_actor.h"
+
+namespace mindspore {
+namespace runtime {
+using namespace test;
+class SuperKernelActorTest : public UT::Common {
+ public:
+  SuperKernelActorTest() {}
+};
+
+namespace {
+// Records the input device address of the launches.
+class CountKernelMod : public kernel::KernelMod {
+ public:
+  CountKernelMod() = default;
+  ~CountKernelMod() override = default;
+  bool Launch(const std::vector<KernelTensor *> &inputs, const std::vector<KernelTensor *> &workspace,
+              const std::vector<KernelTensor *> &outputs, void *stream_ptr) override {
+    ++launch_count_;
+    last_input_ptr_ = inputs[0]->device_ptr();
+    return true;
+  }
+  std::vector<kernel::KernelAttr> GetOpSupport() override { return {}; }
+
+  size_t launch_count_{0};
+  void *last_input_ptr_{nullptr};
+};
+
+std::pair<KernelGraphPtr, CNodePtr> BuildAddGraph() {
+  std::vector<int64_t> shp{2, 2};
+  auto kernel_graph = std::make_shared<KernelGraph>();
+  auto parameter_x = kernel_graph->add_parameter();
+  parameter_x->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, shp));
+
+  std::vector<AnfNodePtr> add_inputs{NewValueNode(prim::kPrimAdd), parameter_x, parameter_x};
+  auto add_node = kernel_graph->NewCNode(add_inputs);
+  add_node->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, shp));
+
+  std::vector<AnfNodePtr> return_inputs{NewValueNode(prim::kPrimReturn), add_node};
+  auto return_node = kernel_graph->NewCNode(return_inputs);
+  return_node->set_abstract(add_node->abstract());
+  kernel_graph->set_return(return_node);
+  kernel_graph->set_execution_order({add_node});
+  kernel_graph->input_nodes_.emplace_back(parameter_x);
+  return std::make_pair(kernel_graph, add_node);
+}
+}  // namespace
+
+/// Feature: Capture and replay the static shape sub graph in SuperKernelActor.
+/// Description: Capture the graph, replay it with the input unchanged or reallocated in place, then change the input
+/// device address once and in every step.
+/// Expectation: The replay launches the kernel with the current input, the graph is recaptured when the input device
+/// address is changed, and the replay is disabled when the input device address is changed in every step.
+TEST_F(SuperKernelActorTest, CaptureAndReplay) {
+  const char device_name[] = "CPU";
+  uint32_t device_id = 0;
+  MS_REGISTER_DEVICE(device_name, TestDeviceContext);
+  DeviceContextKey device_context_key{device_name, device_id};
+  auto device_context = std::make_shared<TestDeviceContext>(device_context_key);
+
+  auto [kernel_graph, add_node] = BuildAddGraph();
+  auto &memory_manager_actor = MemoryManagerActor::GetInstance();
+  auto super_kernel_actor =
+    std::make_shared<SuperKernelActor>(kernel_graph->ToString() + "_SuperKernelActor", kernel_graph,
+                                       device_context.get(), memory_manager_actor->GetAID(), nullptr, nullptr);
+  auto kernel_actor =
+    std::make_shared<KernelActor>(add_node->fullname_with_scope(), add_node, device_context.get(),
+                                  memory_manager_actor->GetAID(), nullptr, nullptr, GraphExecutionStrategy::kPipeline,
+                                  std::set<size_t>(), std::set<size_t>());
+  CountKernelMod kernel_mod;
+  kernel_actor->kernel_mod_ = &kernel_mod;
+  kernel_actor->input_device_tensors_.resize(1);
+  kernel_actor->input_kernel_tensors_.resize(1);
+  kernel_actor->input_kernel_tensors_for_infer_.resize(1);
+  super_kernel_actor->kernel_actors_.emplace_back(kernel_actor);
+  super_kernel_actor->enable_kbk_sub_graph_replay_ = true;
+
+  OpContext<DeviceAddress> op_context;
+  std::vector<Promise<int>> result(1);
+  op_context.sequential_num_ = 140429;
+  op_context.results_ = &result;
+
+  std::vector<float> input_data(4, 1.0f);
+  std::vector<float> realloc_data(4, 2.0f);
+  auto create_input = [&device_context, &input_data]() {
+    auto kernel_tensor = std::make_shared<kernel::KernelTensor>(
+      input_data.data(), input_data.size() * sizeof(float), Format::DEFAULT_FORMAT, TypeId::kNumberTypeFloat32,
+      ShapeVector{2, 2}, device_context->device_context_key().device_name_,
+      device_context->device_context_key().device_id_);
+    return device_context->device_res_manager_->CreateDeviceAddress(kernel_tensor);
+  };
+  // Set the graph input as FetchInputDeviceTensor and the kernel actor input as LaunchAllKernels do.
+  auto set_input = [&super_kernel_actor, &kernel_actor](const DeviceAddressPtr &input) {
+    super_kernel_actor->input_device_tensors_[0] = input.get();
+    kernel_actor->SetInputDeviceTensor(input.get(), 0);
+  };
+
+  auto input = create_input();
+  set_input(input);
+  super_kernel_actor->CaptureGraph();
+  ASSERT_TRUE(super_kernel_actor->is_graph_captured_);
+  ASSERT_EQ(super_kernel_actor->captured_kernel_launches_.size(), 1);
+
+  // Replay on the unchanged graph.
+  ASSERT_TRUE(super_kernel_actor->IsCaptureValid());
+  super_kernel_actor->ReplayGraph(&op_context);
+  ASSERT_EQ(kernel_mod.launch_count_, 1);
+  ASSERT_EQ(kernel_mod.last_input_ptr_, input_data.data());
+
+  // The input reallocated in place is replayed without recapturing.
+  input->set_ptr(realloc_data.data());
+  ASSERT_TRUE(super_kernel_actor->IsCaptureValid());
+  super_kernel_actor->ReplayGraph(&op_context);
+  ASSERT_EQ(kernel_mod.launch_count_, 2);
+  ASSERT_EQ(kernel_mod.last_input_ptr_, realloc_data.data());
+
+  // Recapture when the input device address is changed.
+  auto new_input = create_input();
+  super_kernel_actor->input_device_tensors_[0] = new_input.get();
+  ASSERT_FALSE(super_kernel_actor->IsCaptureValid());
+  super_kernel_actor->DropCapture();
+  ASSERT_FALSE(super_kernel_actor->is_graph_captured_);
+  ASSERT_TRUE(super_kernel_actor->enable_kbk_sub_graph_replay_);
+  set_input(new_input);
+  super_kernel_actor->CaptureGraph();
+  ASSERT_TRUE(super_kernel_actor->IsCaptureValid());
+  super_kernel_actor->ReplayGraph(&op_context);
+  ASSERT_EQ(kernel_mod.launch_count_, 3);
+  ASSERT_EQ(super_kernel_actor->invalid_capture_count_, 0);
+
+  // The graph whose input device address is changed in every step is not recaptured any more.
+  std::vector<DeviceAddressPtr> step_inputs;
+  while (super_kernel_actor->enable_kbk_sub_graph_replay_) {
+    ASSERT_LT(step_inputs.size(), 3);
+    step_inputs.emplace_back(create_input());
+    super_kernel_actor->input_device_tensors_[0] = step_inputs.back().get();
+    ASSERT_FALSE(super_kernel_actor->IsCaptureValid());
+    super_kernel_actor->DropCapture();
+    set_input(step_inputs.back());
+    if (super_kernel_actor->enable_kbk_sub_graph_replay_) {
+      super_kernel_actor->CaptureGraph();
+    }
+  }
+  ASSERT_EQ(step_inputs.size(), 3);
+  ASSERT_FALSE(super_kernel_actor->is_graph_captured_);
+}
+}  // namespace runtime
+}  // namespace mindspore
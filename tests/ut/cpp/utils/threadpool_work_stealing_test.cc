@@ -0,0 +1,129 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include "common/common_test.h"
+#include "thread/threadpool.h"
+#include "thread/steal_deque.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kThreadNum = 4;
+constexpr int kTaskNum = 32;
+constexpr int kLaunchNum = 200;
+
+struct SkewedContent {
+  std::vector<std::atomic_int> hits = std::vector<std::atomic_int>(kTaskNum);
+  int heavy_tasks = kTaskNum / 4;
+  int heavy_loops = 20000;
+};
+
+// the first quarter of the splits is ten times heavier than the rest, which all land on one worker
+// with the static split
+int SkewedKernel(void *cdata, int task_id, float, float) {
+  auto content = static_cast<SkewedContent *>(cdata);
+  int loops = task_id < content->heavy_tasks ? content->heavy_loops : content->heavy_loops / 10;
+  volatile float acc = 0;
+  for (int i = 0; i < loops; ++i) {
+    acc = acc + static_cast<float>(i) * 0.5f;
+  }
+  (void)++content->hits[task_id];
+  return THREAD_OK;
+}
+
+std::vector<double> RunLaunches(ThreadPool *pool, SkewedContent *content) {
+  std::vector<double> latency;
+  for (int i = 0; i < kLaunchNum; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(pool->ParallelLaunch(SkewedKernel, content, kTaskNum), THREAD_OK);
+    auto end = std::chrono::steady_clock::now();
+    latency.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  std::sort(latency.begin(), latency.end());
+  return latency;
+}
+
+double Percentile(const std::vector<double> &latency, double p) {
+  auto idx = static_cast<size_t>(p * (latency.size() - 1));
+  return latency[idx];
+}
+}  // namespace
+
+class TestThreadPoolWorkStealing : public UT::Common {
+ public:
+  TestThreadPoolWorkStealing() {}
+};
+
+/// Feature: StealDeque.
+/// Description: push splits and steal them from several threads.
+/// Expectation: every pushed item is stolen exactly once.
+TEST_F(TestThreadPoolWorkStealing, test_steal_deque) {
+  StealDeque<int> deque;
+  ASSERT_TRUE(deque.Init(100));
+  ASSERT_FALSE(deque.Init(100));
+  std::vector<int> items(128);
+  for (auto &item : items) {
+    ASSERT_TRUE(deque.Push(&item));
+  }
+  ASSERT_FALSE(deque.Push(&items[0]));
+  ASSERT_EQ(deque.Size(), 128);
+
+  std::atomic_int stolen{0};
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    (void)thieves.emplace_back([&deque, &stolen]() {
+      while (deque.Steal() != nullptr) {
+        (void)++stolen;
+      }
+    });
+  }
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  ASSERT_EQ(stolen, 128);
+  ASSERT_TRUE(deque.Empty());
+  ASSERT_EQ(deque.Steal(), nullptr);
+}
+
+/// Feature: ThreadPool work-stealing mode.
+/// Description: launch skewed kernels with the static split and with work stealing.
+/// Expectation: every split runs exactly once per launch in both modes, tail latency is reported.
+TEST_F(TestThreadPoolWorkStealing, test_skewed_kernel_latency) {
+  auto pool = ThreadPool::CreateThreadPool(kThreadNum);
+  ASSERT_NE(pool, nullptr);
+  pool->SetMaxSpinCount(kDefaultKernelSpinCount);
+  pool->SetSpinCountMaxValue();
+
+  SkewedContent static_content;
+  auto static_latency = RunLaunches(pool, &static_content);
+  pool->SetWorkStealing(true);
+  SkewedContent steal_content;
+  auto steal_latency = RunLaunches(pool, &steal_content);
+  pool->SetWorkStealing(false);
+  delete pool;
+
+  for (int i = 0; i < kTaskNum; ++i) {
+    ASSERT_EQ(static_content.hits[i], kLaunchNum);
+    ASSERT_EQ(steal_content.hits[i], kLaunchNum);
+  }
+  MS_LOG(INFO) << "ParallelLaunch latency(us) static split p50: " << Percentile(static_latency, 0.5)
+               << ", p99: " << Percentile(static_latency, 0.99)
+               << "; work stealing p50: " << Percentile(steal_latency, 0.5)
+               << ", p99: " << Percentile(steal_latency, 0.99);
+}
+}  // namespace mindspore
@@ -25,7 +25,7 @@ def test_set_offload_context():
     """
     offload_config = {"offload_param": "CPU", "offload_path": "./", "offload_cpu_size": "1.0GB",
                       "enable_aio": False, "aio_block_size": "0.5GB", "aio_queue_depth": 9999,
-                      "enable_pinned_mem": True}
+                      "aio_backend": "io_uring", "enable_host_compression": True, "enable_pinned_mem": True}
     context.set_offload_context(offload_config=offload_config)
     offload_config_ = context.get_offload_context()
     offload_param = offload_config_.get("offload_param", None)
@@ -34,6 +34,8 @@ def test_set_offload_context():
     enable_aio = offload_config_.get("enable_aio", None)
     aio_block_size = offload_config_.get("aio_block_size", None)
     aio_queue_depth = offload_config_.get("aio_queue_depth", None)
+    aio_backend = offload_config_.get("aio_backend", None)
+    enable_host_compression = offload_config_.get("enable_host_compression", None)
     enable_pinned_mem = offload_config_.get("enable_pinned_mem", None)
     assert offload_param == "cpu"
     assert offload_path == "./"
@@ -41,8 +43,12 @@ def test_set_offload_context():
     assert not enable_aio
     assert aio_block_size == 1 << 29
     assert aio_queue_depth == 9999
+    assert aio_backend == "io_uring"
+    assert enable_host_compression
     assert enable_pinned_mem
     with pytest.raises(ValueError):
         context.set_offload_context(offload_config={"offload_param": "gpu"})
     with pytest.raises(ValueError):
         context.set_offload_context(offload_config={"offload_disk_size": "1"})
+    with pytest.raises(ValueError):
+        context.set_offload_context(offload_config={"aio_backend": "posix_aio"})
@@ -0,0 +1,219 @@
+# Copyright 2024 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+""" test_lazy_eager """
+import numpy as np
+import pytest
+
+import mindspore.nn as nn
+from mindspore import context, Tensor
+from mindspore.common import _lazy_eager
+from mindspore.common._lazy_eager import LazyEager
+
+
+class FakeCell:
+    """The cell whose eager run records the op trace, and whose graph run is counted."""
+
+    cls_name = "FakeCell"
+
+    def __init__(self):
+        self.training = False
+        self._trace = 1
+        self._eager_runs = 0
+        self._graph_runs = 0
+        self._compile_times = 0
+        self._fail_compile = False
+        self._fail_graph_run = False
+
+    def construct(self, x):
+        return x
+
+    def _run_construct(self, args, kwargs):
+        self._eager_runs += 1
+        _lazy_eager._pynative_executor.trace = self._trace
+        return "eager"
+
+
+class FakeExecutor:
+    """Returns the trace set by the eager run of the cell."""
+
+    trace = None
+
+    def begin_op_trace(self):
+        self.trace = None
+
+    def end_op_trace(self):
+        return self.trace
+
+
+class FakeConstructExecutor:
+    """Compiles the construct of the cell, and counts the graph runs."""
+
+    def __init__(self, cell, graph_id):
+        self.cell = cell
+        self.graph_id = graph_id
+
+    def compile_construct(self, args):
+        if self.cell._fail_compile:
+            raise RuntimeError("compile failed")
+        self.cell._compile_times += 1
+
+    def __call__(self, obj, *args):
+        if obj._fail_graph_run:
+            raise RuntimeError("graph run failed")
+        obj._graph_runs += 1
+        return "graph"
+
+
+@pytest.fixture(name="cell")
+def fixture_cell(monkeypatch):
+    monkeypatch.setattr(_lazy_eager, "_pynative_executor", FakeExecutor())
+    monkeypatch.setattr(_lazy_eager, "_ConstructExecutor", FakeConstructExecutor)
+    return FakeCell()
+
+
+def run_steps(lazy_eager, cell, args, steps):
+    return [lazy_eager.run_construct(cell, args, {}) for _ in range(steps)]
+
+
+def test_lazy_eager_warmup_and_replay(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell with the same inputs and op trace.
+    Expectation: The cell runs eagerly in the warmup steps, then is compiled and replays the graph.
+    """
+    lazy_eager = LazyEager(2)
+    x = Tensor(np.ones((2, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 4) == ["eager", "eager", "graph", "graph"]
+    assert cell._eager_runs == 2
+    assert cell._graph_runs == 2
+
+
+def test_lazy_eager_signature_change(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell with the inputs of another shape, and with the keyword inputs.
+    Expectation: The new signature warms up again, and the keyword inputs run eagerly.
+    """
+    lazy_eager = LazyEager(2)
+    x = Tensor(np.ones((2, 3), np.float32))
+    y = Tensor(np.ones((4, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 3) == ["eager", "eager", "graph"]
+    assert run_steps(lazy_eager, cell, (y,), 3) == ["eager", "eager", "graph"]
+    assert run_steps(lazy_eager, cell, (x,), 1) == ["graph"]
+    assert lazy_eager.run_construct(cell, (), {"x": x}) == "eager"
+
+
+def test_lazy_eager_state_change(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell with the training flag and a public attribute changed after it is compiled.
+    Expectation: The cell warms up again for each new state, and replays the graph compiled for a state seen before.
+    """
+    lazy_eager = LazyEager(1)
+    x = Tensor(np.ones((2, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 2) == ["eager", "graph"]
+    cell.training = True
+    assert run_steps(lazy_eager, cell, (x,), 2) == ["eager", "graph"]
+    cell.use_bias = False
+    assert run_steps(lazy_eager, cell, (x,), 2) == ["eager", "graph"]
+    del cell.use_bias
+    cell.training = False
+    assert run_steps(lazy_eager, cell, (x,), 1) == ["graph"]
+    assert cell._compile_times == 3
+
+
+def test_lazy_eager_trace_change(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell whose op trace changes in the warmup steps.
+    Expectation: The warmup restarts from the changed trace.
+    """
+    lazy_eager = LazyEager(2)
+    x = Tensor(np.ones((2, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 1) == ["eager"]
+    cell._trace = 2
+    assert run_steps(lazy_eager, cell, (x,), 2) == ["eager", "eager"]
+    assert run_steps(lazy_eager, cell, (x,), 1) == ["graph"]
+
+
+def test_lazy_eager_validate_trace(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell whose op trace changes after it is compiled, by a state which is not guarded.
+    Expectation: The cell runs eagerly once every validate_steps replays, and the graph of the stale trace is dropped
+        and compiled again after the warmup.
+    """
+    lazy_eager = LazyEager(1, validate_steps=2)
+    x = Tensor(np.ones((2, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 5) == ["eager", "graph", "graph", "eager", "graph"]
+    cell._trace = 2
+    assert run_steps(lazy_eager, cell, (x,), 3) == ["graph", "eager", "graph"]
+    assert cell._compile_times == 2
+
+
+def test_lazy_eager_compile_failure(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell whose graph fails to compile.
+    Expectation: The cell falls back to eager for the signature.
+    """
+    lazy_eager = LazyEager(1)
+    x = Tensor(np.ones((2, 3), np.float32))
+    cell._fail_compile = True
+    assert run_steps(lazy_eager, cell, (x,), 3) == ["eager", "eager", "eager"]
+    assert cell._graph_runs == 0
+
+
+def test_lazy_eager_graph_run_failure(cell):
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run the cell whose compiled graph fails to run.
+    Expectation: The error is raised instead of running the cell eagerly again.
+    """
+    lazy_eager = LazyEager(1)
+    x = Tensor(np.ones((2, 3), np.float32))
+    assert run_steps(lazy_eager, cell, (x,), 1) == ["eager"]
+    cell._fail_graph_run = True
+    with pytest.raises(RuntimeError, match="graph run failed"):
+        lazy_eager.run_construct(cell, (x,), {})
+    assert cell._eager_runs == 1
+
+
+class TrainingNet(nn.Cell):
+    """The net whose control flow depends on the training flag."""
+
+    def construct(self, x):
+        if self.training:
+            return x * 2
+        return x + 1
+
+
+def test_lazy_eager_compile_and_replay():
+    """
+    Feature: Lazy eager mode of cell.
+    Description: Run a net in lazy eager mode, which is really compiled and replayed, and toggle its training flag.
+    Expectation: The outputs follow the training flag, and a graph is compiled for each training flag.
+    """
+    context.set_context(mode=context.PYNATIVE_MODE)
+    net = TrainingNet()
+    net.set_lazy_eager(warmup_steps=1)
+    x = Tensor(np.full((2, 3), 3, np.float32))
+    for training, expected in ((True, 6), (False, 4), (True, 6)):
+        net.set_train(training)
+        outputs = [net(x).asnumpy() for _ in range(3)]
+        for output in outputs:
+            assert np.allclose(output, np.full((2, 3), expected, np.float32))
+    assert len(net._lazy_eager.graphs) == 2
+    assert net._lazy_eager.graph_num == 2